@@ -7,6 +7,12 @@
 
 #include "libretro.h"
 
+#ifdef RARCH_INTERNAL
+#define TESTAUDIO_NO_CALLBACK_CORE_PREFIX(s) libretro_testaudio_no_callback_##s
+#else
+#define TESTAUDIO_NO_CALLBACK_CORE_PREFIX(s) s
+#endif
+
 static uint32_t *frame_buf;
 static struct retro_log_callback logging;
 static retro_log_printf_t log_cb;
@@ -21,28 +27,28 @@ static void fallback_log(enum retro_log_level level, const char *fmt, ...)
    va_end(va);
 }
 
-void retro_init(void)
+void TESTAUDIO_NO_CALLBACK_CORE_PREFIX(retro_init)(void)
 {
    frame_buf = calloc(320 * 240, sizeof(uint32_t));
 }
 
-void retro_deinit(void)
+void TESTAUDIO_NO_CALLBACK_CORE_PREFIX(retro_deinit)(void)
 {
    free(frame_buf);
    frame_buf = NULL;
 }
 
-unsigned retro_api_version(void)
+unsigned TESTAUDIO_NO_CALLBACK_CORE_PREFIX(retro_api_version)(void)
 {
    return RETRO_API_VERSION;
 }
 
-void retro_set_controller_port_device(unsigned port, unsigned device)
+void TESTAUDIO_NO_CALLBACK_CORE_PREFIX(retro_set_controller_port_device)(unsigned port, unsigned device)
 {
    log_cb(RETRO_LOG_INFO, "Plugging device %u into port %u.\n", device, port);
 }
 
-void retro_get_system_info(struct retro_system_info *info)
+void TESTAUDIO_NO_CALLBACK_CORE_PREFIX(retro_get_system_info)(struct retro_system_info *info)
 {
    memset(info, 0, sizeof(*info));
    info->library_name     = "TestCore";
@@ -58,7 +64,7 @@ static retro_environment_t environ_cb;
 static retro_input_poll_t input_poll_cb;
 static retro_input_state_t input_state_cb;
 
-void retro_get_system_av_info(struct retro_system_av_info *info)
+void TESTAUDIO_NO_CALLBACK_CORE_PREFIX(retro_get_system_av_info)(struct retro_system_av_info *info)
 {
    float aspect = 4.0f / 3.0f;
    float sampling_rate = 30000.0f;
@@ -77,7 +83,7 @@ void retro_get_system_av_info(struct retro_system_av_info *info)
    };
 }
 
-void retro_set_environment(retro_environment_t cb)
+void TESTAUDIO_NO_CALLBACK_CORE_PREFIX(retro_set_environment)(retro_environment_t cb)
 {
    environ_cb = cb;
 
@@ -90,27 +96,27 @@ void retro_set_environment(retro_environment_t cb)
       log_cb = fallback_log;
 }
 
-void retro_set_audio_sample(retro_audio_sample_t cb)
+void TESTAUDIO_NO_CALLBACK_CORE_PREFIX(retro_set_audio_sample)(retro_audio_sample_t cb)
 {
    audio_cb = cb;
 }
 
-void retro_set_audio_sample_batch(retro_audio_sample_batch_t cb)
+void TESTAUDIO_NO_CALLBACK_CORE_PREFIX(retro_set_audio_sample_batch)(retro_audio_sample_batch_t cb)
 {
    audio_batch_cb = cb;
 }
 
-void retro_set_input_poll(retro_input_poll_t cb)
+void TESTAUDIO_NO_CALLBACK_CORE_PREFIX(retro_set_input_poll)(retro_input_poll_t cb)
 {
    input_poll_cb = cb;
 }
 
-void retro_set_input_state(retro_input_state_t cb)
+void TESTAUDIO_NO_CALLBACK_CORE_PREFIX(retro_set_input_state)(retro_input_state_t cb)
 {
    input_state_cb = cb;
 }
 
-void retro_set_video_refresh(retro_video_refresh_t cb)
+void TESTAUDIO_NO_CALLBACK_CORE_PREFIX(retro_set_video_refresh)(retro_video_refresh_t cb)
 {
    video_cb = cb;
 }
@@ -120,7 +126,7 @@ static unsigned y_coord;
 static int mouse_rel_x;
 static int mouse_rel_y;
 
-void retro_reset(void)
+void TESTAUDIO_NO_CALLBACK_CORE_PREFIX(retro_reset)(void)
 {
    x_coord = 0;
    y_coord = 0;
@@ -173,7 +179,7 @@ static void audio(void)
    phase %= 100;
 }
 
-void retro_run(void)
+void TESTAUDIO_NO_CALLBACK_CORE_PREFIX(retro_run)(void)
 {
    update_input();
    render_checkered();
@@ -184,7 +190,7 @@ void retro_run(void)
       check_variables();
 }
 
-bool retro_load_game(const struct retro_game_info *info)
+bool TESTAUDIO_NO_CALLBACK_CORE_PREFIX(retro_load_game)(const struct retro_game_info *info)
 {
    enum retro_pixel_format fmt = RETRO_PIXEL_FORMAT_XRGB8888;
    if (!environ_cb(RETRO_ENVIRONMENT_SET_PIXEL_FORMAT, &fmt))
@@ -199,30 +205,30 @@ bool retro_load_game(const struct retro_game_info *info)
    return true;
 }
 
-void retro_unload_game(void)
+void TESTAUDIO_NO_CALLBACK_CORE_PREFIX(retro_unload_game)(void)
 {
 }
 
-unsigned retro_get_region(void)
+unsigned TESTAUDIO_NO_CALLBACK_CORE_PREFIX(retro_get_region)(void)
 {
    return RETRO_REGION_NTSC;
 }
 
-bool retro_load_game_special(unsigned type, const struct retro_game_info *info, size_t num)
+bool TESTAUDIO_NO_CALLBACK_CORE_PREFIX(retro_load_game_special)(unsigned type, const struct retro_game_info *info, size_t num)
 {
    if (type != 0x200)
       return false;
    if (num != 2)
       return false;
-   return retro_load_game(NULL);
+   return TESTAUDIO_NO_CALLBACK_CORE_PREFIX(retro_load_game)(NULL);
 }
 
-size_t retro_serialize_size(void)
+size_t TESTAUDIO_NO_CALLBACK_CORE_PREFIX(retro_serialize_size)(void)
 {
    return 2;
 }
 
-bool retro_serialize(void *data_, size_t size)
+bool TESTAUDIO_NO_CALLBACK_CORE_PREFIX(retro_serialize)(void *data_, size_t size)
 {
    if (size < 2)
       return false;
@@ -233,7 +239,7 @@ bool retro_serialize(void *data_, size_t size)
    return true;
 }
 
-bool retro_unserialize(const void *data_, size_t size)
+bool TESTAUDIO_NO_CALLBACK_CORE_PREFIX(retro_unserialize)(const void *data_, size_t size)
 {
    if (size < 2)
       return false;
@@ -244,22 +250,22 @@ bool retro_unserialize(const void *data_, size_t size)
    return true;
 }
 
-void *retro_get_memory_data(unsigned id)
+void *TESTAUDIO_NO_CALLBACK_CORE_PREFIX(retro_get_memory_data)(unsigned id)
 {
    (void)id;
    return NULL;
 }
 
-size_t retro_get_memory_size(unsigned id)
+size_t TESTAUDIO_NO_CALLBACK_CORE_PREFIX(retro_get_memory_size)(unsigned id)
 {
    (void)id;
    return 0;
 }
 
-void retro_cheat_reset(void)
+void TESTAUDIO_NO_CALLBACK_CORE_PREFIX(retro_cheat_reset)(void)
 {}
 
-void retro_cheat_set(unsigned index, bool enabled, const char *code)
+void TESTAUDIO_NO_CALLBACK_CORE_PREFIX(retro_cheat_set)(unsigned index, bool enabled, const char *code)
 {
    (void)index;
    (void)enabled;
@@ -6,17 +6,23 @@
 
 #include "libretro.h"
 
+#ifdef RARCH_INTERNAL
+#define TESTAUDIO_PLAYBACK_WAV_CORE_PREFIX(s) libretro_testaudio_playback_wav_##s
+#else
+#define TESTAUDIO_PLAYBACK_WAV_CORE_PREFIX(s) s
+#endif
+
 /* NOTE: This core does not work on big endian systems. */
 
 #define BUFSIZE 128
 #define AMP_MUL 64
 
-retro_environment_t environ_cb            = NULL;
-retro_video_refresh_t video_cb            = NULL;
-retro_audio_sample_t audio_cb             = NULL;
-retro_audio_sample_batch_t audio_batch_cb = NULL;
-retro_input_poll_t poller_cb              = NULL;
-retro_input_state_t input_state_cb        = NULL;
+static retro_environment_t environ_cb            = NULL;
+static retro_video_refresh_t video_cb            = NULL;
+static retro_audio_sample_t audio_cb             = NULL;
+static retro_audio_sample_batch_t audio_batch_cb = NULL;
+static retro_input_poll_t poller_cb              = NULL;
+static retro_input_state_t input_state_cb        = NULL;
 
 #ifndef EXTERNC
 #ifdef __cplusplus
@@ -36,7 +42,7 @@ retro_input_state_t input_state_cb        = NULL;
 #endif
 #endif
 
-struct WAVhead
+static struct WAVhead
 {
    char ChunkID[4];
    uint32_t ChunkSize;
@@ -55,15 +61,14 @@ struct WAVhead
    uint32_t Subchunk2Size;
 } head;
 
-void* rawsamples                 = NULL;
-unsigned int sample_pos          = 0;
-unsigned int samples_tot         = 0;
+static void* rawsamples                 = NULL;
+static unsigned int sample_pos          = 0;
+static unsigned int samples_tot         = 0;
 
-unsigned int g_samples_to_play   = 0;
-unsigned int sample_rate         = 0;
-unsigned int bytes_per_sample    = 0;
+static unsigned int g_samples_to_play   = 0;
+static unsigned int bytes_per_sample    = 0;
 
-enum
+static enum
 {
    ST_OFF = 0,
    ST_ON,
@@ -163,32 +168,32 @@ static void enable_audio(bool enabled)
    state = enabled;
 }
 
-EXPORT void retro_set_video_refresh(retro_video_refresh_t cb)
+EXPORT void TESTAUDIO_PLAYBACK_WAV_CORE_PREFIX(retro_set_video_refresh)(retro_video_refresh_t cb)
 {
    video_cb = cb;
 }
 
-EXPORT void retro_set_audio_sample(retro_audio_sample_t cb)
+EXPORT void TESTAUDIO_PLAYBACK_WAV_CORE_PREFIX(retro_set_audio_sample)(retro_audio_sample_t cb)
 {
    audio_cb = cb;
 }
 
-EXPORT void retro_set_audio_sample_batch(retro_audio_sample_batch_t cb)
+EXPORT void TESTAUDIO_PLAYBACK_WAV_CORE_PREFIX(retro_set_audio_sample_batch)(retro_audio_sample_batch_t cb)
 {
    audio_batch_cb = cb;
 }
 
-EXPORT void retro_set_input_poll(retro_input_poll_t cb)
+EXPORT void TESTAUDIO_PLAYBACK_WAV_CORE_PREFIX(retro_set_input_poll)(retro_input_poll_t cb)
 {
    poller_cb = cb;
 }
 
-EXPORT void retro_set_input_state(retro_input_state_t cb)
+EXPORT void TESTAUDIO_PLAYBACK_WAV_CORE_PREFIX(retro_set_input_state)(retro_input_state_t cb)
 {
    input_state_cb = cb;
 }
 
-EXPORT void retro_set_environment(retro_environment_t cb)
+EXPORT void TESTAUDIO_PLAYBACK_WAV_CORE_PREFIX(retro_set_environment)(retro_environment_t cb)
 {
    struct retro_audio_callback aud = { emit_audio, enable_audio };
    environ_cb = cb;
@@ -200,25 +205,25 @@ EXPORT void retro_set_environment(retro_environment_t cb)
 #endif
 }
 
-EXPORT void retro_deinit(void) {}
+EXPORT void TESTAUDIO_PLAYBACK_WAV_CORE_PREFIX(retro_deinit)(void) {}
 
-EXPORT unsigned retro_api_version(void)
+EXPORT unsigned TESTAUDIO_PLAYBACK_WAV_CORE_PREFIX(retro_api_version)(void)
 {
    return RETRO_API_VERSION;
 }
 
-EXPORT void retro_init(void)
+EXPORT void TESTAUDIO_PLAYBACK_WAV_CORE_PREFIX(retro_init)(void)
 {
    rawsamples = NULL;
 }
 
-EXPORT void retro_get_system_info(struct retro_system_info* info)
+EXPORT void TESTAUDIO_PLAYBACK_WAV_CORE_PREFIX(retro_get_system_info)(struct retro_system_info* info)
 {
    const struct retro_system_info myinfo={ "WAV player", "v1", "wav", false, false };
    memcpy(info, &myinfo, sizeof(myinfo));
 }
 
-EXPORT void retro_get_system_av_info(struct retro_system_av_info* info)
+EXPORT void TESTAUDIO_PLAYBACK_WAV_CORE_PREFIX(retro_get_system_av_info)(struct retro_system_av_info* info)
 {
    const struct retro_system_av_info myinfo={
       { 320, 240, 320, 240, 0.0 },
@@ -227,12 +232,12 @@ EXPORT void retro_get_system_av_info(struct retro_system_av_info* info)
    memcpy(info, &myinfo, sizeof(myinfo));
 }
 
-EXPORT void retro_reset(void)
+EXPORT void TESTAUDIO_PLAYBACK_WAV_CORE_PREFIX(retro_reset)(void)
 {
    sample_pos=0; g_samples_to_play=0;
 }
 
-EXPORT void retro_run(void)
+EXPORT void TESTAUDIO_PLAYBACK_WAV_CORE_PREFIX(retro_run)(void)
 {
    static uint16_t pixels[240][320];
    unsigned int x;
@@ -259,24 +264,24 @@ EXPORT void retro_run(void)
    video_cb(pixels, 320, 240, sizeof(uint16_t) * 320);
 }
 
-EXPORT size_t retro_serialize_size(void)
+EXPORT size_t TESTAUDIO_PLAYBACK_WAV_CORE_PREFIX(retro_serialize_size)(void)
 {
    return sizeof(sample_pos);
 }
 
-EXPORT bool retro_serialize(void* data, size_t size)
+EXPORT bool TESTAUDIO_PLAYBACK_WAV_CORE_PREFIX(retro_serialize)(void* data, size_t size)
 {
    memcpy(data, &sample_pos, sizeof(sample_pos));
    return true;
 }
 
-EXPORT bool retro_unserialize(const void* data, size_t size)
+EXPORT bool TESTAUDIO_PLAYBACK_WAV_CORE_PREFIX(retro_unserialize)(const void* data, size_t size)
 {
    memcpy(&sample_pos, data, sizeof(sample_pos));
    return true;
 }
 
-EXPORT bool retro_load_game(const struct retro_game_info* game)
+EXPORT bool TESTAUDIO_PLAYBACK_WAV_CORE_PREFIX(retro_load_game)(const struct retro_game_info* game)
 {
    enum retro_pixel_format rgb565 = RETRO_PIXEL_FORMAT_RGB565;
 
@@ -308,24 +313,24 @@ EXPORT bool retro_load_game(const struct retro_game_info* game)
    return true;
 }
 
-EXPORT bool retro_load_game_special(unsigned game_type,
+EXPORT bool TESTAUDIO_PLAYBACK_WAV_CORE_PREFIX(retro_load_game_special)(unsigned game_type,
       const struct retro_game_info* info, size_t num_info)
 {
    return false;
 }
 
-EXPORT void retro_unload_game(void)
+EXPORT void TESTAUDIO_PLAYBACK_WAV_CORE_PREFIX(retro_unload_game)(void)
 {
    free(rawsamples);
 }
 
-EXPORT unsigned retro_get_region(void)
+EXPORT unsigned TESTAUDIO_PLAYBACK_WAV_CORE_PREFIX(retro_get_region)(void)
 {
    return RETRO_REGION_NTSC;
 }
 
-EXPORT void* retro_get_memory_data(unsigned id)  { return NULL; }
-EXPORT size_t retro_get_memory_size(unsigned id) { return 0; }
-EXPORT void retro_cheat_reset(void) {}
-EXPORT void retro_cheat_set(unsigned index, bool enabled, const char* code) {}
-EXPORT void retro_set_controller_port_device(unsigned port, unsigned device) {}
+EXPORT void* TESTAUDIO_PLAYBACK_WAV_CORE_PREFIX(retro_get_memory_data)(unsigned id)  { return NULL; }
+EXPORT size_t TESTAUDIO_PLAYBACK_WAV_CORE_PREFIX(retro_get_memory_size)(unsigned id) { return 0; }
+EXPORT void TESTAUDIO_PLAYBACK_WAV_CORE_PREFIX(retro_cheat_reset)(void) {}
+EXPORT void TESTAUDIO_PLAYBACK_WAV_CORE_PREFIX(retro_cheat_set)(unsigned index, bool enabled, const char* code) {}
+EXPORT void TESTAUDIO_PLAYBACK_WAV_CORE_PREFIX(retro_set_controller_port_device)(unsigned port, unsigned device) {}
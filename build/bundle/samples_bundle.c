@@ -0,0 +1,92 @@
+#include <string.h>
+
+#include "samples_bundle.h"
+
+/* Every core in the bundle, by the name its RARCH_INTERNAL prefix uses. */
+#define SAMPLES_BUNDLE_CORES(X) \
+   X(test) \
+   X(advanced_tests) \
+   X(testsw) \
+   X(testaudio_callback) \
+   X(testaudio_no_callback) \
+   X(testaudio_playback_wav) \
+   X(midi_test) \
+   X(cruzes)
+
+#define DECLARE_CORE(name) \
+   void libretro_##name##_retro_set_environment(retro_environment_t); \
+   void libretro_##name##_retro_set_video_refresh(retro_video_refresh_t); \
+   void libretro_##name##_retro_set_audio_sample(retro_audio_sample_t); \
+   void libretro_##name##_retro_set_audio_sample_batch(retro_audio_sample_batch_t); \
+   void libretro_##name##_retro_set_input_poll(retro_input_poll_t); \
+   void libretro_##name##_retro_set_input_state(retro_input_state_t); \
+   void libretro_##name##_retro_init(void); \
+   void libretro_##name##_retro_deinit(void); \
+   unsigned libretro_##name##_retro_api_version(void); \
+   void libretro_##name##_retro_get_system_info(struct retro_system_info *info); \
+   void libretro_##name##_retro_get_system_av_info(struct retro_system_av_info *info); \
+   void libretro_##name##_retro_set_controller_port_device(unsigned port, unsigned device); \
+   void libretro_##name##_retro_reset(void); \
+   void libretro_##name##_retro_run(void); \
+   size_t libretro_##name##_retro_serialize_size(void); \
+   bool libretro_##name##_retro_serialize(void *data, size_t size); \
+   bool libretro_##name##_retro_unserialize(const void *data, size_t size); \
+   void libretro_##name##_retro_cheat_reset(void); \
+   void libretro_##name##_retro_cheat_set(unsigned index, bool enabled, const char *code); \
+   bool libretro_##name##_retro_load_game(const struct retro_game_info *game); \
+   bool libretro_##name##_retro_load_game_special(unsigned game_type, \
+         const struct retro_game_info *info, size_t num_info); \
+   void libretro_##name##_retro_unload_game(void); \
+   unsigned libretro_##name##_retro_get_region(void); \
+   void *libretro_##name##_retro_get_memory_data(unsigned id); \
+   size_t libretro_##name##_retro_get_memory_size(unsigned id);
+
+#define CORE_ENTRY(name) \
+   { \
+      #name, \
+      libretro_##name##_retro_set_environment, \
+      libretro_##name##_retro_set_video_refresh, \
+      libretro_##name##_retro_set_audio_sample, \
+      libretro_##name##_retro_set_audio_sample_batch, \
+      libretro_##name##_retro_set_input_poll, \
+      libretro_##name##_retro_set_input_state, \
+      libretro_##name##_retro_init, \
+      libretro_##name##_retro_deinit, \
+      libretro_##name##_retro_api_version, \
+      libretro_##name##_retro_get_system_info, \
+      libretro_##name##_retro_get_system_av_info, \
+      libretro_##name##_retro_set_controller_port_device, \
+      libretro_##name##_retro_reset, \
+      libretro_##name##_retro_run, \
+      libretro_##name##_retro_serialize_size, \
+      libretro_##name##_retro_serialize, \
+      libretro_##name##_retro_unserialize, \
+      libretro_##name##_retro_cheat_reset, \
+      libretro_##name##_retro_cheat_set, \
+      libretro_##name##_retro_load_game, \
+      libretro_##name##_retro_load_game_special, \
+      libretro_##name##_retro_unload_game, \
+      libretro_##name##_retro_get_region, \
+      libretro_##name##_retro_get_memory_data, \
+      libretro_##name##_retro_get_memory_size, \
+   },
+
+SAMPLES_BUNDLE_CORES(DECLARE_CORE)
+
+const struct samples_bundle_core samples_bundle_cores[] = {
+   SAMPLES_BUNDLE_CORES(CORE_ENTRY)
+};
+
+const unsigned samples_bundle_cores_count =
+   sizeof(samples_bundle_cores) / sizeof(samples_bundle_cores[0]);
+
+const struct samples_bundle_core *samples_bundle_find(const char *name)
+{
+   unsigned i;
+
+   for (i = 0; i < samples_bundle_cores_count; i++)
+      if (!strcmp(samples_bundle_cores[i].name, name))
+         return &samples_bundle_cores[i];
+
+   return NULL;
+}
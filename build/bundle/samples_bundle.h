@@ -0,0 +1,54 @@
+#ifndef SAMPLES_BUNDLE_H__
+#define SAMPLES_BUNDLE_H__
+
+#include "libretro.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Entry points of one sample core linked into libretro_samples.a.
+ * The members mirror the libretro API one to one. */
+struct samples_bundle_core
+{
+   const char *name;
+
+   void (*retro_set_environment)(retro_environment_t);
+   void (*retro_set_video_refresh)(retro_video_refresh_t);
+   void (*retro_set_audio_sample)(retro_audio_sample_t);
+   void (*retro_set_audio_sample_batch)(retro_audio_sample_batch_t);
+   void (*retro_set_input_poll)(retro_input_poll_t);
+   void (*retro_set_input_state)(retro_input_state_t);
+   void (*retro_init)(void);
+   void (*retro_deinit)(void);
+   unsigned (*retro_api_version)(void);
+   void (*retro_get_system_info)(struct retro_system_info *info);
+   void (*retro_get_system_av_info)(struct retro_system_av_info *info);
+   void (*retro_set_controller_port_device)(unsigned port, unsigned device);
+   void (*retro_reset)(void);
+   void (*retro_run)(void);
+   size_t (*retro_serialize_size)(void);
+   bool (*retro_serialize)(void *data, size_t size);
+   bool (*retro_unserialize)(const void *data, size_t size);
+   void (*retro_cheat_reset)(void);
+   void (*retro_cheat_set)(unsigned index, bool enabled, const char *code);
+   bool (*retro_load_game)(const struct retro_game_info *game);
+   bool (*retro_load_game_special)(unsigned game_type,
+         const struct retro_game_info *info, size_t num_info);
+   void (*retro_unload_game)(void);
+   unsigned (*retro_get_region)(void);
+   void *(*retro_get_memory_data)(unsigned id);
+   size_t (*retro_get_memory_size)(unsigned id);
+};
+
+extern const struct samples_bundle_core samples_bundle_cores[];
+extern const unsigned samples_bundle_cores_count;
+
+/* Returns NULL if no core of that name is in the bundle. */
+const struct samples_bundle_core *samples_bundle_find(const char *name);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
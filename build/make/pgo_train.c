@@ -0,0 +1,259 @@
+/* Headless training run for PGO=generate builds.
+ *
+ * Loads a core, optionally with content, and runs it for a fixed number of
+ * frames with every output discarded, so that the profile reflects the
+ * core's own hot loops. Joypad input for port 0 can be scripted with a
+ * text file of "<frame> <button id> <0|1>" lines, sorted by frame.
+ *
+ *    pgo_train <core> <frames> [content|-] [input script]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <dlfcn.h>
+
+#include "libretro.h"
+
+#define MAX_BUTTONS 16
+
+static struct
+{
+   void (*retro_init)(void);
+   void (*retro_deinit)(void);
+   void (*retro_set_environment)(retro_environment_t);
+   void (*retro_set_video_refresh)(retro_video_refresh_t);
+   void (*retro_set_audio_sample)(retro_audio_sample_t);
+   void (*retro_set_audio_sample_batch)(retro_audio_sample_batch_t);
+   void (*retro_set_input_poll)(retro_input_poll_t);
+   void (*retro_set_input_state)(retro_input_state_t);
+   void (*retro_get_system_info)(struct retro_system_info *);
+   bool (*retro_load_game)(const struct retro_game_info *);
+   void (*retro_unload_game)(void);
+   void (*retro_run)(void);
+} core;
+
+static int16_t buttons[MAX_BUTTONS];
+static FILE *script;
+static unsigned long script_frame;
+static unsigned script_id;
+static int script_value;
+static bool script_pending;
+
+static void log_cb(enum retro_log_level level, const char *fmt, ...)
+{
+   va_list va;
+
+   if (level < RETRO_LOG_WARN)
+      return;
+
+   va_start(va, fmt);
+   vfprintf(stderr, fmt, va);
+   va_end(va);
+}
+
+static bool environ_cb(unsigned cmd, void *data)
+{
+   switch (cmd)
+   {
+      case RETRO_ENVIRONMENT_GET_LOG_INTERFACE:
+         ((struct retro_log_callback*)data)->log = log_cb;
+         return true;
+
+      case RETRO_ENVIRONMENT_GET_CAN_DUPE:
+         *(bool*)data = true;
+         return true;
+
+      case RETRO_ENVIRONMENT_GET_SYSTEM_DIRECTORY:
+      case RETRO_ENVIRONMENT_GET_SAVE_DIRECTORY:
+         *(const char**)data = ".";
+         return true;
+
+      case RETRO_ENVIRONMENT_SET_PIXEL_FORMAT:
+         return true;
+
+      default:
+         return false;
+   }
+}
+
+static void video_cb(const void *data, unsigned width, unsigned height, size_t pitch)
+{
+   (void)data;
+   (void)width;
+   (void)height;
+   (void)pitch;
+}
+
+static void audio_cb(int16_t left, int16_t right)
+{
+   (void)left;
+   (void)right;
+}
+
+static size_t audio_batch_cb(const int16_t *data, size_t frames)
+{
+   (void)data;
+   return frames;
+}
+
+static void input_poll_cb(void)
+{
+}
+
+static int16_t input_state_cb(unsigned port, unsigned device, unsigned index, unsigned id)
+{
+   (void)index;
+
+   if (port != 0 || device != RETRO_DEVICE_JOYPAD || id >= MAX_BUTTONS)
+      return 0;
+
+   return buttons[id];
+}
+
+static void script_read(void)
+{
+   script_pending = script &&
+      fscanf(script, "%lu %u %d", &script_frame, &script_id, &script_value) == 3;
+}
+
+static void script_apply(unsigned long frame)
+{
+   while (script_pending && script_frame <= frame)
+   {
+      if (script_id < MAX_BUTTONS)
+         buttons[script_id] = script_value != 0;
+      script_read();
+   }
+}
+
+static bool load_symbols(void *lib)
+{
+#define LOAD(sym) \
+   if (!(*(void**)&core.sym = dlsym(lib, #sym))) \
+   { \
+      fprintf(stderr, "pgo_train: missing symbol %s\n", #sym); \
+      return false; \
+   }
+
+   LOAD(retro_init);
+   LOAD(retro_deinit);
+   LOAD(retro_set_environment);
+   LOAD(retro_set_video_refresh);
+   LOAD(retro_set_audio_sample);
+   LOAD(retro_set_audio_sample_batch);
+   LOAD(retro_set_input_poll);
+   LOAD(retro_set_input_state);
+   LOAD(retro_get_system_info);
+   LOAD(retro_load_game);
+   LOAD(retro_unload_game);
+   LOAD(retro_run);
+#undef LOAD
+
+   return true;
+}
+
+static bool load_content(const char *path, void **buf, struct retro_game_info *info)
+{
+   struct retro_system_info system = {0};
+   FILE *file;
+   long size;
+
+   info->path = path;
+   core.retro_get_system_info(&system);
+   if (system.need_fullpath)
+      return true;
+
+   if (!(file = fopen(path, "rb")))
+      return false;
+
+   fseek(file, 0, SEEK_END);
+   size = ftell(file);
+   rewind(file);
+
+   if (size < 0 || !(*buf = malloc(size ? size : 1)) ||
+         fread(*buf, 1, size, file) != (size_t)size)
+   {
+      fclose(file);
+      return false;
+   }
+
+   fclose(file);
+   info->data = *buf;
+   info->size = size;
+   return true;
+}
+
+int main(int argc, char *argv[])
+{
+   struct retro_game_info info = {0};
+   const char *content = NULL;
+   unsigned long frames, frame;
+   void *content_buf = NULL;
+   void *lib;
+
+   if (argc < 3)
+   {
+      fprintf(stderr, "Usage: %s <core> <frames> [content|-] [input script]\n", argv[0]);
+      return 1;
+   }
+
+   frames = strtoul(argv[2], NULL, 0);
+   if (argc > 3 && strcmp(argv[3], "-"))
+      content = argv[3];
+
+   if (argc > 4 && !(script = fopen(argv[4], "r")))
+   {
+      fprintf(stderr, "pgo_train: cannot open input script %s\n", argv[4]);
+      return 1;
+   }
+   script_read();
+
+   if (!(lib = dlopen(argv[1], RTLD_NOW | RTLD_LOCAL)))
+   {
+      fprintf(stderr, "pgo_train: %s\n", dlerror());
+      return 1;
+   }
+
+   if (!load_symbols(lib))
+      return 1;
+
+   core.retro_set_environment(environ_cb);
+   core.retro_init();
+   core.retro_set_video_refresh(video_cb);
+   core.retro_set_audio_sample(audio_cb);
+   core.retro_set_audio_sample_batch(audio_batch_cb);
+   core.retro_set_input_poll(input_poll_cb);
+   core.retro_set_input_state(input_state_cb);
+
+   if (content && !load_content(content, &content_buf, &info))
+   {
+      fprintf(stderr, "pgo_train: cannot read content %s\n", content);
+      return 1;
+   }
+
+   if (!core.retro_load_game(content ? &info : NULL))
+   {
+      fprintf(stderr, "pgo_train: core refused to load\n");
+      return 1;
+   }
+
+   for (frame = 0; frame < frames; frame++)
+   {
+      script_apply(frame);
+      core.retro_run();
+   }
+
+   core.retro_unload_game();
+   core.retro_deinit();
+
+   /* The core is deliberately not dlclose'd: its profile counters are
+    * written out by the instrumented runtime at process exit. */
+   free(content_buf);
+   if (script)
+      fclose(script);
+
+   printf("pgo_train: ran %lu frames\n", frames);
+   return 0;
+}
@@ -4,6 +4,12 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#ifdef RARCH_INTERNAL
+#define MIDI_TEST_CORE_PREFIX(s) libretro_midi_test_##s
+#else
+#define MIDI_TEST_CORE_PREFIX(s) s
+#endif
+
 #define WIDHT  960
 #define HEIGHT 540
 #define FPS    60
@@ -16,16 +22,16 @@ typedef enum
    MIDI_TEST_KEYBOARD
 } midi_test_t;
 
-retro_environment_t g_env;
-struct retro_log_callback * g_log_cb;
-struct retro_midi_interface * g_midi_iface;
-uint16_t * g_video_frame;
-retro_video_refresh_t g_video_refresh;
-retro_input_poll_t g_input_poll;
-retro_input_state_t g_input_state;
-midi_test_t g_midi_test;
+static retro_environment_t g_env;
+static struct retro_log_callback * g_log_cb;
+static struct retro_midi_interface * g_midi_iface;
+static uint16_t * g_video_frame;
+static retro_video_refresh_t g_video_refresh;
+static retro_input_poll_t g_input_poll;
+static retro_input_state_t g_input_state;
+static midi_test_t g_midi_test;
 
-void run_metronome_test(void)
+static void run_metronome_test(void)
 {
    static unsigned i;
    static int frames_elapsed;
@@ -52,7 +58,7 @@ void run_metronome_test(void)
       frames_elapsed = 0;
 }
 
-void run_loopback_test(void)
+static void run_loopback_test(void)
 {
    uint8_t data;
 
@@ -69,7 +75,7 @@ void run_loopback_test(void)
    }
 }
 
-void run_keyboard_test(void)
+static void run_keyboard_test(void)
 {
    uint8_t i;
    static uint16_t old_keys_state;
@@ -110,7 +116,7 @@ void run_keyboard_test(void)
    old_keys_state = new_keys_state;
 }
 
-void retro_set_environment(retro_environment_t env)
+void MIDI_TEST_CORE_PREFIX(retro_set_environment)(retro_environment_t env)
 {
    bool support = true;
 
@@ -119,32 +125,32 @@ void retro_set_environment(retro_environment_t env)
    g_env = env;
 }
 
-void retro_set_video_refresh(retro_video_refresh_t video_refresh)
+void MIDI_TEST_CORE_PREFIX(retro_set_video_refresh)(retro_video_refresh_t video_refresh)
 {
    g_video_refresh = video_refresh;
 }
 
-void retro_set_audio_sample(retro_audio_sample_t p)
+void MIDI_TEST_CORE_PREFIX(retro_set_audio_sample)(retro_audio_sample_t p)
 {
    (void)p;
 }
 
-void retro_set_audio_sample_batch(retro_audio_sample_batch_t p)
+void MIDI_TEST_CORE_PREFIX(retro_set_audio_sample_batch)(retro_audio_sample_batch_t p)
 {
    (void)p;
 }
 
-void retro_set_input_poll(retro_input_poll_t input_poll)
+void MIDI_TEST_CORE_PREFIX(retro_set_input_poll)(retro_input_poll_t input_poll)
 {
    g_input_poll = input_poll;
 }
 
-void retro_set_input_state(retro_input_state_t input_state)
+void MIDI_TEST_CORE_PREFIX(retro_set_input_state)(retro_input_state_t input_state)
 {
    g_input_state = input_state;
 }
 
-void retro_init(void)
+void MIDI_TEST_CORE_PREFIX(retro_init)(void)
 {
    static struct retro_log_callback callback;
    static struct retro_midi_interface interface;
@@ -164,16 +170,16 @@ void retro_init(void)
    }
 }
 
-void retro_deinit(void)
+void MIDI_TEST_CORE_PREFIX(retro_deinit)(void)
 {
 }
 
-unsigned retro_api_version(void)
+unsigned MIDI_TEST_CORE_PREFIX(retro_api_version)(void)
 {
    return RETRO_API_VERSION;
 }
 
-void retro_get_system_info(struct retro_system_info *info)
+void MIDI_TEST_CORE_PREFIX(retro_get_system_info)(struct retro_system_info *info)
 {
    info->library_name     = "MIDI Test";
    info->library_version  = "v0.1.0";
@@ -182,7 +188,7 @@ void retro_get_system_info(struct retro_system_info *info)
    info->need_fullpath    = false;
 }
 
-void retro_get_system_av_info(struct retro_system_av_info *info)
+void MIDI_TEST_CORE_PREFIX(retro_get_system_av_info)(struct retro_system_av_info *info)
 {
    info->geometry.aspect_ratio = (float)WIDHT / (float)HEIGHT;
    info->geometry.base_height  = HEIGHT;
@@ -193,17 +199,17 @@ void retro_get_system_av_info(struct retro_system_av_info *info)
    info->timing.sample_rate    = 0.0;
 }
 
-void retro_set_controller_port_device(unsigned p1, unsigned p2)
+void MIDI_TEST_CORE_PREFIX(retro_set_controller_port_device)(unsigned p1, unsigned p2)
 {
    (void)p1;
    (void)p2;
 }
 
-void retro_reset(void)
+void MIDI_TEST_CORE_PREFIX(retro_reset)(void)
 {
 }
 
-void retro_run(void)
+void MIDI_TEST_CORE_PREFIX(retro_run)(void)
 {
    midi_test_t old_midi_test = g_midi_test;
 
@@ -250,12 +256,12 @@ void retro_run(void)
    g_video_refresh(g_video_frame, WIDHT, HEIGHT, sizeof(uint16_t) * WIDHT);
 }
 
-size_t retro_serialize_size()
+size_t MIDI_TEST_CORE_PREFIX(retro_serialize_size)()
 {
    return 0;
 }
 
-bool retro_serialize(void *p1, size_t p2)
+bool MIDI_TEST_CORE_PREFIX(retro_serialize)(void *p1, size_t p2)
 {
    (void)p1;
    (void)p2;
@@ -263,7 +269,7 @@ bool retro_serialize(void *p1, size_t p2)
    return false;
 }
 
-bool retro_unserialize(const void *p1, size_t p2)
+bool MIDI_TEST_CORE_PREFIX(retro_unserialize)(const void *p1, size_t p2)
 {
    (void)p1;
    (void)p2;
@@ -271,18 +277,18 @@ bool retro_unserialize(const void *p1, size_t p2)
    return false;
 }
 
-void retro_cheat_reset(void)
+void MIDI_TEST_CORE_PREFIX(retro_cheat_reset)(void)
 {
 }
 
-void retro_cheat_set(unsigned p1, bool p2, const char *p3)
+void MIDI_TEST_CORE_PREFIX(retro_cheat_set)(unsigned p1, bool p2, const char *p3)
 {
    (void)p1;
    (void)p2;
    (void)p3;
 }
 
-bool retro_load_game(const struct retro_game_info *p)
+bool MIDI_TEST_CORE_PREFIX(retro_load_game)(const struct retro_game_info *p)
 {
    (void)p;
 
@@ -295,7 +301,7 @@ bool retro_load_game(const struct retro_game_info *p)
    return g_video_frame != NULL;
 }
 
-bool retro_load_game_special(unsigned p1, const struct retro_game_info *p2, size_t p3)
+bool MIDI_TEST_CORE_PREFIX(retro_load_game_special)(unsigned p1, const struct retro_game_info *p2, size_t p3)
 {
    (void)p1;
    (void)p2;
@@ -304,24 +310,24 @@ bool retro_load_game_special(unsigned p1, const struct retro_game_info *p2, size
    return false;
 }
 
-void retro_unload_game(void)
+void MIDI_TEST_CORE_PREFIX(retro_unload_game)(void)
 {
    free(g_video_frame);
 }
 
-unsigned retro_get_region(void)
+unsigned MIDI_TEST_CORE_PREFIX(retro_get_region)(void)
 {
    return RETRO_REGION_NTSC;
 }
 
-void *retro_get_memory_data(unsigned p)
+void *MIDI_TEST_CORE_PREFIX(retro_get_memory_data)(unsigned p)
 {
    (void)p;
 
    return NULL;
 }
 
-size_t retro_get_memory_size(unsigned p)
+size_t MIDI_TEST_CORE_PREFIX(retro_get_memory_size)(unsigned p)
 {
    (void)p;
 
@@ -34,6 +34,12 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "font16.h"
 #include "font10.h"
 
+#ifdef RARCH_INTERNAL
+#define CRUZES_CORE_PREFIX(s) libretro_cruzes_##s
+#else
+#define CRUZES_CORE_PREFIX(s) s
+#endif
+
 static retro_environment_t   env_cb   = NULL;
 static retro_input_state_t   input_cb = NULL;
 static retro_input_poll_t    poll_cb  = NULL;
@@ -96,7 +102,7 @@ typedef enum
 
 typedef cell_state_t grid_t[GRID_ROWS][GRID_COLS];
 
-struct {
+static struct {
    struct
    {
       grid_t front; // modifiable by the user
@@ -225,7 +231,7 @@ static void draw_square(int x, int y, int side, uint16_t color)
    draw_rect(x, y, x+side, y+side, color);
 }
 
-void draw_str(const ttf2c_font *font, int x1, int y1, unsigned orig, uint16_t color, const char *str)
+static void draw_str(const ttf2c_font *font, int x1, int y1, unsigned orig, uint16_t color, const char *str)
 {
    uint8_t sr, sg, sb;
 
@@ -594,7 +600,7 @@ static void game_step()
 }
 
 
-RETRO_API void retro_run(void)
+RETRO_API void CRUZES_CORE_PREFIX(retro_run)(void)
 {
    if (g.first_run)
    {
@@ -698,7 +704,7 @@ static void load_challenge(const char *chal)
    }
 }
 
-RETRO_API void retro_init(void)
+RETRO_API void CRUZES_CORE_PREFIX(retro_init)(void)
 {
    memset(&g, 0, sizeof(g));
    g.first_run = true;
@@ -717,31 +723,31 @@ RETRO_API void retro_init(void)
    load_challenge(chal);
 }
 
-RETRO_API void retro_deinit(void) { }
+RETRO_API void CRUZES_CORE_PREFIX(retro_deinit)(void) { }
 
 
-RETRO_API void retro_reset(void)
+RETRO_API void CRUZES_CORE_PREFIX(retro_reset)(void)
 {
 
 }
 
-RETRO_API bool retro_load_game(const struct retro_game_info *game)
+RETRO_API bool CRUZES_CORE_PREFIX(retro_load_game)(const struct retro_game_info *game)
 {
    uint_env(RETRO_ENVIRONMENT_SET_PIXEL_FORMAT, RETRO_PIXEL_FORMAT_RGB565);
    return true;
 }
 
-RETRO_API void retro_unload_game(void)
+RETRO_API void CRUZES_CORE_PREFIX(retro_unload_game)(void)
 {
 
 }
 
-RETRO_API void retro_set_controller_port_device(unsigned port, unsigned device)
+RETRO_API void CRUZES_CORE_PREFIX(retro_set_controller_port_device)(unsigned port, unsigned device)
 {
 
 }
 
-RETRO_API void retro_get_system_info(struct retro_system_info *info)
+RETRO_API void CRUZES_CORE_PREFIX(retro_get_system_info)(struct retro_system_info *info)
 {
    info->library_name     = "cruzes";
    info->library_version  = "0.1";
@@ -749,7 +755,7 @@ RETRO_API void retro_get_system_info(struct retro_system_info *info)
    info->valid_extensions = "";
 }
 
-RETRO_API void retro_get_system_av_info(struct retro_system_av_info *info)
+RETRO_API void CRUZES_CORE_PREFIX(retro_get_system_av_info)(struct retro_system_av_info *info)
 {
    info->geometry.base_width  = SCREEN_WIDTH;
    info->geometry.base_height = SCREEN_HEIGHT;
@@ -759,29 +765,29 @@ RETRO_API void retro_get_system_av_info(struct retro_system_av_info *info)
    info->timing.sample_rate = 0.0;
 }
 
-RETRO_API unsigned retro_api_version(void) { return RETRO_API_VERSION; }
+RETRO_API unsigned CRUZES_CORE_PREFIX(retro_api_version)(void) { return RETRO_API_VERSION; }
 
-RETRO_API void retro_set_video_refresh(retro_video_refresh_t p) { video_cb = p; }
-RETRO_API void retro_set_audio_sample(retro_audio_sample_t p) { }
-RETRO_API void retro_set_audio_sample_batch(retro_audio_sample_batch_t p) { }
-RETRO_API void retro_set_input_poll(retro_input_poll_t p) { poll_cb = p; }
-RETRO_API void retro_set_input_state(retro_input_state_t p) { input_cb = p; }
-RETRO_API void retro_set_environment(retro_environment_t p)
+RETRO_API void CRUZES_CORE_PREFIX(retro_set_video_refresh)(retro_video_refresh_t p) { video_cb = p; }
+RETRO_API void CRUZES_CORE_PREFIX(retro_set_audio_sample)(retro_audio_sample_t p) { }
+RETRO_API void CRUZES_CORE_PREFIX(retro_set_audio_sample_batch)(retro_audio_sample_batch_t p) { }
+RETRO_API void CRUZES_CORE_PREFIX(retro_set_input_poll)(retro_input_poll_t p) { poll_cb = p; }
+RETRO_API void CRUZES_CORE_PREFIX(retro_set_input_state)(retro_input_state_t p) { input_cb = p; }
+RETRO_API void CRUZES_CORE_PREFIX(retro_set_environment)(retro_environment_t p)
 {
    env_cb = p;
    bool_env(RETRO_ENVIRONMENT_SET_SUPPORT_NO_GAME, true);
 }
 
-RETRO_API bool retro_load_game_special(unsigned game_type, const struct retro_game_info *info, size_t num_info)
+RETRO_API bool CRUZES_CORE_PREFIX(retro_load_game_special)(unsigned game_type, const struct retro_game_info *info, size_t num_info)
 {
    return false;
 }
 
-RETRO_API unsigned retro_get_region(void) { return RETRO_REGION_NTSC; }
-RETRO_API size_t retro_serialize_size(void) { return 0; }
-RETRO_API bool retro_serialize(void *data, size_t size) { return false; }
-RETRO_API bool retro_unserialize(const void *data, size_t size) { return false; }
-RETRO_API void retro_cheat_reset(void) { }
-RETRO_API void retro_cheat_set(unsigned index, bool enabled, const char *code) { }
-RETRO_API void *retro_get_memory_data(unsigned id) { return NULL; }
-RETRO_API size_t retro_get_memory_size(unsigned id) { return 0; }
+RETRO_API unsigned CRUZES_CORE_PREFIX(retro_get_region)(void) { return RETRO_REGION_NTSC; }
+RETRO_API size_t CRUZES_CORE_PREFIX(retro_serialize_size)(void) { return 0; }
+RETRO_API bool CRUZES_CORE_PREFIX(retro_serialize)(void *data, size_t size) { return false; }
+RETRO_API bool CRUZES_CORE_PREFIX(retro_unserialize)(const void *data, size_t size) { return false; }
+RETRO_API void CRUZES_CORE_PREFIX(retro_cheat_reset)(void) { }
+RETRO_API void CRUZES_CORE_PREFIX(retro_cheat_set)(unsigned index, bool enabled, const char *code) { }
+RETRO_API void *CRUZES_CORE_PREFIX(retro_get_memory_data)(unsigned id) { return NULL; }
+RETRO_API size_t CRUZES_CORE_PREFIX(retro_get_memory_size)(unsigned id) { return 0; }
@@ -6,17 +6,189 @@
 #include <string.h>
 #include <math.h>
 
+#if defined(HAVE_THREADS) && !defined(_WIN32)
+#define HAVE_SRAM_FLUSH
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 #include "libretro.h"
 
-static uint32_t *frame_buf;
-static struct retro_log_callback logging;
-static retro_log_printf_t log_cb;
-static bool use_audio_cb;
-static float last_aspect;
-static float last_sample_rate;
-static bool analog_mouse = true;
-static bool analog_mouse_relative = false;
-static bool enable_audio = true;
+#ifdef RARCH_INTERNAL
+#define TEST_CORE_PREFIX(s) libretro_test_##s
+#else
+#define TEST_CORE_PREFIX(s) s
+#endif
+
+/* The instance a thread drives is selected per thread, so several instances
+ * can run side by side in one process (run-ahead, batch simulation). On
+ * platforms without thread-local storage the selection is process-wide. */
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define INSTANCE_LOCAL __declspec(thread)
+#elif defined(__GNUC__) && (defined(__linux__) || defined(__APPLE__) || defined(_WIN32))
+#define INSTANCE_LOCAL __thread
+#else
+#define INSTANCE_LOCAL
+#endif
+
+/* Subsystem memory ram1..ram4, memory ids 0x400 to 0x403. Writes from the
+ * core go through sram_write() which marks the touched pages dirty. */
+#define SRAM_COUNT      4
+#define SRAM_ID_BASE    0x400
+#define SRAM_SIZE       0x2000
+#define SRAM_PAGE_SHIFT 8 /* 32 pages, one bit each in a uint32_t */
+
+/* Instance slots, slot 0 belongs to the default instance. */
+#define MAX_INSTANCES   32
+
+struct test_sram
+{
+   uint8_t data[SRAM_SIZE];
+   uint32_t dirty;
+#ifdef HAVE_SRAM_FLUSH
+   /* Dirty pages are copied here at the end of a frame, the flush thread
+    * moves them from here into the mmap'd save file. */
+   uint8_t shadow[SRAM_SIZE];
+   uint32_t pending;
+   uint8_t *map;
+   int fd;
+#endif
+};
+
+struct test_core
+{
+   unsigned slot;
+   uint32_t *frame_buf;
+   struct retro_log_callback logging;
+   retro_log_printf_t log_cb;
+   bool use_audio_cb;
+   float last_aspect;
+   float last_sample_rate;
+   bool analog_mouse;
+   bool analog_mouse_relative;
+   bool enable_audio;
+
+   retro_video_refresh_t video_cb;
+   retro_audio_sample_t audio_cb;
+   retro_audio_sample_batch_t audio_batch_cb;
+   retro_environment_t environ_cb;
+   retro_input_poll_t input_poll_cb;
+   retro_input_state_t input_state_cb;
+   struct retro_rumble_interface rumble;
+   struct retro_perf_callback perf;
+
+   unsigned x_coord;
+   unsigned y_coord;
+   unsigned phase;
+   int mouse_rel_x;
+   int mouse_rel_y;
+   bool old_start;
+   bool old_select;
+
+   /* Checkerboard lines, one pattern period wider than the screen so any
+    * scroll offset is a plain copy out of them. */
+   uint32_t bg_rows[2][320 + 32];
+   bool bg_valid;
+   uint32_t *out_buf;
+   unsigned out_stride;
+
+   /* Input latency statistics, see retro_run(). */
+   retro_usec_t frame_time;
+   retro_time_t poll_delay_total;
+   retro_time_t present_delay_total;
+   unsigned poll_delay_frames;
+
+   struct test_sram sram[SRAM_COUNT];
+   unsigned mouse_clicks;
+   uint32_t frame_count;
+#ifdef HAVE_SRAM_FLUSH
+   pthread_t flush_thread;
+   pthread_mutex_t flush_lock;
+   pthread_cond_t flush_cond;
+   bool flush_running;
+   bool flush_quit;
+   unsigned flushed_pages;
+#endif
+};
+
+/* The audio, frame time and keyboard callbacks carry no user data, so each
+ * slot registers callbacks of its own which find the instance by slot. */
+static struct test_core *instances[MAX_INSTANCES];
+
+/* Entry points go to the instance selected on the calling thread with
+ * retro_test_instance_select(), or to the default instance. */
+static struct test_core *default_core;
+static INSTANCE_LOCAL struct test_core *selected_core;
+
+static bool instance_claim(struct test_core **slot, struct test_core *core)
+{
+#if defined(__GNUC__)
+   struct test_core *empty = NULL;
+   return __atomic_compare_exchange_n(slot, &empty, core, false,
+         __ATOMIC_ACQ_REL, __ATOMIC_RELAXED);
+#elif defined(_MSC_VER)
+   return !_InterlockedCompareExchangePointer((void *volatile *)slot, core, NULL);
+#else
+   if (*slot)
+      return false;
+   *slot = core;
+   return true;
+#endif
+}
+
+static void instance_release(struct test_core **slot)
+{
+#if defined(__GNUC__)
+   __atomic_store_n(slot, NULL, __ATOMIC_RELEASE);
+#elif defined(_MSC_VER)
+   _InterlockedExchangePointer((void *volatile *)slot, NULL);
+#else
+   *slot = NULL;
+#endif
+}
+
+/* Used by the callbacks, which may run on any thread. */
+static struct test_core *instance_get(unsigned slot)
+{
+#if defined(__GNUC__)
+   return __atomic_load_n(&instances[slot], __ATOMIC_ACQUIRE);
+#else
+   return *(struct test_core *volatile *)&instances[slot];
+#endif
+}
+
+static struct test_core *core_new(unsigned first_slot, unsigned last_slot)
+{
+   struct test_core *core = calloc(1, sizeof(*core));
+   if (!core)
+      return NULL;
+
+   for (core->slot = first_slot; core->slot <= last_slot; core->slot++)
+   {
+      if (instance_claim(&instances[core->slot], core))
+      {
+         core->analog_mouse = true;
+         core->enable_audio = true;
+         return core;
+      }
+   }
+
+   free(core);
+   return NULL;
+}
+
+static struct test_core *core_get(void)
+{
+   if (selected_core)
+      return selected_core;
+   if (!default_core)
+      default_core = core_new(0, 0);
+   return default_core;
+}
 
 static void fallback_log(enum retro_log_level level, const char *fmt, ...)
 {
@@ -27,40 +199,287 @@ static void fallback_log(enum retro_log_level level, const char *fmt, ...)
    va_end(va);
 }
 
-void retro_init(void)
+static void sram_write(struct test_core *core, unsigned index,
+      unsigned offset, const void *data, size_t size)
 {
-   frame_buf = calloc(320 * 240, sizeof(uint32_t));
+   struct test_sram *sram = &core->sram[index];
+   unsigned first = offset >> SRAM_PAGE_SHIFT;
+   unsigned last  = (offset + size - 1) >> SRAM_PAGE_SHIFT;
+
+   memcpy(sram->data + offset, data, size);
+   for (unsigned page = first; page <= last; page++)
+      sram->dirty |= 1u << page;
 }
 
-void retro_deinit(void)
+#ifdef HAVE_SRAM_FLUSH
+static void sram_unmap(struct test_core *core, unsigned count)
 {
-   free(frame_buf);
-   frame_buf = NULL;
+   for (unsigned i = 0; i < count; i++)
+   {
+      struct test_sram *sram = &core->sram[i];
+      msync(sram->map, SRAM_SIZE, MS_SYNC);
+      munmap(sram->map, SRAM_SIZE);
+      close(sram->fd);
+      sram->map = NULL;
+   }
 }
 
-unsigned retro_api_version(void)
+static void *sram_flush_thread(void *data)
 {
-   return RETRO_API_VERSION;
+   struct test_core *core = data;
+
+   pthread_mutex_lock(&core->flush_lock);
+   for (;;)
+   {
+      bool pending = false;
+      for (unsigned i = 0; i < SRAM_COUNT; i++)
+         pending |= core->sram[i].pending != 0;
+
+      if (!pending)
+      {
+         if (core->flush_quit)
+            break;
+         pthread_cond_wait(&core->flush_cond, &core->flush_lock);
+         continue;
+      }
+
+      for (unsigned i = 0; i < SRAM_COUNT; i++)
+      {
+         struct test_sram *sram = &core->sram[i];
+         uint32_t pending_pages = sram->pending;
+
+         sram->pending = 0;
+         for (unsigned page = 0; pending_pages; page++, pending_pages >>= 1)
+         {
+            if (!(pending_pages & 1))
+               continue;
+
+            unsigned offset = page << SRAM_PAGE_SHIFT;
+            memcpy(sram->map + offset, sram->shadow + offset, 1 << SRAM_PAGE_SHIFT);
+            core->flushed_pages++;
+         }
+      }
+
+      /* The write back itself can take a while, don't hold the lock. */
+      pthread_mutex_unlock(&core->flush_lock);
+      for (unsigned i = 0; i < SRAM_COUNT; i++)
+         msync(core->sram[i].map, SRAM_SIZE, MS_ASYNC);
+      pthread_mutex_lock(&core->flush_lock);
+   }
+   pthread_mutex_unlock(&core->flush_lock);
+
+   return NULL;
+}
+
+static void sram_flush_stop(struct test_core *core)
+{
+   if (!core->flush_running)
+      return;
+
+   pthread_mutex_lock(&core->flush_lock);
+   for (unsigned i = 0; i < SRAM_COUNT; i++)
+   {
+      struct test_sram *sram = &core->sram[i];
+      memcpy(sram->shadow, sram->data, SRAM_SIZE);
+      sram->pending |= sram->dirty;
+      sram->dirty = 0;
+   }
+   core->flush_quit = true;
+   pthread_cond_signal(&core->flush_cond);
+   pthread_mutex_unlock(&core->flush_lock);
+   pthread_join(core->flush_thread, NULL);
+
+   sram_unmap(core, SRAM_COUNT);
+   pthread_mutex_destroy(&core->flush_lock);
+   pthread_cond_destroy(&core->flush_cond);
+   core->flush_running = false;
+
+   core->log_cb(RETRO_LOG_INFO, "SRAM: %u pages written incrementally.\n", core->flushed_pages);
+}
+
+static bool sram_flush_start(struct test_core *core)
+{
+   const char *dir = NULL;
+   unsigned i;
+
+   if (core->flush_running)
+      return true;
+   if (!core->environ_cb(RETRO_ENVIRONMENT_GET_SAVE_DIRECTORY, &dir) || !dir)
+      return false;
+
+   for (i = 0; i < SRAM_COUNT; i++)
+   {
+      struct test_sram *sram = &core->sram[i];
+      char path[4096];
+      struct stat st;
+      bool saved;
+
+      /* Other instances in the same save directory get files of their
+       * own, the default instance keeps the plain names. */
+      if (core->slot)
+         snprintf(path, sizeof(path), "%s/test_libretro.%u.ram%u", dir, core->slot, i + 1);
+      else
+         snprintf(path, sizeof(path), "%s/test_libretro.ram%u", dir, i + 1);
+      sram->fd = open(path, O_RDWR | O_CREAT, 0644);
+      if (sram->fd < 0)
+         break;
+
+      saved = fstat(sram->fd, &st) == 0 && st.st_size >= SRAM_SIZE;
+      if (ftruncate(sram->fd, SRAM_SIZE) == 0)
+         sram->map = mmap(NULL, SRAM_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, sram->fd, 0);
+      if (!sram->map || sram->map == MAP_FAILED)
+      {
+         sram->map = NULL;
+         close(sram->fd);
+         break;
+      }
+
+      /* An existing save is loaded, a new file starts out with what the
+       * core has so far. From here on only pages the core writes are
+       * flushed. */
+      if (saved)
+         memcpy(sram->data, sram->map, SRAM_SIZE);
+      else
+         memcpy(sram->map, sram->data, SRAM_SIZE);
+      memcpy(sram->shadow, sram->data, SRAM_SIZE);
+      sram->dirty   = 0;
+      sram->pending = 0;
+   }
+
+   if (i < SRAM_COUNT)
+   {
+      core->log_cb(RETRO_LOG_WARN, "Could not map SRAM save files in %s.\n", dir);
+      sram_unmap(core, i);
+      return false;
+   }
+
+   /* Carry on counting from the loaded save. */
+   memcpy(&core->frame_count, core->sram[0].data + 4, sizeof(core->frame_count));
+
+   pthread_mutex_init(&core->flush_lock, NULL);
+   pthread_cond_init(&core->flush_cond, NULL);
+   core->flush_quit    = false;
+   core->flushed_pages = 0;
+   if (pthread_create(&core->flush_thread, NULL, sram_flush_thread, core) != 0)
+   {
+      pthread_mutex_destroy(&core->flush_lock);
+      pthread_cond_destroy(&core->flush_cond);
+      sram_unmap(core, SRAM_COUNT);
+      return false;
+   }
+
+   core->flush_running = true;
+   return true;
+}
+
+static void sram_flush(struct test_core *core)
+{
+   if (!core->flush_running)
+   {
+      for (unsigned i = 0; i < SRAM_COUNT; i++)
+         core->sram[i].dirty = 0;
+      return;
+   }
+
+   /* Never wait on the flush thread, pages stay dirty until the next
+    * frame if it happens to be busy. */
+   if (pthread_mutex_trylock(&core->flush_lock) != 0)
+      return;
+
+   for (unsigned i = 0; i < SRAM_COUNT; i++)
+   {
+      struct test_sram *sram = &core->sram[i];
+      uint32_t dirty = sram->dirty;
+
+      for (unsigned page = 0; dirty; page++, dirty >>= 1)
+      {
+         unsigned offset = page << SRAM_PAGE_SHIFT;
+         if (dirty & 1)
+            memcpy(sram->shadow + offset, sram->data + offset, 1 << SRAM_PAGE_SHIFT);
+      }
+
+      sram->pending |= sram->dirty;
+      sram->dirty    = 0;
+   }
+
+   pthread_cond_signal(&core->flush_cond);
+   pthread_mutex_unlock(&core->flush_lock);
+}
+#else
+static bool sram_flush_start(struct test_core *core)
+{
+   (void)core;
+   return false;
+}
+
+static void sram_flush_stop(struct test_core *core)
+{
+   (void)core;
+}
+
+static void sram_flush(struct test_core *core)
+{
+   for (unsigned i = 0; i < SRAM_COUNT; i++)
+      core->sram[i].dirty = 0;
+}
+#endif
+
+void TEST_CORE_PREFIX(retro_init)(void)
+{
+   struct test_core *core = core_get();
+   core->frame_buf = calloc(320 * 240, sizeof(uint32_t));
+}
+
+void TEST_CORE_PREFIX(retro_deinit)(void)
+{
+   struct test_core *core = selected_core ? selected_core : default_core;
+
+   if (!core)
+      return;
+
+   sram_flush_stop(core);
+   free(core->frame_buf);
+
+   instance_release(&instances[core->slot]);
+   if (selected_core == core)
+      selected_core = NULL;
+   if (default_core == core)
+      default_core = NULL;
+   free(core);
+}
+
+/* Not part of the libretro API. A host running several instances out of one
+ * copy of the core creates them here, and selects the one it is about to
+ * call into on the calling thread. NULL selects the default instance again.
+ * Instances are released by retro_deinit() while selected. */
+void *TEST_CORE_PREFIX(retro_test_instance_create)(void)
+{
+   return core_new(1, MAX_INSTANCES - 1);
+}
+
+void TEST_CORE_PREFIX(retro_test_instance_select)(void *instance)
+{
+   selected_core = instance;
 }
 
-static retro_video_refresh_t video_cb;
-static retro_audio_sample_t audio_cb;
-static retro_audio_sample_batch_t audio_batch_cb;
-static retro_environment_t environ_cb;
-static retro_input_poll_t input_poll_cb;
-static retro_input_state_t input_state_cb;
+unsigned TEST_CORE_PREFIX(retro_api_version)(void)
+{
+   return RETRO_API_VERSION;
+}
 
-void retro_set_controller_port_device(unsigned port, unsigned device)
+void TEST_CORE_PREFIX(retro_set_controller_port_device)(unsigned port, unsigned device)
 {
+   struct test_core *core = core_get();
+
    #define max_descriptions  10
    static struct retro_input_descriptor empty_input_descriptor[] = { { 0 } };
    struct retro_input_descriptor descriptions[max_descriptions+1] = {0}; /* set final record to nulls */
    struct retro_input_descriptor *needle = &descriptions[0];
 
-   log_cb(RETRO_LOG_INFO, "Blanking existing controller descriptions.\n", device, port);
-   environ_cb(RETRO_ENVIRONMENT_SET_INPUT_DESCRIPTORS, empty_input_descriptor); /* is this necessary? it was in the sample code */
+   core->log_cb(RETRO_LOG_INFO, "Blanking existing controller descriptions.\n", device, port);
+   core->environ_cb(RETRO_ENVIRONMENT_SET_INPUT_DESCRIPTORS, empty_input_descriptor); /* is this necessary? it was in the sample code */
 
-   log_cb(RETRO_LOG_INFO, "Plugging device %u into port %u.\n", device, port);
+   core->log_cb(RETRO_LOG_INFO, "Plugging device %u into port %u.\n", device, port);
 
    switch(device)
    {
@@ -119,10 +538,10 @@ void retro_set_controller_port_device(unsigned port, unsigned device)
    needle->port = 0;  needle->device = 0;  needle->index = 0;
    needle->id = 0;    needle->description = NULL;
 
-   environ_cb(RETRO_ENVIRONMENT_SET_INPUT_DESCRIPTORS, descriptions);
+   core->environ_cb(RETRO_ENVIRONMENT_SET_INPUT_DESCRIPTORS, descriptions);
 }
 
-void retro_get_system_info(struct retro_system_info *info)
+void TEST_CORE_PREFIX(retro_get_system_info)(struct retro_system_info *info)
 {
    memset(info, 0, sizeof(*info));
    info->library_name     = "TestCore";
@@ -131,11 +550,13 @@ void retro_get_system_info(struct retro_system_info *info)
    info->valid_extensions = NULL; // Anything is fine, we don't care.
 }
 
-void retro_get_system_av_info(struct retro_system_av_info *info)
+void TEST_CORE_PREFIX(retro_get_system_av_info)(struct retro_system_av_info *info)
 {
+   struct test_core *core = core_get();
+
    float aspect = 4.0f / 3.0f;
    struct retro_variable var = { .key = "test_aspect" };
-   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   if (core->environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
    {
       if (!strcmp(var.value, "4:3"))
          aspect = 4.0f / 3.0f;
@@ -145,7 +566,7 @@ void retro_get_system_av_info(struct retro_system_av_info *info)
 
    float sampling_rate = 30000.0f;
    var.key = "test_samplerate";
-   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   if (core->environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
       sampling_rate = strtof(var.value, NULL);
 
    info->timing = (struct retro_system_timing) {
@@ -161,15 +582,15 @@ void retro_get_system_av_info(struct retro_system_av_info *info)
       .aspect_ratio = aspect,
    };
 
-   last_aspect = aspect;
-   last_sample_rate = sampling_rate;
+   core->last_aspect = aspect;
+   core->last_sample_rate = sampling_rate;
 }
 
-static struct retro_rumble_interface rumble;
-
-void retro_set_environment(retro_environment_t cb)
+void TEST_CORE_PREFIX(retro_set_environment)(retro_environment_t cb)
 {
-   environ_cb = cb;
+   struct test_core *core = core_get();
+
+   core->environ_cb = cb;
 
    static const struct retro_variable vars[] = {
       { "test_aspect", "Aspect Ratio; 4:3|16:9" },
@@ -177,6 +598,7 @@ void retro_set_environment(retro_environment_t cb)
       { "test_analog_mouse", "Left Analog as mouse; true|false" },
       { "test_analog_mouse_relative", "Analog mouse is relative; false|true" },
       { "test_audio_enable", "Enable Audio; true|false" },
+      { "test_sram_flush", "Write SRAM to save directory incrementally; false|true" },
       { NULL, NULL },
    };
 
@@ -185,10 +607,10 @@ void retro_set_environment(retro_environment_t cb)
    bool no_content = true;
    cb(RETRO_ENVIRONMENT_SET_SUPPORT_NO_GAME, &no_content);
 
-   if (cb(RETRO_ENVIRONMENT_GET_LOG_INTERFACE, &logging))
-      log_cb = logging.log;
+   if (cb(RETRO_ENVIRONMENT_GET_LOG_INTERFACE, &core->logging))
+      core->log_cb = core->logging.log;
    else
-      log_cb = fallback_log;
+      core->log_cb = fallback_log;
 
    static const struct retro_subsystem_memory_info mem1[] = {{ "ram1", 0x400 }, { "ram2", 0x401 }};
    static const struct retro_subsystem_memory_info mem2[] = {{ "ram3", 0x402 }, { "ram4", 0x403 }};
@@ -228,84 +650,86 @@ void retro_set_environment(retro_environment_t cb)
    cb(RETRO_ENVIRONMENT_SET_CONTROLLER_INFO, (void*)ports);
 }
 
-void retro_set_audio_sample(retro_audio_sample_t cb)
+void TEST_CORE_PREFIX(retro_set_audio_sample)(retro_audio_sample_t cb)
 {
-   audio_cb = cb;
+   struct test_core *core = core_get();
+   core->audio_cb = cb;
 }
 
-void retro_set_audio_sample_batch(retro_audio_sample_batch_t cb)
+void TEST_CORE_PREFIX(retro_set_audio_sample_batch)(retro_audio_sample_batch_t cb)
 {
-   audio_batch_cb = cb;
+   struct test_core *core = core_get();
+   core->audio_batch_cb = cb;
 }
 
-void retro_set_input_poll(retro_input_poll_t cb)
+void TEST_CORE_PREFIX(retro_set_input_poll)(retro_input_poll_t cb)
 {
-   input_poll_cb = cb;
+   struct test_core *core = core_get();
+   core->input_poll_cb = cb;
 }
 
-void retro_set_input_state(retro_input_state_t cb)
+void TEST_CORE_PREFIX(retro_set_input_state)(retro_input_state_t cb)
 {
-   input_state_cb = cb;
+   struct test_core *core = core_get();
+   core->input_state_cb = cb;
 }
 
-void retro_set_video_refresh(retro_video_refresh_t cb)
+void TEST_CORE_PREFIX(retro_set_video_refresh)(retro_video_refresh_t cb)
 {
-   video_cb = cb;
+   struct test_core *core = core_get();
+   core->video_cb = cb;
 }
 
-static unsigned x_coord;
-static unsigned y_coord;
-static unsigned phase;
-static int mouse_rel_x;
-static int mouse_rel_y;
-
-void retro_reset(void)
+void TEST_CORE_PREFIX(retro_reset)(void)
 {
-   x_coord = 0;
-   y_coord = 0;
+   struct test_core *core = core_get();
+   core->x_coord = 0;
+   core->y_coord = 0;
 }
 
 static void update_input(void)
 {
+   struct test_core *core = core_get();
+
    int port = 0;
 
    int dir_x = 0;
    int dir_y = 0;
 
-   input_poll_cb();
+   core->input_poll_cb();
 
-   if (input_state_cb(0, RETRO_DEVICE_KEYBOARD, 0, RETROK_RETURN))
-      log_cb(RETRO_LOG_INFO, "Return key is pressed!\n");
+   if (core->input_state_cb(0, RETRO_DEVICE_KEYBOARD, 0, RETROK_RETURN))
+      core->log_cb(RETRO_LOG_INFO, "Return key is pressed!\n");
 
-   if (input_state_cb(0, RETRO_DEVICE_KEYBOARD, 0, RETROK_x))
-      log_cb(RETRO_LOG_INFO, "x key is pressed!\n");
+   if (core->input_state_cb(0, RETRO_DEVICE_KEYBOARD, 0, RETROK_x))
+      core->log_cb(RETRO_LOG_INFO, "x key is pressed!\n");
 
    for(port = 0; port < NUMBER_OF_CONTROLS; port++)
    {
-      if (input_state_cb(port, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_UP))
+      if (core->input_state_cb(port, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_UP))
          dir_y--;
-      if (input_state_cb(port, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_DOWN))
+      if (core->input_state_cb(port, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_DOWN))
          dir_y++;
-      if (input_state_cb(port, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_LEFT))
+      if (core->input_state_cb(port, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_LEFT))
          dir_x--;
-      if (input_state_cb(port, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_RIGHT))
+      if (core->input_state_cb(port, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_RIGHT))
          dir_x++;
 
       int16_t mouse_x;
       int16_t mouse_y;
 
-      bool mouse_l      = input_state_cb(port, RETRO_DEVICE_MOUSE, 0, RETRO_DEVICE_ID_MOUSE_LEFT);
-      bool mouse_r      = input_state_cb(port, RETRO_DEVICE_MOUSE, 0, RETRO_DEVICE_ID_MOUSE_RIGHT);
-      bool mouse_down   = input_state_cb(port, RETRO_DEVICE_MOUSE, 0, RETRO_DEVICE_ID_MOUSE_WHEELDOWN);
-      bool mouse_up     = input_state_cb(port, RETRO_DEVICE_MOUSE, 0, RETRO_DEVICE_ID_MOUSE_WHEELUP);
-      bool mouse_middle = input_state_cb(port, RETRO_DEVICE_MOUSE, 0, RETRO_DEVICE_ID_MOUSE_MIDDLE);
+      bool mouse_l      = core->input_state_cb(port, RETRO_DEVICE_MOUSE, 0, RETRO_DEVICE_ID_MOUSE_LEFT);
+      bool mouse_r      = core->input_state_cb(port, RETRO_DEVICE_MOUSE, 0, RETRO_DEVICE_ID_MOUSE_RIGHT);
+      bool mouse_down   = core->input_state_cb(port, RETRO_DEVICE_MOUSE, 0, RETRO_DEVICE_ID_MOUSE_WHEELDOWN);
+      bool mouse_up     = core->input_state_cb(port, RETRO_DEVICE_MOUSE, 0, RETRO_DEVICE_ID_MOUSE_WHEELUP);
+      bool mouse_middle = core->input_state_cb(port, RETRO_DEVICE_MOUSE, 0, RETRO_DEVICE_ID_MOUSE_MIDDLE);
 
-      if (analog_mouse)
+      if (core->analog_mouse)
       {
-         mouse_x = (320.0f / 32767.0f) * input_state_cb(port, RETRO_DEVICE_ANALOG, RETRO_DEVICE_INDEX_ANALOG_LEFT, RETRO_DEVICE_ID_ANALOG_X);
-         mouse_y = (240.0f / 32767.0f) * input_state_cb(port, RETRO_DEVICE_ANALOG, RETRO_DEVICE_INDEX_ANALOG_LEFT, RETRO_DEVICE_ID_ANALOG_Y);
+         mouse_x = (320.0f / 32767.0f) * core->input_state_cb(port, RETRO_DEVICE_ANALOG, RETRO_DEVICE_INDEX_ANALOG_LEFT, RETRO_DEVICE_ID_ANALOG_X);
+         mouse_y = (240.0f / 32767.0f) * core->input_state_cb(port, RETRO_DEVICE_ANALOG, RETRO_DEVICE_INDEX_ANALOG_LEFT, RETRO_DEVICE_ID_ANALOG_Y);
 
-         if (analog_mouse_relative)
+         if (core->analog_mouse_relative)
          {
             mouse_x /= 32;
             mouse_y /= 32;
@@ -321,162 +745,204 @@ static void update_input(void)
       }
       else
       {
-         mouse_x = input_state_cb(port, RETRO_DEVICE_MOUSE, 0, RETRO_DEVICE_ID_MOUSE_X);
-         mouse_y = input_state_cb(port, RETRO_DEVICE_MOUSE, 0, RETRO_DEVICE_ID_MOUSE_Y);
+         mouse_x = core->input_state_cb(port, RETRO_DEVICE_MOUSE, 0, RETRO_DEVICE_ID_MOUSE_X);
+         mouse_y = core->input_state_cb(port, RETRO_DEVICE_MOUSE, 0, RETRO_DEVICE_ID_MOUSE_Y);
+      }
+
+      if (mouse_l)
+      {
+         /* Keep a log of clicks in ram2 so SRAM sees scattered writes. */
+         int16_t click[2] = { mouse_x, mouse_y };
+         unsigned slot = core->mouse_clicks++ % (SRAM_SIZE / sizeof(click));
+         sram_write(core, 1, slot * sizeof(click), click, sizeof(click));
       }
 
       if (mouse_l)
-         log_cb(RETRO_LOG_INFO, "Mouse #: %d     L pressed.   X: %d   Y: %d\n", port, mouse_x, mouse_y);
+         core->log_cb(RETRO_LOG_INFO, "Mouse #: %d     L pressed.   X: %d   Y: %d\n", port, mouse_x, mouse_y);
       if (mouse_r)
-         log_cb(RETRO_LOG_INFO, "Mouse #: %d     R pressed.   X: %d   Y: %d\n", port, mouse_x, mouse_y);
+         core->log_cb(RETRO_LOG_INFO, "Mouse #: %d     R pressed.   X: %d   Y: %d\n", port, mouse_x, mouse_y);
       if (mouse_down)
-         log_cb(RETRO_LOG_INFO, "Mouse #: %d     wheeldown pressed.   X: %d   Y: %d\n", port, mouse_x, mouse_y);
+         core->log_cb(RETRO_LOG_INFO, "Mouse #: %d     wheeldown pressed.   X: %d   Y: %d\n", port, mouse_x, mouse_y);
       if (mouse_up)
-         log_cb(RETRO_LOG_INFO, "Mouse #: %d     wheelup pressed.     X: %d   Y: %d\n", port, mouse_x, mouse_y);
+         core->log_cb(RETRO_LOG_INFO, "Mouse #: %d     wheelup pressed.     X: %d   Y: %d\n", port, mouse_x, mouse_y);
       if (mouse_middle)
-         log_cb(RETRO_LOG_INFO, "Mouse #: %d     middle pressed.      X: %d   Y: %d\n", port, mouse_x, mouse_y);
+         core->log_cb(RETRO_LOG_INFO, "Mouse #: %d     middle pressed.      X: %d   Y: %d\n", port, mouse_x, mouse_y);
 
-      if ((analog_mouse && analog_mouse_relative) || !analog_mouse)
+      if ((core->analog_mouse && core->analog_mouse_relative) || !core->analog_mouse)
       {
-         mouse_rel_x += mouse_x;
-         mouse_rel_y += mouse_y;
+         core->mouse_rel_x += mouse_x;
+         core->mouse_rel_y += mouse_y;
       }
       else
       {
-         mouse_rel_x = mouse_x;
-         mouse_rel_y = mouse_y;
+         core->mouse_rel_x = mouse_x;
+         core->mouse_rel_y = mouse_y;
       }
 
-      if (mouse_rel_x >= 310)
-         mouse_rel_x = 309;
-      else if (mouse_rel_x < 10)
-         mouse_rel_x = 10;
-      if (mouse_rel_y >= 230)
-         mouse_rel_y = 229;
-      else if (mouse_rel_y < 10)
-         mouse_rel_y = 10;
-
-      bool pointer_pressed = input_state_cb(port, RETRO_DEVICE_POINTER, 0, RETRO_DEVICE_ID_POINTER_PRESSED);
-      int16_t pointer_x = input_state_cb(port, RETRO_DEVICE_POINTER, 0, RETRO_DEVICE_ID_POINTER_X);
-      int16_t pointer_y = input_state_cb(port, RETRO_DEVICE_POINTER, 0, RETRO_DEVICE_ID_POINTER_Y);
+      if (core->mouse_rel_x >= 310)
+         core->mouse_rel_x = 309;
+      else if (core->mouse_rel_x < 10)
+         core->mouse_rel_x = 10;
+      if (core->mouse_rel_y >= 230)
+         core->mouse_rel_y = 229;
+      else if (core->mouse_rel_y < 10)
+         core->mouse_rel_y = 10;
+
+      bool pointer_pressed = core->input_state_cb(port, RETRO_DEVICE_POINTER, 0, RETRO_DEVICE_ID_POINTER_PRESSED);
+      int16_t pointer_x = core->input_state_cb(port, RETRO_DEVICE_POINTER, 0, RETRO_DEVICE_ID_POINTER_X);
+      int16_t pointer_y = core->input_state_cb(port, RETRO_DEVICE_POINTER, 0, RETRO_DEVICE_ID_POINTER_Y);
       if (pointer_pressed)
-         log_cb(RETRO_LOG_INFO, "Pointer Pressed #: %d    : (%6d, %6d).\n", port, pointer_x, pointer_y);
+         core->log_cb(RETRO_LOG_INFO, "Pointer Pressed #: %d    : (%6d, %6d).\n", port, pointer_x, pointer_y);
 
-      dir_x += input_state_cb(port, RETRO_DEVICE_ANALOG, RETRO_DEVICE_INDEX_ANALOG_LEFT, RETRO_DEVICE_ID_ANALOG_X) / 5000;
-      dir_y += input_state_cb(port, RETRO_DEVICE_ANALOG, RETRO_DEVICE_INDEX_ANALOG_LEFT, RETRO_DEVICE_ID_ANALOG_Y) / 5000;
-      dir_x += input_state_cb(port, RETRO_DEVICE_ANALOG, RETRO_DEVICE_INDEX_ANALOG_RIGHT, RETRO_DEVICE_ID_ANALOG_X) / 5000;
-      dir_y += input_state_cb(port, RETRO_DEVICE_ANALOG, RETRO_DEVICE_INDEX_ANALOG_RIGHT, RETRO_DEVICE_ID_ANALOG_Y) / 5000;
+      dir_x += core->input_state_cb(port, RETRO_DEVICE_ANALOG, RETRO_DEVICE_INDEX_ANALOG_LEFT, RETRO_DEVICE_ID_ANALOG_X) / 5000;
+      dir_y += core->input_state_cb(port, RETRO_DEVICE_ANALOG, RETRO_DEVICE_INDEX_ANALOG_LEFT, RETRO_DEVICE_ID_ANALOG_Y) / 5000;
+      dir_x += core->input_state_cb(port, RETRO_DEVICE_ANALOG, RETRO_DEVICE_INDEX_ANALOG_RIGHT, RETRO_DEVICE_ID_ANALOG_X) / 5000;
+      dir_y += core->input_state_cb(port, RETRO_DEVICE_ANALOG, RETRO_DEVICE_INDEX_ANALOG_RIGHT, RETRO_DEVICE_ID_ANALOG_Y) / 5000;
 
-      x_coord = (x_coord + dir_x) & 31;
-      y_coord = (y_coord + dir_y) & 31;
+      core->x_coord = (core->x_coord + dir_x) & 31;
+      core->y_coord = (core->y_coord + dir_y) & 31;
 
-      if (rumble.set_rumble_state)
+      if (core->rumble.set_rumble_state)
       {
-         static bool old_start;
-         static bool old_select;
-         uint16_t strength_strong = input_state_cb(port, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_R2) ? 0x4000 : 0xffff;
-         uint16_t strength_weak = input_state_cb(port, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_L2) ? 0x4000 : 0xffff;
-         bool start = input_state_cb(port, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_START);
-         bool select = input_state_cb(port, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_SELECT);
-         if (old_start != start)
-            log_cb(RETRO_LOG_INFO, "Port #: %d   Strong rumble: %s.\n", port, start ? "ON": "OFF");
-         rumble.set_rumble_state(port, RETRO_RUMBLE_STRONG, start * strength_strong);
-
-         if (old_select != select)
-            log_cb(RETRO_LOG_INFO, "Port #: %d   Weak rumble: %s.\n", port, select ? "ON": "OFF");
-         rumble.set_rumble_state(port, RETRO_RUMBLE_WEAK, select * strength_weak);
-
-         old_start = start;
-         old_select = select;
+         uint16_t strength_strong = core->input_state_cb(port, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_R2) ? 0x4000 : 0xffff;
+         uint16_t strength_weak = core->input_state_cb(port, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_L2) ? 0x4000 : 0xffff;
+         bool start = core->input_state_cb(port, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_START);
+         bool select = core->input_state_cb(port, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_SELECT);
+         if (core->old_start != start)
+            core->log_cb(RETRO_LOG_INFO, "Port #: %d   Strong rumble: %s.\n", port, start ? "ON": "OFF");
+         core->rumble.set_rumble_state(port, RETRO_RUMBLE_STRONG, start * strength_strong);
+
+         if (core->old_select != select)
+            core->log_cb(RETRO_LOG_INFO, "Port #: %d   Weak rumble: %s.\n", port, select ? "ON": "OFF");
+         core->rumble.set_rumble_state(port, RETRO_RUMBLE_WEAK, select * strength_weak);
+
+         core->old_start = start;
+         core->old_select = select;
       }
 
       int16_t lightgun_x = 0;
       int16_t lightgun_y = 0;
       bool trigger_pressed = false;
 
-      lightgun_x      = input_state_cb(port, RETRO_DEVICE_LIGHTGUN, 0, RETRO_DEVICE_ID_LIGHTGUN_SCREEN_X);
-      lightgun_y      = input_state_cb(port, RETRO_DEVICE_LIGHTGUN, 0, RETRO_DEVICE_ID_LIGHTGUN_SCREEN_Y);
-      trigger_pressed = input_state_cb(port, RETRO_DEVICE_LIGHTGUN, 0, RETRO_DEVICE_ID_LIGHTGUN_TRIGGER );
+      lightgun_x      = core->input_state_cb(port, RETRO_DEVICE_LIGHTGUN, 0, RETRO_DEVICE_ID_LIGHTGUN_SCREEN_X);
+      lightgun_y      = core->input_state_cb(port, RETRO_DEVICE_LIGHTGUN, 0, RETRO_DEVICE_ID_LIGHTGUN_SCREEN_Y);
+      trigger_pressed = core->input_state_cb(port, RETRO_DEVICE_LIGHTGUN, 0, RETRO_DEVICE_ID_LIGHTGUN_TRIGGER );
 
       if (trigger_pressed)
-         log_cb(RETRO_LOG_INFO, "Lightgun Trigger Pressed #: %d   Lightgun X: %d   Lightgun Y: %d\n", port, lightgun_x, lightgun_y);   }
+         core->log_cb(RETRO_LOG_INFO, "Lightgun Trigger Pressed #: %d   Lightgun X: %d   Lightgun Y: %d\n", port, lightgun_x, lightgun_y);   }
 }
 
-static void render_checkered(void)
+static void render_background(void)
 {
+   struct test_core *core = core_get();
+
    /* Try rendering straight into VRAM if we can. */
-   uint32_t *buf = NULL;
-   unsigned stride = 0;
    struct retro_framebuffer fb = {0};
    fb.width = 320;
    fb.height = 240;
    fb.access_flags = RETRO_MEMORY_ACCESS_WRITE;
-   if (environ_cb(RETRO_ENVIRONMENT_GET_CURRENT_SOFTWARE_FRAMEBUFFER, &fb) && fb.format == RETRO_PIXEL_FORMAT_XRGB8888)
+   if (core->environ_cb(RETRO_ENVIRONMENT_GET_CURRENT_SOFTWARE_FRAMEBUFFER, &fb) && fb.format == RETRO_PIXEL_FORMAT_XRGB8888)
    {
-      buf = fb.data;
-      stride = fb.pitch >> 2;
+      core->out_buf = fb.data;
+      core->out_stride = fb.pitch >> 2;
    }
    else
    {
-      buf = frame_buf;
-      stride = 320;
+      core->out_buf = core->frame_buf;
+      core->out_stride = 320;
    }
 
+   if (core->bg_valid)
+      return;
+
    uint32_t color_r = 0xff << 16;
    uint32_t color_g = 0xff <<  8;
 
+   for (unsigned x = 0; x < 320 + 32; x++)
+   {
+      unsigned index_x = (x >> 4) & 1;
+      core->bg_rows[0][x] = index_x ? color_r : color_g;
+      core->bg_rows[1][x] = index_x ? color_g : color_r;
+   }
+
+   core->bg_valid = true;
+}
+
+static void render_checkered(void)
+{
+   struct test_core *core = core_get();
+
+   uint32_t *buf = core->out_buf;
+   unsigned stride = core->out_stride;
+
+   /* Shifting right by x_coord is the same as starting 32 - x_coord pixels
+    * into a row, since the pattern repeats every 32 pixels. */
+   unsigned offset_x = 32 - core->x_coord;
+
    uint32_t *line = buf;
    for (unsigned y = 0; y < 240; y++, line += stride)
    {
-      unsigned index_y = ((y - y_coord) >> 4) & 1;
-      for (unsigned x = 0; x < 320; x++)
-      {
-         unsigned index_x = ((x - x_coord) >> 4) & 1;
-         line[x] = (index_y ^ index_x) ? color_r : color_g;
-      }
+      unsigned index_y = ((y - core->y_coord) >> 4) & 1;
+      memcpy(line, core->bg_rows[index_y] + offset_x, 320 * sizeof(uint32_t));
    }
 
-   for (unsigned y = mouse_rel_y - 5; y <= mouse_rel_y + 5; y++)
-      for (unsigned x = mouse_rel_x - 5; x <= mouse_rel_x + 5; x++)
+   for (unsigned y = core->mouse_rel_y - 5; y <= core->mouse_rel_y + 5; y++)
+      for (unsigned x = core->mouse_rel_x - 5; x <= core->mouse_rel_x + 5; x++)
          buf[y * stride + x] = 0xff;
 
-   video_cb(buf, 320, 240, stride << 2);
+   core->video_cb(buf, 320, 240, stride << 2);
 }
 
 static void check_variables(void)
 {
+   struct test_core *core = core_get();
+
    struct retro_variable var = {0};
 
    var.key = "test_analog_mouse";
 
-   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   if (core->environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
    {
-      analog_mouse = !strcmp(var.value, "true") ? true : false;
-      log_cb(RETRO_LOG_INFO, "Key -> Val: %s -> %s.\n", var.key, var.value);
+      core->analog_mouse = !strcmp(var.value, "true") ? true : false;
+      core->log_cb(RETRO_LOG_INFO, "Key -> Val: %s -> %s.\n", var.key, var.value);
    }
 
    var.key = "test_analog_mouse_relative";
 
-   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   if (core->environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
    {
-      analog_mouse_relative = !strcmp(var.value, "true") ? true : false;
-      log_cb(RETRO_LOG_INFO, "Key -> Val: %s -> %s.\n", var.key, var.value);
+      core->analog_mouse_relative = !strcmp(var.value, "true") ? true : false;
+      core->log_cb(RETRO_LOG_INFO, "Key -> Val: %s -> %s.\n", var.key, var.value);
    }
 
    var.key = "test_audio_enable";
 
-   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   if (core->environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
    {
-      enable_audio = !strcmp(var.value, "true") ? true : false;
-      log_cb(RETRO_LOG_INFO, "Key -> Val: %s -> %s.\n", var.key, var.value);
+      core->enable_audio = !strcmp(var.value, "true") ? true : false;
+      core->log_cb(RETRO_LOG_INFO, "Key -> Val: %s -> %s.\n", var.key, var.value);
    }
 
-   float last = last_aspect;
-   float last_rate = last_sample_rate;
+   var.key = "test_sram_flush";
+
+   if (core->environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   {
+      if (!strcmp(var.value, "true"))
+      {
+         if (!sram_flush_start(core))
+            core->log_cb(RETRO_LOG_WARN, "Incremental SRAM writing is not available.\n");
+      }
+      else
+         sram_flush_stop(core);
+      core->log_cb(RETRO_LOG_INFO, "Key -> Val: %s -> %s.\n", var.key, var.value);
+   }
+
+   float last = core->last_aspect;
+   float last_rate = core->last_sample_rate;
    struct retro_system_av_info info;
-   retro_get_system_av_info(&info);
+   TEST_CORE_PREFIX(retro_get_system_av_info)(&info);
 
-   if ((last != last_aspect && last != 0.0f) || (last_rate != last_sample_rate && last_rate != 0.0f))
+   if ((last != core->last_aspect && last != 0.0f) || (last_rate != core->last_sample_rate && last_rate != 0.0f))
    {
       // SET_SYSTEM_AV_INFO can only be called within retro_run().
       // check_variables() is called once in retro_load_game(), but the checks
@@ -484,26 +950,26 @@ static void check_variables(void)
       // last_aspect and last_sample_rate are not updated until retro_get_system_av_info(),
       // which must come after retro_load_game().
       bool ret;
-      if (last_rate != last_sample_rate && last_rate != 0.0f) // If audio rate changes, go through SET_SYSTEM_AV_INFO.
-         ret = environ_cb(RETRO_ENVIRONMENT_SET_SYSTEM_AV_INFO, &info);
+      if (last_rate != core->last_sample_rate && last_rate != 0.0f) // If audio rate changes, go through SET_SYSTEM_AV_INFO.
+         ret = core->environ_cb(RETRO_ENVIRONMENT_SET_SYSTEM_AV_INFO, &info);
       else // If only aspect changed, take the simpler path.
-         ret = environ_cb(RETRO_ENVIRONMENT_SET_GEOMETRY, &info.geometry);
-      log_cb(RETRO_LOG_INFO, "SET_SYSTEM_AV_INFO/SET_GEOMETRY = %u.\n", ret);
+         ret = core->environ_cb(RETRO_ENVIRONMENT_SET_GEOMETRY, &info.geometry);
+      core->log_cb(RETRO_LOG_INFO, "SET_SYSTEM_AV_INFO/SET_GEOMETRY = %u.\n", ret);
    }
 }
 
-static void audio_callback(void)
+static void audio_callback(struct test_core *core)
 {
-   if (!enable_audio)
+   if (!core->enable_audio)
       return;
 
-   for (unsigned i = 0; i < 30000 / 60; i++, phase++)
+   for (unsigned i = 0; i < 30000 / 60; i++, core->phase++)
    {
-      int16_t val = 0x800 * sinf(2.0f * M_PI * phase * 300.0f / 30000.0f);
-      audio_cb(val, val);
+      int16_t val = 0x800 * sinf(2.0f * M_PI * core->phase * 300.0f / 30000.0f);
+      core->audio_cb(val, val);
    }
 
-   phase %= 100;
+   core->phase %= 100;
 }
 
 static void audio_set_state(bool enable)
@@ -511,28 +977,126 @@ static void audio_set_state(bool enable)
    (void)enable;
 }
 
-void retro_run(void)
+static void frame_time_cb(struct test_core *core, retro_usec_t usec)
+{
+   core->frame_time = usec;
+}
+
+/* Compares input to present latency against polling at the start of the
+ * frame, where the core used to poll. */
+static void report_latency(retro_time_t frame_start, retro_time_t poll_time,
+      retro_time_t present_time)
+{
+   struct test_core *core = core_get();
+
+   core->poll_delay_total += poll_time - frame_start;
+   core->present_delay_total += present_time - frame_start;
+   if (++core->poll_delay_frames < 600)
+      return;
+
+   retro_time_t saved = core->poll_delay_total / core->poll_delay_frames;
+   retro_time_t before = core->present_delay_total / core->poll_delay_frames;
+   core->log_cb(RETRO_LOG_INFO, "Input to present %lld usec, %lld usec when polled at frame start "
+         "(%lld usec less, frame time %lld usec).\n",
+         (long long)(before - saved), (long long)before, (long long)saved,
+         (long long)core->frame_time);
+
+   core->poll_delay_total = 0;
+   core->present_delay_total = 0;
+   core->poll_delay_frames = 0;
+}
+
+void TEST_CORE_PREFIX(retro_run)(void)
 {
+   struct test_core *core = core_get();
+   retro_time_t frame_start = 0;
+   retro_time_t poll_time = 0;
+
+   if (core->perf.get_time_usec)
+      frame_start = core->perf.get_time_usec();
+
+   /* Everything that does not depend on input goes first, so input is
+    * sampled as late as possible and is that much fresher on screen. */
+   render_background();
+   if (!core->use_audio_cb)
+      audio_callback(core);
+
+   if (core->perf.get_time_usec)
+      poll_time = core->perf.get_time_usec();
+
    update_input();
    render_checkered();
-   if (!use_audio_cb)
-      audio_callback();
+
+   if (core->perf.get_time_usec)
+      report_latency(frame_start, poll_time, core->perf.get_time_usec());
+
+   /* ram1 holds the scroll position and a frame counter. */
+   uint8_t coords[2] = { core->x_coord, core->y_coord };
+   core->frame_count++;
+   sram_write(core, 0, 0, coords, sizeof(coords));
+   sram_write(core, 0, 4, &core->frame_count, sizeof(core->frame_count));
+   sram_flush(core);
 
    bool updated = false;
-   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE_UPDATE, &updated) && updated)
+   if (core->environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE_UPDATE, &updated) && updated)
       check_variables();
 }
 
-static void keyboard_cb(bool down, unsigned keycode,
+static void keyboard_cb(struct test_core *core, bool down, unsigned keycode,
       uint32_t character, uint16_t mod)
 {
-   log_cb(RETRO_LOG_INFO, "Down: %s, Code: %d, Char: %u, Mod: %u.\n",
+   core->log_cb(RETRO_LOG_INFO, "Down: %s, Code: %d, Char: %u, Mod: %u.\n",
          down ? "yes" : "no", keycode, character, mod);
 }
 
+#define INSTANCE_CALLBACKS(n) \
+   static void audio_callback_##n(void) \
+   { \
+      audio_callback(instance_get(n)); \
+   } \
+   static void frame_time_cb_##n(retro_usec_t usec) \
+   { \
+      frame_time_cb(instance_get(n), usec); \
+   } \
+   static void keyboard_cb_##n(bool down, unsigned keycode, \
+         uint32_t character, uint16_t mod) \
+   { \
+      keyboard_cb(instance_get(n), down, keycode, character, mod); \
+   }
 
-bool retro_load_game(const struct retro_game_info *info)
+INSTANCE_CALLBACKS(0) INSTANCE_CALLBACKS(1) INSTANCE_CALLBACKS(2) INSTANCE_CALLBACKS(3)
+INSTANCE_CALLBACKS(4) INSTANCE_CALLBACKS(5) INSTANCE_CALLBACKS(6) INSTANCE_CALLBACKS(7)
+INSTANCE_CALLBACKS(8) INSTANCE_CALLBACKS(9) INSTANCE_CALLBACKS(10) INSTANCE_CALLBACKS(11)
+INSTANCE_CALLBACKS(12) INSTANCE_CALLBACKS(13) INSTANCE_CALLBACKS(14) INSTANCE_CALLBACKS(15)
+INSTANCE_CALLBACKS(16) INSTANCE_CALLBACKS(17) INSTANCE_CALLBACKS(18) INSTANCE_CALLBACKS(19)
+INSTANCE_CALLBACKS(20) INSTANCE_CALLBACKS(21) INSTANCE_CALLBACKS(22) INSTANCE_CALLBACKS(23)
+INSTANCE_CALLBACKS(24) INSTANCE_CALLBACKS(25) INSTANCE_CALLBACKS(26) INSTANCE_CALLBACKS(27)
+INSTANCE_CALLBACKS(28) INSTANCE_CALLBACKS(29) INSTANCE_CALLBACKS(30) INSTANCE_CALLBACKS(31)
+
+#define INSTANCE_CALLBACK_ENTRY(n) \
+   { audio_callback_##n, frame_time_cb_##n, keyboard_cb_##n }
+
+static const struct
+{
+   retro_audio_callback_t audio;
+   retro_frame_time_callback_t frame_time;
+   retro_keyboard_event_t keyboard;
+} instance_callbacks[MAX_INSTANCES] = {
+   INSTANCE_CALLBACK_ENTRY(0), INSTANCE_CALLBACK_ENTRY(1), INSTANCE_CALLBACK_ENTRY(2), INSTANCE_CALLBACK_ENTRY(3),
+   INSTANCE_CALLBACK_ENTRY(4), INSTANCE_CALLBACK_ENTRY(5), INSTANCE_CALLBACK_ENTRY(6), INSTANCE_CALLBACK_ENTRY(7),
+   INSTANCE_CALLBACK_ENTRY(8), INSTANCE_CALLBACK_ENTRY(9), INSTANCE_CALLBACK_ENTRY(10), INSTANCE_CALLBACK_ENTRY(11),
+   INSTANCE_CALLBACK_ENTRY(12), INSTANCE_CALLBACK_ENTRY(13), INSTANCE_CALLBACK_ENTRY(14), INSTANCE_CALLBACK_ENTRY(15),
+   INSTANCE_CALLBACK_ENTRY(16), INSTANCE_CALLBACK_ENTRY(17), INSTANCE_CALLBACK_ENTRY(18), INSTANCE_CALLBACK_ENTRY(19),
+   INSTANCE_CALLBACK_ENTRY(20), INSTANCE_CALLBACK_ENTRY(21), INSTANCE_CALLBACK_ENTRY(22), INSTANCE_CALLBACK_ENTRY(23),
+   INSTANCE_CALLBACK_ENTRY(24), INSTANCE_CALLBACK_ENTRY(25), INSTANCE_CALLBACK_ENTRY(26), INSTANCE_CALLBACK_ENTRY(27),
+   INSTANCE_CALLBACK_ENTRY(28), INSTANCE_CALLBACK_ENTRY(29), INSTANCE_CALLBACK_ENTRY(30), INSTANCE_CALLBACK_ENTRY(31),
+};
+
+
+bool TEST_CORE_PREFIX(retro_load_game)(const struct retro_game_info *info)
 {
+   struct test_core *core = core_get();
+
    struct retro_input_descriptor desc[] = {
       { 0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_LEFT,  "Left" },
       { 0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_UP,    "Up" },
@@ -541,24 +1105,31 @@ bool retro_load_game(const struct retro_game_info *info)
       { 0 },
    };
 
-   environ_cb(RETRO_ENVIRONMENT_SET_INPUT_DESCRIPTORS, desc);
+   core->environ_cb(RETRO_ENVIRONMENT_SET_INPUT_DESCRIPTORS, desc);
 
    enum retro_pixel_format fmt = RETRO_PIXEL_FORMAT_XRGB8888;
-   if (!environ_cb(RETRO_ENVIRONMENT_SET_PIXEL_FORMAT, &fmt))
+   if (!core->environ_cb(RETRO_ENVIRONMENT_SET_PIXEL_FORMAT, &fmt))
    {
-      log_cb(RETRO_LOG_INFO, "XRGB8888 is not supported.\n");
+      core->log_cb(RETRO_LOG_INFO, "XRGB8888 is not supported.\n");
       return false;
    }
 
-   struct retro_keyboard_callback cb = { keyboard_cb };
-   environ_cb(RETRO_ENVIRONMENT_SET_KEYBOARD_CALLBACK, &cb);
-   if (environ_cb(RETRO_ENVIRONMENT_GET_RUMBLE_INTERFACE, &rumble))
-      log_cb(RETRO_LOG_INFO, "Rumble environment supported.\n");
+   struct retro_keyboard_callback cb = { instance_callbacks[core->slot].keyboard };
+   core->environ_cb(RETRO_ENVIRONMENT_SET_KEYBOARD_CALLBACK, &cb);
+   if (core->environ_cb(RETRO_ENVIRONMENT_GET_RUMBLE_INTERFACE, &core->rumble))
+      core->log_cb(RETRO_LOG_INFO, "Rumble environment supported.\n");
    else
-      log_cb(RETRO_LOG_INFO, "Rumble environment not supported.\n");
+      core->log_cb(RETRO_LOG_INFO, "Rumble environment not supported.\n");
+
+   struct retro_audio_callback audio_iface = { instance_callbacks[core->slot].audio, audio_set_state };
+   core->use_audio_cb = core->environ_cb(RETRO_ENVIRONMENT_SET_AUDIO_CALLBACK, &audio_iface);
+
+   struct retro_frame_time_callback frame_cb = { instance_callbacks[core->slot].frame_time, 1000000 / 60 };
+   core->frame_time = frame_cb.reference;
+   core->environ_cb(RETRO_ENVIRONMENT_SET_FRAME_TIME_CALLBACK, &frame_cb);
 
-   struct retro_audio_callback audio_cb = { audio_callback, audio_set_state };
-   use_audio_cb = environ_cb(RETRO_ENVIRONMENT_SET_AUDIO_CALLBACK, &audio_cb);
+   if (!core->environ_cb(RETRO_ENVIRONMENT_GET_PERF_INTERFACE, &core->perf))
+      memset(&core->perf, 0, sizeof(core->perf));
 
    check_variables();
 
@@ -566,69 +1137,80 @@ bool retro_load_game(const struct retro_game_info *info)
    return true;
 }
 
-void retro_unload_game(void)
+void TEST_CORE_PREFIX(retro_unload_game)(void)
 {
-   last_aspect = 0.0f;
-   last_sample_rate = 0.0f;
+   struct test_core *core = core_get();
+
+   sram_flush_stop(core);
+   core->last_aspect = 0.0f;
+   core->last_sample_rate = 0.0f;
 }
 
-unsigned retro_get_region(void)
+unsigned TEST_CORE_PREFIX(retro_get_region)(void)
 {
    return RETRO_REGION_NTSC;
 }
 
-bool retro_load_game_special(unsigned type, const struct retro_game_info *info, size_t num)
+bool TEST_CORE_PREFIX(retro_load_game_special)(unsigned type, const struct retro_game_info *info, size_t num)
 {
    if (type != 0x200)
       return false;
    if (num != 2)
       return false;
-   return retro_load_game(NULL);
+   return TEST_CORE_PREFIX(retro_load_game)(NULL);
 }
 
-size_t retro_serialize_size(void)
+size_t TEST_CORE_PREFIX(retro_serialize_size)(void)
 {
    return 2;
 }
 
-bool retro_serialize(void *data_, size_t size)
+bool TEST_CORE_PREFIX(retro_serialize)(void *data_, size_t size)
 {
+   struct test_core *core = core_get();
+
    if (size < 2)
       return false;
 
    uint8_t *data = data_;
-   data[0] = x_coord;
-   data[1] = y_coord;
+   data[0] = core->x_coord;
+   data[1] = core->y_coord;
    return true;
 }
 
-bool retro_unserialize(const void *data_, size_t size)
+bool TEST_CORE_PREFIX(retro_unserialize)(const void *data_, size_t size)
 {
+   struct test_core *core = core_get();
+
    if (size < 2)
       return false;
 
    const uint8_t *data = data_;
-   x_coord = data[0] & 31;
-   y_coord = data[1] & 31;
+   core->x_coord = data[0] & 31;
+   core->y_coord = data[1] & 31;
    return true;
 }
 
-void *retro_get_memory_data(unsigned id)
+void *TEST_CORE_PREFIX(retro_get_memory_data)(unsigned id)
 {
-   (void)id;
-   return NULL;
+   struct test_core *core = core_get();
+
+   if (id < SRAM_ID_BASE || id >= SRAM_ID_BASE + SRAM_COUNT)
+      return NULL;
+   return core->sram[id - SRAM_ID_BASE].data;
 }
 
-size_t retro_get_memory_size(unsigned id)
+size_t TEST_CORE_PREFIX(retro_get_memory_size)(unsigned id)
 {
-   (void)id;
-   return 0;
+   if (id < SRAM_ID_BASE || id >= SRAM_ID_BASE + SRAM_COUNT)
+      return 0;
+   return SRAM_SIZE;
 }
 
-void retro_cheat_reset(void)
+void TEST_CORE_PREFIX(retro_cheat_reset)(void)
 {}
 
-void retro_cheat_set(unsigned index, bool enabled, const char *code)
+void TEST_CORE_PREFIX(retro_cheat_set)(unsigned index, bool enabled, const char *code)
 {
    (void)index;
    (void)enabled;
@@ -0,0 +1,468 @@
+/* vim: set et sw=3 ts=3 sts=3: */
+/* Runs several test core instances out of one copy of the core, both on one
+ * thread (the run-ahead case) and one per thread, and checks each against an
+ * instance running on its own, and that instances sharing a save directory
+ * keep separate SRAM saves. Prints the throughput for 1 .. N threads.
+ *
+ *    ./test-instances ./test_libretro.so [threads] [frames]
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <time.h>
+#include <dlfcn.h>
+#include <dirent.h>
+#include <unistd.h>
+
+#include "libretro.h"
+
+#define MAX_THREADS 16
+
+static struct
+{
+   void (*set_environment)(retro_environment_t);
+   void (*set_video_refresh)(retro_video_refresh_t);
+   void (*set_audio_sample)(retro_audio_sample_t);
+   void (*set_audio_sample_batch)(retro_audio_sample_batch_t);
+   void (*set_input_poll)(retro_input_poll_t);
+   void (*set_input_state)(retro_input_state_t);
+   void (*init)(void);
+   void (*deinit)(void);
+   bool (*load_game)(const struct retro_game_info *);
+   void (*unload_game)(void);
+   void (*run)(void);
+   size_t (*serialize_size)(void);
+   bool (*serialize)(void *, size_t);
+   void *(*instance_create)(void);
+   void (*instance_select)(void *);
+} core;
+
+/* What the host knows about the instance it is driving on this thread. */
+struct instance
+{
+   void *handle;
+   unsigned seed;
+   unsigned frame;
+   uint32_t hash;
+   unsigned samples;
+   retro_audio_callback_t audio_cb;
+   /* Turns on test_sram_flush into this directory when set. */
+   const char *save_dir;
+};
+
+static __thread struct instance *current;
+
+static void log_quiet(enum retro_log_level level, const char *fmt, ...)
+{
+   (void)level;
+   (void)fmt;
+}
+
+static bool environment(unsigned cmd, void *data)
+{
+   switch (cmd)
+   {
+      case RETRO_ENVIRONMENT_SET_PIXEL_FORMAT:
+         return *(const enum retro_pixel_format*)data == RETRO_PIXEL_FORMAT_XRGB8888;
+      case RETRO_ENVIRONMENT_GET_LOG_INTERFACE:
+         ((struct retro_log_callback*)data)->log = log_quiet;
+         return true;
+      case RETRO_ENVIRONMENT_GET_SAVE_DIRECTORY:
+         *(const char**)data = current->save_dir;
+         return current->save_dir != NULL;
+      case RETRO_ENVIRONMENT_GET_VARIABLE:
+      {
+         struct retro_variable *var = data;
+         if (!current->save_dir || strcmp(var->key, "test_sram_flush"))
+            return false;
+         var->value = "true";
+         return true;
+      }
+      case RETRO_ENVIRONMENT_SET_AUDIO_CALLBACK:
+         current->audio_cb = ((const struct retro_audio_callback*)data)->callback;
+         return true;
+      default:
+         return false;
+   }
+}
+
+static void video_refresh(const void *data, unsigned width, unsigned height, size_t pitch)
+{
+   const uint8_t *row = data;
+   uint32_t hash = current->hash;
+
+   for (unsigned y = 0; y < height; y++, row += pitch)
+      for (unsigned x = 0; x < width * 4; x++)
+         hash = (hash ^ row[x]) * 16777619u;
+
+   current->hash = hash;
+}
+
+static void audio_sample(int16_t left, int16_t right)
+{
+   (void)left;
+   (void)right;
+   current->samples++;
+}
+
+static size_t audio_sample_batch(const int16_t *data, size_t frames)
+{
+   (void)data;
+   current->samples += frames;
+   return frames;
+}
+
+static void input_poll(void)
+{
+}
+
+/* Every instance scrolls in its own pattern. */
+static int16_t input_state(unsigned port, unsigned device, unsigned index, unsigned id)
+{
+   unsigned frame = current->frame;
+   unsigned seed = current->seed;
+
+   if (port || device != RETRO_DEVICE_JOYPAD || index)
+      return 0;
+   if (id == RETRO_DEVICE_ID_JOYPAD_RIGHT)
+      return (frame * seed) % 3 == 0;
+   if (id == RETRO_DEVICE_ID_JOYPAD_DOWN)
+      return (frame + seed) % 5 == 0;
+   return 0;
+}
+
+static void instance_start(struct instance *inst, unsigned seed, const char *save_dir)
+{
+   memset(inst, 0, sizeof(*inst));
+   inst->seed = seed;
+   inst->save_dir = save_dir;
+   inst->hash = 2166136261u;
+   current = inst;
+
+   inst->handle = core.instance_create();
+   if (!inst->handle)
+   {
+      fprintf(stderr, "Out of core instances.\n");
+      exit(1);
+   }
+
+   core.instance_select(inst->handle);
+   core.set_environment(environment);
+   core.set_video_refresh(video_refresh);
+   core.set_audio_sample(audio_sample);
+   core.set_audio_sample_batch(audio_sample_batch);
+   core.set_input_poll(input_poll);
+   core.set_input_state(input_state);
+   core.init();
+   if (!core.load_game(NULL))
+   {
+      fprintf(stderr, "retro_load_game failed.\n");
+      exit(1);
+   }
+}
+
+static void instance_run(struct instance *inst, unsigned frames)
+{
+   current = inst;
+   core.instance_select(inst->handle);
+
+   for (unsigned i = 0; i < frames; i++, inst->frame++)
+   {
+      core.run();
+      inst->audio_cb();
+   }
+}
+
+static uint64_t instance_finish(struct instance *inst)
+{
+   uint8_t state[64] = {0};
+   uint64_t result;
+
+   current = inst;
+   core.instance_select(inst->handle);
+   core.serialize(state, core.serialize_size());
+   core.unload_game();
+   core.deinit();
+   core.instance_select(NULL);
+
+   result = inst->hash;
+   for (size_t i = 0; i < core.serialize_size(); i++)
+      result = (result ^ state[i]) * 1099511628211ull;
+   return result ^ ((uint64_t)inst->samples << 32);
+}
+
+static uint64_t reference(unsigned seed, unsigned frames)
+{
+   struct instance inst;
+   instance_start(&inst, seed, NULL);
+   instance_run(&inst, frames);
+   return instance_finish(&inst);
+}
+
+/* Samples of the instances in the callback check, by instance. */
+static unsigned routed[2];
+
+static void audio_sample_0(int16_t left, int16_t right)
+{
+   (void)left;
+   (void)right;
+   routed[0]++;
+}
+
+static void audio_sample_1(int16_t left, int16_t right)
+{
+   (void)left;
+   (void)right;
+   routed[1]++;
+}
+
+static void *audio_thread(void *data)
+{
+   ((struct instance*)data)->audio_cb();
+   return NULL;
+}
+
+/* Invokes the audio callback of each instance from a frontend thread which
+ * has no instance selected, and checks that only its owner produced audio. */
+static bool check_callbacks(void)
+{
+   struct instance inst[2];
+   bool ok = true;
+
+   instance_start(&inst[0], 1, NULL);
+   core.set_audio_sample(audio_sample_0);
+   instance_start(&inst[1], 2, NULL);
+   core.set_audio_sample(audio_sample_1);
+
+   for (unsigned i = 0; i < 2; i++)
+   {
+      pthread_t thread;
+      unsigned before[2] = { routed[0], routed[1] };
+
+      pthread_create(&thread, NULL, audio_thread, &inst[i]);
+      pthread_join(thread, NULL);
+      if (routed[i] == before[i] || routed[!i] != before[!i])
+         ok = false;
+   }
+
+   instance_finish(&inst[0]);
+   instance_finish(&inst[1]);
+   return ok;
+}
+
+/* Reads the first bytes of every ram1 save in a directory, returns how many
+ * there were. */
+static unsigned read_saves(const char *dir, uint8_t saves[][8], unsigned max)
+{
+   unsigned count = 0;
+   DIR *d = opendir(dir);
+   struct dirent *entry;
+
+   while (d && (entry = readdir(d)))
+   {
+      size_t len = strlen(entry->d_name);
+      char path[1024];
+      FILE *file;
+
+      if (len < 5 || strcmp(entry->d_name + len - 5, ".ram1") || count == max)
+         continue;
+      snprintf(path, sizeof(path), "%s/%s", dir, entry->d_name);
+      if (!(file = fopen(path, "rb")))
+         continue;
+      if (fread(saves[count], 1, sizeof(saves[count]), file) == sizeof(saves[count]))
+         count++;
+      fclose(file);
+   }
+   if (d)
+      closedir(d);
+   return count;
+}
+
+static void remove_dir(const char *dir)
+{
+   DIR *d = opendir(dir);
+   struct dirent *entry;
+
+   while (d && (entry = readdir(d)))
+   {
+      char path[1024];
+      if (entry->d_name[0] == '.')
+         continue;
+      snprintf(path, sizeof(path), "%s/%s", dir, entry->d_name);
+      unlink(path);
+   }
+   if (d)
+      closedir(d);
+   rmdir(dir);
+}
+
+/* Two instances writing SRAM into the same save directory, which must end up
+ * with a save of each. */
+static bool check_saves(unsigned frames)
+{
+   char dir[] = "/tmp/test-instances.XXXXXX";
+   struct instance inst[2];
+   uint8_t saves[3][8];
+   bool ok;
+
+   if (!mkdtemp(dir))
+      return false;
+
+   /* The saves hold the frame counter, which differs. */
+   instance_start(&inst[0], 1, dir);
+   instance_start(&inst[1], 2, dir);
+   instance_run(&inst[0], frames);
+   instance_run(&inst[1], frames + 1);
+   instance_finish(&inst[0]);
+   instance_finish(&inst[1]);
+
+   ok = read_saves(dir, saves, 3) == 2 && memcmp(saves[0], saves[1], sizeof(saves[0]));
+   remove_dir(dir);
+   return ok;
+}
+
+struct worker
+{
+   pthread_t thread;
+   unsigned seed;
+   unsigned frames;
+   uint64_t result;
+};
+
+static void *worker_main(void *data)
+{
+   struct worker *w = data;
+   struct instance inst;
+
+   instance_start(&inst, w->seed, NULL);
+   instance_run(&inst, w->frames);
+   w->result = instance_finish(&inst);
+   return NULL;
+}
+
+static double now(void)
+{
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void *sym(void *lib, const char *name)
+{
+   void *ptr = dlsym(lib, name);
+   if (!ptr)
+   {
+      fprintf(stderr, "Missing symbol %s.\n", name);
+      exit(1);
+   }
+   return ptr;
+}
+
+int main(int argc, char *argv[])
+{
+   if (argc < 2)
+   {
+      fprintf(stderr, "Usage: %s core [threads] [frames]\n", argv[0]);
+      return 1;
+   }
+
+   unsigned max_threads = argc > 2 ? strtoul(argv[2], NULL, 0) : 8;
+   unsigned frames = argc > 3 ? strtoul(argv[3], NULL, 0) : 600;
+   if (max_threads < 1 || max_threads > MAX_THREADS)
+      max_threads = MAX_THREADS;
+
+   void *lib = dlopen(argv[1], RTLD_NOW | RTLD_LOCAL);
+   if (!lib)
+   {
+      fprintf(stderr, "%s\n", dlerror());
+      return 1;
+   }
+
+   *(void**)&core.set_environment = sym(lib, "retro_set_environment");
+   *(void**)&core.set_video_refresh = sym(lib, "retro_set_video_refresh");
+   *(void**)&core.set_audio_sample = sym(lib, "retro_set_audio_sample");
+   *(void**)&core.set_audio_sample_batch = sym(lib, "retro_set_audio_sample_batch");
+   *(void**)&core.set_input_poll = sym(lib, "retro_set_input_poll");
+   *(void**)&core.set_input_state = sym(lib, "retro_set_input_state");
+   *(void**)&core.init = sym(lib, "retro_init");
+   *(void**)&core.deinit = sym(lib, "retro_deinit");
+   *(void**)&core.load_game = sym(lib, "retro_load_game");
+   *(void**)&core.unload_game = sym(lib, "retro_unload_game");
+   *(void**)&core.run = sym(lib, "retro_run");
+   *(void**)&core.serialize_size = sym(lib, "retro_serialize_size");
+   *(void**)&core.serialize = sym(lib, "retro_serialize");
+   *(void**)&core.instance_create = sym(lib, "retro_test_instance_create");
+   *(void**)&core.instance_select = sym(lib, "retro_test_instance_select");
+
+   uint64_t expected[MAX_THREADS];
+   for (unsigned i = 0; i < max_threads || i < 2; i++)
+      expected[i] = reference(i + 1, frames);
+
+   int failed = 0;
+
+   if (!check_callbacks())
+   {
+      fprintf(stderr, "Audio callback reached the wrong instance.\n");
+      failed = 1;
+   }
+
+   if (!check_saves(frames))
+   {
+      fprintf(stderr, "Instances in one save directory did not keep separate saves.\n");
+      failed = 1;
+   }
+
+   /* Two instances interleaved on one thread, a few frames at a time. */
+   struct instance a, b;
+   instance_start(&a, 1, NULL);
+   instance_start(&b, 2, NULL);
+   for (unsigned i = 0; i < frames; i += 7)
+   {
+      unsigned n = frames - i < 7 ? frames - i : 7;
+      instance_run(&a, n);
+      instance_run(&b, n);
+   }
+   if (instance_finish(&a) != expected[0] || instance_finish(&b) != expected[1])
+   {
+      fprintf(stderr, "Interleaved instances on one thread diverged.\n");
+      failed = 1;
+   }
+
+   printf("%-8s %12s %10s\n", "threads", "frames/s", "scaling");
+
+   double base = 0.0;
+   for (unsigned threads = 1; threads <= max_threads; threads++)
+   {
+      struct worker workers[MAX_THREADS];
+
+      double start = now();
+      for (unsigned i = 0; i < threads; i++)
+      {
+         workers[i].seed = i + 1;
+         workers[i].frames = frames;
+         pthread_create(&workers[i].thread, NULL, worker_main, &workers[i]);
+      }
+      for (unsigned i = 0; i < threads; i++)
+         pthread_join(workers[i].thread, NULL);
+      double fps = threads * frames / (now() - start);
+
+      for (unsigned i = 0; i < threads; i++)
+      {
+         if (workers[i].result != expected[i])
+         {
+            fprintf(stderr, "Instance %u of %u diverged.\n", i + 1, threads);
+            failed = 1;
+         }
+      }
+
+      if (threads == 1)
+         base = fps;
+      printf("%-8u %12.0f %9.2fx\n", threads, fps, fps / base);
+   }
+
+   dlclose(lib);
+   return failed;
+}
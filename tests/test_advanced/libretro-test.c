@@ -51,15 +51,21 @@ static int groupsizes[]={5,2,1,1};
 #include <math.h>
 #define PI 3.14159265358979323846
 
+#ifdef RARCH_INTERNAL
+#define TEST_ADVANCED_CORE_PREFIX(s) libretro_advanced_tests_##s
+#else
+#define TEST_ADVANCED_CORE_PREFIX(s) s
+#endif
+
 static retro_log_printf_t log_cb;
 static void log_null(enum retro_log_level level, const char *fmt, ...) {}
 
-retro_environment_t environ_cb = NULL;
-retro_video_refresh_t video_cb = NULL;
-retro_audio_sample_t audio_cb = NULL;
-retro_audio_sample_batch_t audio_batch_cb = NULL;
-retro_input_poll_t poller_cb = NULL;
-retro_input_state_t input_state_cb = NULL;
+static retro_environment_t environ_cb = NULL;
+static retro_video_refresh_t video_cb = NULL;
+static retro_audio_sample_t audio_cb = NULL;
+static retro_audio_sample_batch_t audio_batch_cb = NULL;
+static retro_input_poll_t poller_cb = NULL;
+static retro_input_state_t input_state_cb = NULL;
 
 static struct
 {
@@ -74,17 +80,17 @@ static struct
    uint16_t test4a[28*3];
 } state;
 
-uint16_t inpstate[2];
-bool sound_enable;
-pixel_t pixels[240*320];
+static uint16_t inpstate[2];
+static bool sound_enable;
+static pixel_t pixels[240*320];
 
-void renderchr(pixel_t col, int chr, int x, int y);
-void renderstr(pixel_t col, const char * str, int x, int y);
-unsigned long crc32_calc(unsigned char *ptr, unsigned cnt, unsigned long crc);
+static void renderchr(pixel_t col, int chr, int x, int y);
+static void renderstr(pixel_t col, const char * str, int x, int y);
+static unsigned long crc32_calc(unsigned char *ptr, unsigned cnt, unsigned long crc);
 
 #if defined(__unix__)
 #include <time.h>
-uint64_t cpu_features_get_time_usec()
+static uint64_t cpu_features_get_time_usec()
 {
    struct timespec ts;
    clock_gettime(CLOCK_MONOTONIC, &ts);
@@ -93,7 +99,7 @@ uint64_t cpu_features_get_time_usec()
 
 #elif defined(_WIN32)
 #include <windows.h>
-uint64_t cpu_features_get_time_usec()
+static uint64_t cpu_features_get_time_usec()
 {
    static LARGE_INTEGER freq = {};
    if (!freq.QuadPart) QueryPerformanceFrequency(&freq);
@@ -103,7 +109,7 @@ uint64_t cpu_features_get_time_usec()
    return count.QuadPart * 1000000 / freq.QuadPart;
 }
 #else
-uint64_t cpu_features_get_time_usec()
+static uint64_t cpu_features_get_time_usec()
 {
    static uint64_t last = 0;
    last += 1000000;
@@ -356,26 +362,32 @@ static void test4a(void)
    }
 }
 
-void retro_set_video_refresh(retro_video_refresh_t cb) { video_cb = cb; }
-void retro_set_audio_sample(retro_audio_sample_t cb) { audio_cb = cb; }
-void retro_set_audio_sample_batch(retro_audio_sample_batch_t cb) { audio_batch_cb = cb; }
-void retro_set_input_poll(retro_input_poll_t cb) { poller_cb = cb; }
-void retro_set_input_state(retro_input_state_t cb) { input_state_cb = cb; }
+void TEST_ADVANCED_CORE_PREFIX(retro_set_video_refresh)(retro_video_refresh_t cb) { video_cb = cb; }
+void TEST_ADVANCED_CORE_PREFIX(retro_set_audio_sample)(retro_audio_sample_t cb) { audio_cb = cb; }
+void TEST_ADVANCED_CORE_PREFIX(retro_set_audio_sample_batch)(retro_audio_sample_batch_t cb) { audio_batch_cb = cb; }
+void TEST_ADVANCED_CORE_PREFIX(retro_set_input_poll)(retro_input_poll_t cb) { poller_cb = cb; }
+void TEST_ADVANCED_CORE_PREFIX(retro_set_input_state)(retro_input_state_t cb) { input_state_cb = cb; }
 
-void retro_set_environment(retro_environment_t cb)
+void TEST_ADVANCED_CORE_PREFIX(retro_set_environment)(retro_environment_t cb)
 {
    environ_cb = cb;
 
    bool True = true;
    environ_cb(RETRO_ENVIRONMENT_SET_SUPPORT_NO_GAME, &True);
 
+   static const struct retro_variable vars[] = {
+      { "test_advanced_state_compression", "Compressed savestates (delta + LZ, applies on load); disabled|enabled" },
+      { NULL, NULL },
+   };
+   environ_cb(RETRO_ENVIRONMENT_SET_VARIABLES, (void*)vars);
+
 #if 0
    environ_cb(RETRO_ENVIRONMENT_SET_FRAME_TIME_CALLBACK, &frametime_g);
    environ_cb(RETRO_ENVIRONMENT_GET_PERF_INTERFACE, &perf);
 #endif
 }
 
-void retro_init(void)
+void TEST_ADVANCED_CORE_PREFIX(retro_init)(void)
 {
    struct retro_log_callback log;
    if (environ_cb(RETRO_ENVIRONMENT_GET_LOG_INTERFACE, &log))
@@ -387,16 +399,16 @@ void retro_init(void)
    log_cb(RETRO_LOG_DEBUG, "%.3i%c t%st", 12, '3', "es");
 }
 
-void retro_deinit(void) {}
-unsigned retro_api_version(void) { return RETRO_API_VERSION; }
+void TEST_ADVANCED_CORE_PREFIX(retro_deinit)(void) {}
+unsigned TEST_ADVANCED_CORE_PREFIX(retro_api_version)(void) { return RETRO_API_VERSION; }
 
-void retro_get_system_info(struct retro_system_info *info)
+void TEST_ADVANCED_CORE_PREFIX(retro_get_system_info)(struct retro_system_info *info)
 {
    const struct retro_system_info myinfo = { "minir test core", "v1.00", "c|h", false, false };
    memcpy(info, &myinfo, sizeof(myinfo));
 }
 
-void retro_get_system_av_info(struct retro_system_av_info* info)
+void TEST_ADVANCED_CORE_PREFIX(retro_get_system_av_info)(struct retro_system_av_info* info)
 {
    static const struct retro_system_av_info myinfo = {
       { 320, 240, 320, 240, 0.0 },
@@ -405,16 +417,16 @@ void retro_get_system_av_info(struct retro_system_av_info* info)
    memcpy(info, &myinfo, sizeof(myinfo));
 }
 
-void retro_set_controller_port_device(unsigned port, unsigned device) {}
+void TEST_ADVANCED_CORE_PREFIX(retro_set_controller_port_device)(unsigned port, unsigned device) {}
 
-void retro_reset(void)
+void TEST_ADVANCED_CORE_PREFIX(retro_reset)(void)
 {
    memset(&state, 0, sizeof(state));
    state.testgroup = init_grp;
    state.testsub = init_sub;
 }
 
-void retro_run(void)
+void TEST_ADVANCED_CORE_PREFIX(retro_run)(void)
 {
    unsigned i;
 
@@ -538,37 +550,290 @@ void retro_run(void)
    video_cb(pixels, 320, 240, sizeof(pixel_t)*320);
 }
 
-size_t retro_serialize_size(void) { return sizeof(state); }
-bool retro_serialize(void* data, size_t size)
+/* Compressed savestates, for hosts keeping many snapshots around (rewind).
+ * Every STATE_KEY_INTERVAL-th snapshot is a keyframe and self-contained; the core
+ * keeps the last STATE_KEYS keyframes, and the snapshots in between are XORed
+ * against the latest one. The result is mostly zero bytes, which are then packed
+ * with a small LZ77 coder. The keyframes only exist in this process, so a delta
+ * can only be loaded by the instance which saved it, and only while its keyframe
+ * has not been evicted, i.e. within STATE_KEYS*STATE_KEY_INTERVAL snapshots.
+ * Anything else is rejected. That rules out netplay, which sends states to
+ * other machines, and save files.
+ *
+ * The option is read once when the game is loaded, since retro_serialize_size
+ * must not change while the game runs. */
+#define STATE_MAGIC 0x5A444154 /* "TADZ" */
+#define STATE_KEY_INTERVAL 64
+#define STATE_KEYS 16
+#define LZ_BOUND(n) ((n) + (n)/255 + 16)
+#define LZ_HASH_BITS 12
+#define LZ_MIN_MATCH 4
+
+struct state_header
+{
+   uint32_t magic;
+   uint32_t key_id; /* 0 if this snapshot is a keyframe */
+   uint32_t key_crc;
+   uint32_t packed_size;
+};
+
+static bool state_compress;
+static uint32_t state_snapshots;
+static struct
+{
+   uint32_t id;
+   uint32_t crc;
+   uint8_t data[sizeof(state)];
+} state_keys[STATE_KEYS];
+static int state_key_last = -1;
+
+static struct
+{
+   unsigned count;
+   uint64_t raw_bytes;
+   uint64_t packed_bytes;
+   uint64_t encode_usec;
+   uint64_t decode_usec;
+   unsigned decodes;
+} state_stats;
+
+static uint32_t lz_hash(const uint8_t *p)
+{
+   uint32_t v;
+   memcpy(&v, p, 4);
+   return (v*2654435761U) >> (32-LZ_HASH_BITS);
+}
+
+static uint8_t *lz_put_len(uint8_t *op, size_t len)
+{
+   for (;len>=255;len-=255) *op++ = 255;
+   *op++ = (uint8_t)len;
+   return op;
+}
+
+static uint8_t *lz_put_seq(uint8_t *op, const uint8_t *lit, size_t nlit, size_t offset, size_t mlen)
+{
+   uint8_t *token = op++;
+   *token = (nlit>=15 ? 15 : nlit) << 4;
+   if (nlit>=15) op = lz_put_len(op, nlit-15);
+   memcpy(op, lit, nlit);
+   op += nlit;
+   if (!mlen) return op;
+
+   *op++ = offset & 0xFF;
+   *op++ = offset >> 8;
+   mlen -= LZ_MIN_MATCH;
+   *token |= (mlen>=15 ? 15 : mlen);
+   if (mlen>=15) op = lz_put_len(op, mlen-15);
+   return op;
+}
+
+static size_t lz_compress(const uint8_t *src, size_t len, uint8_t *dst)
+{
+   int32_t table[1<<LZ_HASH_BITS];
+   size_t ip = 0;
+   size_t anchor = 0;
+   uint8_t *op = dst;
+
+   memset(table, 0xFF, sizeof(table));
+   while (ip+LZ_MIN_MATCH <= len)
+   {
+      uint32_t h = lz_hash(src+ip);
+      int32_t ref = table[h];
+      size_t mlen = LZ_MIN_MATCH;
+
+      table[h] = (int32_t)ip;
+      if (ref<0 || ip-ref > 0xFFFF || memcmp(src+ref, src+ip, LZ_MIN_MATCH))
+      {
+         ip++;
+         continue;
+      }
+
+      while (ip+mlen < len && src[ref+mlen] == src[ip+mlen]) mlen++;
+      op = lz_put_seq(op, src+anchor, ip-anchor, ip-ref, mlen);
+      ip += mlen;
+      anchor = ip;
+   }
+   op = lz_put_seq(op, src+anchor, len-anchor, 0, 0);
+   return op-dst;
+}
+
+static bool lz_get_len(const uint8_t **ip, const uint8_t *end, size_t *len)
 {
+   uint8_t b;
+   do
+   {
+      if (*ip >= end) return false;
+      b = *(*ip)++;
+      *len += b;
+   } while (b == 255);
+   return true;
+}
+
+static bool lz_decompress(const uint8_t *src, size_t len, uint8_t *dst, size_t dst_len)
+{
+   const uint8_t *ip = src;
+   const uint8_t *end = src+len;
+   size_t op = 0;
+
+   while (ip < end)
+   {
+      uint8_t token = *ip++;
+      size_t nlit = token >> 4;
+      size_t mlen = token & 15;
+      size_t offset;
+
+      if (nlit==15 && !lz_get_len(&ip, end, &nlit)) return false;
+      if (nlit > (size_t)(end-ip) || nlit > dst_len-op) return false;
+      memcpy(dst+op, ip, nlit);
+      ip += nlit;
+      op += nlit;
+      if (ip == end) break;
+
+      if (end-ip < 2) return false;
+      offset = ip[0] | (ip[1]<<8);
+      ip += 2;
+      if (mlen==15 && !lz_get_len(&ip, end, &mlen)) return false;
+      mlen += LZ_MIN_MATCH;
+      if (!offset || offset > op || mlen > dst_len-op) return false;
+
+      /* Byte by byte, the source may overlap what we are writing. */
+      for (;mlen;mlen--,op++) dst[op] = dst[op-offset];
+   }
+   return op == dst_len;
+}
+
+static void state_report(void)
+{
+   if (++state_stats.count < 256) return;
+
+   log_cb(RETRO_LOG_INFO, "Savestates: ratio %.2f:1, encode %.2f usec, decode %.2f usec (%u bytes raw).\n",
+         (double)state_stats.raw_bytes / state_stats.packed_bytes,
+         (double)state_stats.encode_usec / state_stats.count,
+         state_stats.decodes ? (double)state_stats.decode_usec / state_stats.decodes : 0.0,
+         (unsigned)sizeof(state));
+   memset(&state_stats, 0, sizeof(state_stats));
+}
+
+static bool state_pack(uint8_t *data, size_t size)
+{
+   struct state_header hdr;
+   uint8_t delta[sizeof(state)];
+   uint64_t start = cpu_features_get_time_usec();
+   unsigned i;
+
+   if (size < sizeof(hdr)+LZ_BOUND(sizeof(state))) return false;
+
+   memcpy(delta, &state, sizeof(state));
+   hdr.magic = STATE_MAGIC;
+   hdr.key_id = 0;
+   hdr.key_crc = 0;
+
+   if (state_key_last<0 || state_snapshots%STATE_KEY_INTERVAL == 0)
+   {
+      state_key_last = (state_key_last+1) % STATE_KEYS;
+      state_keys[state_key_last].id = state_snapshots+1;
+      state_keys[state_key_last].crc = crc32_calc(delta, sizeof(delta), ~0U);
+      memcpy(state_keys[state_key_last].data, delta, sizeof(delta));
+   }
+   else
+   {
+      hdr.key_id = state_keys[state_key_last].id;
+      hdr.key_crc = state_keys[state_key_last].crc;
+      for (i=0;i<sizeof(delta);i++) delta[i] ^= state_keys[state_key_last].data[i];
+   }
+   state_snapshots++;
+
+   hdr.packed_size = lz_compress(delta, sizeof(delta), data+sizeof(hdr));
+   memcpy(data, &hdr, sizeof(hdr));
+
+   state_stats.encode_usec += cpu_features_get_time_usec()-start;
+   state_stats.raw_bytes += sizeof(state);
+   state_stats.packed_bytes += sizeof(hdr)+hdr.packed_size;
+   state_report();
+   return true;
+}
+
+static bool state_unpack(const uint8_t *data, size_t size)
+{
+   struct state_header hdr;
+   uint8_t delta[sizeof(state)];
+   uint64_t start = cpu_features_get_time_usec();
+   unsigned i, key;
+
+   memcpy(&hdr, data, sizeof(hdr));
+   if (hdr.packed_size > size-sizeof(hdr)) return false;
+   if (!lz_decompress(data+sizeof(hdr), hdr.packed_size, delta, sizeof(delta))) return false;
+
+   if (hdr.key_id)
+   {
+      for (key=0;key<STATE_KEYS;key++)
+      {
+         if (state_keys[key].id == hdr.key_id && state_keys[key].crc == hdr.key_crc) break;
+      }
+      if (key == STATE_KEYS)
+      {
+         log_cb(RETRO_LOG_WARN, "Savestate keyframe %u is no longer available.\n", hdr.key_id);
+         return false;
+      }
+      for (i=0;i<sizeof(delta);i++) delta[i] ^= state_keys[key].data[i];
+   }
+   memcpy(&state, delta, sizeof(state));
+
+   state_stats.decode_usec += cpu_features_get_time_usec()-start;
+   state_stats.decodes++;
+   return true;
+}
+
+static void state_read_option(void)
+{
+   struct retro_variable var = { "test_advanced_state_compression", NULL };
+   state_compress = environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value && !strcmp(var.value, "enabled");
+}
+
+size_t TEST_ADVANCED_CORE_PREFIX(retro_serialize_size)(void)
+{
+   if (state_compress) return sizeof(struct state_header)+LZ_BOUND(sizeof(state));
+   return sizeof(state);
+}
+bool TEST_ADVANCED_CORE_PREFIX(retro_serialize)(void* data, size_t size)
+{
+   if (state_compress) return state_pack(data, size);
    if (size<sizeof(state)) return false;
    memcpy(data, &state, sizeof(state));
    return true;
 }
-bool retro_unserialize(const void* data, size_t size)
+bool TEST_ADVANCED_CORE_PREFIX(retro_unserialize)(const void* data, size_t size)
 {
+   uint32_t magic;
+   if (size>=sizeof(struct state_header))
+   {
+      memcpy(&magic, data, sizeof(magic));
+      if (magic == STATE_MAGIC) return state_unpack(data, size);
+   }
    if (size<sizeof(state)) return false;
    memcpy(&state, data, sizeof(state));
    return true;
 }
 
-void retro_cheat_reset(void) {}
-void retro_cheat_set(unsigned index, bool enabled, const char* code) {}
-bool retro_load_game(const struct retro_game_info* game)
+void TEST_ADVANCED_CORE_PREFIX(retro_cheat_reset)(void) {}
+void TEST_ADVANCED_CORE_PREFIX(retro_cheat_set)(unsigned index, bool enabled, const char* code) {}
+bool TEST_ADVANCED_CORE_PREFIX(retro_load_game)(const struct retro_game_info* game)
 {
-   retro_reset();
+   TEST_ADVANCED_CORE_PREFIX(retro_reset)();
    enum retro_pixel_format rgb565=(enum retro_pixel_format)PIXFMT;
    if (!environ_cb(RETRO_ENVIRONMENT_SET_PIXEL_FORMAT, &rgb565)) return false;
+   state_read_option();
    return true;
 }
-bool retro_load_game_special(unsigned game_type, const struct retro_game_info* info, size_t num_info) { return false; }
-void retro_unload_game(void) {}
-unsigned retro_get_region(void) { return RETRO_REGION_NTSC; }
-void* retro_get_memory_data(unsigned id) { return NULL; }
-size_t retro_get_memory_size(unsigned id) { return 0; }
+bool TEST_ADVANCED_CORE_PREFIX(retro_load_game_special)(unsigned game_type, const struct retro_game_info* info, size_t num_info) { return false; }
+void TEST_ADVANCED_CORE_PREFIX(retro_unload_game)(void) {}
+unsigned TEST_ADVANCED_CORE_PREFIX(retro_get_region)(void) { return RETRO_REGION_NTSC; }
+void* TEST_ADVANCED_CORE_PREFIX(retro_get_memory_data)(unsigned id) { return NULL; }
+size_t TEST_ADVANCED_CORE_PREFIX(retro_get_memory_size)(unsigned id) { return 0; }
 
 /* blatant zsnes copypasta */
-unsigned char zfont[]={
+static unsigned char zfont[]={
 0,0,0,0,0,
 0x70,0x98,0xA8,0xC8,0x70, 0x20,0x60,0x20,0x20,0x70, 0x70,0x88,0x30,0x40,0xF8, 0x70,0x88,0x30,0x88,0x70,
 0x50,0x90,0xF8,0x10,0x10, 0xF8,0x80,0xF0,0x08,0xF0, 0x70,0x80,0xF0,0x88,0x70, 0xF8,0x08,0x10,0x10,0x10,
@@ -592,7 +857,7 @@ unsigned char zfont[]={
 0xF8,0x88,0x88,0x88,0xF8,
 };
 
-unsigned char convtable[256]={
+static unsigned char convtable[256]={
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,
 0x00,0x3E,0x33,0x31,0x3F,0x37,0x2F,0x3D,0x3A,0x3B,0x35,0x38,0x39,0x25,0x28,0x29,
@@ -611,7 +876,7 @@ unsigned char convtable[256]={
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x4C,0x4B,0x4A,0x45,0x46,0x47,0x48,0x49,
 };
 
-void renderchr(pixel_t col, int chr, int x, int y)
+static void renderchr(pixel_t col, int chr, int x, int y)
 {
    int ix;
    int iy;
@@ -626,7 +891,7 @@ void renderchr(pixel_t col, int chr, int x, int y)
    }
 }
 
-void renderstr(pixel_t col, const char * str, int x, int y)
+static void renderstr(pixel_t col, const char * str, int x, int y)
 {
    int i;
    for (i=0;str[i];i++)
@@ -638,14 +903,14 @@ void renderstr(pixel_t col, const char * str, int x, int y)
  * http://www.geocities.ws/malbrain/
  */
 
-unsigned long Crc32[] = {
+static unsigned long Crc32[] = {
 0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac,
 0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
 0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c,
 0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c
 };
 
-unsigned long crc32_calc (unsigned char *ptr, unsigned cnt, unsigned long crc)
+static unsigned long crc32_calc (unsigned char *ptr, unsigned cnt, unsigned long crc)
 {
     while( cnt-- ) {
         crc = ( crc >> 4 ) ^ Crc32[(crc & 0xf) ^ (*ptr & 0xf)];
@@ -0,0 +1,133 @@
+#include "box_collision.hpp"
+
+using namespace std;
+using namespace glm;
+
+namespace BoxCollision
+{
+   static inline float grid_unorm(uint32_t h)
+   {
+      return float(h >> 8) * (1.0f / 16777216.0f);
+   }
+
+   Instance grid_instance(const Grid& grid, uint32_t index)
+   {
+      uint32_t dim = grid.dim();
+      ivec3 id(index % dim, (index / dim) % dim, index / (dim * dim));
+      vec3 cell = vec3(id - ivec3(grid.base));
+
+      uint32_t h0 = grid_hash(index ^ (grid.seed * 0x9e3779b9u));
+      uint32_t h1 = grid_hash(h0);
+      uint32_t h2 = grid_hash(h1);
+      vec3 vel = (vec3(grid_unorm(h0), grid_unorm(h1), grid_unorm(h2)) * 2.0f - 1.0f) * grid.jitter;
+
+      return { vec4(cell * grid.spacing, grid.radius), vec4(vel, 0.0f) };
+   }
+
+   bool integrate(Instance& instance, uint32_t index, const Camera& camera,
+         uint32_t frame, bool amortized)
+   {
+      if (amortized && !physics_due(index, physics_period(instance, camera), frame))
+         return false;
+
+      vec3 dist = vec3(instance.pos) - camera.pos;
+      float dist_len_sq = dot(dist, dist);
+
+      uint32_t elapsed = (frame - uint32_t(instance.vel.w)) & PhysicsStampMask;
+      float delta_time = camera.delta_time * float(std::min<uint32_t>(elapsed, PhysicsMaxPeriod));
+
+      vec3 pos = vec3(instance.pos);
+      vec3 vel = vec3(instance.vel);
+      vec3 accel_neg = 20000.0f * -normalize(dist) / (dot(dist, dist) + 0.001f);
+      pos += delta_time * vel;
+      vel += delta_time * accel_neg;
+
+      vec3 rel_vel = vel - camera.vel;
+      if (dist_len_sq < 10.0f && dot(rel_vel, dist) < 0.0f)
+         vel = reflect(rel_vel, normalize(dist)) + camera.vel;
+
+      instance.pos = vec4(pos, instance.pos.w);
+      instance.vel = vec4(vel, float(frame & PhysicsStampMask));
+      return true;
+   }
+
+   unsigned Reference::resolve(const vector<Instance>& in, vector<Instance>& out)
+   {
+      cell_count.assign(HashCells, 0);
+      cell_start.resize(HashCells);
+      sorted.resize(in.size());
+      out.resize(in.size());
+
+      vector<uint32_t> instance_cell(in.size());
+      for (size_t i = 0; i < in.size(); i++)
+      {
+         instance_cell[i] = cell_hash(cell_coord(vec3(in[i].pos)));
+         cell_count[instance_cell[i]]++;
+      }
+
+      uint32_t sum = 0;
+      for (unsigned i = 0; i < HashCells; i++)
+      {
+         cell_start[i] = sum;
+         sum += cell_count[i];
+      }
+
+      for (size_t i = 0; i < in.size(); i++)
+      {
+         uint32_t cell = instance_cell[i];
+         sorted[cell_start[cell] + --cell_count[cell]] = i;
+      }
+
+      unsigned contacts = 0;
+      for (size_t i = 0; i < in.size(); i++)
+      {
+         Instance self = in[i];
+         ivec3 base = cell_coord(vec3(self.pos));
+
+         vec3 push(0.0f);
+         vec3 impulse(0.0f);
+         uint32_t visited[27];
+         unsigned num_visited = 0;
+
+         for (int z = -1; z <= 1; z++)
+            for (int y = -1; y <= 1; y++)
+               for (int x = -1; x <= 1; x++)
+               {
+                  uint32_t cell = cell_hash(base + ivec3(x, y, z));
+                  if (find(visited, visited + num_visited, cell) != visited + num_visited)
+                     continue;
+                  visited[num_visited++] = cell;
+
+                  uint32_t end = cell + 1 < HashCells ? cell_start[cell + 1] : uint32_t(in.size());
+                  for (uint32_t j = cell_start[cell]; j < end; j++)
+                  {
+                     uint32_t other_index = sorted[j];
+                     if (other_index == i)
+                        continue;
+
+                     const Instance& other = in[other_index];
+                     vec3 dist = vec3(self.pos) - vec3(other.pos);
+                     float radius = self.pos.w + other.pos.w;
+                     float dist_sq = dot(dist, dist);
+                     if (dist_sq >= radius * radius || dist_sq < 1e-8f)
+                        continue;
+
+                     float dist_len = sqrt(dist_sq);
+                     vec3 normal = dist / dist_len;
+                     push += 0.5f * (radius - dist_len) * normal;
+
+                     float approach = dot(vec3(self.vel) - vec3(other.vel), normal);
+                     if (approach < 0.0f)
+                        impulse -= approach * normal;
+                     contacts++;
+                  }
+               }
+
+         self.pos += vec4(push, 0.0f);
+         self.vel += vec4(impulse, 0.0f);
+         out[i] = self;
+      }
+
+      return contacts;
+   }
+}
@@ -0,0 +1,115 @@
+#ifndef BOX_COLLISION_HPP__
+#define BOX_COLLISION_HPP__
+
+#include <gl/global.hpp>
+#include <cstdint>
+#include <vector>
+
+// CPU reference for the spatial hash collision passes in
+// app/shaders/boxhash.cs and app/shaders/boxscan.cs, for the
+// instance grid generated by app/shaders/boxinit.cs and for the
+// physics step in app/shaders/boxcull.cs.
+// The constants and hashes here must match the shaders.
+namespace BoxCollision
+{
+   enum
+   {
+      HashCells = 1 << 20,
+      ScanBlock = 1024,
+      BuildWorkGroup = 256,
+   };
+
+   static const float CellSize = 4.0f;
+
+   struct Instance
+   {
+      glm::vec4 pos; // w is the bounding sphere radius.
+      glm::vec4 vel;
+   };
+
+   inline uint32_t cell_hash(const glm::ivec3& cell)
+   {
+      return ((uint32_t(cell.x) * 73856093u) ^
+            (uint32_t(cell.y) * 19349663u) ^
+            (uint32_t(cell.z) * 83492791u)) & (HashCells - 1);
+   }
+
+   inline glm::ivec3 cell_coord(const glm::vec3& pos)
+   {
+      return glm::ivec3(glm::floor(pos / glm::vec3(CellSize)));
+   }
+
+   enum { GridWorkGroup = 64 };
+
+   // Initial instance layout, (2 * base)^3 instances on a regular grid.
+   struct Grid
+   {
+      int base;
+      float spacing;
+      float radius;
+      uint32_t seed;
+      float jitter; // Largest initial speed along each axis.
+
+      unsigned dim() const { return 2 * base; }
+      unsigned count() const { return dim() * dim() * dim(); }
+   };
+
+   inline uint32_t grid_hash(uint32_t v)
+   {
+      v = v * 747796405u + 2891336453u;
+      uint32_t w = ((v >> ((v >> 28u) + 4u)) ^ v) * 277803737u;
+      return (w >> 22u) ^ w;
+   }
+
+   Instance grid_instance(const Grid& grid, uint32_t index);
+
+   // Physics is stepped per distance band, see PHYSICS_AMORTIZED.
+   enum
+   {
+      PhysicsWorkGroup = 64,
+      PhysicsMaxPeriod = 4,
+      PhysicsStampMask = 0xffffff,
+   };
+
+   static const float PhysicsNear = 100.0f;
+   static const float PhysicsFar = 500.0f;
+
+   struct Camera
+   {
+      glm::vec3 pos;
+      glm::vec3 vel;
+      float delta_time;
+   };
+
+   inline unsigned physics_period(const Instance& instance, const Camera& camera)
+   {
+      glm::vec3 dist = glm::vec3(instance.pos) - camera.pos;
+      float dist_sq = glm::dot(dist, dist);
+      return dist_sq < PhysicsNear * PhysicsNear ? 1 : (dist_sq < PhysicsFar * PhysicsFar ? 2 : 4);
+   }
+
+   inline bool physics_due(uint32_t index, unsigned period, uint32_t frame)
+   {
+      return ((frame + index / PhysicsWorkGroup) & (period - 1)) == 0;
+   }
+
+   // Steps one instance in frame like boxcull.cs does.
+   // Returns false if it was not due.
+   bool integrate(Instance& instance, uint32_t index, const Camera& camera,
+         uint32_t frame, bool amortized);
+
+   class Reference
+   {
+      public:
+         // Resolves one step of collisions exactly like HASH_PASS 2 does.
+         // Returns the number of overlapping pairs (counted per side).
+         unsigned resolve(const std::vector<Instance>& in, std::vector<Instance>& out);
+
+      private:
+         std::vector<uint32_t> cell_start;
+         std::vector<uint32_t> cell_count;
+         std::vector<uint32_t> sorted;
+   };
+}
+
+#endif
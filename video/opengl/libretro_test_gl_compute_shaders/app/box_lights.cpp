@@ -0,0 +1,30 @@
+#include "box_lights.hpp"
+#include <random>
+
+using namespace std;
+using namespace glm;
+
+namespace BoxLights
+{
+   vector<Light> generate_lights(unsigned count, float extent, uint32_t seed)
+   {
+      minstd_rand rng(seed);
+      uniform_real_distribution<float> pos(-extent, extent);
+      uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+      vector<Light> lights(count);
+      for (auto& light : lights)
+      {
+         light.pos_radius = vec4(pos(rng), pos(rng), pos(rng), 16.0f + 16.0f * unit(rng));
+
+         // Saturated hues so overlapping lights stay distinguishable.
+         vec3 hue = clamp(abs(mod(vec3(unit(rng) * 6.0f) + vec3(0.0f, 4.0f, 2.0f), vec3(6.0f)) - 3.0f) - 1.0f,
+               vec3(0.0f), vec3(1.0f));
+         light.color = vec4(hue * 2.0f, 1.0f);
+
+         light.motion = vec4(vec3(unit(rng), unit(rng), unit(rng)) * 24.0f, unit(rng) * 6.2831853f);
+      }
+
+      return lights;
+   }
+}
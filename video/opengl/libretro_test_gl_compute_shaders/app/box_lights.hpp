@@ -0,0 +1,35 @@
+#ifndef BOX_LIGHTS_HPP__
+#define BOX_LIGHTS_HPP__
+
+#include <gl/global.hpp>
+#include <cstdint>
+#include <vector>
+
+// Point lights for clustered shading. app/shaders/boxlight.cs bins the
+// lights into a view-space froxel grid and app/shaders/boxrender.fs only
+// iterates the lights of the cluster a fragment falls into.
+// The constants here must match both shaders.
+namespace BoxLights
+{
+   enum
+   {
+      ClusterX = 16,
+      ClusterY = 9,
+      ClusterZ = 24,
+      Clusters = ClusterX * ClusterY * ClusterZ,
+      MaxClusterLights = 256,
+      AnimateWorkGroup = 64,
+   };
+
+   struct Light
+   {
+      glm::vec4 pos_radius; // Rest position, w is the radius of influence.
+      glm::vec4 color;
+      glm::vec4 motion; // xyz is the swing amplitude, w the phase.
+   };
+
+   // Lights scattered through the block grid, spanning [-extent, extent].
+   std::vector<Light> generate_lights(unsigned count, float extent, uint32_t seed);
+}
+
+#endif
@@ -7,49 +7,218 @@
 #include <gl/aabb.hpp>
 #include <gl/framebuffer.hpp>
 #include <gl/scene.hpp>
+#include <gl/timer.hpp>
+#include <gl/fence.hpp>
+#include <gl/loader.hpp>
+#include <gl/snapshot.hpp>
+#include "box_collision.hpp"
+#include "box_lights.hpp"
 #include <memory>
+#include <algorithm>
+#include <numeric>
 #include <cstdint>
 
 using namespace std;
 using namespace glm;
 using namespace GL;
 using namespace Util;
+using namespace BoxCollision;
+using namespace BoxLights;
 
-class Scene
+static const float ZNear = 1.0f;
+static const float ZFar = 2000.0f;
+
+// Fills the model buffers with the initial instance grid on the GPU
+// (app/shaders/boxinit.cs). The buffers keep no CPU copy, so this runs
+// again from the reset chain whenever the context is recreated.
+class GridGenerator : public ContextListener, public ContextResource
 {
    public:
-      void init()
+      GridGenerator() { ContextListener::init(); }
+      ~GridGenerator() { deinit(); }
+
+      void init(const Grid& grid, vector<Buffer*> targets, bool verify)
       {
-         int base = 48;
-         int scale = 8;
-         for (int z = -base; z < base; z++)
-            for (int y = -base; y < base; y++)
-               for (int x = -base; x < base; x++)
-               {
-                  blocks.push_back(vec4(vec3(x, y, z) * vec3(scale), 1.4143f));
-                  blocks.push_back(vec4(0.0f));
-               }
-         size = 2 * base / 4;
+         for (auto target : this->targets)
+            unregister_dependency(target);
+         unregister_dependency(&shader);
 
-         model.init(GL_ARRAY_BUFFER, blocks.size() * sizeof(vec4), Buffer::None, blocks.data());
+         this->grid = grid;
+         this->targets = move(targets);
+         this->verify = verify;
+         shader.init_compute("app/shaders/boxinit.cs");
 
-         auto mesh = create_mesh_box();
-         auto mesh_fine = load_meshes_obj("app/mesh.obj");
+         for (auto target : this->targets)
+            register_dependency(target);
+         register_dependency(&shader);
 
-         mesh_fine[0].arrays.push_back({3, 4, GL_FLOAT, GL_FALSE, 0, 1, 1, 0});
-         render_array[0].setup(mesh_fine[0].arrays, { &vert_fine, &culled_buffer[0] }, &elem_fine);
+         if (alive)
+            generate();
+      }
 
-         mesh.arrays.push_back({3, 4, GL_FLOAT, GL_FALSE, 0, 1, 1, 0});
-         render_array[1].setup(mesh.arrays, { &vert, &culled_buffer[1] }, &elem);
+      void reset() override
+      {
+         alive = true;
+         if (!targets.empty())
+            generate();
+      }
 
-         // Point sprites here.
-         VertexArray::Array point_array = { Shader::VertexLocation, 4, GL_FLOAT, GL_FALSE };
-         render_array[2].setup({point_array}, { &culled_buffer[2] }, nullptr);
+      void destroyed() override
+      {
+         alive = false;
+      }
+
+   private:
+      Shader shader;
+      Grid grid;
+      vector<Buffer*> targets;
+      bool verify = false;
+      bool alive = false;
+
+      void generate()
+      {
+         shader.use();
+         glUniform1i(0, grid.base);
+         glUniform1f(1, grid.spacing);
+         glUniform1f(2, grid.radius);
+         glUniform1ui(3, grid.seed);
+         glUniform1f(4, grid.jitter);
+
+         for (auto target : targets)
+         {
+            target->bind_indexed(GL_SHADER_STORAGE_BUFFER, 0);
+            glDispatchCompute((grid.dim() + GridWorkGroup - 1) / GridWorkGroup, grid.dim(), grid.dim());
+            target->unbind_indexed(GL_SHADER_STORAGE_BUFFER, 0);
+         }
+         shader.unbind();
+
+         glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT | GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT |
+               GL_BUFFER_UPDATE_BARRIER_BIT);
+
+         if (verify)
+            verify_grid();
+      }
+
+      void verify_grid()
+      {
+         vector<Instance> gpu(grid.count());
+         targets[0]->read(gpu.data(), gpu.size() * sizeof(Instance));
+
+         unsigned mismatches = 0;
+         float max_error = 0.0f;
+         for (uint32_t i = 0; i < gpu.size(); i++)
+         {
+            Instance cpu = grid_instance(grid, i);
+            float error = std::max(length(gpu[i].pos - cpu.pos), length(gpu[i].vel - cpu.vel));
+            if (error > 1e-5f * (1.0f + length(cpu.pos)))
+               mismatches++;
+            max_error = std::max(max_error, error);
+         }
+
+         Log::log("Grid check: %u of %u instances differ from CPU reference, max error %g.",
+               mismatches, unsigned(gpu.size()), max_error);
+      }
+};
+
+class Scene : public ContextListener, public ContextResource
+{
+   public:
+      Scene() { ContextListener::init(); }
+      ~Scene() { deinit(); }
+
+      // Extension lookups search the whole list, so they are done once
+      // per context.
+      void reset() override
+      {
+         ballot = has_extension("GL_ARB_shader_ballot") &&
+            has_extension("GL_ARB_gpu_shader_int64");
+         atomic64 = has_extension("GL_NV_shader_atomic_int64") &&
+            has_extension("GL_ARB_gpu_shader_int64");
+      }
+
+      void destroyed() override
+      {
+      }
+
+      enum VertexFormat
+      {
+         VertexFloat = 0,
+         VertexCompact = 1
+      };
+
+      // LOD0 and LOD1 geometry in both vertex formats, so the option can
+      // switch between them without reloading the meshes.
+      struct LodGeometry
+      {
+         Buffer vert[2];
+         Buffer elem[2];
+         vector<VertexArray::Array> arrays[2];
+         GLenum index_type[2];
+         AABB aabb;
+      };
+
+      // CPU side of loading, runs on the loader thread.
+      void prepare_meshes()
+      {
+         mesh = create_mesh_box();
+         mesh_fine = load_meshes_obj("app/mesh.obj");
+
+         mesh.quantize();
+         mesh_fine[0].quantize();
+      }
+
+      // GL side of loading, runs on the main thread once the prepare steps
+      // are done. Each step is run in a frame of its own, so the uploads and
+      // shader compiles are spread over the loading screen.
+      vector<function<void ()>> init_steps()
+      {
+         return {
+            [this]() { init_instances(); },
+            [this]() { init_buffers(); },
+            [this]() { init_geometry(); },
+            [this]() { init_shaders(); },
+            [this]() { compile_compute(); },
+            [this]() { compile_render(0); },
+            [this]() { compile_render(1); },
+            [this]() { compile_points(); },
+         };
+      }
+
+      void init_instances()
+      {
+         size = grid.dim() / 4;
+         instance_count = grid.count();
+
+         for (auto& buffer : model)
+            buffer.init(GL_ARRAY_BUFFER, instance_count * sizeof(Instance), Buffer::Copy);
+         current_model = 0;
+         generator.init(grid, { &model[0], &model[1] }, verify);
+      }
+
+      void init_buffers()
+      {
+         snapshots.init(instance_count * sizeof(Instance));
 
-         vert_fine.init(GL_ARRAY_BUFFER, mesh_fine[0].vbo, Buffer::None);
-         elem_fine.init(GL_ELEMENT_ARRAY_BUFFER, mesh_fine[0].ibo, Buffer::None);
-         vert.init(GL_ARRAY_BUFFER, mesh.vbo, Buffer::None);
-         elem.init(GL_ELEMENT_ARRAY_BUFFER, mesh.ibo, Buffer::None);
+         vector<uint32_t> zero_counts(HashCells);
+         cell_count.init(GL_SHADER_STORAGE_BUFFER, zero_counts, Buffer::Copy);
+         cell_start.init(GL_SHADER_STORAGE_BUFFER, HashCells * sizeof(uint32_t), Buffer::Copy);
+         block_sums.init(GL_SHADER_STORAGE_BUFFER, ScanBlock * sizeof(uint32_t), Buffer::Copy);
+         instance_cell.init(GL_SHADER_STORAGE_BUFFER, instance_count * sizeof(uint32_t), Buffer::Copy);
+         sorted.init(GL_SHADER_STORAGE_BUFFER, instance_count * sizeof(uint32_t), Buffer::Copy);
+
+         cluster_count.init(GL_SHADER_STORAGE_BUFFER, Clusters * sizeof(uint32_t), Buffer::Copy);
+         cluster_lights.init(GL_SHADER_STORAGE_BUFFER, Clusters * MaxClusterLights * sizeof(uint32_t), Buffer::Copy);
+         for (auto& count : point_counts)
+            count.init(GL_COPY_WRITE_BUFFER, sizeof(GLuint), Buffer::ReadOnly);
+
+         for (auto& buffer : culled_buffer)
+            buffer.init(GL_ARRAY_BUFFER, 16 * 1024 * 1024, Buffer::Copy);
+      }
+
+      void init_geometry()
+      {
+         init_lod_geometry(lod_geometry[0], mesh_fine[0]);
+         init_lod_geometry(lod_geometry[1], mesh);
 
          indices_fine = mesh_fine[0].ibo.size();
          indices = mesh.ibo.size();
@@ -71,24 +240,144 @@ class Scene
          if (!mesh.material.diffuse_map.empty())
          {
             use_diffuse = true;
-            tex.load_texture({Texture::Texture2D,
-                  { mesh.material.diffuse_map },
-                  true });
+            tex.load_texture(diffuse_resource());
          }
          else
             use_diffuse = false;
 
+         // The context is usually alive by now, so the vertex arrays are
+         // set up right away and their buffers must be initialized first.
+         setup_vertex_format();
+
+         // Point sprites here.
+         VertexArray::Array point_array = { Shader::VertexLocation, 4, GL_FLOAT, GL_FALSE };
+         render_array[2].setup({point_array}, { &culled_buffer[2] }, nullptr);
+
+         // The buffers have their own copies now.
+         mesh = {};
+         mesh_fine = {};
+      }
+
+      // Only reads the sources, programs are compiled on first use.
+      void init_shaders()
+      {
+         cull_shader.reserve_define("CULL_COMPACTION", 2);
+         cull_shader.reserve_define("PHYSICS_AMORTIZED", 1);
          cull_shader.init_compute("app/shaders/boxcull.cs");
+         hash_shader.reserve_define("HASH_PASS", 2);
+         hash_shader.init_compute("app/shaders/boxhash.cs");
+         scan_shader.reserve_define("SCAN_PASS", 2);
+         scan_shader.init_compute("app/shaders/boxscan.cs");
+         light_shader.reserve_define("LIGHT_PASS", 1);
+         light_shader.init_compute("app/shaders/boxlight.cs");
+         timer.init({ "hash", "scan", "scatter", "collide", "cull", "lights", "draw", "points" }, 600);
          render_shader.reserve_define("DIFFUSE_MAP", 1);
          render_shader.reserve_define("LOD", 1);
+         render_shader.reserve_define("CLUSTERED_LIGHTS", 1);
+         render_shader.reserve_define("COMPACT_VERTEX", 1);
+
          render_shader.init("app/shaders/boxrender.vs", "app/shaders/boxrender.fs");
          render_shader_point.init("app/shaders/boxrender_point.vs", "app/shaders/boxrender_point.fs");
+         point_shader.reserve_define("POINT_ATOMIC64", 1);
+         point_shader.init_compute("app/shaders/boxpoint.cs");
+         point_resolve_shader.reserve_define("POINT_ATOMIC64", 1);
+         point_resolve_shader.init("app/shaders/boxpoint_resolve.vs", "app/shaders/boxpoint_resolve.fs");
+         resolve_array.setup({}, {}, nullptr);
+      }
 
-         for (auto& buffer : culled_buffer)
-            buffer.init(GL_ARRAY_BUFFER, 16 * 1024 * 1024, Buffer::Copy);
+      // The compile steps build the permutations the first frame draws with
+      // under the current options. Benchmarks and later option changes still
+      // compile on first use.
+      void compile_compute()
+      {
+         unsigned mode = compaction;
+         if (mode == CompactionSubgroup && !ballot)
+            mode = CompactionWorkgroup;
+         cull_shader.set_define("CULL_COMPACTION", mode);
+         cull_shader.set_define("PHYSICS_AMORTIZED", physics_amortized);
+         cull_shader.compile();
+
+         if (collisions)
+         {
+            for (unsigned pass = 0; pass < 3; pass++)
+            {
+               hash_shader.set_define("HASH_PASS", pass);
+               hash_shader.compile();
+               scan_shader.set_define("SCAN_PASS", pass);
+               scan_shader.compile();
+            }
+         }
+
+         if (light_count)
+         {
+            for (unsigned pass = 0; pass < 2; pass++)
+            {
+               light_shader.set_define("LIGHT_PASS", pass);
+               light_shader.compile();
+            }
+         }
+      }
+
+      void compile_render(unsigned lod)
+      {
+         render_shader.set_define("DIFFUSE_MAP", use_diffuse);
+         render_shader.set_define("CLUSTERED_LIGHTS", light_count ? 1 : 0);
+         render_shader.set_define("COMPACT_VERTEX", vertex_format);
+         render_shader.set_define("LOD", lod);
+         render_shader.compile();
       }
 
-      void render(const mat4& view_proj)
+      void compile_points()
+      {
+         if (point_mode == PointCompute)
+         {
+            point_shader.set_define("POINT_ATOMIC64", atomic64);
+            point_shader.compile();
+            point_resolve_shader.set_define("POINT_ATOMIC64", atomic64);
+            point_resolve_shader.compile();
+         }
+         else
+            render_shader_point.compile();
+      }
+
+      void init_lod_geometry(LodGeometry& lod, const Mesh& m)
+      {
+         lod.vert[VertexFloat].init(GL_ARRAY_BUFFER, m.vbo, Buffer::None);
+         lod.elem[VertexFloat].init(GL_ELEMENT_ARRAY_BUFFER, m.ibo, Buffer::None);
+         lod.arrays[VertexFloat] = m.arrays;
+         lod.index_type[VertexFloat] = GL_UNSIGNED_INT;
+
+         lod.vert[VertexCompact].init(GL_ARRAY_BUFFER, m.packed_vbo, Buffer::None);
+         if (m.packed_index_type == GL_UNSIGNED_SHORT)
+            lod.elem[VertexCompact].init(GL_ELEMENT_ARRAY_BUFFER, m.packed_ibo, Buffer::None);
+         else
+            lod.elem[VertexCompact].init(GL_ELEMENT_ARRAY_BUFFER, m.ibo, Buffer::None);
+         lod.arrays[VertexCompact] = m.packed_arrays;
+         lod.index_type[VertexCompact] = m.packed_index_type;
+         lod.aabb = m.aabb;
+
+         // Instance positions, written by the cull shader.
+         for (auto& arrays : lod.arrays)
+            arrays.push_back({3, 4, GL_FLOAT, GL_FALSE, 0, 1, 1, 0});
+      }
+
+      void setup_vertex_format()
+      {
+         for (unsigned i = 0; i < 2; i++)
+         {
+            auto& lod = lod_geometry[i];
+            render_array[i].setup(lod.arrays[vertex_format],
+                  { &lod.vert[vertex_format], &culled_buffer[i] }, &lod.elem[vertex_format]);
+         }
+         bound_format = vertex_format;
+      }
+
+      Texture::Resource diffuse_resource() const
+      {
+         return { Texture::Texture2D, { mesh.material.diffuse_map }, true };
+      }
+
+      void render(const mat4& view_proj, unsigned width, unsigned height)
       {
          // Reset indirect draw buffer.
          struct IndirectCommand
@@ -106,22 +395,66 @@ class Scene
          };
          indirect.init(GL_DRAW_INDIRECT_BUFFER, sizeof(command), Buffer::Copy, command);
 
+         unsigned compaction_mode = select_compaction();
+         unsigned lights = select_lights();
+         unsigned points = select_points();
+         bool amortized = select_physics();
+         timer.set_label(String::cat(compaction_label, ", ", physics_label, ", ",
+                  to_string(lights), " lights, points ", points_label));
+         snapshots.update();
+         captured = 0;
+         timer.begin_frame();
+         if (collisions)
+            resolve_collisions();
+         else
+            for (unsigned pass = PassHash; pass <= PassCollide; pass++)
+               timer.end_pass(pass);
+
+         bool check = physics_verify && (physics_check_frame++ % VerifyInterval) == 0;
+         vector<Instance> before;
+         if (check)
+         {
+            glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+            before.resize(instance_count);
+            model[current_model].read(before.data(), instance_count * sizeof(Instance));
+         }
+
          // Frustum cull instanced cubes (points) and update indirect draw buffer.
          // Compute shader! :D
+         cull_shader.set_define("CULL_COMPACTION", compaction_mode);
+         cull_shader.set_define("PHYSICS_AMORTIZED", amortized);
          cull_shader.use();
-         model.bind_indexed(GL_SHADER_STORAGE_BUFFER, 0);
+         glUniform1ui(0, ++physics_frame);
+         model[current_model].bind_indexed(GL_SHADER_STORAGE_BUFFER, 0);
          for (unsigned i = 0; i < 3; i++)
             culled_buffer[i].bind_indexed(GL_SHADER_STORAGE_BUFFER, i + 1);
          indirect.bind_indexed(GL_ATOMIC_COUNTER_BUFFER, 0); // Instance count is written here.
+         indirect.bind_indexed(GL_SHADER_STORAGE_BUFFER, 4); // Or here, with aggregated compaction.
          glDispatchCompute(size, size, size);
          indirect.unbind_indexed(GL_ATOMIC_COUNTER_BUFFER, 0);
-         model.unbind_indexed(GL_SHADER_STORAGE_BUFFER, 0);
+         indirect.unbind_indexed(GL_SHADER_STORAGE_BUFFER, 4);
+         model[current_model].unbind_indexed(GL_SHADER_STORAGE_BUFFER, 0);
          for (unsigned i = 0; i < 3; i++)
             culled_buffer[i].unbind_indexed(GL_SHADER_STORAGE_BUFFER, i + 1);
 
          // GL must wait until previous shader has made updated data visible.
          // We use updated shader storage buffer in next frame, so just barrier it here.
          glMemoryBarrier(GL_COMMAND_BARRIER_BIT | GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT | GL_SHADER_STORAGE_BARRIER_BIT);
+         if (check)
+         {
+            glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+            verify_physics(before, model[current_model], amortized);
+         }
+
+         // The simulation is done for this frame. Copying it out now keeps
+         // the copy ahead of the draws.
+         if (capture)
+            captured = snapshots.capture(model[current_model]);
+         timer.end_pass(PassCull);
+
+         if (lights)
+            bin_lights(lights);
+         timer.end_pass(PassLights);
 
          // Render instanced data.
          Sampler::bind(0, Sampler::TrilinearClamp);
@@ -135,49 +468,459 @@ class Scene
          else
             render_shader.set_define("DIFFUSE_MAP", 0);
 
+         render_shader.set_define("CLUSTERED_LIGHTS", lights ? 1 : 0);
+         if (lights)
+            bind_light_buffers();
+
+         if (bound_format != vertex_format)
+            setup_vertex_format();
+         render_shader.set_define("COMPACT_VERTEX", vertex_format);
+
          indirect.bind();
          for (unsigned i = 0; i < 2; i++)
          {
+            auto& lod = lod_geometry[i];
             render_shader.set_define("LOD", i);
+            if (vertex_format == VertexCompact)
+            {
+               glUniform3fv(0, 1, value_ptr(lod.aabb.base));
+               glUniform3fv(1, 1, value_ptr(lod.aabb.offset));
+            }
             render_array[i].bind();
             material[i].bind();
 
             // glMultiDrawElementsIndirect is possible, but I had issues getting it to work.
             // Only possible if all LOD levels use same shader though ...
-            glDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT,
+            glDrawElementsIndirect(GL_TRIANGLES, lod.index_type[vertex_format],
                   reinterpret_cast<void*>(i * uintptr_t(sizeof(IndirectCommand))));
          }
 
-         // Draw farthest blocks as point sprites.
-         render_shader_point.use();
-         render_array[2].bind();
-         material[2].bind();
-         glDrawArraysIndirect(GL_POINTS, reinterpret_cast<void*>(2 * uintptr_t(sizeof(IndirectCommand))));
-
          indirect.unbind();
 
          if (use_diffuse)
             tex.unbind(0);
+         if (lights)
+            unbind_light_buffers();
 
          Sampler::unbind(0, Sampler::TrilinearClamp);
-         render_shader_point.unbind();
-         render_array[2].unbind();
+         timer.end_pass(PassDraw);
+
+         // Draw farthest blocks as point sprites, or rasterize them in compute.
+         material[2].bind();
+         if (points == PointCompute)
+            rasterize_points(width, height);
+         else
+         {
+            render_shader_point.use();
+            render_array[2].bind();
+            indirect.bind();
+            glDrawArraysIndirect(GL_POINTS, reinterpret_cast<void*>(2 * uintptr_t(sizeof(IndirectCommand))));
+            indirect.unbind();
+            render_shader_point.unbind();
+            render_array[2].unbind();
+         }
          material[2].unbind();
+         count_points();
+         timer.end_pass(PassPoints);
+      }
+
+      // Picks sprites or compute for the far LOD this frame.
+      unsigned select_points()
+      {
+         unsigned mode = point_mode;
+         if (point_benchmark)
+            mode = (point_benchmark_frame++ / BenchmarkInterval) % 2;
+
+         if (mode == PointCompute && !atomic64 && !atomic64_warned)
+         {
+            Log::log("NV_shader_atomic_int64 not supported, far points use 32-bit atomics.");
+            atomic64_warned = true;
+         }
+
+         if (mode == PointSprites)
+            points_label = "sprites";
+         else
+            points_label = atomic64 ? "compute 64-bit" : "compute 32-bit";
+         return mode;
+      }
+
+      // boxpoint.cs splats the far LOD into point_target, one texel per
+      // pixel, and a full screen pass resolves that into colour and depth.
+      void rasterize_points(unsigned width, unsigned height)
+      {
+         unsigned texel_size = atomic64 ? sizeof(uint64_t) : sizeof(uint32_t);
+         if (width != target_width || height != target_height || texel_size != target_texel_size)
+         {
+            // All ones is the empty texel, the resolve writes it back after reading.
+            vector<uint8_t> empty(width * height * texel_size, 0xff);
+            point_target.init(GL_SHADER_STORAGE_BUFFER, empty, Buffer::Copy);
+            target_width = width;
+            target_height = height;
+            target_texel_size = texel_size;
+         }
+
+         point_shader.set_define("POINT_ATOMIC64", atomic64);
+         point_shader.use();
+         culled_buffer[2].bind_indexed(GL_SHADER_STORAGE_BUFFER, 0);
+         indirect.bind_indexed(GL_SHADER_STORAGE_BUFFER, 1);
+         point_target.bind_indexed(GL_SHADER_STORAGE_BUFFER, 2);
+         glDispatchCompute(std::min((instance_count + PointWorkGroup - 1) / PointWorkGroup, unsigned(MaxPointGroups)), 1, 1);
+         culled_buffer[2].unbind_indexed(GL_SHADER_STORAGE_BUFFER, 0);
+         indirect.unbind_indexed(GL_SHADER_STORAGE_BUFFER, 1);
+         point_shader.unbind();
+         glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+
+         point_resolve_shader.set_define("POINT_ATOMIC64", atomic64);
+         point_resolve_shader.use();
+         resolve_array.bind();
+         glDrawArrays(GL_TRIANGLES, 0, 3);
+         resolve_array.unbind();
+         point_resolve_shader.unbind();
+         point_target.unbind_indexed(GL_SHADER_STORAGE_BUFFER, 2);
+
+         // The cleared target must be visible to next frame's dispatch.
+         glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+      }
+
+      // Far LOD count for the points throughput. Copied into a ring of
+      // small buffers and read back a few frames late, so it never waits
+      // on the GPU.
+      void count_points()
+      {
+         unsigned slot = point_count_frame++ % PointCountLatency;
+         indirect.bind(GL_COPY_READ_BUFFER);
+         point_counts[slot].bind(GL_COPY_WRITE_BUFFER);
+         glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 2 * 5 * sizeof(GLuint), 0, sizeof(GLuint));
+         point_counts[slot].unbind(GL_COPY_WRITE_BUFFER);
+         indirect.unbind(GL_COPY_READ_BUFFER);
+
+         if (point_count_frame < PointCountLatency)
+            return;
+
+         GLuint count = 0;
+         point_counts[(slot + 1) % PointCountLatency].read(&count, sizeof(count));
+         timer.set_items(PassPoints, count);
+      }
+
+      // Picks the CULL_COMPACTION variant of boxcull.cs for this frame.
+      unsigned select_compaction()
+      {
+         unsigned mode = compaction;
+         if (compaction_benchmark)
+         {
+            unsigned modes = ballot ? 3 : 2;
+            mode = (benchmark_frame++ / BenchmarkInterval) % modes;
+         }
+         else if (mode == CompactionSubgroup && !ballot)
+         {
+            if (!ballot_warned)
+               Log::log("ARB_shader_ballot not supported, using workgroup compaction.");
+            ballot_warned = true;
+            mode = CompactionWorkgroup;
+         }
+
+         static const char *names[] = { "atomic", "workgroup", "subgroup" };
+         compaction_label = String::cat("cull compaction ", names[mode]);
+         return mode;
+      }
+
+      // Picks full rate or amortized physics for this frame.
+      bool select_physics()
+      {
+         bool amortized = physics_amortized;
+         if (physics_benchmark)
+            amortized = (physics_benchmark_frame++ / BenchmarkInterval) % 2 != 0;
+
+         physics_label = amortized ? "amortized physics" : "full rate physics";
+         return amortized;
+      }
+
+      // Picks this frame's light count and rebuilds the light buffer on change.
+      unsigned select_lights()
+      {
+         unsigned count = light_count;
+         if (light_benchmark)
+            count = LightCounts[(light_benchmark_frame++ / BenchmarkInterval) % LightCounts.size()];
+
+         if (count != built_lights)
+         {
+            auto data = generate_lights(count, 384.0f, 1);
+            if (count)
+               light_data.init(GL_SHADER_STORAGE_BUFFER, data, Buffer::None);
+            animated_lights.init(GL_SHADER_STORAGE_BUFFER, std::max(count, 1u) * 3 * sizeof(vec4), Buffer::Copy);
+            built_lights = count;
+         }
+         return count;
+      }
+
+      // Animates the lights, then lists per froxel which lights reach into it.
+      void bin_lights(unsigned count)
+      {
+         Buffer *buffers[] = { &light_data, &animated_lights, &cluster_count, &cluster_lights };
+         for (unsigned i = 0; i < 4; i++)
+            buffers[i]->bind_indexed(GL_SHADER_STORAGE_BUFFER, i);
+
+         for (unsigned pass = 0; pass < 2; pass++)
+         {
+            light_shader.set_define("LIGHT_PASS", pass);
+            light_shader.use();
+            glUniform1ui(0, count);
+            glUniform1f(1, time);
+            glUniform2f(2, ZNear, ZFar);
+            if (pass == 0)
+               glDispatchCompute((count + AnimateWorkGroup - 1) / AnimateWorkGroup, 1, 1);
+            else
+               glDispatchCompute(ClusterX, ClusterY, ClusterZ);
+            glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+         }
+
+         for (unsigned i = 0; i < 4; i++)
+            buffers[i]->unbind_indexed(GL_SHADER_STORAGE_BUFFER, i);
+         light_shader.unbind();
+      }
+
+      void bind_light_buffers()
+      {
+         animated_lights.bind_indexed(GL_SHADER_STORAGE_BUFFER, 1);
+         cluster_count.bind_indexed(GL_SHADER_STORAGE_BUFFER, 2);
+         cluster_lights.bind_indexed(GL_SHADER_STORAGE_BUFFER, 3);
+      }
+
+      void unbind_light_buffers()
+      {
+         animated_lights.unbind_indexed(GL_SHADER_STORAGE_BUFFER, 1);
+         cluster_count.unbind_indexed(GL_SHADER_STORAGE_BUFFER, 2);
+         cluster_lights.unbind_indexed(GL_SHADER_STORAGE_BUFFER, 3);
+      }
+
+      // Builds a spatial hash of all instances with a counting sort
+      // (count, prefix sum, scatter) and resolves overlapping bounding
+      // spheres against the neighbouring cells. Reads the current model
+      // buffer and writes the other one, which becomes current.
+      void resolve_collisions()
+      {
+         Buffer& source = model[current_model];
+         Buffer& dest = model[current_model ^ 1];
+         GLuint groups = (instance_count + BuildWorkGroup - 1) / BuildWorkGroup;
+
+         Buffer *hash_buffers[] = { &source, &cell_count, &cell_start, &instance_cell, &sorted, &dest };
+         auto bind_hash_buffers = [&]() {
+            for (unsigned i = 0; i < 6; i++)
+               hash_buffers[i]->bind_indexed(GL_SHADER_STORAGE_BUFFER, i);
+         };
+         auto run_hash_pass = [&](unsigned pass) {
+            hash_shader.set_define("HASH_PASS", pass);
+            hash_shader.use();
+            glUniform1ui(0, instance_count);
+            glDispatchCompute(groups, 1, 1);
+            glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+         };
+
+         bind_hash_buffers();
+         run_hash_pass(0);
+         timer.end_pass(PassHash);
+
+         // Exclusive scan of the cell counts into cell_start.
+         // HashCells / ScanBlock block totals fit in a single block.
+         scan_shader.set_define("SCAN_PASS", 0);
+         scan_shader.use();
+         cell_count.bind_indexed(GL_SHADER_STORAGE_BUFFER, 0);
+         cell_start.bind_indexed(GL_SHADER_STORAGE_BUFFER, 1);
+         block_sums.bind_indexed(GL_SHADER_STORAGE_BUFFER, 2);
+         glDispatchCompute(HashCells / ScanBlock, 1, 1);
+         glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+
+         scan_shader.set_define("SCAN_PASS", 1);
+         block_sums.bind_indexed(GL_SHADER_STORAGE_BUFFER, 0);
+         block_sums.bind_indexed(GL_SHADER_STORAGE_BUFFER, 1);
+         glDispatchCompute(1, 1, 1);
+         glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+
+         scan_shader.set_define("SCAN_PASS", 2);
+         cell_start.bind_indexed(GL_SHADER_STORAGE_BUFFER, 1);
+         glDispatchCompute(HashCells / ScanBlock, 1, 1);
+         glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+         timer.end_pass(PassScan);
+
+         bind_hash_buffers();
+         run_hash_pass(1);
+         timer.end_pass(PassScatter);
+
+         bool check = verify && (frame_count++ % VerifyInterval) == 0;
+         vector<Instance> before;
+         if (check)
+         {
+            before.resize(instance_count);
+            source.read(before.data(), instance_count * sizeof(Instance));
+         }
+
+         run_hash_pass(2);
+         timer.end_pass(PassCollide);
+
+         for (unsigned i = 0; i < 6; i++)
+            hash_buffers[i]->unbind_indexed(GL_SHADER_STORAGE_BUFFER, i);
+         hash_shader.unbind();
+
+         if (check)
+         {
+            glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+            verify_collisions(before, dest);
+         }
+
+         current_model ^= 1;
+      }
+
+      // Savestates outside of render(), after the frame's simulation.
+      uint64_t capture_now()
+      {
+         return snapshots.capture(model[current_model]);
       }
 
+      bool restore(const void *data)
+      {
+         captured = 0;
+         return snapshots.restore(model[current_model], data);
+      }
+
+      void verify_collisions(const vector<Instance>& before, Buffer& result)
+      {
+         vector<Instance> gpu(before.size());
+         result.read(gpu.data(), gpu.size() * sizeof(Instance));
+
+         vector<Instance> cpu;
+         unsigned contacts = reference.resolve(before, cpu);
+
+         unsigned mismatches = 0;
+         float max_error = 0.0f;
+         for (size_t i = 0; i < cpu.size(); i++)
+         {
+            float error = std::max(length(vec3(gpu[i].pos) - vec3(cpu[i].pos)),
+                  length(vec3(gpu[i].vel) - vec3(cpu[i].vel)));
+            float tolerance = 1e-3f * (1.0f + length(vec3(cpu[i].pos)) + length(vec3(cpu[i].vel)));
+            if (error > tolerance)
+               mismatches++;
+            max_error = std::max(max_error, error);
+         }
+
+         Log::log("Collision check: %u contacts, %u of %u instances differ from CPU reference, max error %g.",
+               contacts, mismatches, unsigned(cpu.size()), max_error);
+      }
+
+      // Checks this frame's physics step against the CPU reference. Then a
+      // sample of the instances is run ahead both at full rate and amortized,
+      // with the camera held still, to see how far apart they drift.
+      // Also counts how many instances the coming frames step.
+      void verify_physics(const vector<Instance>& before, Buffer& result, bool amortized)
+      {
+         vector<Instance> gpu(before.size());
+         result.read(gpu.data(), gpu.size() * sizeof(Instance));
+
+         unsigned mismatches = 0;
+         float max_error = 0.0f;
+         unsigned steps[PhysicsMaxPeriod] = {};
+         for (uint32_t i = 0; i < before.size(); i++)
+         {
+            Instance cpu = before[i];
+            integrate(cpu, i, camera, physics_frame, amortized);
+
+            float error = std::max(length(gpu[i].pos - cpu.pos), length(gpu[i].vel - cpu.vel));
+            float tolerance = 1e-3f * (1.0f + length(cpu.pos) + length(cpu.vel));
+            if (error > tolerance)
+               mismatches++;
+            max_error = std::max(max_error, error);
+
+            unsigned period = physics_period(before[i], camera);
+            for (unsigned frame = 0; frame < PhysicsMaxPeriod; frame++)
+               if (physics_due(i, period, physics_frame + frame))
+                  steps[frame]++;
+         }
+
+         // 7 work groups apart samples every phase of the stagger.
+         unsigned sampled = 0;
+         float max_drift = 0.0f;
+         double drift = 0.0, travel = 0.0;
+         uint32_t last_frame = physics_frame + PhysicsCheckFrames - 1;
+         for (uint32_t i = 0; i < before.size(); i++)
+         {
+            if ((i / PhysicsWorkGroup) % 7 != 0)
+               continue;
+
+            Instance full = before[i];
+            Instance partial = before[i];
+            for (uint32_t frame = physics_frame; frame <= last_frame; frame++)
+            {
+               integrate(full, i, camera, frame, false);
+               integrate(partial, i, camera, frame, true);
+            }
+
+            // Catches up on the frames the amortized instance has not stepped yet.
+            if (uint32_t(partial.vel.w) != (last_frame & PhysicsStampMask))
+               integrate(partial, i, camera, last_frame, false);
+
+            float dist = length(vec3(full.pos) - vec3(partial.pos));
+            max_drift = std::max(max_drift, dist);
+            drift += dist;
+            travel += length(vec3(full.pos) - vec3(before[i].pos));
+            sampled++;
+         }
+
+         auto step_range = minmax_element(begin(steps), end(steps));
+         Log::log("Physics check: %u of %u instances differ from CPU reference, max error %g. "
+               "%u to %u stepped per frame (%.1f%% on average).",
+               mismatches, unsigned(gpu.size()), max_error, *step_range.first, *step_range.second,
+               100.0 * accumulate(begin(steps), end(steps), 0.0) / (PhysicsMaxPeriod * gpu.size()));
+         Log::log("Physics check: over %u frames, %u sampled instances moved %g on average "
+               "and drifted from full rate by %g on average, %g at most.",
+               unsigned(PhysicsCheckFrames), sampled, sampled ? travel / sampled : 0.0,
+               sampled ? drift / sampled : 0.0, max_drift);
+      }
+
+      enum Pass
+      {
+         PassHash = 0,
+         PassScan,
+         PassScatter,
+         PassCollide,
+         PassCull,
+         PassLights,
+         PassDraw,
+         PassPoints
+      };
+      enum { VerifyInterval = 120, PhysicsCheckFrames = 120 };
+
+      enum Compaction
+      {
+         CompactionAtomic = 0,
+         CompactionWorkgroup = 1,
+         CompactionSubgroup = 2
+      };
+      enum { BenchmarkInterval = 600 };
+
       Shader cull_shader;
+      Shader hash_shader;
+      Shader scan_shader;
       Shader render_shader;
       Shader render_shader_point;
+      Shader light_shader;
+
+      LodGeometry lod_geometry[2];
+      unsigned vertex_format = VertexCompact;
+      unsigned bound_format = ~0u;
 
-      Buffer vert, vert_fine;
-      Buffer elem, elem_fine;
       Buffer culled_buffer[3];
       VertexArray render_array[3];
 
       size_t indices_fine;
       size_t indices;
 
-      Buffer model;
+      // base, spacing, radius, seed, jitter. The blocks start at rest.
+      const Grid grid = { 48, 8.0f, 1.4143f, 1, 0.0f };
+      Buffer model[2];
+      GridGenerator generator;
+      unsigned current_model = 0;
+      unsigned instance_count = 0;
+      Buffer cell_count, cell_start, block_sums;
+      Buffer instance_cell, sorted;
       Buffer material[3];
       Buffer indirect;
 
@@ -186,7 +929,71 @@ class Scene
       float cache_depth;
       unsigned size;
 
-      vector<vec4> blocks;
+      Mesh mesh;
+      vector<Mesh> mesh_fine;
+
+      bool collisions = false;
+      bool verify = false;
+      unsigned compaction = CompactionSubgroup;
+      bool compaction_benchmark = false;
+      bool ballot = false;
+      bool ballot_warned = false;
+      unsigned benchmark_frame = 0;
+      string compaction_label;
+
+      static const vector<unsigned> LightCounts;
+      unsigned light_count = 0;
+      bool light_benchmark = false;
+      unsigned light_benchmark_frame = 0;
+      unsigned built_lights = ~0u;
+      float time = 0.0f;
+      Buffer light_data, animated_lights;
+      Buffer cluster_count, cluster_lights;
+
+      enum PointMode
+      {
+         PointSprites = 0,
+         PointCompute = 1
+      };
+      enum
+      {
+         PointWorkGroup = 64,
+         MaxPointGroups = 1024,
+         PointCountLatency = 4
+      };
+      Shader point_shader;
+      Shader point_resolve_shader;
+      VertexArray resolve_array;
+      Buffer point_target;
+      unsigned target_width = 0;
+      unsigned target_height = 0;
+      unsigned target_texel_size = 0;
+      Buffer point_counts[PointCountLatency];
+      unsigned point_count_frame = 0;
+      unsigned point_mode = PointSprites;
+      bool point_benchmark = false;
+      unsigned point_benchmark_frame = 0;
+      bool atomic64 = false;
+      bool atomic64_warned = false;
+      string points_label;
+      unsigned frame_count = 0;
+      PassTimer timer;
+      Reference reference;
+
+      Camera camera;
+      uint32_t physics_frame = 0;
+      bool physics_amortized = false;
+      bool physics_benchmark = false;
+      unsigned physics_benchmark_frame = 0;
+      bool physics_verify = false;
+      unsigned physics_check_frame = 0;
+      string physics_label;
+
+      // Savestates. Once the frontend has asked for one, every frame is
+      // captured, since rewind and run-ahead ask every frame.
+      BufferSnapshots snapshots;
+      bool capture = false;
+      uint64_t captured = 0;
 };
 
 class BoxesApp : public LibretroGLApplication
@@ -232,10 +1039,122 @@ class BoxesApp : public LibretroGLApplication
          return res;
       }
 
+      vector<Option> get_options() const override
+      {
+         return {
+            { "collisions", "Box collisions; disabled|enabled" },
+            { "collision_verify", "Verify collisions against CPU; disabled|enabled" },
+            { "cull_compaction", "Cull compaction; subgroup|workgroup|atomic|benchmark" },
+            { "lights", "Point lights; 0|256|1024|4096|16384|benchmark" },
+            { "vertex_format", "Vertex format; compact|float" },
+            { "far_points", "Far LOD points; sprites|compute|benchmark" },
+            { "savestates", "Savestates; exact|async" },
+            { "physics", "Physics update rate; full|amortized|benchmark" },
+            { "physics_verify", "Verify amortized physics against full rate; disabled|enabled" },
+         };
+      }
+
+      void option_changed(const string& key, const string& value) override
+      {
+         if (key == "collisions")
+            scene.collisions = value == "enabled";
+         else if (key == "collision_verify")
+            scene.verify = value == "enabled";
+         else if (key == "cull_compaction")
+         {
+            scene.compaction_benchmark = value == "benchmark";
+            if (value == "atomic")
+               scene.compaction = Scene::CompactionAtomic;
+            else if (value == "workgroup")
+               scene.compaction = Scene::CompactionWorkgroup;
+            else
+               scene.compaction = Scene::CompactionSubgroup;
+         }
+         else if (key == "lights")
+         {
+            scene.light_benchmark = value == "benchmark";
+            if (!scene.light_benchmark)
+               scene.light_count = stoi(value);
+         }
+         else if (key == "vertex_format")
+            scene.vertex_format = value == "float" ? Scene::VertexFloat : Scene::VertexCompact;
+         else if (key == "far_points")
+         {
+            scene.point_benchmark = value == "benchmark";
+            scene.point_mode = value == "compute" ? Scene::PointCompute : Scene::PointSprites;
+         }
+         else if (key == "savestates")
+            savestate_async = value == "async";
+         else if (key == "physics")
+         {
+            scene.physics_benchmark = value == "benchmark";
+            scene.physics_amortized = value == "amortized";
+         }
+         else if (key == "physics_verify")
+            scene.physics_verify = value == "enabled";
+      }
+
+      size_t serialize_size() const override
+      {
+         return sizeof(SaveHeader) + scene.grid.count() * sizeof(Instance);
+      }
+
+      // The instances stay on the GPU, so a savestate is a snapshot of them.
+      // Exact mode (default) waits for the copy of the frame which just ran.
+      // Async mode takes the newest snapshot the GPU has finished copying,
+      // usually the previous frame's, along with the view it was taken with.
+      // Only the very first savestate waits for the GPU then. Run-ahead and
+      // rollback always get the exact state.
+      bool serialize(void *data, size_t size, bool exact) override
+      {
+         if (load_state != LoadDone || size < serialize_size())
+            return false;
+
+         uint64_t id = savestate_async && !exact ? scene.snapshots.latest_ready() : 0;
+         if (!id)
+            id = scene.captured;
+         if (!id)
+         {
+            // First savestate, nothing was captured yet.
+            id = scene.capture_now();
+            remember_view(id);
+         }
+         scene.capture = true;
+
+         const SaveHeader& header = saved_views[id % BufferSnapshots::Slots];
+         if (!id || header.id != id)
+            return false;
+
+         memcpy(data, &header, sizeof(header));
+         return scene.snapshots.read(id, static_cast<uint8_t*>(data) + sizeof(header), true);
+      }
+
+      bool unserialize(const void *data, size_t size) override
+      {
+         if (load_state != LoadDone || size < serialize_size())
+            return false;
+
+         SaveHeader header;
+         memcpy(&header, data, sizeof(header));
+         if (header.magic != SaveMagic || header.version != SaveVersion ||
+               header.instance_count != scene.grid.count())
+            return false;
+
+         if (!scene.restore(static_cast<const uint8_t*>(data) + sizeof(header)))
+            return false;
+
+         player_pos = vec3(header.player_pos[0], header.player_pos[1], header.player_pos[2]);
+         player_view_deg_x = header.view_deg_x;
+         player_view_deg_y = header.view_deg_y;
+         scene.time = header.time;
+         scene.physics_frame = header.physics_frame;
+         return true;
+      }
+
       void update_global_data()
       {
-         float zn = 1.0f;
-         float zf = 2000.0f;
+         float zn = ZNear;
+         float zf = ZFar;
          global.proj = perspective(45.0f, float(width) / float(height), zn, zf);
          global.inv_proj = inverse(global.proj);
          global.view = lookAt(player_pos, player_pos + player_look_dir, vec3(0, 1, 0));
@@ -253,6 +1172,8 @@ class BoxesApp : public LibretroGLApplication
          global_fragment.light_pos = vec4(500, 2500, -1000, 1);
          global_fragment.light_color = vec4(1.0);
          global_fragment.light_ambient = vec4(0.2);
+         global_fragment.view = global.view;
+         global_fragment.cluster_depth = vec4(zn, ClusterZ / log(zf / zn), 0.0f, 0.0f);
 
          // Compute a point size factor for point sprites.
          // Point size can be determined as size * Delta / clip.w where clip.w is depth.
@@ -306,6 +1227,7 @@ class BoxesApp : public LibretroGLApplication
 
          player_pos += velocity * mod_speed * delta;
          global.delta_time = delta;
+         scene.camera = { player_pos, velocity * mod_speed, delta };
          global.camera_vel = vec4(velocity * mod_speed, 0.0f);
          global_fragment.camera_vel = vec4(velocity * mod_speed, 0.0f);
          update_global_data();
@@ -322,7 +1244,14 @@ class BoxesApp : public LibretroGLApplication
             analog.rx = 0.0f;
          if (fabsf(analog.ry) < 0.3f)
             analog.ry = 0.0f;
+         if (!assets_ready())
+         {
+            render_progress();
+            return;
+         }
+
          update_input(delta, analog, input.pressed);
+         scene.time += delta;
 
          glViewport(0, 0, width, height);
          glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
@@ -335,7 +1264,9 @@ class BoxesApp : public LibretroGLApplication
          global_buffer.bind();
          global_fragment_buffer.bind();
 
-         scene.render(global.vp);
+         scene.render(global.vp, width, height);
+         if (scene.captured)
+            remember_view(scene.captured);
 
          skybox.tex.bind(0);
          Sampler::bind(0, Sampler::TrilinearClamp);
@@ -368,31 +1299,182 @@ class BoxesApp : public LibretroGLApplication
          player_view_deg_x = 0.0f;
          player_view_deg_y = 0.0f;
 
-         scene.init();
+         // Loading meshes takes long enough that the frontend would stall,
+         // so it runs on the loader thread while run() presents a progress
+         // bar. Textures are mip streamed and need no loader job.
+         loader.add([this]() { scene.prepare_meshes(); });
 
-         skybox.tex.load_texture({Texture::TextureCube, {
-                  "app/xpos.png",
-                  "app/xneg.png",
-                  "app/ypos.png",
-                  "app/yneg.png",
-                  "app/zpos.png",
-                  "app/zneg.png",
-               }, true});
-         skybox.shader.init("app/shaders/skybox.vs", "app/shaders/skybox.fs");
-         vector<int8_t> vertices = { -1, -1, 1, -1, -1, 1, 1, 1 };
-         skybox.vertex.init(GL_ARRAY_BUFFER, 8, Buffer::None, vertices.data());
-         skybox.arrays.setup({{Shader::VertexLocation, 2, GL_BYTE, GL_FALSE}}, { &skybox.vertex }, nullptr);
+         load_state = LoadDecoding;
+         loader.start();
+      }
+
+      void unload() override
+      {
+         try
+         {
+            loader.wait();
+         }
+         catch (const exception&)
+         {
+            // Already reported, or the game is going away regardless.
+         }
       }
 
    private:
       unsigned width = 0;
       unsigned height = 0;
 
+      enum LoadState
+      {
+         LoadDecoding,
+         LoadUploading,
+         LoadDone,
+         LoadFailed
+      };
+      LoadState load_state = LoadDecoding;
+      Loader loader;
+      Fence upload_fence;
+
+      static const vector<string> SkyboxFaces;
+
+      vector<function<void ()>> upload_steps;
+      size_t upload_step = 0;
+
+      // Hands the decoded assets to GL once the loader thread is done, one
+      // upload step per frame. Resources only become visible after the GPU
+      // has passed the fence behind the last step. A context reset
+      // re-uploads everything from the retained CPU copies, and the fence
+      // gates those uploads too.
+      bool assets_ready()
+      {
+         if (load_state == LoadDecoding)
+         {
+            if (!loader.done())
+               return false;
+
+            upload_steps = upload_assets();
+            upload_step = 0;
+            load_state = LoadUploading;
+         }
+
+         if (load_state == LoadUploading && upload_step < upload_steps.size())
+         {
+            try
+            {
+               upload_steps[upload_step++]();
+            }
+            catch (const exception& e)
+            {
+               Log::log("Loading assets failed: %s", e.what());
+               load_state = LoadFailed;
+               return false;
+            }
+
+            if (upload_step == upload_steps.size())
+               upload_fence.insert();
+            return false;
+         }
+
+         if (load_state == LoadFailed || !upload_fence.signaled())
+            return false;
+
+         if (load_state == LoadUploading)
+            Log::log("Assets loaded.");
+         load_state = LoadDone;
+         return true;
+      }
+
+      vector<function<void ()>> upload_assets()
+      {
+         // Rethrows what failed on the loader thread.
+         vector<function<void ()>> steps = { [this]() { loader.wait(); } };
+
+         auto scene_steps = scene.init_steps();
+         steps.insert(end(steps), begin(scene_steps), end(scene_steps));
+
+         steps.push_back([this]() {
+            skybox.tex.load_texture({Texture::TextureCube, SkyboxFaces, true});
+            skybox.shader.init("app/shaders/skybox.vs", "app/shaders/skybox.fs");
+            skybox.shader.compile();
+            vector<int8_t> vertices = { -1, -1, 1, -1, -1, 1, 1, 1 };
+            skybox.vertex.init(GL_ARRAY_BUFFER, 8, Buffer::None, vertices.data());
+            skybox.arrays.setup({{Shader::VertexLocation, 2, GL_BYTE, GL_FALSE}}, { &skybox.vertex }, nullptr);
+         });
+         return steps;
+      }
+
+      // Progress bar drawn with scissored clears, so it needs no resources
+      // of its own. Decoding fills the first half and the upload steps the
+      // second. Turns red if loading failed.
+      void render_progress()
+      {
+         float progress = 1.0f;
+         if (load_state == LoadDecoding)
+            progress = 0.5f * loader.progress();
+         else if (load_state == LoadUploading && upload_step < upload_steps.size())
+            progress = 0.5f + 0.5f * upload_step / upload_steps.size();
+         GLint bar_width = GLint(width * 3 / 4);
+         GLint bar_height = GLint(std::max(height / 32, 2u));
+         GLint x = GLint(width / 8);
+         GLint y = GLint(height / 2) - bar_height / 2;
+
+         glViewport(0, 0, width, height);
+         glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+
+         glEnable(GL_SCISSOR_TEST);
+         glScissor(x, y, bar_width, bar_height);
+         glClearColor(0.15f, 0.15f, 0.15f, 1.0f);
+         glClear(GL_COLOR_BUFFER_BIT);
+
+         glScissor(x, y, GLint(bar_width * progress), bar_height);
+         if (load_state == LoadFailed)
+            glClearColor(0.8f, 0.1f, 0.1f, 1.0f);
+         else
+            glClearColor(0.5f, 0.8f, 0.5f, 1.0f);
+         glClear(GL_COLOR_BUFFER_BIT);
+         glDisable(GL_SCISSOR_TEST);
+      }
+
       float player_view_deg_x = 0.0f;
       float player_view_deg_y = 0.0f;
       vec3 player_pos;
       vec3 player_look_dir{0, 0, -1};
 
+      // Precedes the instances in a savestate. The view of every captured
+      // frame is kept until its snapshot slot is reused.
+      enum { SaveMagic = 0x53584f42, SaveVersion = 2 };
+      struct SaveHeader
+      {
+         uint32_t magic;
+         uint32_t version;
+         uint32_t instance_count;
+         uint32_t physics_frame; // Instances hold the frame they were last stepped in.
+         uint64_t id; // Snapshot the view was captured with.
+         float player_pos[3];
+         float view_deg_x;
+         float view_deg_y;
+         float time;
+      };
+      SaveHeader saved_views[BufferSnapshots::Slots] = {};
+      bool savestate_async = false;
+
+      void remember_view(uint64_t id)
+      {
+         SaveHeader& header = saved_views[id % BufferSnapshots::Slots];
+         header.magic = SaveMagic;
+         header.version = SaveVersion;
+         header.instance_count = scene.grid.count();
+         header.physics_frame = scene.physics_frame;
+         header.id = id;
+         header.player_pos[0] = player_pos.x;
+         header.player_pos[1] = player_pos.y;
+         header.player_pos[2] = player_pos.z;
+         header.view_deg_x = player_view_deg_x;
+         header.view_deg_y = player_view_deg_y;
+         header.time = scene.time;
+      }
+
       struct GlobalTransforms
       {
          mat4 vp;
@@ -418,6 +1500,9 @@ class BoxesApp : public LibretroGLApplication
          vec4 light_color;
          vec4 light_ambient;
          vec2 resolution;
+         vec2 padding;
+         mat4 view;
+         vec4 cluster_depth;
       };
 
       GlobalTransforms global;
@@ -436,6 +1521,17 @@ class BoxesApp : public LibretroGLApplication
       } skybox;
 };
 
+const vector<unsigned> Scene::LightCounts = { 0, 256, 1024, 4096, 16384 };
+
+const vector<string> BoxesApp::SkyboxFaces = {
+   "app/xpos.png",
+   "app/xneg.png",
+   "app/ypos.png",
+   "app/yneg.png",
+   "app/zpos.png",
+   "app/zneg.png",
+};
+
 unique_ptr<LibretroGLApplication> libretro_gl_application_create()
 {
    return Util::make_unique<BoxesApp>();
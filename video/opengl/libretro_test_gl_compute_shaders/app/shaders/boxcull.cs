@@ -1,3 +1,13 @@
+// CULL_COMPACTION selects how surviving instances get their output slots:
+//   0: one atomic counter increment per instance.
+//   1: workgroup prefix sum in shared memory, one atomic per LOD and workgroup.
+//   2: ARB_shader_ballot, one atomic per LOD and subgroup.
+// PHYSICS_AMORTIZED steps instances further than PHYSICS_NEAR from the camera
+// only every 2nd frame, and those beyond PHYSICS_FAR every 4th.
+// The physics and its bands must match app/box_collision.hpp.
+#extension GL_ARB_shader_ballot : enable
+#extension GL_ARB_gpu_shader_int64 : enable
+
 layout(local_size_x = 4, local_size_y = 4, local_size_z = 4) in;
 
 layout(binding = GLOBAL_VERTEX_DATA) uniform GlobalVertexData
@@ -17,9 +27,36 @@ layout(binding = GLOBAL_VERTEX_DATA) uniform GlobalVertexData
    float delta_time;
 } global_vert;
 
+#define PHYSICS_NEAR 100.0
+#define PHYSICS_FAR 500.0
+#define PHYSICS_MAX_PERIOD 4u
+// vel.w holds the frame an instance was last stepped in. It is kept as a
+// float, so it wraps early enough to stay exact.
+#define PHYSICS_STAMP_MASK 0xffffffu
+
+layout(location = 0) uniform uint physics_frame;
+
+#if CULL_COMPACTION == 0
 layout(binding = 0, offset = 4) uniform atomic_uint lod0_cnt; // Outputs to instance variable.
 layout(binding = 0, offset = 24) uniform atomic_uint lod1_cnt;
 layout(binding = 0, offset = 40) uniform atomic_uint lod2_cnt; // not 44 since we're using point sprites here with glDrawArraysIndirect.
+#else
+// Same indirect buffer as above, as plain words so we can add more than one at a time.
+layout(binding = 4) buffer IndirectCommands
+{
+   uint words[];
+} indirect;
+
+uint lod_counter_word(int lod)
+{
+   return lod == 0 ? 1u : (lod == 1 ? 6u : 10u);
+}
+#endif
+
+#if CULL_COMPACTION == 1
+shared uint lod_count[3];
+shared uint lod_base[3];
+#endif
 
 struct Point
 {
@@ -53,6 +90,24 @@ uint get_invocation()
    return work_group * gl_WorkGroupSize.x * gl_WorkGroupSize.y * gl_WorkGroupSize.z + gl_LocalInvocationIndex;
 }
 
+void emit(int lod, uint slot, vec4 point)
+{
+   if (lod == 0)
+      culled0.pos[slot] = point;
+   else if (lod == 1)
+      culled1.pos[slot] = point;
+   else
+      culled2.pos[slot] = point;
+}
+
+#if CULL_COMPACTION == 2
+uint bit_count(uint64_t mask)
+{
+   uvec2 words = unpackUint2x32(mask);
+   return uint(bitCount(words.x) + bitCount(words.y));
+}
+#endif
+
 void main()
 {
    uint invocation = get_invocation();
@@ -63,43 +118,94 @@ void main()
    vec3 dist = point.xyz - global_vert.camera_pos.xyz;
    float dist_len_sq = dot(dist, dist);
 
-   vec3 accel_neg = 20000.0 * -normalize(dist) / (dot(dist, dist) + 0.001);
-   point.xyz += global_vert.delta_time * vel.xyz;
-   vel.xyz += global_vert.delta_time * accel_neg;
-
-   vec3 rel_vel = vel.xyz - global_vert.camera_vel.xyz; // Relative velocity to camera.
-   if (dist_len_sq < 10.0 && dot(rel_vel, dist) < 0.0)
-      vel.xyz = reflect(rel_vel, normalize(dist)) + global_vert.camera_vel.xyz; // Bounce factor
-
-   source_data.points[invocation].pos = point;
-   source_data.points[invocation].vel = vel;
+#if PHYSICS_AMORTIZED
+   // Staggered by work group, so every frame steps about the same share
+   // of each band and whole work groups skip together.
+   uint group = invocation / (gl_WorkGroupSize.x * gl_WorkGroupSize.y * gl_WorkGroupSize.z);
+   uint period = dist_len_sq < PHYSICS_NEAR * PHYSICS_NEAR ? 1u :
+      (dist_len_sq < PHYSICS_FAR * PHYSICS_FAR ? 2u : 4u);
+   bool due = ((physics_frame + group) & (period - 1u)) == 0u;
+#else
+   bool due = true;
+#endif
+
+   if (due)
+   {
+      // The step covers every frame since the last one, however the band
+      // changed in between.
+      uint elapsed = (physics_frame - uint(vel.w)) & PHYSICS_STAMP_MASK;
+      float delta_time = global_vert.delta_time * float(min(elapsed, PHYSICS_MAX_PERIOD));
+
+      vec3 accel_neg = 20000.0 * -normalize(dist) / (dot(dist, dist) + 0.001);
+      point.xyz += delta_time * vel.xyz;
+      vel.xyz += delta_time * accel_neg;
+
+      vec3 rel_vel = vel.xyz - global_vert.camera_vel.xyz; // Relative velocity to camera.
+      if (dist_len_sq < 10.0 && dot(rel_vel, dist) < 0.0)
+         vel.xyz = reflect(rel_vel, normalize(dist)) + global_vert.camera_vel.xyz; // Bounce factor
+
+      vel.w = float(physics_frame & PHYSICS_STAMP_MASK);
+      source_data.points[invocation].pos = point;
+      source_data.points[invocation].vel = vel;
+   }
 
    vec4 pos = vec4(point.xyz, 1.0);
 
    // Frustum cull and create instance draw lists.
-
+   // No early outs here, the aggregated paths need every invocation to take part.
    float depth = dot(pos, global_vert.frustum[0]);
-   if (depth < -point.w) // Culled
-      return;
-
+   bool visible = depth >= -point.w;
    for (int i = 1; i < 6; i++)
-      if (dot(pos, global_vert.frustum[i]) < -point.w) // Culled
-         return;
-
-   if (depth > 500.0) // LOD2
-   {
-      uint counter = atomicCounterIncrement(lod2_cnt);
-      culled2.pos[counter] = point;
-   }
-   else if (depth > 100.0) // LOD1
+      visible = visible && dot(pos, global_vert.frustum[i]) >= -point.w;
+
+   int lod = -1; // Culled
+   if (visible)
+      lod = depth > 500.0 ? 2 : (depth > 100.0 ? 1 : 0);
+
+#if CULL_COMPACTION == 0
+   if (lod == 2)
+      emit(lod, atomicCounterIncrement(lod2_cnt), point);
+   else if (lod == 1)
+      emit(lod, atomicCounterIncrement(lod1_cnt), point);
+   else if (lod == 0)
+      emit(lod, atomicCounterIncrement(lod0_cnt), point);
+#elif CULL_COMPACTION == 1
+   uint local = gl_LocalInvocationIndex;
+   if (local < 3u)
+      lod_count[local] = 0u;
+   barrier();
+
+   uint slot = 0u;
+   if (lod >= 0)
+      slot = atomicAdd(lod_count[lod], 1u);
+   barrier();
+
+   if (local < 3u && lod_count[local] != 0u)
+      lod_base[local] = atomicAdd(indirect.words[lod_counter_word(int(local))], lod_count[local]);
+   barrier();
+
+   if (lod >= 0)
+      emit(lod, lod_base[lod] + slot, point);
+#else
+   // The lowest active invocation does the atomic for the whole subgroup,
+   // which is also the one readFirstInvocationARB() reads back from.
+   uint64_t active_mask = ballotARB(true);
+   bool leader = bit_count(active_mask & gl_SubGroupLtMaskARB) == 0u;
+
+   for (int i = 0; i < 3; i++)
    {
-      uint counter = atomicCounterIncrement(lod1_cnt);
-      culled1.pos[counter] = point;
-   }
-   else // LOD0
-   {
-      uint counter = atomicCounterIncrement(lod0_cnt);
-      culled0.pos[counter] = point;
+      uint64_t mask = ballotARB(lod == i);
+      uint count = bit_count(mask);
+      if (count == 0u)
+         continue;
+
+      uint base = 0u;
+      if (leader)
+         base = atomicAdd(indirect.words[lod_counter_word(i)], count);
+      base = readFirstInvocationARB(base);
+
+      if (lod == i)
+         emit(lod, base + bit_count(mask & gl_SubGroupLtMaskARB), point);
    }
+#endif
 }
-
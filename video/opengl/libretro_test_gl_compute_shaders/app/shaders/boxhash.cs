@@ -0,0 +1,132 @@
+// Uniform spatial hash over all box instances, built with a counting sort.
+//   HASH_PASS 0: count instances per cell.
+//   HASH_PASS 1: scatter instance indices into cell order (after boxscan.cs).
+//   HASH_PASS 2: resolve sphere-sphere collisions against the 27 neighbour cells.
+// Constants and hash must match app/box_collision.hpp.
+
+layout(local_size_x = 256) in;
+
+#define HASH_CELLS (1u << 20)
+#define CELL_SIZE 4.0
+
+layout(location = 0) uniform uint instance_count;
+
+struct Point
+{
+   vec4 pos;
+   vec4 vel;
+};
+
+layout(binding = 0) buffer SourceData
+{
+   Point points[];
+} source_data;
+
+layout(binding = 1) buffer CellCount
+{
+   uint count[];
+} cell_count;
+
+layout(binding = 2) buffer CellStart
+{
+   uint start[];
+} cell_start;
+
+layout(binding = 3) buffer InstanceCell
+{
+   uint cell[];
+} instance_cell;
+
+layout(binding = 4) buffer SortedIndex
+{
+   uint index[];
+} sorted;
+
+layout(binding = 5) buffer DestData
+{
+   Point points[];
+} dest_data;
+
+uint cell_hash(ivec3 cell)
+{
+   uvec3 c = uvec3(cell);
+   return ((c.x * 73856093u) ^ (c.y * 19349663u) ^ (c.z * 83492791u)) & (HASH_CELLS - 1u);
+}
+
+ivec3 cell_coord(vec3 pos)
+{
+   return ivec3(floor(pos / CELL_SIZE));
+}
+
+void main()
+{
+   uint invocation = gl_GlobalInvocationID.x;
+   if (invocation >= instance_count)
+      return;
+
+#if HASH_PASS == 0
+   uint cell = cell_hash(cell_coord(source_data.points[invocation].pos.xyz));
+   instance_cell.cell[invocation] = cell;
+   atomicAdd(cell_count.count[cell], 1u);
+#elif HASH_PASS == 1
+   // Counting down also leaves the counts cleared for the next frame.
+   uint cell = instance_cell.cell[invocation];
+   uint slot = cell_start.start[cell] + atomicAdd(cell_count.count[cell], uint(-1)) - 1u;
+   sorted.index[slot] = invocation;
+#else
+   Point self = source_data.points[invocation];
+   ivec3 base = cell_coord(self.pos.xyz);
+
+   vec3 push = vec3(0.0);
+   vec3 impulse = vec3(0.0);
+   uint visited[27];
+   uint num_visited = 0u;
+
+   for (int z = -1; z <= 1; z++)
+      for (int y = -1; y <= 1; y++)
+         for (int x = -1; x <= 1; x++)
+         {
+            uint cell = cell_hash(base + ivec3(x, y, z));
+
+            // Distinct neighbour cells can alias in the hash table,
+            // don't visit the same bucket twice.
+            bool seen = false;
+            for (uint i = 0u; i < num_visited; i++)
+               seen = seen || visited[i] == cell;
+            if (seen)
+               continue;
+            visited[num_visited++] = cell;
+
+            uint begin = cell_start.start[cell];
+            uint end = cell + 1u < HASH_CELLS ? cell_start.start[cell + 1u] : instance_count;
+
+            for (uint i = begin; i < end; i++)
+            {
+               uint other_index = sorted.index[i];
+               if (other_index == invocation)
+                  continue;
+
+               Point other = source_data.points[other_index];
+               vec3 dist = self.pos.xyz - other.pos.xyz;
+               float radius = self.pos.w + other.pos.w;
+               float dist_sq = dot(dist, dist);
+               if (dist_sq >= radius * radius || dist_sq < 1e-8)
+                  continue;
+
+               // Equal masses, so each side takes half of the penetration
+               // and swaps the approaching part of the relative velocity.
+               float dist_len = sqrt(dist_sq);
+               vec3 normal = dist / dist_len;
+               push += 0.5 * (radius - dist_len) * normal;
+
+               float approach = dot(self.vel.xyz - other.vel.xyz, normal);
+               if (approach < 0.0)
+                  impulse -= approach * normal;
+            }
+         }
+
+   self.pos.xyz += push;
+   self.vel.xyz += impulse;
+   dest_data.points[invocation] = self;
+#endif
+}
@@ -0,0 +1,54 @@
+// Generates the initial instance grid straight into the model buffer.
+// Instance i sits at grid cell (x, y, z) in [-base, base), x varying fastest.
+// Velocities are hashed from the seed and scaled by jitter.
+// Layout and hash must match BoxCollision::grid_instance().
+
+layout(local_size_x = 64) in;
+
+layout(location = 0) uniform int base;
+layout(location = 1) uniform float spacing;
+layout(location = 2) uniform float radius;
+layout(location = 3) uniform uint seed;
+layout(location = 4) uniform float jitter;
+
+struct Point
+{
+   vec4 pos;
+   vec4 vel;
+};
+
+layout(binding = 0) buffer ModelData
+{
+   Point points[];
+} model_data;
+
+uint grid_hash(uint v)
+{
+   v = v * 747796405u + 2891336453u;
+   uint w = ((v >> ((v >> 28u) + 4u)) ^ v) * 277803737u;
+   return (w >> 22u) ^ w;
+}
+
+float grid_unorm(uint h)
+{
+   return float(h >> 8u) * (1.0 / 16777216.0);
+}
+
+void main()
+{
+   uvec3 id = gl_GlobalInvocationID;
+   uint dim = uint(2 * base);
+   if (id.x >= dim)
+      return;
+
+   uint index = (id.z * dim + id.y) * dim + id.x;
+   vec3 cell = vec3(ivec3(id) - ivec3(base));
+
+   uint h0 = grid_hash(index ^ (seed * 0x9e3779b9u));
+   uint h1 = grid_hash(h0);
+   uint h2 = grid_hash(h1);
+   vec3 vel = (vec3(grid_unorm(h0), grid_unorm(h1), grid_unorm(h2)) * 2.0 - 1.0) * jitter;
+
+   model_data.points[index].pos = vec4(cell * spacing, radius);
+   model_data.points[index].vel = vec4(vel, 0.0);
+}
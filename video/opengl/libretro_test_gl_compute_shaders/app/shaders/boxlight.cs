@@ -0,0 +1,140 @@
+// Clustered point lights.
+//   LIGHT_PASS 0: animate the lights, store world and view space positions.
+//   LIGHT_PASS 1: one work group per froxel, lists the lights touching it.
+// Froxels split the screen into CLUSTER_X x CLUSTER_Y tiles and view depth
+// into CLUSTER_Z exponential slices. Constants must match app/box_lights.hpp.
+
+#define CLUSTER_X 16
+#define CLUSTER_Y 9
+#define CLUSTER_Z 24
+#define MAX_CLUSTER_LIGHTS 256u
+
+layout(local_size_x = 64) in;
+
+layout(binding = GLOBAL_VERTEX_DATA) uniform GlobalVertexData
+{
+   mat4 vp;
+   mat4 view;
+   mat4 view_nt;
+   mat4 proj;
+   mat4 inv_vp;
+   mat4 inv_view;
+   mat4 inv_view_nt;
+   mat4 inv_proj;
+} global_vert;
+
+layout(location = 0) uniform uint light_count;
+layout(location = 1) uniform float time;
+layout(location = 2) uniform vec2 depth_range;
+
+struct Light
+{
+   vec4 pos_radius;
+   vec4 color;
+   vec4 motion;
+};
+
+struct AnimatedLight
+{
+   vec4 pos_radius;
+   vec4 color;
+   vec4 view_pos_radius;
+};
+
+layout(binding = 0) buffer LightData
+{
+   Light lights[];
+} light_data;
+
+layout(binding = 1) buffer AnimatedLightData
+{
+   AnimatedLight lights[];
+} animated;
+
+layout(binding = 2) buffer ClusterCount
+{
+   uint count[];
+} cluster_count;
+
+layout(binding = 3) buffer ClusterLights
+{
+   uint index[];
+} cluster_lights;
+
+#if LIGHT_PASS == 0
+void main()
+{
+   uint i = gl_GlobalInvocationID.x;
+   if (i >= light_count)
+      return;
+
+   Light light = light_data.lights[i];
+   vec3 swing = sin(vec3(time * 0.5 + light.motion.w) + vec3(0.0, 1.3, 2.6));
+   vec3 pos = light.pos_radius.xyz + light.motion.xyz * swing;
+
+   animated.lights[i].pos_radius = vec4(pos, light.pos_radius.w);
+   animated.lights[i].color = light.color;
+   animated.lights[i].view_pos_radius = vec4((global_vert.view * vec4(pos, 1.0)).xyz, light.pos_radius.w);
+}
+#else
+shared vec3 cluster_min;
+shared vec3 cluster_max;
+shared uint cluster_used;
+
+vec3 view_at_depth(vec2 ndc, float depth)
+{
+   vec4 p = global_vert.inv_proj * vec4(ndc, -1.0, 1.0);
+   p.xyz /= p.w;
+   return p.xyz * (depth / -p.z);
+}
+
+void main()
+{
+   uvec3 cluster = gl_WorkGroupID;
+   uint cluster_index = (cluster.z * CLUSTER_Y + cluster.y) * CLUSTER_X + cluster.x;
+
+   if (gl_LocalInvocationIndex == 0u)
+   {
+      vec2 ndc0 = vec2(cluster.xy) / vec2(CLUSTER_X, CLUSTER_Y) * 2.0 - 1.0;
+      vec2 ndc1 = vec2(cluster.xy + 1u) / vec2(CLUSTER_X, CLUSTER_Y) * 2.0 - 1.0;
+      float ratio = depth_range.y / depth_range.x;
+      float near = depth_range.x * pow(ratio, float(cluster.z) / CLUSTER_Z);
+      float far = depth_range.x * pow(ratio, float(cluster.z + 1u) / CLUSTER_Z);
+
+      vec3 lo = vec3(1e30);
+      vec3 hi = vec3(-1e30);
+      for (int c = 0; c < 4; c++)
+      {
+         vec2 ndc = vec2((c & 1) != 0 ? ndc1.x : ndc0.x, (c & 2) != 0 ? ndc1.y : ndc0.y);
+         vec3 a = view_at_depth(ndc, near);
+         vec3 b = view_at_depth(ndc, far);
+         lo = min(lo, min(a, b));
+         hi = max(hi, max(a, b));
+      }
+      cluster_min = lo;
+      cluster_max = hi;
+      cluster_used = 0u;
+   }
+   barrier();
+
+   vec3 lo = cluster_min;
+   vec3 hi = cluster_max;
+   uint base = cluster_index * MAX_CLUSTER_LIGHTS;
+
+   for (uint i = gl_LocalInvocationIndex; i < light_count; i += gl_WorkGroupSize.x)
+   {
+      vec4 light = animated.lights[i].view_pos_radius;
+      vec3 d = max(max(lo - light.xyz, light.xyz - hi), vec3(0.0));
+      if (dot(d, d) <= light.w * light.w)
+      {
+         uint slot = atomicAdd(cluster_used, 1u);
+         if (slot < MAX_CLUSTER_LIGHTS)
+            cluster_lights.index[base + slot] = i;
+      }
+   }
+   barrier();
+
+   if (gl_LocalInvocationIndex == 0u)
+      cluster_count.count[cluster_index] = min(cluster_used, MAX_CLUSTER_LIGHTS);
+}
+#endif
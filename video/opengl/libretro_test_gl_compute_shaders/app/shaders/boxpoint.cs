@@ -0,0 +1,117 @@
+// Rasterizes the far LOD instances in compute instead of as point sprites.
+// Every pixel a point covers folds its depth and colour into the target
+// with atomicMin, depth in the high bits so the nearest point wins.
+// boxpoint_resolve.fs then writes the survivors to colour and depth.
+//   POINT_ATOMIC64 1: 64-bit atomics, float depth over RGBA8 colour.
+//   POINT_ATOMIC64 0: 32-bit atomics, 24-bit depth over the 8-bit diffuse
+//                     term, the resolve rebuilds the colour from it.
+// Shading and size match boxrender_point.vs.
+// Shader::compile_shader() hoists #extension out of any #if, so these
+// can only be enabled, not required.
+#extension GL_ARB_gpu_shader_int64 : enable
+#extension GL_NV_shader_atomic_int64 : enable
+
+#define POINT_COUNT_WORD 10
+#define MAX_POINT_SIZE 16.0
+
+layout(local_size_x = 64) in;
+
+layout(binding = GLOBAL_VERTEX_DATA) uniform GlobalVertexData
+{
+   mat4 vp;
+   mat4 view;
+   mat4 view_nt;
+   mat4 proj;
+   mat4 inv_vp;
+   mat4 inv_view;
+   mat4 inv_view_nt;
+   mat4 inv_proj;
+   vec4 camera_pos;
+   vec4 camera_vel;
+   vec4 resolution;
+} global_vert;
+
+layout(binding = GLOBAL_FRAGMENT_DATA) uniform GlobalFragmentData
+{
+   vec4 camera_pos;
+   vec4 camera_vel;
+   vec4 light_pos;
+   vec4 light_color;
+   vec4 light_ambient;
+   vec2 resolution;
+} global_frag;
+
+#if POINT_ATOMIC64
+layout(binding = MATERIAL) uniform Material
+{
+   vec4 ambient;
+   vec4 diffuse;
+   vec4 specular;
+   float specular_power;
+} material;
+#endif
+
+layout(binding = 0) readonly buffer Points
+{
+   vec4 pos[];
+} points;
+
+// The indirect draw commands, the far LOD count is the third command's count.
+layout(binding = 1) readonly buffer Commands
+{
+   uint words[];
+} commands;
+
+layout(binding = 2) buffer Target
+{
+#if POINT_ATOMIC64
+   uint64_t texels[];
+#else
+   uint texels[];
+#endif
+} target;
+
+void main()
+{
+   uint count = commands.words[POINT_COUNT_WORD];
+   ivec2 size = ivec2(global_vert.resolution.xy);
+   uint stride = gl_NumWorkGroups.x * gl_WorkGroupSize.x;
+
+   for (uint i = gl_GlobalInvocationID.x; i < count; i += stride)
+   {
+      vec3 world = points.pos[i].xyz;
+      vec4 clip = global_vert.vp * vec4(world, 1.0);
+      if (clip.w <= 0.0)
+         continue;
+
+      vec3 ndc = clip.xyz / clip.w;
+      float depth = ndc.z * 0.5 + 0.5;
+      if (depth < 0.0 || depth > 1.0)
+         continue;
+
+      // Pixels whose centre falls inside the point square, like sprites.
+      vec2 window = (ndc.xy * 0.5 + 0.5) * vec2(size);
+      float point_size = dot(vec2(0.5), 2.2 * global_vert.resolution.zw / clip.w);
+      float half_size = 0.5 * clamp(point_size, 1.0, MAX_POINT_SIZE);
+      ivec2 lo = max(ivec2(ceil(window - half_size - 0.5)), ivec2(0));
+      ivec2 hi = min(ivec2(ceil(window + half_size - 0.5)) - 1, size - 1);
+
+      vec3 vEye = normalize(global_frag.camera_pos.xyz - world);
+      vec3 vLight = normalize(global_frag.light_pos.xyz - world);
+      float ndotl = max(dot(vLight, vEye), 0.0);
+
+#if POINT_ATOMIC64
+      float light_mod = 0.5;
+      vec3 ambient = global_frag.light_ambient.rgb * material.ambient.rgb;
+      vec3 diffuse = light_mod * ndotl * global_frag.light_color.rgb * material.diffuse.rgb;
+      vec3 color = sqrt(ambient + diffuse);
+      uint64_t value = packUint2x32(uvec2(packUnorm4x8(vec4(color, 1.0)), floatBitsToUint(depth)));
+#else
+      uint value = (uint(depth * 16777215.0) << 8) | uint(ndotl * 255.0 + 0.5);
+#endif
+
+      for (int y = lo.y; y <= hi.y; y++)
+         for (int x = lo.x; x <= hi.x; x++)
+            atomicMin(target.texels[y * size.x + x], value);
+   }
+}
@@ -0,0 +1,64 @@
+// Writes the points rasterized by boxpoint.cs to colour and depth, and
+// clears the target for the next frame on the way. Pixels no point
+// touched are discarded, the depth test sorts the rest against the scene.
+#extension GL_ARB_gpu_shader_int64 : enable
+
+layout(binding = GLOBAL_FRAGMENT_DATA) uniform GlobalFragmentData
+{
+   vec4 camera_pos;
+   vec4 camera_vel;
+   vec4 light_pos;
+   vec4 light_color;
+   vec4 light_ambient;
+   vec2 resolution;
+} global_frag;
+
+#if !POINT_ATOMIC64
+layout(binding = MATERIAL) uniform Material
+{
+   vec4 ambient;
+   vec4 diffuse;
+   vec4 specular;
+   float specular_power;
+} material;
+#endif
+
+layout(binding = 2) buffer Target
+{
+#if POINT_ATOMIC64
+   uint64_t texels[];
+#else
+   uint texels[];
+#endif
+} target;
+
+out vec4 FragColor;
+
+void main()
+{
+   ivec2 coord = ivec2(gl_FragCoord.xy);
+   int index = coord.y * int(global_frag.resolution.x) + coord.x;
+
+#if POINT_ATOMIC64
+   uint64_t value = target.texels[index];
+   target.texels[index] = ~0ul;
+   if (value == ~0ul)
+      discard;
+
+   uvec2 words = unpackUint2x32(value);
+   FragColor = unpackUnorm4x8(words.x);
+   gl_FragDepth = uintBitsToFloat(words.y);
+#else
+   uint value = target.texels[index];
+   target.texels[index] = ~0u;
+   if (value == ~0u)
+      discard;
+
+   float ndotl = float(value & 0xffu) / 255.0;
+   float light_mod = 0.5;
+   vec3 ambient = global_frag.light_ambient.rgb * material.ambient.rgb;
+   vec3 diffuse = light_mod * ndotl * global_frag.light_color.rgb * material.diffuse.rgb;
+   FragColor = vec4(sqrt(ambient + diffuse), 1.0);
+   gl_FragDepth = float(value >> 8) / 16777215.0;
+#endif
+}
@@ -0,0 +1,6 @@
+// Full screen triangle, no vertex input.
+void main()
+{
+   vec2 pos = vec2(gl_VertexID & 1, gl_VertexID >> 1) * 4.0 - 1.0;
+   gl_Position = vec4(pos, 0.0, 1.0);
+}
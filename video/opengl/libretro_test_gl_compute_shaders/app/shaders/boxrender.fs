@@ -6,6 +6,8 @@ layout(binding = GLOBAL_FRAGMENT_DATA) uniform GlobalFragmentData
    vec4 light_color;
    vec4 light_ambient;
    vec2 resolution;
+   mat4 view;
+   vec4 cluster_depth; // Near plane, CLUSTER_Z / log(far / near).
 } global_frag;
 
 layout(binding = MATERIAL) uniform Material
@@ -29,6 +31,45 @@ layout(binding = 0) uniform sampler2D Diffuse;
 
 out vec4 FragColor;
 
+#if CLUSTERED_LIGHTS
+// Written by app/shaders/boxlight.cs, constants must match.
+#define CLUSTER_X 16
+#define CLUSTER_Y 9
+#define CLUSTER_Z 24
+#define MAX_CLUSTER_LIGHTS 256u
+
+struct AnimatedLight
+{
+   vec4 pos_radius;
+   vec4 color;
+   vec4 view_pos_radius;
+};
+
+layout(binding = 1) readonly buffer AnimatedLightData
+{
+   AnimatedLight lights[];
+} animated;
+
+layout(binding = 2) readonly buffer ClusterCount
+{
+   uint count[];
+} cluster_count;
+
+layout(binding = 3) readonly buffer ClusterLights
+{
+   uint index[];
+} cluster_lights;
+
+uint cluster_index()
+{
+   float view_z = -(global_frag.view * vec4(fin.world, 1.0)).z;
+   int slice = clamp(int(log(view_z / global_frag.cluster_depth.x) * global_frag.cluster_depth.y), 0, CLUSTER_Z - 1);
+   ivec2 tile = clamp(ivec2(gl_FragCoord.xy / global_frag.resolution * vec2(CLUSTER_X, CLUSTER_Y)),
+         ivec2(0), ivec2(CLUSTER_X - 1, CLUSTER_Y - 1));
+   return uint((slice * CLUSTER_Y + tile.y) * CLUSTER_X + tile.x);
+}
+#endif
+
 void main()
 {
    vec3 vEye = normalize(global_frag.camera_pos.xyz - fin.world);
@@ -56,7 +97,29 @@ void main()
 #endif
 
    vec3 ambient = global_frag.light_ambient.rgb * mix(material.ambient.rgb, diffuse_term.rgb, diffuse_term.a);
-   vec3 diffuse = light_mod * ndotl * global_frag.light_color.rgb * mix(material.diffuse.rgb, diffuse_term.rgb, diffuse_term.a);
+   vec3 albedo = mix(material.diffuse.rgb, diffuse_term.rgb, diffuse_term.a);
+   vec3 diffuse = light_mod * ndotl * global_frag.light_color.rgb * albedo;
+
+#if CLUSTERED_LIGHTS
+   uint cluster = cluster_index();
+   uint count = cluster_count.count[cluster];
+   for (uint i = 0u; i < count; i++)
+   {
+      AnimatedLight light = animated.lights[cluster_lights.index[cluster * MAX_CLUSTER_LIGHTS + i]];
+      vec3 to_light = light.pos_radius.xyz - fin.world;
+      float dist2 = dot(to_light, to_light);
+      float falloff = clamp(1.0 - dist2 / (light.pos_radius.w * light.pos_radius.w), 0.0, 1.0);
+      vec3 l = to_light * inversesqrt(max(dist2, 1e-6));
+      vec3 radiance = light.color.rgb * falloff * falloff;
+
+      diffuse += max(dot(l, normal), 0.0) * radiance * albedo;
+#if LOD == 0
+      float spec_mod = max(dot(normalize(l + vEye), normal), 0.001);
+      specular += radiance * material.specular.xyz * pow(spec_mod, material.specular_power);
+#endif
+   }
+#endif
+
    FragColor = sqrt(vec4(ambient + diffuse + specular, 1.0));
 }
 
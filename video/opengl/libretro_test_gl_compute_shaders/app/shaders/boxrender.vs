@@ -11,8 +11,26 @@ layout(binding = GLOBAL_VERTEX_DATA) uniform GlobalVertexData
    vec4 camera_pos;
 } global_vert;
 
+#if COMPACT_VERTEX
+// Mesh::PackedVertex, positions are unorm16 within the mesh AABB and
+// normals are octahedral encoded.
+layout(location = 0) uniform vec3 aabb_base;
+layout(location = 1) uniform vec3 aabb_offset;
+
+layout(location = VERTEX) in vec3 aVertex;
+layout(location = NORMAL) in vec2 aNormal;
+
+vec3 decode_octahedral(vec2 e)
+{
+   vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+   float t = max(-n.z, 0.0);
+   n.xy += mix(vec2(t), vec2(-t), greaterThanEqual(n.xy, vec2(0.0)));
+   return normalize(n);
+}
+#else
 layout(location = VERTEX) in vec3 aVertex;
 layout(location = NORMAL) in vec3 aNormal;
+#endif
 layout(location = TEXCOORD) in vec2 aTexCoord;
 layout(location = 3) in vec4 aPos;
 
@@ -25,11 +43,18 @@ out VertexData
 
 void main()
 {
-   vec4 world = vec4(aVertex + aPos.xyz, 1.0);
+#if COMPACT_VERTEX
+   vec3 vertex = aVertex * aabb_offset + aabb_base;
+   vec3 normal = decode_octahedral(aNormal);
+#else
+   vec3 vertex = aVertex;
+   vec3 normal = aNormal;
+#endif
+   vec4 world = vec4(vertex + aPos.xyz, 1.0);
 
    gl_Position = global_vert.vp * world;
 
-   vout.normal = aNormal;
+   vout.normal = normal;
 
    vout.world = world.xyz;
    vout.tex = vec2(aTexCoord.x, 1.0 - aTexCoord.y);
@@ -0,0 +1,84 @@
+// Exclusive prefix sum of the spatial hash cell counts, in three passes.
+//   SCAN_PASS 0: scan each block of SCAN_BLOCK counts, write block totals.
+//   SCAN_PASS 1: scan the block totals in place (one work group).
+//   SCAN_PASS 2: add the scanned block totals back onto each block.
+
+#define SCAN_BLOCK 1024u
+
+layout(local_size_x = 512) in;
+
+layout(binding = 0) buffer ScanInput
+{
+   uint data[];
+} scan_input;
+
+layout(binding = 1) buffer ScanOutput
+{
+   uint data[];
+} scan_output;
+
+layout(binding = 2) buffer BlockSums
+{
+   uint data[];
+} block_sums;
+
+shared uint scratch[SCAN_BLOCK];
+
+void main()
+{
+   uint local = gl_LocalInvocationID.x;
+   uint base = gl_WorkGroupID.x * SCAN_BLOCK;
+
+#if SCAN_PASS == 2
+   uint offset = block_sums.data[gl_WorkGroupID.x];
+   scan_output.data[base + 2u * local + 0u] += offset;
+   scan_output.data[base + 2u * local + 1u] += offset;
+#else
+   scratch[2u * local + 0u] = scan_input.data[base + 2u * local + 0u];
+   scratch[2u * local + 1u] = scan_input.data[base + 2u * local + 1u];
+
+   // Up-sweep.
+   uint stride = 1u;
+   for (uint d = SCAN_BLOCK >> 1u; d > 0u; d >>= 1u)
+   {
+      barrier();
+      if (local < d)
+      {
+         uint a = stride * (2u * local + 1u) - 1u;
+         uint b = stride * (2u * local + 2u) - 1u;
+         scratch[b] += scratch[a];
+      }
+      stride <<= 1u;
+   }
+
+   barrier();
+   uint total = scratch[SCAN_BLOCK - 1u];
+   barrier();
+   if (local == 0u)
+      scratch[SCAN_BLOCK - 1u] = 0u;
+
+   // Down-sweep.
+   for (uint d = 1u; d < SCAN_BLOCK; d <<= 1u)
+   {
+      stride >>= 1u;
+      barrier();
+      if (local < d)
+      {
+         uint a = stride * (2u * local + 1u) - 1u;
+         uint b = stride * (2u * local + 2u) - 1u;
+         uint t = scratch[a];
+         scratch[a] = scratch[b];
+         scratch[b] += t;
+      }
+   }
+   barrier();
+
+   scan_output.data[base + 2u * local + 0u] = scratch[2u * local + 0u];
+   scan_output.data[base + 2u * local + 1u] = scratch[2u * local + 1u];
+
+#if SCAN_PASS == 0
+   if (local == 0u)
+      block_sums.data[gl_WorkGroupID.x] = total;
+#endif
+#endif
+}
@@ -1,4 +1,5 @@
 #include "buffer.hpp"
+#include "state_cache.hpp"
 
 namespace GL
 {
@@ -35,15 +36,25 @@ namespace GL
    {
       alive = false;
       if (id)
+      {
+         StateCache::get().forget_buffer(id);
          glDeleteBuffers(1, &id);
+      }
       id = 0;
    }
 
    void Buffer::unmap()
    {
-      glBindBuffer(target, id);
+      StateCache::get().bind_buffer(target, id);
       glUnmapBuffer(target);
-      glBindBuffer(target, 0);
+      StateCache::get().bind_buffer(target, 0);
+   }
+
+   void Buffer::read(void *data, GLsizei size, GLintptr offset)
+   {
+      StateCache::get().bind_buffer(target, id);
+      glGetBufferSubData(target, offset, size, data);
+      StateCache::get().bind_buffer(target, 0);
    }
 
    bool Buffer::is_indexed(GLenum type)
@@ -61,38 +72,38 @@ namespace GL
 
    void Buffer::bind_indexed(GLenum target, unsigned index)
    {
-      glBindBufferBase(target, index, id);
+      StateCache::get().bind_buffer_base(target, index, id);
    }
 
    void Buffer::unbind_indexed(GLenum target, unsigned index)
    {
-      glBindBufferBase(target, index, 0);
+      StateCache::get().unbind_buffer_base(target, index);
    }
 
    void Buffer::bind(GLenum target)
    {
-      glBindBuffer(target, id);
+      StateCache::get().bind_buffer(target, id);
    }
 
    void Buffer::unbind(GLenum target)
    {
-      glBindBuffer(target, 0);
+      StateCache::get().bind_buffer(target, 0);
    }
 
    void Buffer::bind()
    {
       if (is_indexed(target))
-         glBindBufferBase(target, index, id);
+         StateCache::get().bind_buffer_base(target, index, id);
       else
-         glBindBuffer(target, id);
+         StateCache::get().bind_buffer(target, id);
    }
 
    void Buffer::unbind()
    {
       if (is_indexed(target))
-         glBindBufferBase(target, index, 0);
+         StateCache::get().unbind_buffer_base(target, index);
       else
-         glBindBuffer(target, 0);
+         StateCache::get().bind_buffer(target, 0);
    }
 
    GLenum Buffer::gl_usage_from_flags(GLuint flags)
@@ -108,9 +119,9 @@ namespace GL
 
    void Buffer::init_buffer(const void *initial_data)
    {
-      glBindBuffer(target, id);
+      StateCache::get().bind_buffer(target, id);
       glBufferData(target, size, initial_data, gl_usage_from_flags(flags));
-      glBindBuffer(target, 0);
+      StateCache::get().bind_buffer(target, 0);
    }
 }
 
@@ -38,14 +38,15 @@ namespace GL
                if (!size || !id || flags == None)
                   return false;
 
-               glBindBuffer(target, id);
+               bind(target);
                void *ptr = glMapBufferRange(target, 0, size, flags == WriteOnly ? (GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT) : GL_MAP_READ_BIT);
                data = reinterpret_cast<T*>(ptr);
-               glBindBuffer(target, 0);
+               unbind(target);
                return ptr != nullptr;
             }
 
          void unmap();
+         void read(void *data, GLsizei size, GLintptr offset = 0);
          void bind();
          void unbind();
 
@@ -0,0 +1,49 @@
+#include "fence.hpp"
+
+namespace GL
+{
+   void Fence::insert()
+   {
+      if (!alive)
+      {
+         pending = true;
+         return;
+      }
+
+      if (sync)
+         glDeleteSync(sync);
+      sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+      pending = false;
+   }
+
+   bool Fence::signaled()
+   {
+      if (pending)
+         insert();
+
+      if (!sync)
+         return alive;
+
+      GLenum ret = glClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+      if (ret != GL_ALREADY_SIGNALED && ret != GL_CONDITION_SATISFIED)
+         return false;
+
+      glDeleteSync(sync);
+      sync = nullptr;
+      return true;
+   }
+
+   void Fence::reset()
+   {
+      alive = true;
+      pending = true;
+   }
+
+   void Fence::destroyed()
+   {
+      if (sync)
+         glDeleteSync(sync);
+      sync = nullptr;
+      alive = false;
+   }
+}
@@ -0,0 +1,32 @@
+#ifndef FENCE_HPP__
+#define FENCE_HPP__
+
+#include "global.hpp"
+
+namespace GL
+{
+   // Tracks when the GPU has consumed all commands issued up to insert().
+   // After a context reset every resource has been recreated and uploaded
+   // again, so the next signaled() places a fence behind those uploads.
+   class Fence : public ContextListener, public ContextResource
+   {
+      public:
+         Fence() { ContextListener::init(); }
+         ~Fence() { deinit(); }
+
+         void insert();
+
+         // Non-blocking. True once the GPU has passed the fence.
+         bool signaled();
+
+         void reset() override;
+         void destroyed() override;
+
+      private:
+         GLsync sync = nullptr;
+         bool alive = false;
+         bool pending = false;
+   };
+}
+
+#endif
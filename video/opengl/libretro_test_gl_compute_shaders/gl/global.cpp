@@ -1,4 +1,5 @@
 #include "global.hpp"
+#include "state_cache.hpp"
 #include <memory>
 #include <algorithm>
 
@@ -167,8 +168,21 @@ namespace GL
       erase_all(listeners, itr);
    }
 
+   bool ContextManager::has_extension(const string& name) const
+   {
+      return find(begin(extensions), end(extensions), name) != end(extensions);
+   }
+
    void ContextManager::notify_reset()
    {
+      GLint num_extensions = 0;
+      glGetIntegerv(GL_NUM_EXTENSIONS, &num_extensions);
+      extensions.clear();
+      for (GLint i = 0; i < num_extensions; i++)
+         extensions.push_back(reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, i)));
+
+      StateCache::get().invalidate();
+
       alive = true;
       for (auto& state : listeners)
          state->reset_chain();
@@ -179,6 +193,8 @@ namespace GL
       for (auto& state : listeners)
          state->destroy_chain();
       alive = false;
+
+      StateCache::get().invalidate();
    }
 
    void ContextManager::ListenerState::reset_chain()
@@ -46,17 +46,35 @@ namespace GL
             Buttons triggered;
          };
 
+         // Application specific core options. The key is prefixed with the
+         // short application name, the description uses the libretro
+         // "Label; value1|value2" format with the first value as default.
+         struct Option
+         {
+            std::string key;
+            std::string description;
+         };
+
          virtual void get_context_version(unsigned& major, unsigned& minor) const = 0;
          virtual void get_system_info(retro_system_info& info) const = 0;
          virtual void get_system_av_info(retro_system_av_info& info) const = 0;
          virtual std::string get_application_name() const = 0;
          virtual std::string get_application_name_short() const = 0;
          virtual std::vector<Resolution> get_resolutions() const = 0;
+         virtual std::vector<Option> get_options() const { return {}; }
+         virtual void option_changed(const std::string&, const std::string&) {}
 
          virtual void load() {}
          virtual void unload() {}
          virtual void viewport_changed(const Resolution& res) = 0;
          virtual void run(float delta, const InputState& input) = 0;
+
+         // Savestates. The size must not change once a game is loaded.
+         virtual size_t serialize_size() const { return 0; }
+         // Exact is set when the state has to be the frame which just ran,
+         // as for run-ahead and netplay rollback.
+         virtual bool serialize(void *, size_t, bool) { return false; }
+         virtual bool unserialize(const void *, size_t) { return false; }
    };
 
    class ContextListener
@@ -96,6 +114,8 @@ namespace GL
          void register_dependency(ContextListener *master, ContextListener *slave);
          void unregister_dependency(ContextListener *master, ContextListener *slave);
 
+         bool has_extension(const std::string& name) const;
+
          void set_dir(const std::string& dir) { libretro_dir = dir; }
          inline std::string path(const std::string& p)
          {
@@ -131,6 +151,7 @@ namespace GL
          uint64_t context_id = 0;
 
          std::string libretro_dir;
+         std::vector<std::string> extensions;
    };
 
    inline std::string asset_path(const std::string& path)
@@ -138,6 +159,11 @@ namespace GL
       return ContextManager::get().path(path);
    }
 
+   inline bool has_extension(const std::string& name)
+   {
+      return ContextManager::get().has_extension(name);
+   }
+
    // Non-copyable, non-movable stubs.
    class ContextResource
    {
@@ -0,0 +1,60 @@
+#include "loader.hpp"
+
+using namespace std;
+
+namespace GL
+{
+   Loader::~Loader()
+   {
+      if (thread.joinable())
+         thread.join();
+   }
+
+   void Loader::start()
+   {
+      if (thread.joinable())
+         thread.join();
+
+      total = jobs.size();
+      completed = 0;
+      finished = false;
+      error = nullptr;
+
+      thread = std::thread([this]() {
+         try
+         {
+            for (auto& job : jobs)
+            {
+               job();
+               completed++;
+            }
+         }
+         catch (...)
+         {
+            error = current_exception();
+         }
+         jobs.clear();
+         finished = true;
+      });
+   }
+
+   float Loader::progress() const
+   {
+      if (finished)
+         return 1.0f;
+      return total ? float(completed) / total : 0.0f;
+   }
+
+   void Loader::wait()
+   {
+      if (thread.joinable())
+         thread.join();
+
+      if (error)
+      {
+         auto e = error;
+         error = nullptr;
+         rethrow_exception(e);
+      }
+   }
+}
@@ -0,0 +1,43 @@
+#ifndef LOADER_HPP__
+#define LOADER_HPP__
+
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace GL
+{
+   // Runs CPU-side asset work (file reads, decoding, generating data) on a
+   // background thread. Jobs must not touch GL; whatever they produce is
+   // handed to GL objects on the main thread once done() returns true.
+   class Loader
+   {
+      public:
+         Loader() {}
+         ~Loader();
+
+         Loader(const Loader&) = delete;
+         Loader& operator=(const Loader&) = delete;
+
+         void add(std::function<void ()> job) { jobs.push_back(std::move(job)); }
+         void start();
+
+         bool done() const { return finished; }
+         float progress() const;
+
+         // Joins the loader thread and rethrows the first job failure.
+         void wait();
+
+      private:
+         std::vector<std::function<void ()>> jobs;
+         std::thread thread;
+         unsigned total = 0;
+         std::atomic<unsigned> completed{0};
+         std::atomic<bool> finished{false};
+         std::exception_ptr error;
+   };
+}
+
+#endif
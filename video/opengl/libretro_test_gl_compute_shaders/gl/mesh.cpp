@@ -1,6 +1,7 @@
 #include "mesh.hpp"
 #include "shader.hpp"
 #include <set>
+#include <cstddef>
 
 using namespace std;
 using namespace glm;
@@ -111,6 +112,101 @@ namespace GL
          array.stride = offset;
    }
 
+   // Picks the octahedral encoding whose snorm8 rounding decodes
+   // closest to n, plain rounding is visibly off in the specular.
+   static void encode_octahedral(vec3 n, int8_t *out)
+   {
+      n /= abs(n.x) + abs(n.y) + abs(n.z);
+      vec2 e(n.x, n.y);
+      if (n.z < 0.0f)
+      {
+         e = (vec2(1.0f) - abs(vec2(n.y, n.x))) *
+            vec2(n.x >= 0.0f ? 1.0f : -1.0f, n.y >= 0.0f ? 1.0f : -1.0f);
+      }
+
+      vec2 base = floor(clamp(e, vec2(-1.0f), vec2(1.0f)) * 127.0f);
+      float best = -2.0f;
+      for (unsigned i = 0; i < 4; i++)
+      {
+         vec2 q = clamp(base + vec2(float(i & 1), float(i >> 1)), vec2(-127.0f), vec2(127.0f));
+         vec2 d = q / 127.0f;
+         vec3 decoded(d.x, d.y, 1.0f - abs(d.x) - abs(d.y));
+         if (decoded.z < 0.0f)
+         {
+            float t = -decoded.z;
+            decoded.x += decoded.x >= 0.0f ? -t : t;
+            decoded.y += decoded.y >= 0.0f ? -t : t;
+         }
+
+         float quality = dot(normalize(decoded), normalize(n));
+         if (quality > best)
+         {
+            best = quality;
+            out[0] = int8_t(q.x);
+            out[1] = int8_t(q.y);
+         }
+      }
+   }
+
+   void Mesh::quantize()
+   {
+      static_assert(sizeof(PackedVertex) == 12, "PackedVertex must be tightly packed.");
+
+      unsigned stride = has_vertex ? 3 : 0;
+      unsigned normal_offset = stride;
+      if (has_normal)
+         stride += 3;
+      unsigned tex_offset = stride;
+      if (has_texcoord)
+         stride += 2;
+
+      size_t count = stride ? vbo.size() / stride : 0;
+      vec3 scale;
+      for (unsigned i = 0; i < 3; i++)
+         scale[i] = aabb.offset[i] > 0.0f ? 65535.0f / aabb.offset[i] : 0.0f;
+
+      packed_vbo.clear();
+      packed_vbo.resize(count);
+      for (size_t i = 0; i < count; i++)
+      {
+         const float *in = vbo.data() + i * stride;
+         auto& out = packed_vbo[i];
+
+         if (has_vertex)
+         {
+            vec3 pos = clamp((vec3(in[0], in[1], in[2]) - aabb.base) * scale, vec3(0.0f), vec3(65535.0f));
+            for (unsigned c = 0; c < 3; c++)
+               out.pos[c] = uint16_t(pos[c] + 0.5f);
+         }
+
+         if (has_normal)
+            encode_octahedral(vec3(in[normal_offset], in[normal_offset + 1], in[normal_offset + 2]), out.normal);
+
+         if (has_texcoord)
+         {
+            out.tex[0] = uint16_t(detail::toFloat16(in[tex_offset]));
+            out.tex[1] = uint16_t(detail::toFloat16(in[tex_offset + 1]));
+         }
+      }
+
+      packed_ibo.clear();
+      if (count <= 0x10000)
+      {
+         packed_ibo.insert(end(packed_ibo), begin(ibo), end(ibo));
+         packed_index_type = GL_UNSIGNED_SHORT;
+      }
+      else
+         packed_index_type = GL_UNSIGNED_INT;
+
+      packed_arrays.clear();
+      if (has_vertex)
+         packed_arrays.push_back({ Shader::VertexLocation, 3, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(PackedVertex), 0, 0, 0 });
+      if (has_normal)
+         packed_arrays.push_back({ Shader::NormalLocation, 2, GL_BYTE, GL_TRUE, sizeof(PackedVertex), 0, 0, offsetof(PackedVertex, normal) });
+      if (has_texcoord)
+         packed_arrays.push_back({ Shader::TexCoordLocation, 2, GL_HALF_FLOAT, GL_FALSE, sizeof(PackedVertex), 0, 0, offsetof(PackedVertex, tex) });
+   }
+
    struct Face 
    {
       int vertex = -1;
@@ -55,6 +55,27 @@ namespace GL
       Material material;
 
       void finalize();
+
+      // Compact layout, 12 bytes per vertex instead of 32.
+      // Positions are unorm16 relative to aabb (decoded as
+      // pos * aabb.offset + aabb.base), normals are octahedral
+      // encoded in 2x snorm8 and texcoords are half floats.
+      struct PackedVertex
+      {
+         uint16_t pos[3];
+         int8_t normal[2];
+         uint16_t tex[2];
+      };
+
+      std::vector<PackedVertex> packed_vbo;
+      std::vector<uint16_t> packed_ibo;
+      std::vector<VertexArray::Array> packed_arrays;
+      GLenum packed_index_type = GL_UNSIGNED_INT;
+
+      // Fills the packed members from vbo, ibo and aabb. Indices are
+      // narrowed to 16 bits when every vertex fits, otherwise packed_ibo
+      // stays empty and ibo is used with GL_UNSIGNED_INT.
+      void quantize();
    };
 
    std::vector<Mesh> load_meshes_obj(const std::string& path);
@@ -1,4 +1,5 @@
 #include "shader.hpp"
+#include "state_cache.hpp"
 #include "util.hpp"
 #include <vector>
 
@@ -53,7 +54,8 @@ namespace GL
          const vector<string>& defines)
    {
       vector<const GLchar*> gl_source = {
-         "#version 430\nlayout(std140) uniform;\n",
+         "#version 430\n",
+         "layout(std140) uniform;\n",
          "layout(std430) buffer;\n",
          "#define GLOBAL_VERTEX_DATA 0\n",
          "#define GLOBAL_FRAGMENT_DATA 1\n",
@@ -66,7 +68,19 @@ namespace GL
       };
       for (auto& define : defines)
          gl_source.push_back(define.c_str());
-      gl_source.push_back(source.c_str());
+
+      // #extension has to precede any declaration, so hoist those
+      // directives above the default layouts.
+      string extensions, body;
+      for (auto& line : String::split(source, "\n", true))
+      {
+         if (line.compare(0, 10, "#extension") == 0)
+            extensions += line + "\n";
+         else
+            body += line + "\n";
+      }
+      gl_source.insert(gl_source.begin() + 1, extensions.c_str());
+      gl_source.push_back(body.c_str());
 
       glShaderSource(obj, gl_source.size(), gl_source.data(), nullptr);
       glCompileShader(obj);
@@ -209,7 +223,7 @@ namespace GL
 
       if (alive)
          for (auto& prog : progs)
-            glDeleteProgram(prog.second);
+            delete_program(prog.second);
 
       progs.clear();
    }
@@ -220,24 +234,28 @@ namespace GL
 
       if (alive)
          for (auto& prog : progs)
-            glDeleteProgram(prog.second);
+            delete_program(prog.second);
 
       progs.clear();
    }
 
-   void Shader::use()
+   void Shader::compile()
    {
-      GLuint prog = progs[current_permutation];
+      GLuint& prog = progs[current_permutation];
       if (!prog)
-         progs[current_permutation] = prog = compile_shaders();
+         prog = compile_shaders();
+   }
 
-      glUseProgram(prog);
+   void Shader::use()
+   {
+      compile();
+      StateCache::get().use_program(progs[current_permutation]);
       active = true;
    }
 
    void Shader::unbind()
    {
-      glUseProgram(0);
+      StateCache::get().unbind_program();
       active = false;
    }
 
@@ -250,8 +268,14 @@ namespace GL
    {
       alive = false;
       for (auto& prog : progs)
-         glDeleteProgram(prog.second);
+         delete_program(prog.second);
       progs.clear();
    }
+
+   void Shader::delete_program(GLuint prog)
+   {
+      StateCache::get().forget_program(prog);
+      glDeleteProgram(prog);
+   }
 }
 
@@ -51,6 +51,10 @@ namespace GL
          void use();
          void unbind();
 
+         // Compiles the current permutation without binding it, so the
+         // cost can be paid before the first use().
+         void compile();
+
          void reset() override;
          void destroyed() override;
 
@@ -85,6 +89,7 @@ namespace GL
                const std::vector<std::string>& defines);
          void log_shader(GLuint obj, const std::vector<const GLchar*>& source);
          void log_program(GLuint obj);
+         static void delete_program(GLuint prog);
 
          std::vector<std::string> current_defines() const;
          unsigned compute_permutation() const;
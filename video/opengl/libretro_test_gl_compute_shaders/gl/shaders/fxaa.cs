@@ -0,0 +1,86 @@
+// Compute FXAA over the single-sampled scene colour.
+// Each work group caches the luma of its tile plus a one texel border in
+// shared memory, so the edge test costs one texture fetch per texel.
+// Pixels below the contrast threshold are copied through untouched,
+// edge pixels get the directional blur from FXAA 3.11 (console variant).
+
+#define TILE 16
+#define EDGE_THRESHOLD (1.0 / 8.0)
+#define EDGE_THRESHOLD_MIN (1.0 / 24.0)
+#define REDUCE_MUL (1.0 / 8.0)
+#define REDUCE_MIN (1.0 / 128.0)
+#define SPAN_MAX 8.0
+
+layout(local_size_x = TILE, local_size_y = TILE) in;
+
+layout(binding = 0) uniform sampler2D scene;
+layout(binding = 0, rgba8) uniform writeonly image2D result;
+
+shared float luma_tile[TILE + 2][TILE + 2];
+
+float luma(vec3 rgb)
+{
+   return dot(rgb, vec3(0.299, 0.587, 0.114));
+}
+
+void main()
+{
+   ivec2 size = textureSize(scene, 0);
+   ivec2 tile_origin = ivec2(gl_WorkGroupID.xy) * TILE - 1;
+   ivec2 local = ivec2(gl_LocalInvocationID.xy);
+
+   // (TILE + 2)^2 border tile loaded by TILE^2 invocations.
+   for (int i = local.y * TILE + local.x; i < (TILE + 2) * (TILE + 2); i += TILE * TILE)
+   {
+      ivec2 t = ivec2(i % (TILE + 2), i / (TILE + 2));
+      ivec2 coord = clamp(tile_origin + t, ivec2(0), size - 1);
+      luma_tile[t.y][t.x] = luma(texelFetch(scene, coord, 0).rgb);
+   }
+   barrier();
+
+   ivec2 coord = ivec2(gl_GlobalInvocationID.xy);
+   if (any(greaterThanEqual(coord, size)))
+      return;
+
+   ivec2 t = local + 1;
+   float luma_m  = luma_tile[t.y][t.x];
+   // Named in texel space, NW is (-1, -1).
+   float luma_nw = luma_tile[t.y - 1][t.x - 1];
+   float luma_ne = luma_tile[t.y - 1][t.x + 1];
+   float luma_sw = luma_tile[t.y + 1][t.x - 1];
+   float luma_se = luma_tile[t.y + 1][t.x + 1];
+
+   float luma_min = min(luma_m, min(min(luma_nw, luma_ne), min(luma_sw, luma_se)));
+   float luma_max = max(luma_m, max(max(luma_nw, luma_ne), max(luma_sw, luma_se)));
+
+   vec4 color = texelFetch(scene, coord, 0);
+   if (luma_max - luma_min < max(EDGE_THRESHOLD_MIN, luma_max * EDGE_THRESHOLD))
+   {
+      imageStore(result, coord, color);
+      return;
+   }
+
+   vec2 inv_size = 1.0 / vec2(size);
+   vec2 pos = (vec2(coord) + 0.5) * inv_size;
+
+   vec2 dir;
+   dir.x = -((luma_nw + luma_ne) - (luma_sw + luma_se));
+   dir.y = ((luma_nw + luma_sw) - (luma_ne + luma_se));
+
+   float dir_reduce = max((luma_nw + luma_ne + luma_sw + luma_se) * (0.25 * REDUCE_MUL), REDUCE_MIN);
+   float rcp_dir_min = 1.0 / (min(abs(dir.x), abs(dir.y)) + dir_reduce);
+   dir = clamp(dir * rcp_dir_min, vec2(-SPAN_MAX), vec2(SPAN_MAX)) * inv_size;
+
+   vec3 rgb_a = 0.5 * (
+         textureLod(scene, pos + dir * (1.0 / 3.0 - 0.5), 0.0).rgb +
+         textureLod(scene, pos + dir * (2.0 / 3.0 - 0.5), 0.0).rgb);
+   vec3 rgb_b = rgb_a * 0.5 + 0.25 * (
+         textureLod(scene, pos - dir * 0.5, 0.0).rgb +
+         textureLod(scene, pos + dir * 0.5, 0.0).rgb);
+
+   float luma_b = luma(rgb_b);
+   if (luma_b < luma_min || luma_b > luma_max)
+      imageStore(result, coord, vec4(rgb_a, color.a));
+   else
+      imageStore(result, coord, vec4(rgb_b, color.a));
+}
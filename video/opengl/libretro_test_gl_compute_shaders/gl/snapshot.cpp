@@ -0,0 +1,258 @@
+#include "snapshot.hpp"
+#include "state_cache.hpp"
+#include <algorithm>
+#include <cstring>
+
+using namespace std;
+using namespace Log;
+
+namespace GL
+{
+   void BufferSnapshots::init(GLsizeiptr size)
+   {
+      bool was_alive = alive;
+      if (was_alive)
+         destroyed();
+
+      this->size = size;
+
+      if (was_alive)
+         reset();
+   }
+
+   void BufferSnapshots::reset()
+   {
+      alive = true;
+      if (!size)
+         return;
+
+      for (auto& slot : slots)
+      {
+         glGenBuffers(1, &slot.buffer);
+         StateCache::get().bind_buffer(GL_COPY_WRITE_BUFFER, slot.buffer);
+         glBufferData(GL_COPY_WRITE_BUFFER, size, nullptr, GL_STREAM_READ);
+      }
+
+      glGenBuffers(1, &upload);
+      StateCache::get().bind_buffer(GL_COPY_WRITE_BUFFER, upload);
+      glBufferData(GL_COPY_WRITE_BUFFER, UploadChunk * UploadRegions, nullptr, GL_STREAM_DRAW);
+      StateCache::get().bind_buffer(GL_COPY_WRITE_BUFFER, 0);
+   }
+
+   void BufferSnapshots::destroyed()
+   {
+      alive = false;
+
+      for (auto& slot : slots)
+      {
+         if (slot.fence)
+            glDeleteSync(slot.fence);
+         if (slot.buffer)
+         {
+            StateCache::get().forget_buffer(slot.buffer);
+            glDeleteBuffers(1, &slot.buffer);
+         }
+         slot = Slot();
+      }
+
+      for (auto& fence : upload_fences)
+      {
+         if (fence)
+            glDeleteSync(fence);
+         fence = nullptr;
+      }
+
+      if (upload)
+      {
+         StateCache::get().forget_buffer(upload);
+         glDeleteBuffers(1, &upload);
+      }
+      upload = 0;
+      upload_region = 0;
+   }
+
+   double BufferSnapshots::elapsed_ms(Clock::time_point start)
+   {
+      return chrono::duration<double, milli>(Clock::now() - start).count();
+   }
+
+   uint64_t BufferSnapshots::capture(Buffer& source)
+   {
+      if (!alive || !size)
+         return 0;
+
+      // The oldest snapshot makes room, whether it was read or not.
+      Slot *slot = &slots[0];
+      for (auto& s : slots)
+         if (s.id < slot->id)
+            slot = &s;
+
+      if (slot->fence)
+         glDeleteSync(slot->fence);
+
+      // Shader writes to the source have to land before the copy reads it.
+      glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+
+      source.bind(GL_COPY_READ_BUFFER);
+      StateCache::get().bind_buffer(GL_COPY_WRITE_BUFFER, slot->buffer);
+      glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, size);
+      StateCache::get().bind_buffer(GL_COPY_WRITE_BUFFER, 0);
+      source.unbind(GL_COPY_READ_BUFFER);
+
+      slot->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+      slot->id = next_id++;
+      slot->captured = Clock::now();
+      captures++;
+      return slot->id;
+   }
+
+   BufferSnapshots::Slot *BufferSnapshots::find(uint64_t id)
+   {
+      for (auto& slot : slots)
+         if (id && slot.id == id)
+            return &slot;
+      return nullptr;
+   }
+
+   bool BufferSnapshots::poll(Slot& slot, bool wait)
+   {
+      if (!slot.fence)
+         return slot.id != 0;
+
+      GLenum ret;
+      if (wait)
+      {
+         auto start = Clock::now();
+         do
+         {
+            ret = glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+         } while (ret == GL_TIMEOUT_EXPIRED);
+         stall_ms += elapsed_ms(start);
+      }
+      else
+         ret = glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+
+      if (ret != GL_ALREADY_SIGNALED && ret != GL_CONDITION_SATISFIED)
+         return false;
+
+      glDeleteSync(slot.fence);
+      slot.fence = nullptr;
+      latency_ms += elapsed_ms(slot.captured);
+      completed++;
+      return true;
+   }
+
+   uint64_t BufferSnapshots::latest_ready()
+   {
+      uint64_t latest = 0;
+      for (auto& slot : slots)
+         if (slot.id > latest && poll(slot, false))
+            latest = slot.id;
+      return latest;
+   }
+
+   bool BufferSnapshots::read(uint64_t id, void *data, bool wait)
+   {
+      Slot *slot = find(id);
+      if (!alive || !slot || !poll(*slot, wait))
+         return false;
+
+      // The copy has finished, so mapping does not wait for the GPU.
+      auto start = Clock::now();
+      StateCache::get().bind_buffer(GL_COPY_READ_BUFFER, slot->buffer);
+      void *ptr = glMapBufferRange(GL_COPY_READ_BUFFER, 0, size, GL_MAP_READ_BIT);
+      if (ptr)
+      {
+         memcpy(data, ptr, size);
+         glUnmapBuffer(GL_COPY_READ_BUFFER);
+      }
+      StateCache::get().bind_buffer(GL_COPY_READ_BUFFER, 0);
+
+      map_ms += elapsed_ms(start);
+      reads++;
+      return ptr != nullptr;
+   }
+
+   bool BufferSnapshots::restore(Buffer& dest, const void *data)
+   {
+      if (!alive || !size)
+         return false;
+
+      auto start = Clock::now();
+      auto src = static_cast<const uint8_t*>(data);
+      bool mapped = true;
+
+      for (GLsizeiptr offset = 0; offset < size; offset += UploadChunk)
+      {
+         GLsizeiptr len = min<GLsizeiptr>(UploadChunk, size - offset);
+         GLintptr region_offset = GLintptr(upload_region) * UploadChunk;
+         GLsync& fence = upload_fences[upload_region];
+         upload_region = (upload_region + 1) % UploadRegions;
+
+         // Only waits if the GPU has not copied out of this region yet.
+         if (fence)
+         {
+            auto stall = Clock::now();
+            while (glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000) == GL_TIMEOUT_EXPIRED);
+            glDeleteSync(fence);
+            fence = nullptr;
+            upload_stall_ms += elapsed_ms(stall);
+         }
+
+         StateCache::get().bind_buffer(GL_COPY_READ_BUFFER, upload);
+         void *ptr = glMapBufferRange(GL_COPY_READ_BUFFER, region_offset, len,
+               GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+         if (!ptr)
+         {
+            mapped = false;
+            break;
+         }
+         memcpy(ptr, src + offset, len);
+         glUnmapBuffer(GL_COPY_READ_BUFFER);
+
+         dest.bind(GL_COPY_WRITE_BUFFER);
+         glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, region_offset, offset, len);
+         fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+      }
+
+      StateCache::get().bind_buffer(GL_COPY_READ_BUFFER, 0);
+      dest.unbind(GL_COPY_WRITE_BUFFER);
+
+      upload_ms += elapsed_ms(start);
+      restores++;
+      return mapped;
+   }
+
+   void BufferSnapshots::update()
+   {
+      if (alive)
+         for (auto& slot : slots)
+            poll(slot, false);
+
+      if (++frames >= ReportInterval)
+         report();
+   }
+
+   void BufferSnapshots::report()
+   {
+      if (captures || restores)
+      {
+         log("Snapshots of %.1f MiB: %u captured, %.2f ms until copied, %u read with %.2f ms stalled and %.2f ms mapped, "
+               "%u restored in %.2f ms with %.2f ms stalled (averages).",
+               size / (1024.0 * 1024.0), captures, completed ? latency_ms / completed : 0.0,
+               reads, reads ? stall_ms / reads : 0.0, reads ? map_ms / reads : 0.0,
+               restores, restores ? upload_ms / restores : 0.0, restores ? upload_stall_ms / restores : 0.0);
+      }
+
+      frames = 0;
+      captures = 0;
+      completed = 0;
+      reads = 0;
+      restores = 0;
+      latency_ms = 0.0;
+      stall_ms = 0.0;
+      map_ms = 0.0;
+      upload_ms = 0.0;
+      upload_stall_ms = 0.0;
+   }
+}
@@ -0,0 +1,96 @@
+#ifndef SNAPSHOT_HPP__
+#define SNAPSHOT_HPP__
+
+#include "global.hpp"
+#include "buffer.hpp"
+#include <chrono>
+#include <cstdint>
+
+namespace GL
+{
+   // Asynchronous copies of a GPU buffer, for savestates.
+   //
+   // capture() copies the buffer into one of a few staging buffers on the
+   // GPU and places a fence behind the copy. The staging buffer is only
+   // mapped for reading once that fence has passed, so the frame which
+   // captured never waits; read() blocks only if asked for a snapshot the
+   // GPU has not finished yet.
+   //
+   // restore() streams data back through a ring of fenced upload regions
+   // which are mapped unsynchronized, so an upload only waits for a region
+   // the GPU is still copying from.
+   //
+   // Staging contents do not survive a context reset, pending snapshots
+   // are dropped with it.
+   class BufferSnapshots : public ContextListener, public ContextResource
+   {
+      public:
+         BufferSnapshots() { ContextListener::init(); }
+         ~BufferSnapshots() { deinit(); }
+
+         void init(GLsizeiptr size);
+
+         // Starts a copy of source, which must be at least size bytes.
+         // Returns 0 if there is no context.
+         uint64_t capture(Buffer& source);
+
+         // Newest snapshot whose copy has finished, 0 if none. Non-blocking.
+         uint64_t latest_ready();
+
+         // Copies a snapshot to data. Without wait, fails if the copy is
+         // still in flight. Fails if the snapshot has been recycled.
+         bool read(uint64_t id, void *data, bool wait);
+
+         // Fails without a context.
+         bool restore(Buffer& dest, const void *data);
+
+         // Polls pending copies so latencies are measured close to when
+         // they finish. Call once per frame.
+         void update();
+
+         void reset() override;
+         void destroyed() override;
+
+         enum { Slots = 4, UploadChunk = 1 << 20, UploadRegions = 4, ReportInterval = 600 };
+
+      private:
+         using Clock = std::chrono::steady_clock;
+
+         struct Slot
+         {
+            GLuint buffer = 0;
+            GLsync fence = nullptr;
+            uint64_t id = 0;
+            Clock::time_point captured;
+         };
+
+         Slot slots[Slots];
+         GLuint upload = 0;
+         GLsync upload_fences[UploadRegions] = {};
+         unsigned upload_region = 0;
+
+         GLsizeiptr size = 0;
+         uint64_t next_id = 1;
+         bool alive = false;
+
+         // Since the last report.
+         unsigned frames = 0;
+         unsigned captures = 0;
+         unsigned completed = 0;
+         unsigned reads = 0;
+         unsigned restores = 0;
+         double latency_ms = 0.0;
+         double stall_ms = 0.0;
+         double map_ms = 0.0;
+         double upload_ms = 0.0;
+         double upload_stall_ms = 0.0;
+
+         Slot *find(uint64_t id);
+         bool poll(Slot& slot, bool wait);
+         void report();
+
+         static double elapsed_ms(Clock::time_point start);
+   };
+}
+
+#endif
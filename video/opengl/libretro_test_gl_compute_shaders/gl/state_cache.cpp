@@ -0,0 +1,235 @@
+#include "state_cache.hpp"
+
+using namespace std;
+using namespace Log;
+
+namespace GL
+{
+   StateCache& StateCache::get()
+   {
+      static StateCache cache;
+      return cache;
+   }
+
+   void StateCache::invalidate()
+   {
+      program = Binding();
+      vertex_array = Binding();
+      active_unit = Binding();
+      for (auto& binding : buffers)
+         binding = Binding();
+      for (auto& row : indexed_buffers)
+         for (auto& binding : row)
+            binding = Binding();
+      for (auto& row : textures)
+         for (auto& binding : row)
+            binding = Binding();
+      for (auto& binding : samplers)
+         binding = Binding();
+   }
+
+   void StateCache::begin_frame()
+   {
+      if (++frames < ReportInterval)
+         return;
+
+      unsigned long long frame_issued = issued - reported_issued;
+      unsigned long long frame_elided = elided - reported_elided;
+      unsigned long long total = frame_issued + frame_elided;
+      log("GL state cache: %llu calls issued, %llu elided (%.1f%%) over %u frames.",
+            frame_issued, frame_elided, total ? 100.0 * frame_elided / total : 0.0, frames);
+
+      reported_issued = issued;
+      reported_elided = elided;
+      frames = 0;
+   }
+
+   void StateCache::flush()
+   {
+      if (program.deferred_unbind)
+      {
+         program.deferred_unbind = false;
+         use_program(0);
+      }
+
+      static const GLenum indexed_targets[] = {
+         GL_UNIFORM_BUFFER, GL_SHADER_STORAGE_BUFFER, GL_ATOMIC_COUNTER_BUFFER,
+      };
+      for (unsigned target = 0; target < IndexedTargets; target++)
+         for (unsigned index = 0; index < MaxIndices; index++)
+            if (indexed_buffers[target][index].deferred_unbind)
+               bind_buffer_base(indexed_targets[target], index, 0);
+
+      for (unsigned unit = 0; unit < MaxUnits; unit++)
+         if (samplers[unit].deferred_unbind)
+            bind_sampler(unit, 0);
+
+      static const GLenum texture_targets[] = {
+         GL_TEXTURE_2D, GL_TEXTURE_2D_ARRAY, GL_TEXTURE_CUBE_MAP,
+      };
+      for (unsigned unit = 0; unit < MaxUnits; unit++)
+         for (unsigned target = 0; target < TextureTargets; target++)
+            if (textures[unit][target].deferred_unbind)
+               bind_texture(unit, texture_targets[target], 0);
+
+      // Leave unit 0 active like the helpers always used to.
+      active_texture(0);
+   }
+
+   StateCache::Binding *StateCache::buffer_binding(GLenum target)
+   {
+      switch (target)
+      {
+         case GL_ARRAY_BUFFER: return &buffers[ArrayBuffer];
+         case GL_ELEMENT_ARRAY_BUFFER: return &buffers[ElementArrayBuffer];
+         case GL_UNIFORM_BUFFER: return &buffers[UniformBuffer];
+         case GL_SHADER_STORAGE_BUFFER: return &buffers[ShaderStorageBuffer];
+         case GL_ATOMIC_COUNTER_BUFFER: return &buffers[AtomicCounterBuffer];
+         case GL_DRAW_INDIRECT_BUFFER: return &buffers[DrawIndirectBuffer];
+         case GL_COPY_READ_BUFFER: return &buffers[CopyReadBuffer];
+         case GL_COPY_WRITE_BUFFER: return &buffers[CopyWriteBuffer];
+         default: return nullptr;
+      }
+   }
+
+   StateCache::Binding *StateCache::indexed_binding(GLenum target, unsigned index)
+   {
+      if (index >= MaxIndices)
+         return nullptr;
+
+      switch (target)
+      {
+         case GL_UNIFORM_BUFFER: return &indexed_buffers[IndexedUniform][index];
+         case GL_SHADER_STORAGE_BUFFER: return &indexed_buffers[IndexedShaderStorage][index];
+         case GL_ATOMIC_COUNTER_BUFFER: return &indexed_buffers[IndexedAtomicCounter][index];
+         default: return nullptr;
+      }
+   }
+
+   StateCache::Binding *StateCache::texture_binding(unsigned unit, GLenum target)
+   {
+      if (unit >= MaxUnits)
+         return nullptr;
+
+      switch (target)
+      {
+         case GL_TEXTURE_2D: return &textures[unit][Texture2D];
+         case GL_TEXTURE_2D_ARRAY: return &textures[unit][Texture2DArray];
+         case GL_TEXTURE_CUBE_MAP: return &textures[unit][TextureCube];
+         default: return nullptr;
+      }
+   }
+
+   StateCache::Binding *StateCache::sampler_binding(unsigned unit)
+   {
+      return unit < MaxUnits ? &samplers[unit] : nullptr;
+   }
+
+   void StateCache::use_program(GLuint prog)
+   {
+      if (bind(&program, prog))
+         glUseProgram(prog);
+   }
+
+   void StateCache::unbind_program()
+   {
+      defer_unbind(&program);
+   }
+
+   void StateCache::bind_vertex_array(GLuint vao)
+   {
+      if (bind(&vertex_array, vao))
+      {
+         glBindVertexArray(vao);
+         // The element array binding is part of the VAO.
+         buffers[ElementArrayBuffer] = Binding();
+      }
+   }
+
+   void StateCache::bind_buffer(GLenum target, GLuint id)
+   {
+      if (bind(buffer_binding(target), id))
+         glBindBuffer(target, id);
+   }
+
+   void StateCache::bind_buffer_base(GLenum target, unsigned index, GLuint id)
+   {
+      if (bind(indexed_binding(target, index), id))
+      {
+         glBindBufferBase(target, index, id);
+         // Binds the generic binding point as well.
+         if (auto generic = buffer_binding(target))
+         {
+            generic->name = id;
+            generic->known = true;
+         }
+      }
+   }
+
+   void StateCache::unbind_buffer_base(GLenum target, unsigned index)
+   {
+      if (defer_unbind(indexed_binding(target, index)))
+         bind_buffer_base(target, index, 0);
+   }
+
+   void StateCache::active_texture(unsigned unit)
+   {
+      if (bind(&active_unit, unit))
+         glActiveTexture(GL_TEXTURE0 + unit);
+   }
+
+   void StateCache::bind_texture(unsigned unit, GLenum target, GLuint id)
+   {
+      // Texture uploads go through the active unit, so select it even if
+      // the binding itself is already current.
+      active_texture(unit);
+      if (bind(texture_binding(unit, target), id))
+         glBindTexture(target, id);
+   }
+
+   void StateCache::unbind_texture(unsigned unit, GLenum target)
+   {
+      if (defer_unbind(texture_binding(unit, target)))
+         bind_texture(unit, target, 0);
+   }
+
+   void StateCache::bind_sampler(unsigned unit, GLuint id)
+   {
+      if (bind(sampler_binding(unit), id))
+         glBindSampler(unit, id);
+   }
+
+   void StateCache::unbind_sampler(unsigned unit)
+   {
+      if (defer_unbind(sampler_binding(unit)))
+         bind_sampler(unit, 0);
+   }
+
+   void StateCache::forget_program(GLuint prog)
+   {
+      forget(program, prog);
+   }
+
+   void StateCache::forget_vertex_array(GLuint vao)
+   {
+      if (vertex_array.known && vertex_array.name == vao)
+         buffers[ElementArrayBuffer] = Binding();
+      forget(vertex_array, vao);
+   }
+
+   void StateCache::forget_buffer(GLuint id)
+   {
+      forget(buffers, id);
+      forget(indexed_buffers, id);
+   }
+
+   void StateCache::forget_texture(GLuint id)
+   {
+      forget(textures, id);
+   }
+
+   void StateCache::forget_sampler(GLuint id)
+   {
+      forget(samplers, id);
+   }
+}
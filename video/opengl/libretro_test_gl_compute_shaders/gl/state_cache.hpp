@@ -0,0 +1,177 @@
+#ifndef STATE_CACHE_HPP__
+#define STATE_CACHE_HPP__
+
+#include "global.hpp"
+#include <cstddef>
+
+namespace GL
+{
+   // Shadows the bindings made through Buffer, VertexArray, Texture, Sampler
+   // and Shader so binds of what is already bound can be skipped.
+   //
+   // Unbinding programs, textures, samplers and indexed buffers is deferred:
+   // every draw and dispatch binds what it uses first, so the unbind is only
+   // sent if nothing rebinds the same object before flush().
+   //
+   // Bindings are kept in fixed arrays per target and unit. Targets, indices
+   // and units outside of them are not cached and their calls are always
+   // sent. Everything is forgotten on context reset and destroy. The cache
+   // lives across frames as long as the frontend keeps its own GL state
+   // apart, otherwise it has to be invalidated every frame.
+   class StateCache
+   {
+      public:
+         static StateCache& get();
+
+         void invalidate();
+         void begin_frame();
+         void flush();
+
+         void use_program(GLuint prog);
+         void unbind_program();
+         void bind_vertex_array(GLuint vao);
+         void bind_buffer(GLenum target, GLuint id);
+         void bind_buffer_base(GLenum target, unsigned index, GLuint id);
+         void unbind_buffer_base(GLenum target, unsigned index);
+         void bind_texture(unsigned unit, GLenum target, GLuint id);
+         void unbind_texture(unsigned unit, GLenum target);
+         void bind_sampler(unsigned unit, GLuint id);
+         void unbind_sampler(unsigned unit);
+
+         // Names are recycled by glGen*, so anything cached for a deleted
+         // object has to go. GL also unbinds deleted objects by itself.
+         void forget_program(GLuint prog);
+         void forget_vertex_array(GLuint vao);
+         void forget_buffer(GLuint id);
+         void forget_texture(GLuint id);
+         void forget_sampler(GLuint id);
+
+         unsigned long long get_issued() const { return issued; }
+         unsigned long long get_elided() const { return elided; }
+
+      private:
+         StateCache() {}
+
+         enum { ReportInterval = 600, MaxIndices = 16, MaxUnits = 16 };
+
+         enum BufferTarget
+         {
+            ArrayBuffer,
+            ElementArrayBuffer,
+            UniformBuffer,
+            ShaderStorageBuffer,
+            AtomicCounterBuffer,
+            DrawIndirectBuffer,
+            CopyReadBuffer,
+            CopyWriteBuffer,
+            BufferTargets
+         };
+
+         enum IndexedTarget
+         {
+            IndexedUniform,
+            IndexedShaderStorage,
+            IndexedAtomicCounter,
+            IndexedTargets
+         };
+
+         enum TextureTarget
+         {
+            Texture2D,
+            Texture2DArray,
+            TextureCube,
+            TextureTargets
+         };
+
+         // What GL has bound at one binding point. Unknown bindings are
+         // always sent on their next bind.
+         struct Binding
+         {
+            GLuint name = 0;
+            bool known = false;
+            bool deferred_unbind = false;
+         };
+
+         Binding program;
+         Binding vertex_array;
+         Binding active_unit;
+         Binding buffers[BufferTargets];
+         Binding indexed_buffers[IndexedTargets][MaxIndices];
+         Binding textures[MaxUnits][TextureTargets];
+         Binding samplers[MaxUnits];
+
+         unsigned long long issued = 0;
+         unsigned long long elided = 0;
+         unsigned long long reported_issued = 0;
+         unsigned long long reported_elided = 0;
+         unsigned frames = 0;
+
+         // Return nullptr for binding points which are not cached.
+         Binding *buffer_binding(GLenum target);
+         Binding *indexed_binding(GLenum target, unsigned index);
+         Binding *texture_binding(unsigned unit, GLenum target);
+         Binding *sampler_binding(unsigned unit);
+
+         // Returns true if GL has to be told about the new binding.
+         bool bind(Binding *binding, GLuint name)
+         {
+            if (binding)
+            {
+               if (binding->deferred_unbind)
+               {
+                  binding->deferred_unbind = false;
+                  elided++; // The deferred unbind will never be sent.
+               }
+
+               if (binding->known && binding->name == name)
+               {
+                  elided++;
+                  return false;
+               }
+
+               binding->name = name;
+               binding->known = true;
+            }
+
+            issued++;
+            return true;
+         }
+
+         // Returns true if the unbind has to be sent right away.
+         bool defer_unbind(Binding *binding)
+         {
+            if (!binding)
+               return true;
+
+            if (binding->known && binding->name == 0)
+               elided++;
+            else
+               binding->deferred_unbind = true;
+            return false;
+         }
+
+         static void forget(Binding& binding, GLuint name)
+         {
+            if (binding.known && binding.name == name)
+               binding = Binding();
+         }
+
+         template<size_t N>
+         static void forget(Binding (&bindings)[N], GLuint name)
+         {
+            for (auto& binding : bindings)
+               forget(binding, name);
+         }
+
+         template<size_t N, size_t M>
+         static void forget(Binding (&bindings)[N][M], GLuint name)
+         {
+            for (auto& row : bindings)
+               forget(row, name);
+         }
+
+         void active_texture(unsigned unit);
+   };
+}
+
+#endif
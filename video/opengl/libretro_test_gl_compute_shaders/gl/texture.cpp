@@ -1,6 +1,10 @@
 #include "texture.hpp"
+#include "state_cache.hpp"
+#include "texture_stream.hpp"
 #include <rpng/rpng.h>
 #include <math.h>
+#include <stdio.h>
+#include <string.h>
 #include <utility>
 
 using namespace std;
@@ -107,12 +111,12 @@ namespace GL
 
    void Sampler::bind(unsigned unit)
    {
-      glBindSampler(unit, id);
+      StateCache::get().bind_sampler(unit, id);
    }
 
    void Sampler::unbind(unsigned unit)
    {
-      glBindSampler(unit, 0);
+      StateCache::get().unbind_sampler(unit);
    }
 
    void Sampler::reset()
@@ -129,22 +133,27 @@ namespace GL
    void Sampler::destroyed()
    {
       if (id)
+      {
+         StateCache::get().forget_sampler(id);
          glDeleteSamplers(1, &id);
+      }
       id = 0;
    }
 
+   Texture::~Texture()
+   {
+      stop_stream();
+      deinit();
+   }
+
    void Texture::bind(unsigned unit)
    {
-      glActiveTexture(GL_TEXTURE0 + unit);
-      glBindTexture(texture_type, id);
-      glActiveTexture(GL_TEXTURE0);
+      StateCache::get().bind_texture(unit, texture_type, id);
    }
 
    void Texture::unbind(unsigned unit)
    {
-      glActiveTexture(GL_TEXTURE0 + unit);
-      glBindTexture(texture_type, 0);
-      glActiveTexture(GL_TEXTURE0);
+      StateCache::get().unbind_texture(unit, texture_type);
    }
 
    void Texture::bind_image(unsigned unit, StorageAccess access, unsigned level, unsigned layer)
@@ -177,7 +186,10 @@ namespace GL
    void Texture::destroyed()
    {
       if (id)
+      {
+         StateCache::get().forget_texture(id);
          glDeleteTextures(1, &id);
+      }
       id = 0;
    }
 
@@ -188,9 +200,12 @@ namespace GL
          desc.levels = size_to_miplevels(desc.width, desc.height);
       texture_type = type_to_gl(desc.type);
       res = {};
+      stop_stream();
+      mips.clear();
 
       if (id)
       {
+         StateCache::get().forget_texture(id);
          glDeleteTextures(1, &id);
          glGenTextures(1, &id);
          setup();
@@ -209,10 +224,8 @@ namespace GL
       }
    }
 
-   void Texture::load_texture_data()
+   vector<Texture::Image> Texture::decode(const Resource& res)
    {
-      data.clear();
-
       switch (res.type)
       {
          case Texture1D:
@@ -237,7 +250,7 @@ namespace GL
             throw std::logic_error("Invalid texture format!");
       }
 
-      unsigned index = 0;
+      vector<Image> images;
       for (auto& path : res.paths)
       {
          uint32_t *raw_data = nullptr;
@@ -248,30 +261,188 @@ namespace GL
          if (!rpng_load_image_argb(apath.c_str(), &raw_data, &width, &height))
             throw std::runtime_error(String::cat("Failed to load texture: ", path.c_str()));
 
-         if ((desc.width && width != desc.width) || (desc.height && height != desc.height))
+         if (!images.empty() && (width != images[0].width || height != images[0].height))
+         {
+            free(raw_data);
             throw std::logic_error("Textures are not all of same size!");
-
-         desc.width = width;
-         desc.height = height;
+         }
 
          std::vector<uint8_t> byte_data;
          byte_data.resize(width * height * sizeof(uint32_t));
          swizzle(byte_data.data(), raw_data, width * height);
 
-         data.push_back({move(byte_data), width, height});
+         images.push_back({move(byte_data), width, height});
          free(raw_data);
-         index++;
       }
 
+      return images;
+   }
+
+   void Texture::load_texture_data()
+   {
+      if (mips.empty())
+         mips.push_back(decode(res));
+
+      desc.width = mips[0][0].width;
+      desc.height = mips[0][0].height;
+
       if (res.type == Texture2DArray)
          desc.array_size = res.paths.size();
+   }
 
-      if (res.generate_mipmaps)
-         desc.levels = size_to_miplevels(desc.width, desc.height);
+   // Width and height live at fixed offsets in the IHDR chunk, which
+   // always comes first, so sizing the storage needs no decode.
+   static void read_png_size(const string& path, unsigned& width, unsigned& height)
+   {
+      static const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+      uint8_t header[24];
+
+      auto apath = asset_path(path);
+      FILE *file = fopen(apath.c_str(), "rb");
+      if (!file)
+         throw std::runtime_error(String::cat("Failed to load texture: ", path.c_str()));
+
+      size_t read = fread(header, 1, sizeof(header), file);
+      fclose(file);
+
+      if (read != sizeof(header) || memcmp(header, signature, sizeof(signature)) || memcmp(header + 12, "IHDR", 4))
+         throw std::runtime_error(String::cat("Not a PNG: ", path.c_str()));
+
+      width = (unsigned(header[16]) << 24) | (unsigned(header[17]) << 16) | (unsigned(header[18]) << 8) | header[19];
+      height = (unsigned(header[20]) << 24) | (unsigned(header[21]) << 16) | (unsigned(header[22]) << 8) | header[23];
+   }
+
+   void Texture::load_stream_desc()
+   {
+      switch (res.type)
+      {
+         case TextureCube:
+            if (res.paths.size() != 6)
+               throw std::logic_error("Cube map must have 6 textures!");
+            break;
+
+         case Texture2D:
+            if (res.paths.size() != 1)
+               throw std::logic_error("Texture2D must have 1 entry!");
+            break;
+
+         case Texture2DArray:
+            if (res.paths.empty())
+               throw std::logic_error("Texture2DArray must have at least 1 entry!");
+            desc.array_size = res.paths.size();
+            break;
+
+         default:
+            throw std::logic_error("Only 2D, 2D array and cube textures can be streamed!");
+      }
+
+      if (!mips.empty())
+      {
+         desc.width = mips[0][0].width;
+         desc.height = mips[0][0].height;
+      }
+      else
+      {
+         // The worker checks the remaining paths when it decodes them.
+         read_png_size(res.paths[0], desc.width, desc.height);
+      }
+
+      desc.levels = size_to_miplevels(desc.width, desc.height);
+   }
+
+   GLenum Texture::layer_target(unsigned layer) const
+   {
+      if (desc.type == TextureCube)
+         return GL_TEXTURE_CUBE_MAP_POSITIVE_X + layer;
+      return texture_type;
+   }
+
+   void Texture::set_resident_level(unsigned level)
+   {
+      resident_level = level;
+      glTexParameteri(texture_type, GL_TEXTURE_BASE_LEVEL, level);
+      // Ignored while a sampler object is bound, BASE_LEVEL does the
+      // clamping there. Keeps the texture's own sampling state in line.
+      glTexParameterf(texture_type, GL_TEXTURE_MIN_LOD, float(level));
+   }
+
+   // Starts sampling from a grey placeholder in the 1x1 level, the real
+   // levels replace it from the smallest up as TextureStreamer gets to them.
+   void Texture::begin_stream()
+   {
+      static const uint8_t grey[4] = { 0x80, 0x80, 0x80, 0xff };
+      unsigned last = desc.levels - 1;
+
+      if (desc.type == Texture2DArray)
+      {
+         for (unsigned i = 0; i < desc.array_size; i++)
+            glTexSubImage3D(texture_type, last, 0, 0, i, 1, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, grey);
+      }
+      else
+      {
+         unsigned layers = desc.type == TextureCube ? 6 : 1;
+         for (unsigned i = 0; i < layers; i++)
+            glTexSubImage2D(layer_target(i), last, 0, 0, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, grey);
+      }
+
+      set_resident_level(last);
+      TextureStreamer::get().request(this);
+   }
+
+   // Uploads whole rows until the budget runs out, at least one row per
+   // call so progress is guaranteed. Returns true once level 0 is resident.
+   bool Texture::stream_step(size_t& budget)
+   {
+      unsigned layers = mips[0].size();
+      bool complete = false;
+
+      bind(0);
+      while (budget)
+      {
+         auto& image = mips[upload_level][upload_layer];
+         size_t row_size = image.width * 4;
+         unsigned rows = unsigned(min<size_t>(image.height - upload_row, max<size_t>(budget / row_size, 1)));
+         const uint8_t *src = image.data.data() + upload_row * row_size;
+
+         if (desc.type == Texture2DArray)
+            glTexSubImage3D(texture_type, upload_level, 0, upload_row, upload_layer,
+                  image.width, rows, 1, GL_RGBA, GL_UNSIGNED_BYTE, src);
+         else
+            glTexSubImage2D(layer_target(upload_layer), upload_level, 0, upload_row,
+                  image.width, rows, GL_RGBA, GL_UNSIGNED_BYTE, src);
+
+         budget -= min(budget, rows * row_size);
+         upload_row += rows;
+         if (upload_row < image.height)
+            continue;
+
+         upload_row = 0;
+         if (++upload_layer < layers)
+            continue;
+
+         upload_layer = 0;
+         set_resident_level(upload_level);
+         if (upload_level == 0)
+         {
+            complete = true;
+            break;
+         }
+         upload_level--;
+      }
+      unbind(0);
+
+      return complete;
+   }
+
+   void Texture::stop_stream()
+   {
+      if (stream_id)
+         TextureStreamer::get().cancel(this);
    }
 
    void Texture::upload_texture_data()
    {
+      auto& data = mips[0];
       switch (desc.type)
       {
          case Texture2D:
@@ -299,15 +470,15 @@ namespace GL
          default:
             throw std::logic_error("Trying to upload null texture.");
       }
-
-      data.clear();
-      if (res.generate_mipmaps)
-         glGenerateMipmap(texture_type);
    }
 
-   void Texture::load_texture(const Resource& res)
+   void Texture::load_texture(const Resource& res, vector<Image> images)
    {
+      stop_stream();
       this->res = res;
+      mips.clear();
+      if (!images.empty())
+         mips.push_back(move(images));
 
       desc.type            = res.type;
       desc.levels          = 1;
@@ -320,6 +491,7 @@ namespace GL
 
       if (id)
       {
+         StateCache::get().forget_texture(id);
          glDeleteTextures(1, &id);
          glGenTextures(1, &id);
          setup();
@@ -335,7 +507,10 @@ namespace GL
    {
       bind(0);
 
-      if (!res.paths.empty())
+      bool stream = !res.paths.empty() && res.generate_mipmaps;
+      if (stream)
+         load_stream_desc();
+      else if (!res.paths.empty())
          load_texture_data();
 
       switch (desc.type)
@@ -365,7 +540,9 @@ namespace GL
             break;
       }
 
-      if (!res.paths.empty())
+      if (stream)
+         begin_stream();
+      else if (!res.paths.empty())
          upload_texture_data();
 
       unbind(0);
@@ -3,6 +3,7 @@
 
 #include "global.hpp"
 #include <string>
+#include <cstdint>
 
 namespace GL
 {
@@ -58,11 +59,17 @@ namespace GL
       StaticSampler(Type type) { init(type); }
    };
 
+   // Resources with generate_mipmaps stream in progressively: setup()
+   // allocates the full mip chain from the PNG header sizes and makes the
+   // texture usable at once with a placeholder in its smallest level.
+   // TextureStreamer decodes and downsamples on its worker thread, and the
+   // levels are uploaded smallest first within a per-frame byte budget,
+   // lowering GL_TEXTURE_BASE_LEVEL as each one becomes resident.
    class Texture : public ContextListener, public ContextResource
    {
       public:
          Texture() { ContextListener::init(); }
-         ~Texture() { deinit(); }
+         ~Texture();
 
          enum Type
          {
@@ -98,10 +105,21 @@ namespace GL
             bool generate_mipmaps;
          };
 
+         struct Image
+         {
+            std::vector<uint8_t> data;
+            unsigned width;
+            unsigned height;
+         };
+
          static unsigned size_to_miplevels(unsigned width, unsigned height);
 
+         // Decodes the images of a resource. Touches no GL state, so it can
+         // run on a loader thread ahead of load_texture().
+         static std::vector<Image> decode(const Resource& res);
+
          void init(const Desc& desc);
-         void load_texture(const Resource& res);
+         void load_texture(const Resource& res, std::vector<Image> images = {});
 
          void bind(unsigned unit);
          void unbind(unsigned unit);
@@ -113,7 +131,11 @@ namespace GL
          void destroyed() override;
 
          const Desc& get_desc() const { return desc; }
+         unsigned get_resident_level() const { return resident_level; }
+         bool is_streaming() const { return stream_id != 0; }
+
          friend class Framebuffer;
+         friend class TextureStreamer;
 
       private:
          GLuint id = 0;
@@ -127,15 +149,24 @@ namespace GL
          void load_texture_data();
          void upload_texture_data();
 
+         void load_stream_desc();
+         void begin_stream();
+         bool stream_step(size_t& budget);
+         void set_resident_level(unsigned level);
+         void stop_stream();
+
          GLenum type_to_gl(Type type);
+         GLenum layer_target(unsigned layer) const;
 
-         struct TextureData
-         {
-            std::vector<uint8_t> data;
-            unsigned width;
-            unsigned height;
-         };
-         std::vector<TextureData> data;
+         // [level][layer]. Either the decoded top level only, or the full
+         // chain once streamed. Kept so a context reset does not decode again.
+         std::vector<std::vector<Image>> mips;
+
+         uint64_t stream_id = 0;
+         unsigned resident_level = 0;
+         unsigned upload_level = 0;
+         unsigned upload_layer = 0;
+         unsigned upload_row = 0;
    };
 }
 
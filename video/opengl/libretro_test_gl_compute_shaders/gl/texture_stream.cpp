@@ -0,0 +1,223 @@
+#include "texture_stream.hpp"
+#include <algorithm>
+#include <exception>
+#include <utility>
+
+using namespace std;
+
+namespace GL
+{
+   TextureStreamer& TextureStreamer::get()
+   {
+      static TextureStreamer streamer;
+      return streamer;
+   }
+
+   // 2x2 box filter, the last row or column is repeated for odd sizes.
+   static Texture::Image downsample(const Texture::Image& src)
+   {
+      Texture::Image dst;
+      dst.width = max(src.width / 2, 1u);
+      dst.height = max(src.height / 2, 1u);
+      dst.data.resize(dst.width * dst.height * 4);
+
+      const uint8_t *in = src.data.data();
+      uint8_t *out = dst.data.data();
+      for (unsigned y = 0; y < dst.height; y++)
+      {
+         unsigned y0 = min(2 * y, src.height - 1);
+         unsigned y1 = min(2 * y + 1, src.height - 1);
+         for (unsigned x = 0; x < dst.width; x++, out += 4)
+         {
+            unsigned x0 = min(2 * x, src.width - 1);
+            unsigned x1 = min(2 * x + 1, src.width - 1);
+            const uint8_t *p00 = in + 4 * (y0 * src.width + x0);
+            const uint8_t *p01 = in + 4 * (y0 * src.width + x1);
+            const uint8_t *p10 = in + 4 * (y1 * src.width + x0);
+            const uint8_t *p11 = in + 4 * (y1 * src.width + x1);
+            for (unsigned c = 0; c < 4; c++)
+               out[c] = uint8_t((p00[c] + p01[c] + p10[c] + p11[c] + 2) >> 2);
+         }
+      }
+
+      return dst;
+   }
+
+   void TextureStreamer::work()
+   {
+      for (;;)
+      {
+         Job job;
+         {
+            lock_guard<mutex> hold(lock);
+            if (jobs.empty())
+            {
+               running = false;
+               return;
+            }
+            job = move(jobs.front());
+            jobs.pop_front();
+         }
+
+         Result result;
+         result.id = job.id;
+         try
+         {
+            if (job.base.empty())
+               job.base = Texture::decode(job.res);
+            result.mips.push_back(move(job.base));
+
+            for (;;)
+            {
+               auto& prev = result.mips.back();
+               if (prev[0].width == 1 && prev[0].height == 1)
+                  break;
+
+               vector<Texture::Image> level;
+               for (auto& layer : prev)
+                  level.push_back(downsample(layer));
+               result.mips.push_back(move(level));
+            }
+         }
+         catch (const exception& e)
+         {
+            result.mips.clear();
+            result.error = e.what();
+         }
+
+         lock_guard<mutex> hold(lock);
+         results.push_back(move(result));
+      }
+   }
+
+   void TextureStreamer::request(Texture *tex)
+   {
+      // Still decoding, the upload goes to whatever storage the texture has
+      // once the chain is done.
+      if (tex->stream_id && decoding.count(tex->stream_id))
+         return;
+
+      cancel(tex);
+      tex->stream_id = next_id++;
+
+      if (tex->mips.size() == tex->desc.levels)
+      {
+         start_upload(tex);
+         return;
+      }
+
+      decoding[tex->stream_id] = tex;
+      Job job;
+      job.id = tex->stream_id;
+      job.res = tex->res;
+      if (!tex->mips.empty())
+         job.base = move(tex->mips[0]);
+      tex->mips.clear();
+
+      lock_guard<mutex> hold(lock);
+      jobs.push_back(move(job));
+      if (!running)
+      {
+         if (worker.joinable())
+            worker.join();
+         running = true;
+         worker = thread(&TextureStreamer::work, this);
+      }
+   }
+
+   void TextureStreamer::cancel(Texture *tex)
+   {
+      if (!tex->stream_id)
+         return;
+
+      uint64_t id = tex->stream_id;
+      decoding.erase(id);
+      uploading.erase(remove(begin(uploading), end(uploading), tex), end(uploading));
+
+      {
+         lock_guard<mutex> hold(lock);
+         jobs.erase(remove_if(begin(jobs), end(jobs), [id](const Job& job) {
+            return job.id == id;
+         }), end(jobs));
+      }
+
+      tex->stream_id = 0;
+   }
+
+   void TextureStreamer::start_upload(Texture *tex)
+   {
+      tex->upload_level = tex->desc.levels - 1;
+      tex->upload_layer = 0;
+      tex->upload_row = 0;
+      uploading.push_back(tex);
+   }
+
+   void TextureStreamer::update(size_t budget)
+   {
+      vector<Result> done;
+      {
+         lock_guard<mutex> hold(lock);
+         done.swap(results);
+      }
+
+      for (auto& result : done)
+      {
+         auto itr = decoding.find(result.id);
+         if (itr == end(decoding))
+            continue; // Cancelled.
+
+         Texture *tex = itr->second;
+         decoding.erase(itr);
+
+         if (result.error.empty() && (result.mips.size() != tex->desc.levels ||
+                  result.mips[0][0].width != tex->desc.width ||
+                  result.mips[0][0].height != tex->desc.height))
+            result.error = "Decoded size does not match the PNG header.";
+
+         if (!result.error.empty())
+         {
+            Log::log("Streaming texture failed: %s", result.error.c_str());
+            tex->stream_id = 0;
+            continue;
+         }
+
+         tex->mips = move(result.mips);
+         start_upload(tex);
+      }
+
+      while (budget && !uploading.empty())
+      {
+         Texture *tex = uploading.front();
+
+         // Lost its storage to a context reset, setup() queues it again.
+         if (!tex->id)
+            break;
+
+         if (!tex->stream_step(budget))
+            break;
+
+         Log::log("Streamed texture: %s (%u levels).", tex->res.paths[0].c_str(), tex->desc.levels);
+         tex->stream_id = 0;
+         uploading.erase(begin(uploading));
+      }
+   }
+
+   void TextureStreamer::shutdown()
+   {
+      {
+         lock_guard<mutex> hold(lock);
+         jobs.clear();
+      }
+
+      if (worker.joinable())
+         worker.join();
+
+      results.clear();
+      for (auto& tex : decoding)
+         tex.second->stream_id = 0;
+      for (auto tex : uploading)
+         tex->stream_id = 0;
+      decoding.clear();
+      uploading.clear();
+   }
+}
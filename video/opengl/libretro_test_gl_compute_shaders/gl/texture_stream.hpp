@@ -0,0 +1,70 @@
+#ifndef TEXTURE_STREAM_HPP__
+#define TEXTURE_STREAM_HPP__
+
+#include "texture.hpp"
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace GL
+{
+   // Feeds mip-streamed textures. A worker thread decodes the PNGs and
+   // builds the mip chain on the CPU; update() runs once per frame on the
+   // main thread and uploads finished chains, smallest level first, until
+   // the frame's byte budget is spent. The worker only lives while there
+   // is something to decode.
+   class TextureStreamer
+   {
+      public:
+         enum { DefaultBudget = 1 << 20 };
+
+         static TextureStreamer& get();
+         ~TextureStreamer() { shutdown(); }
+
+         // (Re)starts streaming into the texture's current storage.
+         void request(Texture *tex);
+         void cancel(Texture *tex);
+
+         void update(size_t budget = DefaultBudget);
+
+         // Drops all work and joins the worker.
+         void shutdown();
+
+      private:
+         TextureStreamer() {}
+
+         struct Job
+         {
+            uint64_t id;
+            Texture::Resource res;
+            std::vector<Texture::Image> base;
+         };
+
+         struct Result
+         {
+            uint64_t id;
+            std::vector<std::vector<Texture::Image>> mips;
+            std::string error;
+         };
+
+         std::mutex lock;
+         std::thread worker;
+         bool running = false;
+         std::deque<Job> jobs;
+         std::vector<Result> results;
+
+         // Main thread only.
+         uint64_t next_id = 1;
+         std::map<uint64_t, Texture*> decoding;
+         std::vector<Texture*> uploading;
+
+         void start_upload(Texture *tex);
+         void work();
+   };
+}
+
+#endif
@@ -0,0 +1,132 @@
+#include "timer.hpp"
+
+using namespace std;
+using namespace Log;
+
+namespace GL
+{
+   void PassTimer::init(const vector<string>& passes, unsigned report_interval)
+   {
+      bool was_alive = alive;
+      if (was_alive)
+         destroyed();
+
+      this->passes = passes;
+      this->report_interval = report_interval;
+      total_ms.assign(passes.size(), 0.0);
+      total_items.assign(passes.size(), 0.0);
+      collected = 0;
+
+      if (was_alive)
+         reset();
+   }
+
+   void PassTimer::reset()
+   {
+      alive = true;
+      for (auto& frame : frames)
+      {
+         frame.queries.resize(passes.size() + 1);
+         if (!frame.queries.empty())
+            glGenQueries(frame.queries.size(), frame.queries.data());
+         frame.pending = false;
+      }
+   }
+
+   void PassTimer::destroyed()
+   {
+      alive = false;
+      for (auto& frame : frames)
+      {
+         if (!frame.queries.empty())
+            glDeleteQueries(frame.queries.size(), frame.queries.data());
+         frame.queries.clear();
+         frame.pending = false;
+      }
+   }
+
+   void PassTimer::collect(Frame& frame)
+   {
+      frame.pending = false;
+
+      GLint available = 0;
+      glGetQueryObjectiv(frame.queries.back(), GL_QUERY_RESULT_AVAILABLE, &available);
+      if (!available)
+         return;
+
+      vector<GLuint64> stamps(frame.queries.size());
+      for (unsigned i = 0; i < frame.queries.size(); i++)
+         glGetQueryObjectui64v(frame.queries[i], GL_QUERY_RESULT, &stamps[i]);
+
+      if (collected && frame.label != total_label)
+         report();
+      total_label = frame.label;
+
+      for (unsigned i = 0; i < passes.size(); i++)
+      {
+         total_ms[i] += (stamps[i + 1] - stamps[i]) * 1e-6;
+         total_items[i] += double(frame.items[i]);
+      }
+
+      if (++collected >= report_interval)
+         report();
+   }
+
+   void PassTimer::report()
+   {
+      string line;
+      for (unsigned i = 0; i < passes.size(); i++)
+      {
+         char buf[64];
+         snprintf(buf, sizeof(buf), "%s%s %.3f ms", i ? ", " : "",
+               passes[i].c_str(), total_ms[i] / collected);
+         line += buf;
+
+         if (total_items[i] > 0.0 && total_ms[i] > 0.0)
+         {
+            snprintf(buf, sizeof(buf), " (%.1f M/s)", total_items[i] / (total_ms[i] * 1e3));
+            line += buf;
+         }
+      }
+      if (total_label.empty())
+         log("GPU passes: %s.", line.c_str());
+      else
+         log("GPU passes (%s): %s.", total_label.c_str(), line.c_str());
+
+      total_ms.assign(passes.size(), 0.0);
+      total_items.assign(passes.size(), 0.0);
+      collected = 0;
+   }
+
+   void PassTimer::begin_frame()
+   {
+      if (!alive || passes.empty())
+         return;
+
+      frame_index = (frame_index + 1) % Latency;
+      auto& frame = frames[frame_index];
+      if (frame.pending)
+         collect(frame);
+
+      glQueryCounter(frame.queries[0], GL_TIMESTAMP);
+      frame.label = current_label;
+      frame.items.assign(passes.size(), 0);
+      frame.pending = true;
+   }
+
+   void PassTimer::end_pass(unsigned pass)
+   {
+      if (!alive || pass >= passes.size())
+         return;
+
+      glQueryCounter(frames[frame_index].queries[pass + 1], GL_TIMESTAMP);
+   }
+
+   void PassTimer::set_items(unsigned pass, uint64_t items)
+   {
+      if (!alive || pass >= passes.size())
+         return;
+
+      frames[frame_index].items[pass] = items;
+   }
+}
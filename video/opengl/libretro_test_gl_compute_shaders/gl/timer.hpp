@@ -0,0 +1,63 @@
+#ifndef TIMER_HPP__
+#define TIMER_HPP__
+
+#include "global.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace GL
+{
+   // Measures GPU time of a fixed sequence of passes with timestamp queries.
+   // Results are read back a few frames late so the CPU never waits on the
+   // GPU, and the averages are logged every report_interval frames.
+   class PassTimer : public ContextListener, public ContextResource
+   {
+      public:
+         PassTimer() { ContextListener::init(); }
+         ~PassTimer() { deinit(); }
+
+         void init(const std::vector<std::string>& passes, unsigned report_interval);
+
+         // Frames with different labels are never averaged together.
+         void set_label(const std::string& label) { current_label = label; }
+
+         // Work done by a pass in the current frame, e.g. primitives drawn.
+         // Passes with a count also report their throughput.
+         void set_items(unsigned pass, uint64_t items);
+
+         void begin_frame();
+         void end_pass(unsigned pass);
+
+         void reset() override;
+         void destroyed() override;
+
+      private:
+         enum { Latency = 4 };
+
+         struct Frame
+         {
+            std::vector<GLuint> queries;
+            std::vector<uint64_t> items;
+            std::string label;
+            bool pending = false;
+         };
+
+         Frame frames[Latency];
+         unsigned frame_index = 0;
+
+         std::vector<std::string> passes;
+         std::vector<double> total_ms;
+         std::vector<double> total_items;
+         std::string current_label;
+         std::string total_label;
+         unsigned collected = 0;
+         unsigned report_interval = 0;
+         bool alive = false;
+
+         void collect(Frame& frame);
+         void report();
+   };
+}
+
+#endif
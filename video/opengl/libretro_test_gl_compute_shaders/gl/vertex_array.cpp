@@ -1,4 +1,5 @@
 #include "vertex_array.hpp"
+#include "state_cache.hpp"
 
 using namespace std;
 
@@ -29,12 +30,12 @@ namespace GL
 
    void VertexArray::bind()
    {
-      glBindVertexArray(vao);
+      StateCache::get().bind_vertex_array(vao);
    }
 
    void VertexArray::unbind()
    {
-      glBindVertexArray(0);
+      StateCache::get().bind_vertex_array(0);
    }
 
    void VertexArray::setup(const vector<Array>& arrays, std::vector<Buffer*> vertex_buffers, Buffer *elem_buffer)
@@ -73,6 +74,7 @@ namespace GL
 
    void VertexArray::destroyed()
    {
+      StateCache::get().forget_vertex_array(vao);
       glDeleteVertexArrays(1, &vao);
       vao = 0;
    }
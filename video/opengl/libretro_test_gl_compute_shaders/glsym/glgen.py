@@ -54,8 +54,45 @@ def generate_defines(gl_syms):
 def generate_declarations(gl_syms):
    return ['RGLSYM' + x.upper() + 'PROC ' + '__rglgen_' + x + ';' for x in gl_syms]
 
-def generate_macros(gl_syms):
-   return ['    SYM(' + x.replace('gl', '') + '),' for x in gl_syms]
+def generate_macros(gl_syms, lazy):
+   return ['    {}('.format('SYM' if x in lazy else 'EAGER') + x.replace('gl', '', 1) + '),' for x in gl_syms]
+
+# Every symbol gets a stub with its own signature which resolves the real
+# entry point on first call, patches the pointer and forwards the call, so
+# only the entry points a core actually uses are ever looked up.
+def parse_typedef(line):
+   m = re.search(r'^typedef (.+?) \((GL_)?APIENTRYP (RGLSYM\w+PROC)\) ?\((.*)\);', line)
+   if not m:
+      return None
+   params = m.group(4).strip()
+   args = []
+   if params not in ('', 'void'):
+      args = [re.search(r'(\w+)\s*(\[[^\]]*\])?$', x.strip()).group(1) for x in params.split(',')]
+   return (m.group(3), m.group(1), (m.group(2) or '') + 'APIENTRY', params, args)
+
+def generate_lazy_stubs(typedefs, gl_syms):
+   protos = {}
+   for line in typedefs:
+      t = parse_typedef(line)
+      if t:
+         protos[t[0]] = t[1:]
+
+   res = []
+   for x in gl_syms:
+      proto = protos.get('RGLSYM' + x.upper() + 'PROC')
+      if not proto:
+         continue
+      ret, apientry, params, args = proto
+      res.append('static {} {} lazy_{}({})'.format(ret, apientry, x, params or 'void'))
+      res.append('{')
+      res.append('   LAZY({});'.format(x.replace('gl', '', 1)))
+      res.append('   {}{}({});'.format('' if ret == 'void' else 'return ', x, ', '.join(args)))
+      res.append('}')
+   return res
+
+def lazy_syms(typedefs, gl_syms):
+   names = set(t[0] for t in map(parse_typedef, typedefs) if t)
+   return set(x for x in gl_syms if 'RGLSYM' + x.upper() + 'PROC' in names)
 
 def dump(f, lines):
    f.write('\n'.join(lines))
@@ -75,7 +112,9 @@ if __name__ == '__main__':
       declarations = generate_declarations(syms)
       externs = ['extern ' + x for x in declarations]
 
-      macros = generate_macros(syms)
+      lazy = lazy_syms(typedefs, syms)
+      stubs = generate_lazy_stubs(typedefs, syms)
+      macros = generate_macros(syms, lazy)
 
    with open(sys.argv[2], 'w') as f:
       f.write('#ifndef RGLGEN_DECL_H__\n')
@@ -110,7 +149,7 @@ if __name__ == '__main__':
       dump(f, overrides)
       dump(f, externs)
 
-      f.write('struct rglgen_sym_map { const char *sym; void *ptr; };\n')
+      f.write('struct rglgen_sym_map { const char *sym; void *ptr; rglgen_func_t lazy; };\n')
       f.write('extern const struct rglgen_sym_map rglgen_symbol_map[];\n')
 
       f.write('#ifdef __cplusplus\n')
@@ -122,10 +161,13 @@ if __name__ == '__main__':
    with open(sys.argv[3], 'w') as f:
       f.write('#include "glsym.h"\n')
       f.write('#include <stddef.h>\n')
-      f.write('#define SYM(x) { "gl" #x, &(gl##x) }\n')
+      f.write('#define LAZY(x) rglgen_resolve_lazy("gl" #x, &(gl##x))\n')
+      f.write('#define SYM(x) { "gl" #x, &(gl##x), (rglgen_func_t)lazy_gl##x }\n')
+      f.write('#define EAGER(x) { "gl" #x, &(gl##x), NULL }\n')
+      dump(f, stubs)
       f.write('const struct rglgen_sym_map rglgen_symbol_map[] = {\n')
       dump(f, macros)
-      f.write('    { NULL, NULL },\n')
+      f.write('    { NULL, NULL, NULL },\n')
       f.write('};\n')
       dump(f, declarations)
 
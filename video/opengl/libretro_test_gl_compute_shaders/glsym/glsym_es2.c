@@ -1,6 +1,149 @@
 #include "glsym.h"
 #include <stddef.h>
-#define SYM(x) { "gl" #x, &(gl##x) }
+#define LAZY(x) rglgen_resolve_lazy("gl" #x, &(gl##x))
+#define SYM(x) { "gl" #x, &(gl##x), (rglgen_func_t)lazy_gl##x }
+#define EAGER(x) { "gl" #x, &(gl##x), NULL }
+static void GL_APIENTRY lazy_glEGLImageTargetTexture2DOES(GLenum target, GLeglImageOES image)
+{
+   LAZY(EGLImageTargetTexture2DOES);
+   glEGLImageTargetTexture2DOES(target, image);
+}
+static void GL_APIENTRY lazy_glEGLImageTargetRenderbufferStorageOES(GLenum target, GLeglImageOES image)
+{
+   LAZY(EGLImageTargetRenderbufferStorageOES);
+   glEGLImageTargetRenderbufferStorageOES(target, image);
+}
+static void GL_APIENTRY lazy_glGetProgramBinaryOES(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, GLvoid *binary)
+{
+   LAZY(GetProgramBinaryOES);
+   glGetProgramBinaryOES(program, bufSize, length, binaryFormat, binary);
+}
+static void GL_APIENTRY lazy_glProgramBinaryOES(GLuint program, GLenum binaryFormat, const GLvoid *binary, GLint length)
+{
+   LAZY(ProgramBinaryOES);
+   glProgramBinaryOES(program, binaryFormat, binary, length);
+}
+static void* GL_APIENTRY lazy_glMapBufferOES(GLenum target, GLenum access)
+{
+   LAZY(MapBufferOES);
+   return glMapBufferOES(target, access);
+}
+static GLboolean GL_APIENTRY lazy_glUnmapBufferOES(GLenum target)
+{
+   LAZY(UnmapBufferOES);
+   return glUnmapBufferOES(target);
+}
+static void GL_APIENTRY lazy_glGetBufferPointervOES(GLenum target, GLenum pname, GLvoid** params)
+{
+   LAZY(GetBufferPointervOES);
+   glGetBufferPointervOES(target, pname, params);
+}
+static void GL_APIENTRY lazy_glTexImage3DOES(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const GLvoid* pixels)
+{
+   LAZY(TexImage3DOES);
+   glTexImage3DOES(target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+static void GL_APIENTRY lazy_glTexSubImage3DOES(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const GLvoid* pixels)
+{
+   LAZY(TexSubImage3DOES);
+   glTexSubImage3DOES(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+static void GL_APIENTRY lazy_glCopyTexSubImage3DOES(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+   LAZY(CopyTexSubImage3DOES);
+   glCopyTexSubImage3DOES(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+static void GL_APIENTRY lazy_glCompressedTexImage3DOES(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const GLvoid* data)
+{
+   LAZY(CompressedTexImage3DOES);
+   glCompressedTexImage3DOES(target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+static void GL_APIENTRY lazy_glCompressedTexSubImage3DOES(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const GLvoid* data)
+{
+   LAZY(CompressedTexSubImage3DOES);
+   glCompressedTexSubImage3DOES(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+static void GL_APIENTRY lazy_glFramebufferTexture3DOES(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset)
+{
+   LAZY(FramebufferTexture3DOES);
+   glFramebufferTexture3DOES(target, attachment, textarget, texture, level, zoffset);
+}
+static void GL_APIENTRY lazy_glBindVertexArrayOES(GLuint array)
+{
+   LAZY(BindVertexArrayOES);
+   glBindVertexArrayOES(array);
+}
+static void GL_APIENTRY lazy_glDeleteVertexArraysOES(GLsizei n, const GLuint *arrays)
+{
+   LAZY(DeleteVertexArraysOES);
+   glDeleteVertexArraysOES(n, arrays);
+}
+static void GL_APIENTRY lazy_glGenVertexArraysOES(GLsizei n, GLuint *arrays)
+{
+   LAZY(GenVertexArraysOES);
+   glGenVertexArraysOES(n, arrays);
+}
+static GLboolean GL_APIENTRY lazy_glIsVertexArrayOES(GLuint array)
+{
+   LAZY(IsVertexArrayOES);
+   return glIsVertexArrayOES(array);
+}
+static void GL_APIENTRY lazy_glDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled)
+{
+   LAZY(DebugMessageControl);
+   glDebugMessageControl(source, type, severity, count, ids, enabled);
+}
+static void GL_APIENTRY lazy_glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf)
+{
+   LAZY(DebugMessageInsert);
+   glDebugMessageInsert(source, type, id, severity, length, buf);
+}
+static void GL_APIENTRY lazy_glDebugMessageCallback(RGLGENGLDEBUGPROC callback, const void *userParam)
+{
+   LAZY(DebugMessageCallback);
+   glDebugMessageCallback(callback, userParam);
+}
+static GLuint GL_APIENTRY lazy_glGetDebugMessageLog(GLuint count, GLsizei bufsize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog)
+{
+   LAZY(GetDebugMessageLog);
+   return glGetDebugMessageLog(count, bufsize, sources, types, ids, severities, lengths, messageLog);
+}
+static void GL_APIENTRY lazy_glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar *message)
+{
+   LAZY(PushDebugGroup);
+   glPushDebugGroup(source, id, length, message);
+}
+static void GL_APIENTRY lazy_glPopDebugGroup(void)
+{
+   LAZY(PopDebugGroup);
+   glPopDebugGroup();
+}
+static void GL_APIENTRY lazy_glObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar *label)
+{
+   LAZY(ObjectLabel);
+   glObjectLabel(identifier, name, length, label);
+}
+static void GL_APIENTRY lazy_glGetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label)
+{
+   LAZY(GetObjectLabel);
+   glGetObjectLabel(identifier, name, bufSize, length, label);
+}
+static void GL_APIENTRY lazy_glObjectPtrLabel(const void *ptr, GLsizei length, const GLchar *label)
+{
+   LAZY(ObjectPtrLabel);
+   glObjectPtrLabel(ptr, length, label);
+}
+static void GL_APIENTRY lazy_glGetObjectPtrLabel(const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label)
+{
+   LAZY(GetObjectPtrLabel);
+   glGetObjectPtrLabel(ptr, bufSize, length, label);
+}
+static void GL_APIENTRY lazy_glGetPointerv(GLenum pname, void **params)
+{
+   LAZY(GetPointerv);
+   glGetPointerv(pname, params);
+}
+
 const struct rglgen_sym_map rglgen_symbol_map[] = {
     SYM(EGLImageTargetTexture2DOES),
     SYM(EGLImageTargetRenderbufferStorageOES),
@@ -31,7 +174,7 @@ const struct rglgen_sym_map rglgen_symbol_map[] = {
     SYM(GetObjectPtrLabel),
     SYM(GetPointerv),
 
-    { NULL, NULL },
+    { NULL, NULL, NULL },
 };
 RGLSYMGLEGLIMAGETARGETTEXTURE2DOESPROC __rglgen_glEGLImageTargetTexture2DOES;
 RGLSYMGLEGLIMAGETARGETRENDERBUFFERSTORAGEOESPROC __rglgen_glEGLImageTargetRenderbufferStorageOES;
@@ -108,7 +108,7 @@ extern RGLSYMGLOBJECTPTRLABELPROC __rglgen_glObjectPtrLabel;
 extern RGLSYMGLGETOBJECTPTRLABELPROC __rglgen_glGetObjectPtrLabel;
 extern RGLSYMGLGETPOINTERVPROC __rglgen_glGetPointerv;
 
-struct rglgen_sym_map { const char *sym; void *ptr; };
+struct rglgen_sym_map { const char *sym; void *ptr; rglgen_func_t lazy; };
 extern const struct rglgen_sym_map rglgen_symbol_map[];
 #ifdef __cplusplus
 }
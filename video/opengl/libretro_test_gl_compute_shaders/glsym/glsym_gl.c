@@ -1,6 +1,4989 @@
 #include "glsym.h"
 #include <stddef.h>
-#define SYM(x) { "gl" #x, &(gl##x) }
+#define LAZY(x) rglgen_resolve_lazy("gl" #x, &(gl##x))
+#define SYM(x) { "gl" #x, &(gl##x), (rglgen_func_t)lazy_gl##x }
+#define EAGER(x) { "gl" #x, &(gl##x), NULL }
+static void APIENTRY lazy_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+   LAZY(BlendColor);
+   glBlendColor(red, green, blue, alpha);
+}
+static void APIENTRY lazy_glBlendEquation(GLenum mode)
+{
+   LAZY(BlendEquation);
+   glBlendEquation(mode);
+}
+static void APIENTRY lazy_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const GLvoid *indices)
+{
+   LAZY(DrawRangeElements);
+   glDrawRangeElements(mode, start, end, count, type, indices);
+}
+static void APIENTRY lazy_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const GLvoid *pixels)
+{
+   LAZY(TexImage3D);
+   glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+static void APIENTRY lazy_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const GLvoid *pixels)
+{
+   LAZY(TexSubImage3D);
+   glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+static void APIENTRY lazy_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+   LAZY(CopyTexSubImage3D);
+   glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+static void APIENTRY lazy_glColorTable(GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const GLvoid *table)
+{
+   LAZY(ColorTable);
+   glColorTable(target, internalformat, width, format, type, table);
+}
+static void APIENTRY lazy_glColorTableParameterfv(GLenum target, GLenum pname, const GLfloat *params)
+{
+   LAZY(ColorTableParameterfv);
+   glColorTableParameterfv(target, pname, params);
+}
+static void APIENTRY lazy_glColorTableParameteriv(GLenum target, GLenum pname, const GLint *params)
+{
+   LAZY(ColorTableParameteriv);
+   glColorTableParameteriv(target, pname, params);
+}
+static void APIENTRY lazy_glCopyColorTable(GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width)
+{
+   LAZY(CopyColorTable);
+   glCopyColorTable(target, internalformat, x, y, width);
+}
+static void APIENTRY lazy_glGetColorTable(GLenum target, GLenum format, GLenum type, GLvoid *table)
+{
+   LAZY(GetColorTable);
+   glGetColorTable(target, format, type, table);
+}
+static void APIENTRY lazy_glGetColorTableParameterfv(GLenum target, GLenum pname, GLfloat *params)
+{
+   LAZY(GetColorTableParameterfv);
+   glGetColorTableParameterfv(target, pname, params);
+}
+static void APIENTRY lazy_glGetColorTableParameteriv(GLenum target, GLenum pname, GLint *params)
+{
+   LAZY(GetColorTableParameteriv);
+   glGetColorTableParameteriv(target, pname, params);
+}
+static void APIENTRY lazy_glColorSubTable(GLenum target, GLsizei start, GLsizei count, GLenum format, GLenum type, const GLvoid *data)
+{
+   LAZY(ColorSubTable);
+   glColorSubTable(target, start, count, format, type, data);
+}
+static void APIENTRY lazy_glCopyColorSubTable(GLenum target, GLsizei start, GLint x, GLint y, GLsizei width)
+{
+   LAZY(CopyColorSubTable);
+   glCopyColorSubTable(target, start, x, y, width);
+}
+static void APIENTRY lazy_glConvolutionFilter1D(GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const GLvoid *image)
+{
+   LAZY(ConvolutionFilter1D);
+   glConvolutionFilter1D(target, internalformat, width, format, type, image);
+}
+static void APIENTRY lazy_glConvolutionFilter2D(GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid *image)
+{
+   LAZY(ConvolutionFilter2D);
+   glConvolutionFilter2D(target, internalformat, width, height, format, type, image);
+}
+static void APIENTRY lazy_glConvolutionParameterf(GLenum target, GLenum pname, GLfloat params)
+{
+   LAZY(ConvolutionParameterf);
+   glConvolutionParameterf(target, pname, params);
+}
+static void APIENTRY lazy_glConvolutionParameterfv(GLenum target, GLenum pname, const GLfloat *params)
+{
+   LAZY(ConvolutionParameterfv);
+   glConvolutionParameterfv(target, pname, params);
+}
+static void APIENTRY lazy_glConvolutionParameteri(GLenum target, GLenum pname, GLint params)
+{
+   LAZY(ConvolutionParameteri);
+   glConvolutionParameteri(target, pname, params);
+}
+static void APIENTRY lazy_glConvolutionParameteriv(GLenum target, GLenum pname, const GLint *params)
+{
+   LAZY(ConvolutionParameteriv);
+   glConvolutionParameteriv(target, pname, params);
+}
+static void APIENTRY lazy_glCopyConvolutionFilter1D(GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width)
+{
+   LAZY(CopyConvolutionFilter1D);
+   glCopyConvolutionFilter1D(target, internalformat, x, y, width);
+}
+static void APIENTRY lazy_glCopyConvolutionFilter2D(GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+   LAZY(CopyConvolutionFilter2D);
+   glCopyConvolutionFilter2D(target, internalformat, x, y, width, height);
+}
+static void APIENTRY lazy_glGetConvolutionFilter(GLenum target, GLenum format, GLenum type, GLvoid *image)
+{
+   LAZY(GetConvolutionFilter);
+   glGetConvolutionFilter(target, format, type, image);
+}
+static void APIENTRY lazy_glGetConvolutionParameterfv(GLenum target, GLenum pname, GLfloat *params)
+{
+   LAZY(GetConvolutionParameterfv);
+   glGetConvolutionParameterfv(target, pname, params);
+}
+static void APIENTRY lazy_glGetConvolutionParameteriv(GLenum target, GLenum pname, GLint *params)
+{
+   LAZY(GetConvolutionParameteriv);
+   glGetConvolutionParameteriv(target, pname, params);
+}
+static void APIENTRY lazy_glGetSeparableFilter(GLenum target, GLenum format, GLenum type, GLvoid *row, GLvoid *column, GLvoid *span)
+{
+   LAZY(GetSeparableFilter);
+   glGetSeparableFilter(target, format, type, row, column, span);
+}
+static void APIENTRY lazy_glSeparableFilter2D(GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid *row, const GLvoid *column)
+{
+   LAZY(SeparableFilter2D);
+   glSeparableFilter2D(target, internalformat, width, height, format, type, row, column);
+}
+static void APIENTRY lazy_glGetHistogram(GLenum target, GLboolean reset, GLenum format, GLenum type, GLvoid *values)
+{
+   LAZY(GetHistogram);
+   glGetHistogram(target, reset, format, type, values);
+}
+static void APIENTRY lazy_glGetHistogramParameterfv(GLenum target, GLenum pname, GLfloat *params)
+{
+   LAZY(GetHistogramParameterfv);
+   glGetHistogramParameterfv(target, pname, params);
+}
+static void APIENTRY lazy_glGetHistogramParameteriv(GLenum target, GLenum pname, GLint *params)
+{
+   LAZY(GetHistogramParameteriv);
+   glGetHistogramParameteriv(target, pname, params);
+}
+static void APIENTRY lazy_glGetMinmax(GLenum target, GLboolean reset, GLenum format, GLenum type, GLvoid *values)
+{
+   LAZY(GetMinmax);
+   glGetMinmax(target, reset, format, type, values);
+}
+static void APIENTRY lazy_glGetMinmaxParameterfv(GLenum target, GLenum pname, GLfloat *params)
+{
+   LAZY(GetMinmaxParameterfv);
+   glGetMinmaxParameterfv(target, pname, params);
+}
+static void APIENTRY lazy_glGetMinmaxParameteriv(GLenum target, GLenum pname, GLint *params)
+{
+   LAZY(GetMinmaxParameteriv);
+   glGetMinmaxParameteriv(target, pname, params);
+}
+static void APIENTRY lazy_glHistogram(GLenum target, GLsizei width, GLenum internalformat, GLboolean sink)
+{
+   LAZY(Histogram);
+   glHistogram(target, width, internalformat, sink);
+}
+static void APIENTRY lazy_glMinmax(GLenum target, GLenum internalformat, GLboolean sink)
+{
+   LAZY(Minmax);
+   glMinmax(target, internalformat, sink);
+}
+static void APIENTRY lazy_glResetHistogram(GLenum target)
+{
+   LAZY(ResetHistogram);
+   glResetHistogram(target);
+}
+static void APIENTRY lazy_glResetMinmax(GLenum target)
+{
+   LAZY(ResetMinmax);
+   glResetMinmax(target);
+}
+static void APIENTRY lazy_glActiveTexture(GLenum texture)
+{
+   LAZY(ActiveTexture);
+   glActiveTexture(texture);
+}
+static void APIENTRY lazy_glSampleCoverage(GLfloat value, GLboolean invert)
+{
+   LAZY(SampleCoverage);
+   glSampleCoverage(value, invert);
+}
+static void APIENTRY lazy_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const GLvoid *data)
+{
+   LAZY(CompressedTexImage3D);
+   glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+static void APIENTRY lazy_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const GLvoid *data)
+{
+   LAZY(CompressedTexImage2D);
+   glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+}
+static void APIENTRY lazy_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const GLvoid *data)
+{
+   LAZY(CompressedTexImage1D);
+   glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+}
+static void APIENTRY lazy_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const GLvoid *data)
+{
+   LAZY(CompressedTexSubImage3D);
+   glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+static void APIENTRY lazy_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const GLvoid *data)
+{
+   LAZY(CompressedTexSubImage2D);
+   glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+static void APIENTRY lazy_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const GLvoid *data)
+{
+   LAZY(CompressedTexSubImage1D);
+   glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+}
+static void APIENTRY lazy_glGetCompressedTexImage(GLenum target, GLint level, GLvoid *img)
+{
+   LAZY(GetCompressedTexImage);
+   glGetCompressedTexImage(target, level, img);
+}
+static void APIENTRY lazy_glClientActiveTexture(GLenum texture)
+{
+   LAZY(ClientActiveTexture);
+   glClientActiveTexture(texture);
+}
+static void APIENTRY lazy_glMultiTexCoord1d(GLenum target, GLdouble s)
+{
+   LAZY(MultiTexCoord1d);
+   glMultiTexCoord1d(target, s);
+}
+static void APIENTRY lazy_glMultiTexCoord1dv(GLenum target, const GLdouble *v)
+{
+   LAZY(MultiTexCoord1dv);
+   glMultiTexCoord1dv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord1f(GLenum target, GLfloat s)
+{
+   LAZY(MultiTexCoord1f);
+   glMultiTexCoord1f(target, s);
+}
+static void APIENTRY lazy_glMultiTexCoord1fv(GLenum target, const GLfloat *v)
+{
+   LAZY(MultiTexCoord1fv);
+   glMultiTexCoord1fv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord1i(GLenum target, GLint s)
+{
+   LAZY(MultiTexCoord1i);
+   glMultiTexCoord1i(target, s);
+}
+static void APIENTRY lazy_glMultiTexCoord1iv(GLenum target, const GLint *v)
+{
+   LAZY(MultiTexCoord1iv);
+   glMultiTexCoord1iv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord1s(GLenum target, GLshort s)
+{
+   LAZY(MultiTexCoord1s);
+   glMultiTexCoord1s(target, s);
+}
+static void APIENTRY lazy_glMultiTexCoord1sv(GLenum target, const GLshort *v)
+{
+   LAZY(MultiTexCoord1sv);
+   glMultiTexCoord1sv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord2d(GLenum target, GLdouble s, GLdouble t)
+{
+   LAZY(MultiTexCoord2d);
+   glMultiTexCoord2d(target, s, t);
+}
+static void APIENTRY lazy_glMultiTexCoord2dv(GLenum target, const GLdouble *v)
+{
+   LAZY(MultiTexCoord2dv);
+   glMultiTexCoord2dv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord2f(GLenum target, GLfloat s, GLfloat t)
+{
+   LAZY(MultiTexCoord2f);
+   glMultiTexCoord2f(target, s, t);
+}
+static void APIENTRY lazy_glMultiTexCoord2fv(GLenum target, const GLfloat *v)
+{
+   LAZY(MultiTexCoord2fv);
+   glMultiTexCoord2fv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord2i(GLenum target, GLint s, GLint t)
+{
+   LAZY(MultiTexCoord2i);
+   glMultiTexCoord2i(target, s, t);
+}
+static void APIENTRY lazy_glMultiTexCoord2iv(GLenum target, const GLint *v)
+{
+   LAZY(MultiTexCoord2iv);
+   glMultiTexCoord2iv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord2s(GLenum target, GLshort s, GLshort t)
+{
+   LAZY(MultiTexCoord2s);
+   glMultiTexCoord2s(target, s, t);
+}
+static void APIENTRY lazy_glMultiTexCoord2sv(GLenum target, const GLshort *v)
+{
+   LAZY(MultiTexCoord2sv);
+   glMultiTexCoord2sv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord3d(GLenum target, GLdouble s, GLdouble t, GLdouble r)
+{
+   LAZY(MultiTexCoord3d);
+   glMultiTexCoord3d(target, s, t, r);
+}
+static void APIENTRY lazy_glMultiTexCoord3dv(GLenum target, const GLdouble *v)
+{
+   LAZY(MultiTexCoord3dv);
+   glMultiTexCoord3dv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord3f(GLenum target, GLfloat s, GLfloat t, GLfloat r)
+{
+   LAZY(MultiTexCoord3f);
+   glMultiTexCoord3f(target, s, t, r);
+}
+static void APIENTRY lazy_glMultiTexCoord3fv(GLenum target, const GLfloat *v)
+{
+   LAZY(MultiTexCoord3fv);
+   glMultiTexCoord3fv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord3i(GLenum target, GLint s, GLint t, GLint r)
+{
+   LAZY(MultiTexCoord3i);
+   glMultiTexCoord3i(target, s, t, r);
+}
+static void APIENTRY lazy_glMultiTexCoord3iv(GLenum target, const GLint *v)
+{
+   LAZY(MultiTexCoord3iv);
+   glMultiTexCoord3iv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord3s(GLenum target, GLshort s, GLshort t, GLshort r)
+{
+   LAZY(MultiTexCoord3s);
+   glMultiTexCoord3s(target, s, t, r);
+}
+static void APIENTRY lazy_glMultiTexCoord3sv(GLenum target, const GLshort *v)
+{
+   LAZY(MultiTexCoord3sv);
+   glMultiTexCoord3sv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord4d(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q)
+{
+   LAZY(MultiTexCoord4d);
+   glMultiTexCoord4d(target, s, t, r, q);
+}
+static void APIENTRY lazy_glMultiTexCoord4dv(GLenum target, const GLdouble *v)
+{
+   LAZY(MultiTexCoord4dv);
+   glMultiTexCoord4dv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q)
+{
+   LAZY(MultiTexCoord4f);
+   glMultiTexCoord4f(target, s, t, r, q);
+}
+static void APIENTRY lazy_glMultiTexCoord4fv(GLenum target, const GLfloat *v)
+{
+   LAZY(MultiTexCoord4fv);
+   glMultiTexCoord4fv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord4i(GLenum target, GLint s, GLint t, GLint r, GLint q)
+{
+   LAZY(MultiTexCoord4i);
+   glMultiTexCoord4i(target, s, t, r, q);
+}
+static void APIENTRY lazy_glMultiTexCoord4iv(GLenum target, const GLint *v)
+{
+   LAZY(MultiTexCoord4iv);
+   glMultiTexCoord4iv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord4s(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q)
+{
+   LAZY(MultiTexCoord4s);
+   glMultiTexCoord4s(target, s, t, r, q);
+}
+static void APIENTRY lazy_glMultiTexCoord4sv(GLenum target, const GLshort *v)
+{
+   LAZY(MultiTexCoord4sv);
+   glMultiTexCoord4sv(target, v);
+}
+static void APIENTRY lazy_glLoadTransposeMatrixf(const GLfloat *m)
+{
+   LAZY(LoadTransposeMatrixf);
+   glLoadTransposeMatrixf(m);
+}
+static void APIENTRY lazy_glLoadTransposeMatrixd(const GLdouble *m)
+{
+   LAZY(LoadTransposeMatrixd);
+   glLoadTransposeMatrixd(m);
+}
+static void APIENTRY lazy_glMultTransposeMatrixf(const GLfloat *m)
+{
+   LAZY(MultTransposeMatrixf);
+   glMultTransposeMatrixf(m);
+}
+static void APIENTRY lazy_glMultTransposeMatrixd(const GLdouble *m)
+{
+   LAZY(MultTransposeMatrixd);
+   glMultTransposeMatrixd(m);
+}
+static void APIENTRY lazy_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)
+{
+   LAZY(BlendFuncSeparate);
+   glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+static void APIENTRY lazy_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount)
+{
+   LAZY(MultiDrawArrays);
+   glMultiDrawArrays(mode, first, count, drawcount);
+}
+static void APIENTRY lazy_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const GLvoid* const *indices, GLsizei drawcount)
+{
+   LAZY(MultiDrawElements);
+   glMultiDrawElements(mode, count, type, indices, drawcount);
+}
+static void APIENTRY lazy_glPointParameterf(GLenum pname, GLfloat param)
+{
+   LAZY(PointParameterf);
+   glPointParameterf(pname, param);
+}
+static void APIENTRY lazy_glPointParameterfv(GLenum pname, const GLfloat *params)
+{
+   LAZY(PointParameterfv);
+   glPointParameterfv(pname, params);
+}
+static void APIENTRY lazy_glPointParameteri(GLenum pname, GLint param)
+{
+   LAZY(PointParameteri);
+   glPointParameteri(pname, param);
+}
+static void APIENTRY lazy_glPointParameteriv(GLenum pname, const GLint *params)
+{
+   LAZY(PointParameteriv);
+   glPointParameteriv(pname, params);
+}
+static void APIENTRY lazy_glFogCoordf(GLfloat coord)
+{
+   LAZY(FogCoordf);
+   glFogCoordf(coord);
+}
+static void APIENTRY lazy_glFogCoordfv(const GLfloat *coord)
+{
+   LAZY(FogCoordfv);
+   glFogCoordfv(coord);
+}
+static void APIENTRY lazy_glFogCoordd(GLdouble coord)
+{
+   LAZY(FogCoordd);
+   glFogCoordd(coord);
+}
+static void APIENTRY lazy_glFogCoorddv(const GLdouble *coord)
+{
+   LAZY(FogCoorddv);
+   glFogCoorddv(coord);
+}
+static void APIENTRY lazy_glFogCoordPointer(GLenum type, GLsizei stride, const GLvoid *pointer)
+{
+   LAZY(FogCoordPointer);
+   glFogCoordPointer(type, stride, pointer);
+}
+static void APIENTRY lazy_glSecondaryColor3b(GLbyte red, GLbyte green, GLbyte blue)
+{
+   LAZY(SecondaryColor3b);
+   glSecondaryColor3b(red, green, blue);
+}
+static void APIENTRY lazy_glSecondaryColor3bv(const GLbyte *v)
+{
+   LAZY(SecondaryColor3bv);
+   glSecondaryColor3bv(v);
+}
+static void APIENTRY lazy_glSecondaryColor3d(GLdouble red, GLdouble green, GLdouble blue)
+{
+   LAZY(SecondaryColor3d);
+   glSecondaryColor3d(red, green, blue);
+}
+static void APIENTRY lazy_glSecondaryColor3dv(const GLdouble *v)
+{
+   LAZY(SecondaryColor3dv);
+   glSecondaryColor3dv(v);
+}
+static void APIENTRY lazy_glSecondaryColor3f(GLfloat red, GLfloat green, GLfloat blue)
+{
+   LAZY(SecondaryColor3f);
+   glSecondaryColor3f(red, green, blue);
+}
+static void APIENTRY lazy_glSecondaryColor3fv(const GLfloat *v)
+{
+   LAZY(SecondaryColor3fv);
+   glSecondaryColor3fv(v);
+}
+static void APIENTRY lazy_glSecondaryColor3i(GLint red, GLint green, GLint blue)
+{
+   LAZY(SecondaryColor3i);
+   glSecondaryColor3i(red, green, blue);
+}
+static void APIENTRY lazy_glSecondaryColor3iv(const GLint *v)
+{
+   LAZY(SecondaryColor3iv);
+   glSecondaryColor3iv(v);
+}
+static void APIENTRY lazy_glSecondaryColor3s(GLshort red, GLshort green, GLshort blue)
+{
+   LAZY(SecondaryColor3s);
+   glSecondaryColor3s(red, green, blue);
+}
+static void APIENTRY lazy_glSecondaryColor3sv(const GLshort *v)
+{
+   LAZY(SecondaryColor3sv);
+   glSecondaryColor3sv(v);
+}
+static void APIENTRY lazy_glSecondaryColor3ub(GLubyte red, GLubyte green, GLubyte blue)
+{
+   LAZY(SecondaryColor3ub);
+   glSecondaryColor3ub(red, green, blue);
+}
+static void APIENTRY lazy_glSecondaryColor3ubv(const GLubyte *v)
+{
+   LAZY(SecondaryColor3ubv);
+   glSecondaryColor3ubv(v);
+}
+static void APIENTRY lazy_glSecondaryColor3ui(GLuint red, GLuint green, GLuint blue)
+{
+   LAZY(SecondaryColor3ui);
+   glSecondaryColor3ui(red, green, blue);
+}
+static void APIENTRY lazy_glSecondaryColor3uiv(const GLuint *v)
+{
+   LAZY(SecondaryColor3uiv);
+   glSecondaryColor3uiv(v);
+}
+static void APIENTRY lazy_glSecondaryColor3us(GLushort red, GLushort green, GLushort blue)
+{
+   LAZY(SecondaryColor3us);
+   glSecondaryColor3us(red, green, blue);
+}
+static void APIENTRY lazy_glSecondaryColor3usv(const GLushort *v)
+{
+   LAZY(SecondaryColor3usv);
+   glSecondaryColor3usv(v);
+}
+static void APIENTRY lazy_glSecondaryColorPointer(GLint size, GLenum type, GLsizei stride, const GLvoid *pointer)
+{
+   LAZY(SecondaryColorPointer);
+   glSecondaryColorPointer(size, type, stride, pointer);
+}
+static void APIENTRY lazy_glWindowPos2d(GLdouble x, GLdouble y)
+{
+   LAZY(WindowPos2d);
+   glWindowPos2d(x, y);
+}
+static void APIENTRY lazy_glWindowPos2dv(const GLdouble *v)
+{
+   LAZY(WindowPos2dv);
+   glWindowPos2dv(v);
+}
+static void APIENTRY lazy_glWindowPos2f(GLfloat x, GLfloat y)
+{
+   LAZY(WindowPos2f);
+   glWindowPos2f(x, y);
+}
+static void APIENTRY lazy_glWindowPos2fv(const GLfloat *v)
+{
+   LAZY(WindowPos2fv);
+   glWindowPos2fv(v);
+}
+static void APIENTRY lazy_glWindowPos2i(GLint x, GLint y)
+{
+   LAZY(WindowPos2i);
+   glWindowPos2i(x, y);
+}
+static void APIENTRY lazy_glWindowPos2iv(const GLint *v)
+{
+   LAZY(WindowPos2iv);
+   glWindowPos2iv(v);
+}
+static void APIENTRY lazy_glWindowPos2s(GLshort x, GLshort y)
+{
+   LAZY(WindowPos2s);
+   glWindowPos2s(x, y);
+}
+static void APIENTRY lazy_glWindowPos2sv(const GLshort *v)
+{
+   LAZY(WindowPos2sv);
+   glWindowPos2sv(v);
+}
+static void APIENTRY lazy_glWindowPos3d(GLdouble x, GLdouble y, GLdouble z)
+{
+   LAZY(WindowPos3d);
+   glWindowPos3d(x, y, z);
+}
+static void APIENTRY lazy_glWindowPos3dv(const GLdouble *v)
+{
+   LAZY(WindowPos3dv);
+   glWindowPos3dv(v);
+}
+static void APIENTRY lazy_glWindowPos3f(GLfloat x, GLfloat y, GLfloat z)
+{
+   LAZY(WindowPos3f);
+   glWindowPos3f(x, y, z);
+}
+static void APIENTRY lazy_glWindowPos3fv(const GLfloat *v)
+{
+   LAZY(WindowPos3fv);
+   glWindowPos3fv(v);
+}
+static void APIENTRY lazy_glWindowPos3i(GLint x, GLint y, GLint z)
+{
+   LAZY(WindowPos3i);
+   glWindowPos3i(x, y, z);
+}
+static void APIENTRY lazy_glWindowPos3iv(const GLint *v)
+{
+   LAZY(WindowPos3iv);
+   glWindowPos3iv(v);
+}
+static void APIENTRY lazy_glWindowPos3s(GLshort x, GLshort y, GLshort z)
+{
+   LAZY(WindowPos3s);
+   glWindowPos3s(x, y, z);
+}
+static void APIENTRY lazy_glWindowPos3sv(const GLshort *v)
+{
+   LAZY(WindowPos3sv);
+   glWindowPos3sv(v);
+}
+static void APIENTRY lazy_glGenQueries(GLsizei n, GLuint *ids)
+{
+   LAZY(GenQueries);
+   glGenQueries(n, ids);
+}
+static void APIENTRY lazy_glDeleteQueries(GLsizei n, const GLuint *ids)
+{
+   LAZY(DeleteQueries);
+   glDeleteQueries(n, ids);
+}
+static GLboolean APIENTRY lazy_glIsQuery(GLuint id)
+{
+   LAZY(IsQuery);
+   return glIsQuery(id);
+}
+static void APIENTRY lazy_glBeginQuery(GLenum target, GLuint id)
+{
+   LAZY(BeginQuery);
+   glBeginQuery(target, id);
+}
+static void APIENTRY lazy_glEndQuery(GLenum target)
+{
+   LAZY(EndQuery);
+   glEndQuery(target);
+}
+static void APIENTRY lazy_glGetQueryiv(GLenum target, GLenum pname, GLint *params)
+{
+   LAZY(GetQueryiv);
+   glGetQueryiv(target, pname, params);
+}
+static void APIENTRY lazy_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params)
+{
+   LAZY(GetQueryObjectiv);
+   glGetQueryObjectiv(id, pname, params);
+}
+static void APIENTRY lazy_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params)
+{
+   LAZY(GetQueryObjectuiv);
+   glGetQueryObjectuiv(id, pname, params);
+}
+static void APIENTRY lazy_glBindBuffer(GLenum target, GLuint buffer)
+{
+   LAZY(BindBuffer);
+   glBindBuffer(target, buffer);
+}
+static void APIENTRY lazy_glDeleteBuffers(GLsizei n, const GLuint *buffers)
+{
+   LAZY(DeleteBuffers);
+   glDeleteBuffers(n, buffers);
+}
+static void APIENTRY lazy_glGenBuffers(GLsizei n, GLuint *buffers)
+{
+   LAZY(GenBuffers);
+   glGenBuffers(n, buffers);
+}
+static GLboolean APIENTRY lazy_glIsBuffer(GLuint buffer)
+{
+   LAZY(IsBuffer);
+   return glIsBuffer(buffer);
+}
+static void APIENTRY lazy_glBufferData(GLenum target, GLsizeiptr size, const GLvoid *data, GLenum usage)
+{
+   LAZY(BufferData);
+   glBufferData(target, size, data, usage);
+}
+static void APIENTRY lazy_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const GLvoid *data)
+{
+   LAZY(BufferSubData);
+   glBufferSubData(target, offset, size, data);
+}
+static void APIENTRY lazy_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, GLvoid *data)
+{
+   LAZY(GetBufferSubData);
+   glGetBufferSubData(target, offset, size, data);
+}
+static GLvoid* APIENTRY lazy_glMapBuffer(GLenum target, GLenum access)
+{
+   LAZY(MapBuffer);
+   return glMapBuffer(target, access);
+}
+static GLboolean APIENTRY lazy_glUnmapBuffer(GLenum target)
+{
+   LAZY(UnmapBuffer);
+   return glUnmapBuffer(target);
+}
+static void APIENTRY lazy_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params)
+{
+   LAZY(GetBufferParameteriv);
+   glGetBufferParameteriv(target, pname, params);
+}
+static void APIENTRY lazy_glGetBufferPointerv(GLenum target, GLenum pname, GLvoid* *params)
+{
+   LAZY(GetBufferPointerv);
+   glGetBufferPointerv(target, pname, params);
+}
+static void APIENTRY lazy_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
+{
+   LAZY(BlendEquationSeparate);
+   glBlendEquationSeparate(modeRGB, modeAlpha);
+}
+static void APIENTRY lazy_glDrawBuffers(GLsizei n, const GLenum *bufs)
+{
+   LAZY(DrawBuffers);
+   glDrawBuffers(n, bufs);
+}
+static void APIENTRY lazy_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass)
+{
+   LAZY(StencilOpSeparate);
+   glStencilOpSeparate(face, sfail, dpfail, dppass);
+}
+static void APIENTRY lazy_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask)
+{
+   LAZY(StencilFuncSeparate);
+   glStencilFuncSeparate(face, func, ref, mask);
+}
+static void APIENTRY lazy_glStencilMaskSeparate(GLenum face, GLuint mask)
+{
+   LAZY(StencilMaskSeparate);
+   glStencilMaskSeparate(face, mask);
+}
+static void APIENTRY lazy_glAttachShader(GLuint program, GLuint shader)
+{
+   LAZY(AttachShader);
+   glAttachShader(program, shader);
+}
+static void APIENTRY lazy_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name)
+{
+   LAZY(BindAttribLocation);
+   glBindAttribLocation(program, index, name);
+}
+static void APIENTRY lazy_glCompileShader(GLuint shader)
+{
+   LAZY(CompileShader);
+   glCompileShader(shader);
+}
+static GLuint APIENTRY lazy_glCreateProgram(void)
+{
+   LAZY(CreateProgram);
+   return glCreateProgram();
+}
+static GLuint APIENTRY lazy_glCreateShader(GLenum type)
+{
+   LAZY(CreateShader);
+   return glCreateShader(type);
+}
+static void APIENTRY lazy_glDeleteProgram(GLuint program)
+{
+   LAZY(DeleteProgram);
+   glDeleteProgram(program);
+}
+static void APIENTRY lazy_glDeleteShader(GLuint shader)
+{
+   LAZY(DeleteShader);
+   glDeleteShader(shader);
+}
+static void APIENTRY lazy_glDetachShader(GLuint program, GLuint shader)
+{
+   LAZY(DetachShader);
+   glDetachShader(program, shader);
+}
+static void APIENTRY lazy_glDisableVertexAttribArray(GLuint index)
+{
+   LAZY(DisableVertexAttribArray);
+   glDisableVertexAttribArray(index);
+}
+static void APIENTRY lazy_glEnableVertexAttribArray(GLuint index)
+{
+   LAZY(EnableVertexAttribArray);
+   glEnableVertexAttribArray(index);
+}
+static void APIENTRY lazy_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name)
+{
+   LAZY(GetActiveAttrib);
+   glGetActiveAttrib(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY lazy_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name)
+{
+   LAZY(GetActiveUniform);
+   glGetActiveUniform(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY lazy_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *obj)
+{
+   LAZY(GetAttachedShaders);
+   glGetAttachedShaders(program, maxCount, count, obj);
+}
+static GLint APIENTRY lazy_glGetAttribLocation(GLuint program, const GLchar *name)
+{
+   LAZY(GetAttribLocation);
+   return glGetAttribLocation(program, name);
+}
+static void APIENTRY lazy_glGetProgramiv(GLuint program, GLenum pname, GLint *params)
+{
+   LAZY(GetProgramiv);
+   glGetProgramiv(program, pname, params);
+}
+static void APIENTRY lazy_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+   LAZY(GetProgramInfoLog);
+   glGetProgramInfoLog(program, bufSize, length, infoLog);
+}
+static void APIENTRY lazy_glGetShaderiv(GLuint shader, GLenum pname, GLint *params)
+{
+   LAZY(GetShaderiv);
+   glGetShaderiv(shader, pname, params);
+}
+static void APIENTRY lazy_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+   LAZY(GetShaderInfoLog);
+   glGetShaderInfoLog(shader, bufSize, length, infoLog);
+}
+static void APIENTRY lazy_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source)
+{
+   LAZY(GetShaderSource);
+   glGetShaderSource(shader, bufSize, length, source);
+}
+static GLint APIENTRY lazy_glGetUniformLocation(GLuint program, const GLchar *name)
+{
+   LAZY(GetUniformLocation);
+   return glGetUniformLocation(program, name);
+}
+static void APIENTRY lazy_glGetUniformfv(GLuint program, GLint location, GLfloat *params)
+{
+   LAZY(GetUniformfv);
+   glGetUniformfv(program, location, params);
+}
+static void APIENTRY lazy_glGetUniformiv(GLuint program, GLint location, GLint *params)
+{
+   LAZY(GetUniformiv);
+   glGetUniformiv(program, location, params);
+}
+static void APIENTRY lazy_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params)
+{
+   LAZY(GetVertexAttribdv);
+   glGetVertexAttribdv(index, pname, params);
+}
+static void APIENTRY lazy_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params)
+{
+   LAZY(GetVertexAttribfv);
+   glGetVertexAttribfv(index, pname, params);
+}
+static void APIENTRY lazy_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params)
+{
+   LAZY(GetVertexAttribiv);
+   glGetVertexAttribiv(index, pname, params);
+}
+static void APIENTRY lazy_glGetVertexAttribPointerv(GLuint index, GLenum pname, GLvoid* *pointer)
+{
+   LAZY(GetVertexAttribPointerv);
+   glGetVertexAttribPointerv(index, pname, pointer);
+}
+static GLboolean APIENTRY lazy_glIsProgram(GLuint program)
+{
+   LAZY(IsProgram);
+   return glIsProgram(program);
+}
+static GLboolean APIENTRY lazy_glIsShader(GLuint shader)
+{
+   LAZY(IsShader);
+   return glIsShader(shader);
+}
+static void APIENTRY lazy_glLinkProgram(GLuint program)
+{
+   LAZY(LinkProgram);
+   glLinkProgram(program);
+}
+static void APIENTRY lazy_glShaderSource(GLuint shader, GLsizei count, const GLchar* const *string, const GLint *length)
+{
+   LAZY(ShaderSource);
+   glShaderSource(shader, count, string, length);
+}
+static void APIENTRY lazy_glUseProgram(GLuint program)
+{
+   LAZY(UseProgram);
+   glUseProgram(program);
+}
+static void APIENTRY lazy_glUniform1f(GLint location, GLfloat v0)
+{
+   LAZY(Uniform1f);
+   glUniform1f(location, v0);
+}
+static void APIENTRY lazy_glUniform2f(GLint location, GLfloat v0, GLfloat v1)
+{
+   LAZY(Uniform2f);
+   glUniform2f(location, v0, v1);
+}
+static void APIENTRY lazy_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+   LAZY(Uniform3f);
+   glUniform3f(location, v0, v1, v2);
+}
+static void APIENTRY lazy_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+   LAZY(Uniform4f);
+   glUniform4f(location, v0, v1, v2, v3);
+}
+static void APIENTRY lazy_glUniform1i(GLint location, GLint v0)
+{
+   LAZY(Uniform1i);
+   glUniform1i(location, v0);
+}
+static void APIENTRY lazy_glUniform2i(GLint location, GLint v0, GLint v1)
+{
+   LAZY(Uniform2i);
+   glUniform2i(location, v0, v1);
+}
+static void APIENTRY lazy_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2)
+{
+   LAZY(Uniform3i);
+   glUniform3i(location, v0, v1, v2);
+}
+static void APIENTRY lazy_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+   LAZY(Uniform4i);
+   glUniform4i(location, v0, v1, v2, v3);
+}
+static void APIENTRY lazy_glUniform1fv(GLint location, GLsizei count, const GLfloat *value)
+{
+   LAZY(Uniform1fv);
+   glUniform1fv(location, count, value);
+}
+static void APIENTRY lazy_glUniform2fv(GLint location, GLsizei count, const GLfloat *value)
+{
+   LAZY(Uniform2fv);
+   glUniform2fv(location, count, value);
+}
+static void APIENTRY lazy_glUniform3fv(GLint location, GLsizei count, const GLfloat *value)
+{
+   LAZY(Uniform3fv);
+   glUniform3fv(location, count, value);
+}
+static void APIENTRY lazy_glUniform4fv(GLint location, GLsizei count, const GLfloat *value)
+{
+   LAZY(Uniform4fv);
+   glUniform4fv(location, count, value);
+}
+static void APIENTRY lazy_glUniform1iv(GLint location, GLsizei count, const GLint *value)
+{
+   LAZY(Uniform1iv);
+   glUniform1iv(location, count, value);
+}
+static void APIENTRY lazy_glUniform2iv(GLint location, GLsizei count, const GLint *value)
+{
+   LAZY(Uniform2iv);
+   glUniform2iv(location, count, value);
+}
+static void APIENTRY lazy_glUniform3iv(GLint location, GLsizei count, const GLint *value)
+{
+   LAZY(Uniform3iv);
+   glUniform3iv(location, count, value);
+}
+static void APIENTRY lazy_glUniform4iv(GLint location, GLsizei count, const GLint *value)
+{
+   LAZY(Uniform4iv);
+   glUniform4iv(location, count, value);
+}
+static void APIENTRY lazy_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+   LAZY(UniformMatrix2fv);
+   glUniformMatrix2fv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+   LAZY(UniformMatrix3fv);
+   glUniformMatrix3fv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+   LAZY(UniformMatrix4fv);
+   glUniformMatrix4fv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glValidateProgram(GLuint program)
+{
+   LAZY(ValidateProgram);
+   glValidateProgram(program);
+}
+static void APIENTRY lazy_glVertexAttrib1d(GLuint index, GLdouble x)
+{
+   LAZY(VertexAttrib1d);
+   glVertexAttrib1d(index, x);
+}
+static void APIENTRY lazy_glVertexAttrib1dv(GLuint index, const GLdouble *v)
+{
+   LAZY(VertexAttrib1dv);
+   glVertexAttrib1dv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib1f(GLuint index, GLfloat x)
+{
+   LAZY(VertexAttrib1f);
+   glVertexAttrib1f(index, x);
+}
+static void APIENTRY lazy_glVertexAttrib1fv(GLuint index, const GLfloat *v)
+{
+   LAZY(VertexAttrib1fv);
+   glVertexAttrib1fv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib1s(GLuint index, GLshort x)
+{
+   LAZY(VertexAttrib1s);
+   glVertexAttrib1s(index, x);
+}
+static void APIENTRY lazy_glVertexAttrib1sv(GLuint index, const GLshort *v)
+{
+   LAZY(VertexAttrib1sv);
+   glVertexAttrib1sv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y)
+{
+   LAZY(VertexAttrib2d);
+   glVertexAttrib2d(index, x, y);
+}
+static void APIENTRY lazy_glVertexAttrib2dv(GLuint index, const GLdouble *v)
+{
+   LAZY(VertexAttrib2dv);
+   glVertexAttrib2dv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y)
+{
+   LAZY(VertexAttrib2f);
+   glVertexAttrib2f(index, x, y);
+}
+static void APIENTRY lazy_glVertexAttrib2fv(GLuint index, const GLfloat *v)
+{
+   LAZY(VertexAttrib2fv);
+   glVertexAttrib2fv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib2s(GLuint index, GLshort x, GLshort y)
+{
+   LAZY(VertexAttrib2s);
+   glVertexAttrib2s(index, x, y);
+}
+static void APIENTRY lazy_glVertexAttrib2sv(GLuint index, const GLshort *v)
+{
+   LAZY(VertexAttrib2sv);
+   glVertexAttrib2sv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+   LAZY(VertexAttrib3d);
+   glVertexAttrib3d(index, x, y, z);
+}
+static void APIENTRY lazy_glVertexAttrib3dv(GLuint index, const GLdouble *v)
+{
+   LAZY(VertexAttrib3dv);
+   glVertexAttrib3dv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z)
+{
+   LAZY(VertexAttrib3f);
+   glVertexAttrib3f(index, x, y, z);
+}
+static void APIENTRY lazy_glVertexAttrib3fv(GLuint index, const GLfloat *v)
+{
+   LAZY(VertexAttrib3fv);
+   glVertexAttrib3fv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z)
+{
+   LAZY(VertexAttrib3s);
+   glVertexAttrib3s(index, x, y, z);
+}
+static void APIENTRY lazy_glVertexAttrib3sv(GLuint index, const GLshort *v)
+{
+   LAZY(VertexAttrib3sv);
+   glVertexAttrib3sv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4Nbv(GLuint index, const GLbyte *v)
+{
+   LAZY(VertexAttrib4Nbv);
+   glVertexAttrib4Nbv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4Niv(GLuint index, const GLint *v)
+{
+   LAZY(VertexAttrib4Niv);
+   glVertexAttrib4Niv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4Nsv(GLuint index, const GLshort *v)
+{
+   LAZY(VertexAttrib4Nsv);
+   glVertexAttrib4Nsv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)
+{
+   LAZY(VertexAttrib4Nub);
+   glVertexAttrib4Nub(index, x, y, z, w);
+}
+static void APIENTRY lazy_glVertexAttrib4Nubv(GLuint index, const GLubyte *v)
+{
+   LAZY(VertexAttrib4Nubv);
+   glVertexAttrib4Nubv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4Nuiv(GLuint index, const GLuint *v)
+{
+   LAZY(VertexAttrib4Nuiv);
+   glVertexAttrib4Nuiv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4Nusv(GLuint index, const GLushort *v)
+{
+   LAZY(VertexAttrib4Nusv);
+   glVertexAttrib4Nusv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4bv(GLuint index, const GLbyte *v)
+{
+   LAZY(VertexAttrib4bv);
+   glVertexAttrib4bv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+   LAZY(VertexAttrib4d);
+   glVertexAttrib4d(index, x, y, z, w);
+}
+static void APIENTRY lazy_glVertexAttrib4dv(GLuint index, const GLdouble *v)
+{
+   LAZY(VertexAttrib4dv);
+   glVertexAttrib4dv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+   LAZY(VertexAttrib4f);
+   glVertexAttrib4f(index, x, y, z, w);
+}
+static void APIENTRY lazy_glVertexAttrib4fv(GLuint index, const GLfloat *v)
+{
+   LAZY(VertexAttrib4fv);
+   glVertexAttrib4fv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4iv(GLuint index, const GLint *v)
+{
+   LAZY(VertexAttrib4iv);
+   glVertexAttrib4iv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)
+{
+   LAZY(VertexAttrib4s);
+   glVertexAttrib4s(index, x, y, z, w);
+}
+static void APIENTRY lazy_glVertexAttrib4sv(GLuint index, const GLshort *v)
+{
+   LAZY(VertexAttrib4sv);
+   glVertexAttrib4sv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4ubv(GLuint index, const GLubyte *v)
+{
+   LAZY(VertexAttrib4ubv);
+   glVertexAttrib4ubv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4uiv(GLuint index, const GLuint *v)
+{
+   LAZY(VertexAttrib4uiv);
+   glVertexAttrib4uiv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4usv(GLuint index, const GLushort *v)
+{
+   LAZY(VertexAttrib4usv);
+   glVertexAttrib4usv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const GLvoid *pointer)
+{
+   LAZY(VertexAttribPointer);
+   glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+}
+static void APIENTRY lazy_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+   LAZY(UniformMatrix2x3fv);
+   glUniformMatrix2x3fv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+   LAZY(UniformMatrix3x2fv);
+   glUniformMatrix3x2fv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+   LAZY(UniformMatrix2x4fv);
+   glUniformMatrix2x4fv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+   LAZY(UniformMatrix4x2fv);
+   glUniformMatrix4x2fv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+   LAZY(UniformMatrix3x4fv);
+   glUniformMatrix3x4fv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+   LAZY(UniformMatrix4x3fv);
+   glUniformMatrix4x3fv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a)
+{
+   LAZY(ColorMaski);
+   glColorMaski(index, r, g, b, a);
+}
+static void APIENTRY lazy_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data)
+{
+   LAZY(GetBooleani_v);
+   glGetBooleani_v(target, index, data);
+}
+static void APIENTRY lazy_glGetIntegeri_v(GLenum target, GLuint index, GLint *data)
+{
+   LAZY(GetIntegeri_v);
+   glGetIntegeri_v(target, index, data);
+}
+static void APIENTRY lazy_glEnablei(GLenum target, GLuint index)
+{
+   LAZY(Enablei);
+   glEnablei(target, index);
+}
+static void APIENTRY lazy_glDisablei(GLenum target, GLuint index)
+{
+   LAZY(Disablei);
+   glDisablei(target, index);
+}
+static GLboolean APIENTRY lazy_glIsEnabledi(GLenum target, GLuint index)
+{
+   LAZY(IsEnabledi);
+   return glIsEnabledi(target, index);
+}
+static void APIENTRY lazy_glBeginTransformFeedback(GLenum primitiveMode)
+{
+   LAZY(BeginTransformFeedback);
+   glBeginTransformFeedback(primitiveMode);
+}
+static void APIENTRY lazy_glEndTransformFeedback(void)
+{
+   LAZY(EndTransformFeedback);
+   glEndTransformFeedback();
+}
+static void APIENTRY lazy_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+   LAZY(BindBufferRange);
+   glBindBufferRange(target, index, buffer, offset, size);
+}
+static void APIENTRY lazy_glBindBufferBase(GLenum target, GLuint index, GLuint buffer)
+{
+   LAZY(BindBufferBase);
+   glBindBufferBase(target, index, buffer);
+}
+static void APIENTRY lazy_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar* const *varyings, GLenum bufferMode)
+{
+   LAZY(TransformFeedbackVaryings);
+   glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+}
+static void APIENTRY lazy_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name)
+{
+   LAZY(GetTransformFeedbackVarying);
+   glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY lazy_glClampColor(GLenum target, GLenum clamp)
+{
+   LAZY(ClampColor);
+   glClampColor(target, clamp);
+}
+static void APIENTRY lazy_glBeginConditionalRender(GLuint id, GLenum mode)
+{
+   LAZY(BeginConditionalRender);
+   glBeginConditionalRender(id, mode);
+}
+static void APIENTRY lazy_glEndConditionalRender(void)
+{
+   LAZY(EndConditionalRender);
+   glEndConditionalRender();
+}
+static void APIENTRY lazy_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const GLvoid *pointer)
+{
+   LAZY(VertexAttribIPointer);
+   glVertexAttribIPointer(index, size, type, stride, pointer);
+}
+static void APIENTRY lazy_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params)
+{
+   LAZY(GetVertexAttribIiv);
+   glGetVertexAttribIiv(index, pname, params);
+}
+static void APIENTRY lazy_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params)
+{
+   LAZY(GetVertexAttribIuiv);
+   glGetVertexAttribIuiv(index, pname, params);
+}
+static void APIENTRY lazy_glVertexAttribI1i(GLuint index, GLint x)
+{
+   LAZY(VertexAttribI1i);
+   glVertexAttribI1i(index, x);
+}
+static void APIENTRY lazy_glVertexAttribI2i(GLuint index, GLint x, GLint y)
+{
+   LAZY(VertexAttribI2i);
+   glVertexAttribI2i(index, x, y);
+}
+static void APIENTRY lazy_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z)
+{
+   LAZY(VertexAttribI3i);
+   glVertexAttribI3i(index, x, y, z);
+}
+static void APIENTRY lazy_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w)
+{
+   LAZY(VertexAttribI4i);
+   glVertexAttribI4i(index, x, y, z, w);
+}
+static void APIENTRY lazy_glVertexAttribI1ui(GLuint index, GLuint x)
+{
+   LAZY(VertexAttribI1ui);
+   glVertexAttribI1ui(index, x);
+}
+static void APIENTRY lazy_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y)
+{
+   LAZY(VertexAttribI2ui);
+   glVertexAttribI2ui(index, x, y);
+}
+static void APIENTRY lazy_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z)
+{
+   LAZY(VertexAttribI3ui);
+   glVertexAttribI3ui(index, x, y, z);
+}
+static void APIENTRY lazy_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
+{
+   LAZY(VertexAttribI4ui);
+   glVertexAttribI4ui(index, x, y, z, w);
+}
+static void APIENTRY lazy_glVertexAttribI1iv(GLuint index, const GLint *v)
+{
+   LAZY(VertexAttribI1iv);
+   glVertexAttribI1iv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI2iv(GLuint index, const GLint *v)
+{
+   LAZY(VertexAttribI2iv);
+   glVertexAttribI2iv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI3iv(GLuint index, const GLint *v)
+{
+   LAZY(VertexAttribI3iv);
+   glVertexAttribI3iv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI4iv(GLuint index, const GLint *v)
+{
+   LAZY(VertexAttribI4iv);
+   glVertexAttribI4iv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI1uiv(GLuint index, const GLuint *v)
+{
+   LAZY(VertexAttribI1uiv);
+   glVertexAttribI1uiv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI2uiv(GLuint index, const GLuint *v)
+{
+   LAZY(VertexAttribI2uiv);
+   glVertexAttribI2uiv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI3uiv(GLuint index, const GLuint *v)
+{
+   LAZY(VertexAttribI3uiv);
+   glVertexAttribI3uiv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI4uiv(GLuint index, const GLuint *v)
+{
+   LAZY(VertexAttribI4uiv);
+   glVertexAttribI4uiv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI4bv(GLuint index, const GLbyte *v)
+{
+   LAZY(VertexAttribI4bv);
+   glVertexAttribI4bv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI4sv(GLuint index, const GLshort *v)
+{
+   LAZY(VertexAttribI4sv);
+   glVertexAttribI4sv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI4ubv(GLuint index, const GLubyte *v)
+{
+   LAZY(VertexAttribI4ubv);
+   glVertexAttribI4ubv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI4usv(GLuint index, const GLushort *v)
+{
+   LAZY(VertexAttribI4usv);
+   glVertexAttribI4usv(index, v);
+}
+static void APIENTRY lazy_glGetUniformuiv(GLuint program, GLint location, GLuint *params)
+{
+   LAZY(GetUniformuiv);
+   glGetUniformuiv(program, location, params);
+}
+static void APIENTRY lazy_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name)
+{
+   LAZY(BindFragDataLocation);
+   glBindFragDataLocation(program, color, name);
+}
+static GLint APIENTRY lazy_glGetFragDataLocation(GLuint program, const GLchar *name)
+{
+   LAZY(GetFragDataLocation);
+   return glGetFragDataLocation(program, name);
+}
+static void APIENTRY lazy_glUniform1ui(GLint location, GLuint v0)
+{
+   LAZY(Uniform1ui);
+   glUniform1ui(location, v0);
+}
+static void APIENTRY lazy_glUniform2ui(GLint location, GLuint v0, GLuint v1)
+{
+   LAZY(Uniform2ui);
+   glUniform2ui(location, v0, v1);
+}
+static void APIENTRY lazy_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2)
+{
+   LAZY(Uniform3ui);
+   glUniform3ui(location, v0, v1, v2);
+}
+static void APIENTRY lazy_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
+{
+   LAZY(Uniform4ui);
+   glUniform4ui(location, v0, v1, v2, v3);
+}
+static void APIENTRY lazy_glUniform1uiv(GLint location, GLsizei count, const GLuint *value)
+{
+   LAZY(Uniform1uiv);
+   glUniform1uiv(location, count, value);
+}
+static void APIENTRY lazy_glUniform2uiv(GLint location, GLsizei count, const GLuint *value)
+{
+   LAZY(Uniform2uiv);
+   glUniform2uiv(location, count, value);
+}
+static void APIENTRY lazy_glUniform3uiv(GLint location, GLsizei count, const GLuint *value)
+{
+   LAZY(Uniform3uiv);
+   glUniform3uiv(location, count, value);
+}
+static void APIENTRY lazy_glUniform4uiv(GLint location, GLsizei count, const GLuint *value)
+{
+   LAZY(Uniform4uiv);
+   glUniform4uiv(location, count, value);
+}
+static void APIENTRY lazy_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params)
+{
+   LAZY(TexParameterIiv);
+   glTexParameterIiv(target, pname, params);
+}
+static void APIENTRY lazy_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params)
+{
+   LAZY(TexParameterIuiv);
+   glTexParameterIuiv(target, pname, params);
+}
+static void APIENTRY lazy_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params)
+{
+   LAZY(GetTexParameterIiv);
+   glGetTexParameterIiv(target, pname, params);
+}
+static void APIENTRY lazy_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params)
+{
+   LAZY(GetTexParameterIuiv);
+   glGetTexParameterIuiv(target, pname, params);
+}
+static void APIENTRY lazy_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value)
+{
+   LAZY(ClearBufferiv);
+   glClearBufferiv(buffer, drawbuffer, value);
+}
+static void APIENTRY lazy_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value)
+{
+   LAZY(ClearBufferuiv);
+   glClearBufferuiv(buffer, drawbuffer, value);
+}
+static void APIENTRY lazy_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value)
+{
+   LAZY(ClearBufferfv);
+   glClearBufferfv(buffer, drawbuffer, value);
+}
+static void APIENTRY lazy_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil)
+{
+   LAZY(ClearBufferfi);
+   glClearBufferfi(buffer, drawbuffer, depth, stencil);
+}
+static const GLubyte * APIENTRY lazy_glGetStringi(GLenum name, GLuint index)
+{
+   LAZY(GetStringi);
+   return glGetStringi(name, index);
+}
+static void APIENTRY lazy_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount)
+{
+   LAZY(DrawArraysInstanced);
+   glDrawArraysInstanced(mode, first, count, instancecount);
+}
+static void APIENTRY lazy_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const GLvoid *indices, GLsizei instancecount)
+{
+   LAZY(DrawElementsInstanced);
+   glDrawElementsInstanced(mode, count, type, indices, instancecount);
+}
+static void APIENTRY lazy_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer)
+{
+   LAZY(TexBuffer);
+   glTexBuffer(target, internalformat, buffer);
+}
+static void APIENTRY lazy_glPrimitiveRestartIndex(GLuint index)
+{
+   LAZY(PrimitiveRestartIndex);
+   glPrimitiveRestartIndex(index);
+}
+static void APIENTRY lazy_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data)
+{
+   LAZY(GetInteger64i_v);
+   glGetInteger64i_v(target, index, data);
+}
+static void APIENTRY lazy_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params)
+{
+   LAZY(GetBufferParameteri64v);
+   glGetBufferParameteri64v(target, pname, params);
+}
+static void APIENTRY lazy_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level)
+{
+   LAZY(FramebufferTexture);
+   glFramebufferTexture(target, attachment, texture, level);
+}
+static void APIENTRY lazy_glVertexAttribDivisor(GLuint index, GLuint divisor)
+{
+   LAZY(VertexAttribDivisor);
+   glVertexAttribDivisor(index, divisor);
+}
+static void APIENTRY lazy_glMinSampleShading(GLfloat value)
+{
+   LAZY(MinSampleShading);
+   glMinSampleShading(value);
+}
+static void APIENTRY lazy_glBlendEquationi(GLuint buf, GLenum mode)
+{
+   LAZY(BlendEquationi);
+   glBlendEquationi(buf, mode);
+}
+static void APIENTRY lazy_glBlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha)
+{
+   LAZY(BlendEquationSeparatei);
+   glBlendEquationSeparatei(buf, modeRGB, modeAlpha);
+}
+static void APIENTRY lazy_glBlendFunci(GLuint buf, GLenum src, GLenum dst)
+{
+   LAZY(BlendFunci);
+   glBlendFunci(buf, src, dst);
+}
+static void APIENTRY lazy_glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+{
+   LAZY(BlendFuncSeparatei);
+   glBlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+}
+static void APIENTRY lazy_glActiveTextureARB(GLenum texture)
+{
+   LAZY(ActiveTextureARB);
+   glActiveTextureARB(texture);
+}
+static void APIENTRY lazy_glClientActiveTextureARB(GLenum texture)
+{
+   LAZY(ClientActiveTextureARB);
+   glClientActiveTextureARB(texture);
+}
+static void APIENTRY lazy_glMultiTexCoord1dARB(GLenum target, GLdouble s)
+{
+   LAZY(MultiTexCoord1dARB);
+   glMultiTexCoord1dARB(target, s);
+}
+static void APIENTRY lazy_glMultiTexCoord1dvARB(GLenum target, const GLdouble *v)
+{
+   LAZY(MultiTexCoord1dvARB);
+   glMultiTexCoord1dvARB(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord1fARB(GLenum target, GLfloat s)
+{
+   LAZY(MultiTexCoord1fARB);
+   glMultiTexCoord1fARB(target, s);
+}
+static void APIENTRY lazy_glMultiTexCoord1fvARB(GLenum target, const GLfloat *v)
+{
+   LAZY(MultiTexCoord1fvARB);
+   glMultiTexCoord1fvARB(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord1iARB(GLenum target, GLint s)
+{
+   LAZY(MultiTexCoord1iARB);
+   glMultiTexCoord1iARB(target, s);
+}
+static void APIENTRY lazy_glMultiTexCoord1ivARB(GLenum target, const GLint *v)
+{
+   LAZY(MultiTexCoord1ivARB);
+   glMultiTexCoord1ivARB(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord1sARB(GLenum target, GLshort s)
+{
+   LAZY(MultiTexCoord1sARB);
+   glMultiTexCoord1sARB(target, s);
+}
+static void APIENTRY lazy_glMultiTexCoord1svARB(GLenum target, const GLshort *v)
+{
+   LAZY(MultiTexCoord1svARB);
+   glMultiTexCoord1svARB(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord2dARB(GLenum target, GLdouble s, GLdouble t)
+{
+   LAZY(MultiTexCoord2dARB);
+   glMultiTexCoord2dARB(target, s, t);
+}
+static void APIENTRY lazy_glMultiTexCoord2dvARB(GLenum target, const GLdouble *v)
+{
+   LAZY(MultiTexCoord2dvARB);
+   glMultiTexCoord2dvARB(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord2fARB(GLenum target, GLfloat s, GLfloat t)
+{
+   LAZY(MultiTexCoord2fARB);
+   glMultiTexCoord2fARB(target, s, t);
+}
+static void APIENTRY lazy_glMultiTexCoord2fvARB(GLenum target, const GLfloat *v)
+{
+   LAZY(MultiTexCoord2fvARB);
+   glMultiTexCoord2fvARB(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord2iARB(GLenum target, GLint s, GLint t)
+{
+   LAZY(MultiTexCoord2iARB);
+   glMultiTexCoord2iARB(target, s, t);
+}
+static void APIENTRY lazy_glMultiTexCoord2ivARB(GLenum target, const GLint *v)
+{
+   LAZY(MultiTexCoord2ivARB);
+   glMultiTexCoord2ivARB(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord2sARB(GLenum target, GLshort s, GLshort t)
+{
+   LAZY(MultiTexCoord2sARB);
+   glMultiTexCoord2sARB(target, s, t);
+}
+static void APIENTRY lazy_glMultiTexCoord2svARB(GLenum target, const GLshort *v)
+{
+   LAZY(MultiTexCoord2svARB);
+   glMultiTexCoord2svARB(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord3dARB(GLenum target, GLdouble s, GLdouble t, GLdouble r)
+{
+   LAZY(MultiTexCoord3dARB);
+   glMultiTexCoord3dARB(target, s, t, r);
+}
+static void APIENTRY lazy_glMultiTexCoord3dvARB(GLenum target, const GLdouble *v)
+{
+   LAZY(MultiTexCoord3dvARB);
+   glMultiTexCoord3dvARB(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord3fARB(GLenum target, GLfloat s, GLfloat t, GLfloat r)
+{
+   LAZY(MultiTexCoord3fARB);
+   glMultiTexCoord3fARB(target, s, t, r);
+}
+static void APIENTRY lazy_glMultiTexCoord3fvARB(GLenum target, const GLfloat *v)
+{
+   LAZY(MultiTexCoord3fvARB);
+   glMultiTexCoord3fvARB(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord3iARB(GLenum target, GLint s, GLint t, GLint r)
+{
+   LAZY(MultiTexCoord3iARB);
+   glMultiTexCoord3iARB(target, s, t, r);
+}
+static void APIENTRY lazy_glMultiTexCoord3ivARB(GLenum target, const GLint *v)
+{
+   LAZY(MultiTexCoord3ivARB);
+   glMultiTexCoord3ivARB(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord3sARB(GLenum target, GLshort s, GLshort t, GLshort r)
+{
+   LAZY(MultiTexCoord3sARB);
+   glMultiTexCoord3sARB(target, s, t, r);
+}
+static void APIENTRY lazy_glMultiTexCoord3svARB(GLenum target, const GLshort *v)
+{
+   LAZY(MultiTexCoord3svARB);
+   glMultiTexCoord3svARB(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord4dARB(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q)
+{
+   LAZY(MultiTexCoord4dARB);
+   glMultiTexCoord4dARB(target, s, t, r, q);
+}
+static void APIENTRY lazy_glMultiTexCoord4dvARB(GLenum target, const GLdouble *v)
+{
+   LAZY(MultiTexCoord4dvARB);
+   glMultiTexCoord4dvARB(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord4fARB(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q)
+{
+   LAZY(MultiTexCoord4fARB);
+   glMultiTexCoord4fARB(target, s, t, r, q);
+}
+static void APIENTRY lazy_glMultiTexCoord4fvARB(GLenum target, const GLfloat *v)
+{
+   LAZY(MultiTexCoord4fvARB);
+   glMultiTexCoord4fvARB(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord4iARB(GLenum target, GLint s, GLint t, GLint r, GLint q)
+{
+   LAZY(MultiTexCoord4iARB);
+   glMultiTexCoord4iARB(target, s, t, r, q);
+}
+static void APIENTRY lazy_glMultiTexCoord4ivARB(GLenum target, const GLint *v)
+{
+   LAZY(MultiTexCoord4ivARB);
+   glMultiTexCoord4ivARB(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord4sARB(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q)
+{
+   LAZY(MultiTexCoord4sARB);
+   glMultiTexCoord4sARB(target, s, t, r, q);
+}
+static void APIENTRY lazy_glMultiTexCoord4svARB(GLenum target, const GLshort *v)
+{
+   LAZY(MultiTexCoord4svARB);
+   glMultiTexCoord4svARB(target, v);
+}
+static void APIENTRY lazy_glLoadTransposeMatrixfARB(const GLfloat *m)
+{
+   LAZY(LoadTransposeMatrixfARB);
+   glLoadTransposeMatrixfARB(m);
+}
+static void APIENTRY lazy_glLoadTransposeMatrixdARB(const GLdouble *m)
+{
+   LAZY(LoadTransposeMatrixdARB);
+   glLoadTransposeMatrixdARB(m);
+}
+static void APIENTRY lazy_glMultTransposeMatrixfARB(const GLfloat *m)
+{
+   LAZY(MultTransposeMatrixfARB);
+   glMultTransposeMatrixfARB(m);
+}
+static void APIENTRY lazy_glMultTransposeMatrixdARB(const GLdouble *m)
+{
+   LAZY(MultTransposeMatrixdARB);
+   glMultTransposeMatrixdARB(m);
+}
+static void APIENTRY lazy_glSampleCoverageARB(GLfloat value, GLboolean invert)
+{
+   LAZY(SampleCoverageARB);
+   glSampleCoverageARB(value, invert);
+}
+static void APIENTRY lazy_glCompressedTexImage3DARB(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const GLvoid *data)
+{
+   LAZY(CompressedTexImage3DARB);
+   glCompressedTexImage3DARB(target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+static void APIENTRY lazy_glCompressedTexImage2DARB(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const GLvoid *data)
+{
+   LAZY(CompressedTexImage2DARB);
+   glCompressedTexImage2DARB(target, level, internalformat, width, height, border, imageSize, data);
+}
+static void APIENTRY lazy_glCompressedTexImage1DARB(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const GLvoid *data)
+{
+   LAZY(CompressedTexImage1DARB);
+   glCompressedTexImage1DARB(target, level, internalformat, width, border, imageSize, data);
+}
+static void APIENTRY lazy_glCompressedTexSubImage3DARB(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const GLvoid *data)
+{
+   LAZY(CompressedTexSubImage3DARB);
+   glCompressedTexSubImage3DARB(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+static void APIENTRY lazy_glCompressedTexSubImage2DARB(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const GLvoid *data)
+{
+   LAZY(CompressedTexSubImage2DARB);
+   glCompressedTexSubImage2DARB(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+static void APIENTRY lazy_glCompressedTexSubImage1DARB(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const GLvoid *data)
+{
+   LAZY(CompressedTexSubImage1DARB);
+   glCompressedTexSubImage1DARB(target, level, xoffset, width, format, imageSize, data);
+}
+static void APIENTRY lazy_glGetCompressedTexImageARB(GLenum target, GLint level, GLvoid *img)
+{
+   LAZY(GetCompressedTexImageARB);
+   glGetCompressedTexImageARB(target, level, img);
+}
+static void APIENTRY lazy_glPointParameterfARB(GLenum pname, GLfloat param)
+{
+   LAZY(PointParameterfARB);
+   glPointParameterfARB(pname, param);
+}
+static void APIENTRY lazy_glPointParameterfvARB(GLenum pname, const GLfloat *params)
+{
+   LAZY(PointParameterfvARB);
+   glPointParameterfvARB(pname, params);
+}
+static void APIENTRY lazy_glWeightbvARB(GLint size, const GLbyte *weights)
+{
+   LAZY(WeightbvARB);
+   glWeightbvARB(size, weights);
+}
+static void APIENTRY lazy_glWeightsvARB(GLint size, const GLshort *weights)
+{
+   LAZY(WeightsvARB);
+   glWeightsvARB(size, weights);
+}
+static void APIENTRY lazy_glWeightivARB(GLint size, const GLint *weights)
+{
+   LAZY(WeightivARB);
+   glWeightivARB(size, weights);
+}
+static void APIENTRY lazy_glWeightfvARB(GLint size, const GLfloat *weights)
+{
+   LAZY(WeightfvARB);
+   glWeightfvARB(size, weights);
+}
+static void APIENTRY lazy_glWeightdvARB(GLint size, const GLdouble *weights)
+{
+   LAZY(WeightdvARB);
+   glWeightdvARB(size, weights);
+}
+static void APIENTRY lazy_glWeightubvARB(GLint size, const GLubyte *weights)
+{
+   LAZY(WeightubvARB);
+   glWeightubvARB(size, weights);
+}
+static void APIENTRY lazy_glWeightusvARB(GLint size, const GLushort *weights)
+{
+   LAZY(WeightusvARB);
+   glWeightusvARB(size, weights);
+}
+static void APIENTRY lazy_glWeightuivARB(GLint size, const GLuint *weights)
+{
+   LAZY(WeightuivARB);
+   glWeightuivARB(size, weights);
+}
+static void APIENTRY lazy_glWeightPointerARB(GLint size, GLenum type, GLsizei stride, const GLvoid *pointer)
+{
+   LAZY(WeightPointerARB);
+   glWeightPointerARB(size, type, stride, pointer);
+}
+static void APIENTRY lazy_glVertexBlendARB(GLint count)
+{
+   LAZY(VertexBlendARB);
+   glVertexBlendARB(count);
+}
+static void APIENTRY lazy_glCurrentPaletteMatrixARB(GLint index)
+{
+   LAZY(CurrentPaletteMatrixARB);
+   glCurrentPaletteMatrixARB(index);
+}
+static void APIENTRY lazy_glMatrixIndexubvARB(GLint size, const GLubyte *indices)
+{
+   LAZY(MatrixIndexubvARB);
+   glMatrixIndexubvARB(size, indices);
+}
+static void APIENTRY lazy_glMatrixIndexusvARB(GLint size, const GLushort *indices)
+{
+   LAZY(MatrixIndexusvARB);
+   glMatrixIndexusvARB(size, indices);
+}
+static void APIENTRY lazy_glMatrixIndexuivARB(GLint size, const GLuint *indices)
+{
+   LAZY(MatrixIndexuivARB);
+   glMatrixIndexuivARB(size, indices);
+}
+static void APIENTRY lazy_glMatrixIndexPointerARB(GLint size, GLenum type, GLsizei stride, const GLvoid *pointer)
+{
+   LAZY(MatrixIndexPointerARB);
+   glMatrixIndexPointerARB(size, type, stride, pointer);
+}
+static void APIENTRY lazy_glWindowPos2dARB(GLdouble x, GLdouble y)
+{
+   LAZY(WindowPos2dARB);
+   glWindowPos2dARB(x, y);
+}
+static void APIENTRY lazy_glWindowPos2dvARB(const GLdouble *v)
+{
+   LAZY(WindowPos2dvARB);
+   glWindowPos2dvARB(v);
+}
+static void APIENTRY lazy_glWindowPos2fARB(GLfloat x, GLfloat y)
+{
+   LAZY(WindowPos2fARB);
+   glWindowPos2fARB(x, y);
+}
+static void APIENTRY lazy_glWindowPos2fvARB(const GLfloat *v)
+{
+   LAZY(WindowPos2fvARB);
+   glWindowPos2fvARB(v);
+}
+static void APIENTRY lazy_glWindowPos2iARB(GLint x, GLint y)
+{
+   LAZY(WindowPos2iARB);
+   glWindowPos2iARB(x, y);
+}
+static void APIENTRY lazy_glWindowPos2ivARB(const GLint *v)
+{
+   LAZY(WindowPos2ivARB);
+   glWindowPos2ivARB(v);
+}
+static void APIENTRY lazy_glWindowPos2sARB(GLshort x, GLshort y)
+{
+   LAZY(WindowPos2sARB);
+   glWindowPos2sARB(x, y);
+}
+static void APIENTRY lazy_glWindowPos2svARB(const GLshort *v)
+{
+   LAZY(WindowPos2svARB);
+   glWindowPos2svARB(v);
+}
+static void APIENTRY lazy_glWindowPos3dARB(GLdouble x, GLdouble y, GLdouble z)
+{
+   LAZY(WindowPos3dARB);
+   glWindowPos3dARB(x, y, z);
+}
+static void APIENTRY lazy_glWindowPos3dvARB(const GLdouble *v)
+{
+   LAZY(WindowPos3dvARB);
+   glWindowPos3dvARB(v);
+}
+static void APIENTRY lazy_glWindowPos3fARB(GLfloat x, GLfloat y, GLfloat z)
+{
+   LAZY(WindowPos3fARB);
+   glWindowPos3fARB(x, y, z);
+}
+static void APIENTRY lazy_glWindowPos3fvARB(const GLfloat *v)
+{
+   LAZY(WindowPos3fvARB);
+   glWindowPos3fvARB(v);
+}
+static void APIENTRY lazy_glWindowPos3iARB(GLint x, GLint y, GLint z)
+{
+   LAZY(WindowPos3iARB);
+   glWindowPos3iARB(x, y, z);
+}
+static void APIENTRY lazy_glWindowPos3ivARB(const GLint *v)
+{
+   LAZY(WindowPos3ivARB);
+   glWindowPos3ivARB(v);
+}
+static void APIENTRY lazy_glWindowPos3sARB(GLshort x, GLshort y, GLshort z)
+{
+   LAZY(WindowPos3sARB);
+   glWindowPos3sARB(x, y, z);
+}
+static void APIENTRY lazy_glWindowPos3svARB(const GLshort *v)
+{
+   LAZY(WindowPos3svARB);
+   glWindowPos3svARB(v);
+}
+static void APIENTRY lazy_glVertexAttrib1dARB(GLuint index, GLdouble x)
+{
+   LAZY(VertexAttrib1dARB);
+   glVertexAttrib1dARB(index, x);
+}
+static void APIENTRY lazy_glVertexAttrib1dvARB(GLuint index, const GLdouble *v)
+{
+   LAZY(VertexAttrib1dvARB);
+   glVertexAttrib1dvARB(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib1fARB(GLuint index, GLfloat x)
+{
+   LAZY(VertexAttrib1fARB);
+   glVertexAttrib1fARB(index, x);
+}
+static void APIENTRY lazy_glVertexAttrib1fvARB(GLuint index, const GLfloat *v)
+{
+   LAZY(VertexAttrib1fvARB);
+   glVertexAttrib1fvARB(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib1sARB(GLuint index, GLshort x)
+{
+   LAZY(VertexAttrib1sARB);
+   glVertexAttrib1sARB(index, x);
+}
+static void APIENTRY lazy_glVertexAttrib1svARB(GLuint index, const GLshort *v)
+{
+   LAZY(VertexAttrib1svARB);
+   glVertexAttrib1svARB(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib2dARB(GLuint index, GLdouble x, GLdouble y)
+{
+   LAZY(VertexAttrib2dARB);
+   glVertexAttrib2dARB(index, x, y);
+}
+static void APIENTRY lazy_glVertexAttrib2dvARB(GLuint index, const GLdouble *v)
+{
+   LAZY(VertexAttrib2dvARB);
+   glVertexAttrib2dvARB(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib2fARB(GLuint index, GLfloat x, GLfloat y)
+{
+   LAZY(VertexAttrib2fARB);
+   glVertexAttrib2fARB(index, x, y);
+}
+static void APIENTRY lazy_glVertexAttrib2fvARB(GLuint index, const GLfloat *v)
+{
+   LAZY(VertexAttrib2fvARB);
+   glVertexAttrib2fvARB(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib2sARB(GLuint index, GLshort x, GLshort y)
+{
+   LAZY(VertexAttrib2sARB);
+   glVertexAttrib2sARB(index, x, y);
+}
+static void APIENTRY lazy_glVertexAttrib2svARB(GLuint index, const GLshort *v)
+{
+   LAZY(VertexAttrib2svARB);
+   glVertexAttrib2svARB(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib3dARB(GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+   LAZY(VertexAttrib3dARB);
+   glVertexAttrib3dARB(index, x, y, z);
+}
+static void APIENTRY lazy_glVertexAttrib3dvARB(GLuint index, const GLdouble *v)
+{
+   LAZY(VertexAttrib3dvARB);
+   glVertexAttrib3dvARB(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib3fARB(GLuint index, GLfloat x, GLfloat y, GLfloat z)
+{
+   LAZY(VertexAttrib3fARB);
+   glVertexAttrib3fARB(index, x, y, z);
+}
+static void APIENTRY lazy_glVertexAttrib3fvARB(GLuint index, const GLfloat *v)
+{
+   LAZY(VertexAttrib3fvARB);
+   glVertexAttrib3fvARB(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib3sARB(GLuint index, GLshort x, GLshort y, GLshort z)
+{
+   LAZY(VertexAttrib3sARB);
+   glVertexAttrib3sARB(index, x, y, z);
+}
+static void APIENTRY lazy_glVertexAttrib3svARB(GLuint index, const GLshort *v)
+{
+   LAZY(VertexAttrib3svARB);
+   glVertexAttrib3svARB(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4NbvARB(GLuint index, const GLbyte *v)
+{
+   LAZY(VertexAttrib4NbvARB);
+   glVertexAttrib4NbvARB(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4NivARB(GLuint index, const GLint *v)
+{
+   LAZY(VertexAttrib4NivARB);
+   glVertexAttrib4NivARB(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4NsvARB(GLuint index, const GLshort *v)
+{
+   LAZY(VertexAttrib4NsvARB);
+   glVertexAttrib4NsvARB(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4NubARB(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)
+{
+   LAZY(VertexAttrib4NubARB);
+   glVertexAttrib4NubARB(index, x, y, z, w);
+}
+static void APIENTRY lazy_glVertexAttrib4NubvARB(GLuint index, const GLubyte *v)
+{
+   LAZY(VertexAttrib4NubvARB);
+   glVertexAttrib4NubvARB(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4NuivARB(GLuint index, const GLuint *v)
+{
+   LAZY(VertexAttrib4NuivARB);
+   glVertexAttrib4NuivARB(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4NusvARB(GLuint index, const GLushort *v)
+{
+   LAZY(VertexAttrib4NusvARB);
+   glVertexAttrib4NusvARB(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4bvARB(GLuint index, const GLbyte *v)
+{
+   LAZY(VertexAttrib4bvARB);
+   glVertexAttrib4bvARB(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4dARB(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+   LAZY(VertexAttrib4dARB);
+   glVertexAttrib4dARB(index, x, y, z, w);
+}
+static void APIENTRY lazy_glVertexAttrib4dvARB(GLuint index, const GLdouble *v)
+{
+   LAZY(VertexAttrib4dvARB);
+   glVertexAttrib4dvARB(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4fARB(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+   LAZY(VertexAttrib4fARB);
+   glVertexAttrib4fARB(index, x, y, z, w);
+}
+static void APIENTRY lazy_glVertexAttrib4fvARB(GLuint index, const GLfloat *v)
+{
+   LAZY(VertexAttrib4fvARB);
+   glVertexAttrib4fvARB(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4ivARB(GLuint index, const GLint *v)
+{
+   LAZY(VertexAttrib4ivARB);
+   glVertexAttrib4ivARB(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4sARB(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)
+{
+   LAZY(VertexAttrib4sARB);
+   glVertexAttrib4sARB(index, x, y, z, w);
+}
+static void APIENTRY lazy_glVertexAttrib4svARB(GLuint index, const GLshort *v)
+{
+   LAZY(VertexAttrib4svARB);
+   glVertexAttrib4svARB(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4ubvARB(GLuint index, const GLubyte *v)
+{
+   LAZY(VertexAttrib4ubvARB);
+   glVertexAttrib4ubvARB(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4uivARB(GLuint index, const GLuint *v)
+{
+   LAZY(VertexAttrib4uivARB);
+   glVertexAttrib4uivARB(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4usvARB(GLuint index, const GLushort *v)
+{
+   LAZY(VertexAttrib4usvARB);
+   glVertexAttrib4usvARB(index, v);
+}
+static void APIENTRY lazy_glVertexAttribPointerARB(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const GLvoid *pointer)
+{
+   LAZY(VertexAttribPointerARB);
+   glVertexAttribPointerARB(index, size, type, normalized, stride, pointer);
+}
+static void APIENTRY lazy_glEnableVertexAttribArrayARB(GLuint index)
+{
+   LAZY(EnableVertexAttribArrayARB);
+   glEnableVertexAttribArrayARB(index);
+}
+static void APIENTRY lazy_glDisableVertexAttribArrayARB(GLuint index)
+{
+   LAZY(DisableVertexAttribArrayARB);
+   glDisableVertexAttribArrayARB(index);
+}
+static void APIENTRY lazy_glProgramStringARB(GLenum target, GLenum format, GLsizei len, const GLvoid *string)
+{
+   LAZY(ProgramStringARB);
+   glProgramStringARB(target, format, len, string);
+}
+static void APIENTRY lazy_glBindProgramARB(GLenum target, GLuint program)
+{
+   LAZY(BindProgramARB);
+   glBindProgramARB(target, program);
+}
+static void APIENTRY lazy_glDeleteProgramsARB(GLsizei n, const GLuint *programs)
+{
+   LAZY(DeleteProgramsARB);
+   glDeleteProgramsARB(n, programs);
+}
+static void APIENTRY lazy_glGenProgramsARB(GLsizei n, GLuint *programs)
+{
+   LAZY(GenProgramsARB);
+   glGenProgramsARB(n, programs);
+}
+static void APIENTRY lazy_glProgramEnvParameter4dARB(GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+   LAZY(ProgramEnvParameter4dARB);
+   glProgramEnvParameter4dARB(target, index, x, y, z, w);
+}
+static void APIENTRY lazy_glProgramEnvParameter4dvARB(GLenum target, GLuint index, const GLdouble *params)
+{
+   LAZY(ProgramEnvParameter4dvARB);
+   glProgramEnvParameter4dvARB(target, index, params);
+}
+static void APIENTRY lazy_glProgramEnvParameter4fARB(GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+   LAZY(ProgramEnvParameter4fARB);
+   glProgramEnvParameter4fARB(target, index, x, y, z, w);
+}
+static void APIENTRY lazy_glProgramEnvParameter4fvARB(GLenum target, GLuint index, const GLfloat *params)
+{
+   LAZY(ProgramEnvParameter4fvARB);
+   glProgramEnvParameter4fvARB(target, index, params);
+}
+static void APIENTRY lazy_glProgramLocalParameter4dARB(GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+   LAZY(ProgramLocalParameter4dARB);
+   glProgramLocalParameter4dARB(target, index, x, y, z, w);
+}
+static void APIENTRY lazy_glProgramLocalParameter4dvARB(GLenum target, GLuint index, const GLdouble *params)
+{
+   LAZY(ProgramLocalParameter4dvARB);
+   glProgramLocalParameter4dvARB(target, index, params);
+}
+static void APIENTRY lazy_glProgramLocalParameter4fARB(GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+   LAZY(ProgramLocalParameter4fARB);
+   glProgramLocalParameter4fARB(target, index, x, y, z, w);
+}
+static void APIENTRY lazy_glProgramLocalParameter4fvARB(GLenum target, GLuint index, const GLfloat *params)
+{
+   LAZY(ProgramLocalParameter4fvARB);
+   glProgramLocalParameter4fvARB(target, index, params);
+}
+static void APIENTRY lazy_glGetProgramEnvParameterdvARB(GLenum target, GLuint index, GLdouble *params)
+{
+   LAZY(GetProgramEnvParameterdvARB);
+   glGetProgramEnvParameterdvARB(target, index, params);
+}
+static void APIENTRY lazy_glGetProgramEnvParameterfvARB(GLenum target, GLuint index, GLfloat *params)
+{
+   LAZY(GetProgramEnvParameterfvARB);
+   glGetProgramEnvParameterfvARB(target, index, params);
+}
+static void APIENTRY lazy_glGetProgramLocalParameterdvARB(GLenum target, GLuint index, GLdouble *params)
+{
+   LAZY(GetProgramLocalParameterdvARB);
+   glGetProgramLocalParameterdvARB(target, index, params);
+}
+static void APIENTRY lazy_glGetProgramLocalParameterfvARB(GLenum target, GLuint index, GLfloat *params)
+{
+   LAZY(GetProgramLocalParameterfvARB);
+   glGetProgramLocalParameterfvARB(target, index, params);
+}
+static void APIENTRY lazy_glGetProgramivARB(GLenum target, GLenum pname, GLint *params)
+{
+   LAZY(GetProgramivARB);
+   glGetProgramivARB(target, pname, params);
+}
+static void APIENTRY lazy_glGetProgramStringARB(GLenum target, GLenum pname, GLvoid *string)
+{
+   LAZY(GetProgramStringARB);
+   glGetProgramStringARB(target, pname, string);
+}
+static void APIENTRY lazy_glGetVertexAttribdvARB(GLuint index, GLenum pname, GLdouble *params)
+{
+   LAZY(GetVertexAttribdvARB);
+   glGetVertexAttribdvARB(index, pname, params);
+}
+static void APIENTRY lazy_glGetVertexAttribfvARB(GLuint index, GLenum pname, GLfloat *params)
+{
+   LAZY(GetVertexAttribfvARB);
+   glGetVertexAttribfvARB(index, pname, params);
+}
+static void APIENTRY lazy_glGetVertexAttribivARB(GLuint index, GLenum pname, GLint *params)
+{
+   LAZY(GetVertexAttribivARB);
+   glGetVertexAttribivARB(index, pname, params);
+}
+static void APIENTRY lazy_glGetVertexAttribPointervARB(GLuint index, GLenum pname, GLvoid* *pointer)
+{
+   LAZY(GetVertexAttribPointervARB);
+   glGetVertexAttribPointervARB(index, pname, pointer);
+}
+static GLboolean APIENTRY lazy_glIsProgramARB(GLuint program)
+{
+   LAZY(IsProgramARB);
+   return glIsProgramARB(program);
+}
+static void APIENTRY lazy_glBindBufferARB(GLenum target, GLuint buffer)
+{
+   LAZY(BindBufferARB);
+   glBindBufferARB(target, buffer);
+}
+static void APIENTRY lazy_glDeleteBuffersARB(GLsizei n, const GLuint *buffers)
+{
+   LAZY(DeleteBuffersARB);
+   glDeleteBuffersARB(n, buffers);
+}
+static void APIENTRY lazy_glGenBuffersARB(GLsizei n, GLuint *buffers)
+{
+   LAZY(GenBuffersARB);
+   glGenBuffersARB(n, buffers);
+}
+static GLboolean APIENTRY lazy_glIsBufferARB(GLuint buffer)
+{
+   LAZY(IsBufferARB);
+   return glIsBufferARB(buffer);
+}
+static void APIENTRY lazy_glBufferDataARB(GLenum target, GLsizeiptrARB size, const GLvoid *data, GLenum usage)
+{
+   LAZY(BufferDataARB);
+   glBufferDataARB(target, size, data, usage);
+}
+static void APIENTRY lazy_glBufferSubDataARB(GLenum target, GLintptrARB offset, GLsizeiptrARB size, const GLvoid *data)
+{
+   LAZY(BufferSubDataARB);
+   glBufferSubDataARB(target, offset, size, data);
+}
+static void APIENTRY lazy_glGetBufferSubDataARB(GLenum target, GLintptrARB offset, GLsizeiptrARB size, GLvoid *data)
+{
+   LAZY(GetBufferSubDataARB);
+   glGetBufferSubDataARB(target, offset, size, data);
+}
+static GLvoid* APIENTRY lazy_glMapBufferARB(GLenum target, GLenum access)
+{
+   LAZY(MapBufferARB);
+   return glMapBufferARB(target, access);
+}
+static GLboolean APIENTRY lazy_glUnmapBufferARB(GLenum target)
+{
+   LAZY(UnmapBufferARB);
+   return glUnmapBufferARB(target);
+}
+static void APIENTRY lazy_glGetBufferParameterivARB(GLenum target, GLenum pname, GLint *params)
+{
+   LAZY(GetBufferParameterivARB);
+   glGetBufferParameterivARB(target, pname, params);
+}
+static void APIENTRY lazy_glGetBufferPointervARB(GLenum target, GLenum pname, GLvoid* *params)
+{
+   LAZY(GetBufferPointervARB);
+   glGetBufferPointervARB(target, pname, params);
+}
+static void APIENTRY lazy_glGenQueriesARB(GLsizei n, GLuint *ids)
+{
+   LAZY(GenQueriesARB);
+   glGenQueriesARB(n, ids);
+}
+static void APIENTRY lazy_glDeleteQueriesARB(GLsizei n, const GLuint *ids)
+{
+   LAZY(DeleteQueriesARB);
+   glDeleteQueriesARB(n, ids);
+}
+static GLboolean APIENTRY lazy_glIsQueryARB(GLuint id)
+{
+   LAZY(IsQueryARB);
+   return glIsQueryARB(id);
+}
+static void APIENTRY lazy_glBeginQueryARB(GLenum target, GLuint id)
+{
+   LAZY(BeginQueryARB);
+   glBeginQueryARB(target, id);
+}
+static void APIENTRY lazy_glEndQueryARB(GLenum target)
+{
+   LAZY(EndQueryARB);
+   glEndQueryARB(target);
+}
+static void APIENTRY lazy_glGetQueryivARB(GLenum target, GLenum pname, GLint *params)
+{
+   LAZY(GetQueryivARB);
+   glGetQueryivARB(target, pname, params);
+}
+static void APIENTRY lazy_glGetQueryObjectivARB(GLuint id, GLenum pname, GLint *params)
+{
+   LAZY(GetQueryObjectivARB);
+   glGetQueryObjectivARB(id, pname, params);
+}
+static void APIENTRY lazy_glGetQueryObjectuivARB(GLuint id, GLenum pname, GLuint *params)
+{
+   LAZY(GetQueryObjectuivARB);
+   glGetQueryObjectuivARB(id, pname, params);
+}
+static void APIENTRY lazy_glDeleteObjectARB(GLhandleARB obj)
+{
+   LAZY(DeleteObjectARB);
+   glDeleteObjectARB(obj);
+}
+static GLhandleARB APIENTRY lazy_glGetHandleARB(GLenum pname)
+{
+   LAZY(GetHandleARB);
+   return glGetHandleARB(pname);
+}
+static void APIENTRY lazy_glDetachObjectARB(GLhandleARB containerObj, GLhandleARB attachedObj)
+{
+   LAZY(DetachObjectARB);
+   glDetachObjectARB(containerObj, attachedObj);
+}
+static GLhandleARB APIENTRY lazy_glCreateShaderObjectARB(GLenum shaderType)
+{
+   LAZY(CreateShaderObjectARB);
+   return glCreateShaderObjectARB(shaderType);
+}
+static void APIENTRY lazy_glShaderSourceARB(GLhandleARB shaderObj, GLsizei count, const GLcharARB* *string, const GLint *length)
+{
+   LAZY(ShaderSourceARB);
+   glShaderSourceARB(shaderObj, count, string, length);
+}
+static void APIENTRY lazy_glCompileShaderARB(GLhandleARB shaderObj)
+{
+   LAZY(CompileShaderARB);
+   glCompileShaderARB(shaderObj);
+}
+static GLhandleARB APIENTRY lazy_glCreateProgramObjectARB(void)
+{
+   LAZY(CreateProgramObjectARB);
+   return glCreateProgramObjectARB();
+}
+static void APIENTRY lazy_glAttachObjectARB(GLhandleARB containerObj, GLhandleARB obj)
+{
+   LAZY(AttachObjectARB);
+   glAttachObjectARB(containerObj, obj);
+}
+static void APIENTRY lazy_glLinkProgramARB(GLhandleARB programObj)
+{
+   LAZY(LinkProgramARB);
+   glLinkProgramARB(programObj);
+}
+static void APIENTRY lazy_glUseProgramObjectARB(GLhandleARB programObj)
+{
+   LAZY(UseProgramObjectARB);
+   glUseProgramObjectARB(programObj);
+}
+static void APIENTRY lazy_glValidateProgramARB(GLhandleARB programObj)
+{
+   LAZY(ValidateProgramARB);
+   glValidateProgramARB(programObj);
+}
+static void APIENTRY lazy_glUniform1fARB(GLint location, GLfloat v0)
+{
+   LAZY(Uniform1fARB);
+   glUniform1fARB(location, v0);
+}
+static void APIENTRY lazy_glUniform2fARB(GLint location, GLfloat v0, GLfloat v1)
+{
+   LAZY(Uniform2fARB);
+   glUniform2fARB(location, v0, v1);
+}
+static void APIENTRY lazy_glUniform3fARB(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+   LAZY(Uniform3fARB);
+   glUniform3fARB(location, v0, v1, v2);
+}
+static void APIENTRY lazy_glUniform4fARB(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+   LAZY(Uniform4fARB);
+   glUniform4fARB(location, v0, v1, v2, v3);
+}
+static void APIENTRY lazy_glUniform1iARB(GLint location, GLint v0)
+{
+   LAZY(Uniform1iARB);
+   glUniform1iARB(location, v0);
+}
+static void APIENTRY lazy_glUniform2iARB(GLint location, GLint v0, GLint v1)
+{
+   LAZY(Uniform2iARB);
+   glUniform2iARB(location, v0, v1);
+}
+static void APIENTRY lazy_glUniform3iARB(GLint location, GLint v0, GLint v1, GLint v2)
+{
+   LAZY(Uniform3iARB);
+   glUniform3iARB(location, v0, v1, v2);
+}
+static void APIENTRY lazy_glUniform4iARB(GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+   LAZY(Uniform4iARB);
+   glUniform4iARB(location, v0, v1, v2, v3);
+}
+static void APIENTRY lazy_glUniform1fvARB(GLint location, GLsizei count, const GLfloat *value)
+{
+   LAZY(Uniform1fvARB);
+   glUniform1fvARB(location, count, value);
+}
+static void APIENTRY lazy_glUniform2fvARB(GLint location, GLsizei count, const GLfloat *value)
+{
+   LAZY(Uniform2fvARB);
+   glUniform2fvARB(location, count, value);
+}
+static void APIENTRY lazy_glUniform3fvARB(GLint location, GLsizei count, const GLfloat *value)
+{
+   LAZY(Uniform3fvARB);
+   glUniform3fvARB(location, count, value);
+}
+static void APIENTRY lazy_glUniform4fvARB(GLint location, GLsizei count, const GLfloat *value)
+{
+   LAZY(Uniform4fvARB);
+   glUniform4fvARB(location, count, value);
+}
+static void APIENTRY lazy_glUniform1ivARB(GLint location, GLsizei count, const GLint *value)
+{
+   LAZY(Uniform1ivARB);
+   glUniform1ivARB(location, count, value);
+}
+static void APIENTRY lazy_glUniform2ivARB(GLint location, GLsizei count, const GLint *value)
+{
+   LAZY(Uniform2ivARB);
+   glUniform2ivARB(location, count, value);
+}
+static void APIENTRY lazy_glUniform3ivARB(GLint location, GLsizei count, const GLint *value)
+{
+   LAZY(Uniform3ivARB);
+   glUniform3ivARB(location, count, value);
+}
+static void APIENTRY lazy_glUniform4ivARB(GLint location, GLsizei count, const GLint *value)
+{
+   LAZY(Uniform4ivARB);
+   glUniform4ivARB(location, count, value);
+}
+static void APIENTRY lazy_glUniformMatrix2fvARB(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+   LAZY(UniformMatrix2fvARB);
+   glUniformMatrix2fvARB(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix3fvARB(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+   LAZY(UniformMatrix3fvARB);
+   glUniformMatrix3fvARB(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix4fvARB(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+   LAZY(UniformMatrix4fvARB);
+   glUniformMatrix4fvARB(location, count, transpose, value);
+}
+static void APIENTRY lazy_glGetObjectParameterfvARB(GLhandleARB obj, GLenum pname, GLfloat *params)
+{
+   LAZY(GetObjectParameterfvARB);
+   glGetObjectParameterfvARB(obj, pname, params);
+}
+static void APIENTRY lazy_glGetObjectParameterivARB(GLhandleARB obj, GLenum pname, GLint *params)
+{
+   LAZY(GetObjectParameterivARB);
+   glGetObjectParameterivARB(obj, pname, params);
+}
+static void APIENTRY lazy_glGetInfoLogARB(GLhandleARB obj, GLsizei maxLength, GLsizei *length, GLcharARB *infoLog)
+{
+   LAZY(GetInfoLogARB);
+   glGetInfoLogARB(obj, maxLength, length, infoLog);
+}
+static void APIENTRY lazy_glGetAttachedObjectsARB(GLhandleARB containerObj, GLsizei maxCount, GLsizei *count, GLhandleARB *obj)
+{
+   LAZY(GetAttachedObjectsARB);
+   glGetAttachedObjectsARB(containerObj, maxCount, count, obj);
+}
+static GLint APIENTRY lazy_glGetUniformLocationARB(GLhandleARB programObj, const GLcharARB *name)
+{
+   LAZY(GetUniformLocationARB);
+   return glGetUniformLocationARB(programObj, name);
+}
+static void APIENTRY lazy_glGetActiveUniformARB(GLhandleARB programObj, GLuint index, GLsizei maxLength, GLsizei *length, GLint *size, GLenum *type, GLcharARB *name)
+{
+   LAZY(GetActiveUniformARB);
+   glGetActiveUniformARB(programObj, index, maxLength, length, size, type, name);
+}
+static void APIENTRY lazy_glGetUniformfvARB(GLhandleARB programObj, GLint location, GLfloat *params)
+{
+   LAZY(GetUniformfvARB);
+   glGetUniformfvARB(programObj, location, params);
+}
+static void APIENTRY lazy_glGetUniformivARB(GLhandleARB programObj, GLint location, GLint *params)
+{
+   LAZY(GetUniformivARB);
+   glGetUniformivARB(programObj, location, params);
+}
+static void APIENTRY lazy_glGetShaderSourceARB(GLhandleARB obj, GLsizei maxLength, GLsizei *length, GLcharARB *source)
+{
+   LAZY(GetShaderSourceARB);
+   glGetShaderSourceARB(obj, maxLength, length, source);
+}
+static void APIENTRY lazy_glBindAttribLocationARB(GLhandleARB programObj, GLuint index, const GLcharARB *name)
+{
+   LAZY(BindAttribLocationARB);
+   glBindAttribLocationARB(programObj, index, name);
+}
+static void APIENTRY lazy_glGetActiveAttribARB(GLhandleARB programObj, GLuint index, GLsizei maxLength, GLsizei *length, GLint *size, GLenum *type, GLcharARB *name)
+{
+   LAZY(GetActiveAttribARB);
+   glGetActiveAttribARB(programObj, index, maxLength, length, size, type, name);
+}
+static GLint APIENTRY lazy_glGetAttribLocationARB(GLhandleARB programObj, const GLcharARB *name)
+{
+   LAZY(GetAttribLocationARB);
+   return glGetAttribLocationARB(programObj, name);
+}
+static void APIENTRY lazy_glDrawBuffersARB(GLsizei n, const GLenum *bufs)
+{
+   LAZY(DrawBuffersARB);
+   glDrawBuffersARB(n, bufs);
+}
+static void APIENTRY lazy_glClampColorARB(GLenum target, GLenum clamp)
+{
+   LAZY(ClampColorARB);
+   glClampColorARB(target, clamp);
+}
+static void APIENTRY lazy_glDrawArraysInstancedARB(GLenum mode, GLint first, GLsizei count, GLsizei primcount)
+{
+   LAZY(DrawArraysInstancedARB);
+   glDrawArraysInstancedARB(mode, first, count, primcount);
+}
+static void APIENTRY lazy_glDrawElementsInstancedARB(GLenum mode, GLsizei count, GLenum type, const GLvoid *indices, GLsizei primcount)
+{
+   LAZY(DrawElementsInstancedARB);
+   glDrawElementsInstancedARB(mode, count, type, indices, primcount);
+}
+static GLboolean APIENTRY lazy_glIsRenderbuffer(GLuint renderbuffer)
+{
+   LAZY(IsRenderbuffer);
+   return glIsRenderbuffer(renderbuffer);
+}
+static void APIENTRY lazy_glBindRenderbuffer(GLenum target, GLuint renderbuffer)
+{
+   LAZY(BindRenderbuffer);
+   glBindRenderbuffer(target, renderbuffer);
+}
+static void APIENTRY lazy_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers)
+{
+   LAZY(DeleteRenderbuffers);
+   glDeleteRenderbuffers(n, renderbuffers);
+}
+static void APIENTRY lazy_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers)
+{
+   LAZY(GenRenderbuffers);
+   glGenRenderbuffers(n, renderbuffers);
+}
+static void APIENTRY lazy_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height)
+{
+   LAZY(RenderbufferStorage);
+   glRenderbufferStorage(target, internalformat, width, height);
+}
+static void APIENTRY lazy_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params)
+{
+   LAZY(GetRenderbufferParameteriv);
+   glGetRenderbufferParameteriv(target, pname, params);
+}
+static GLboolean APIENTRY lazy_glIsFramebuffer(GLuint framebuffer)
+{
+   LAZY(IsFramebuffer);
+   return glIsFramebuffer(framebuffer);
+}
+static void APIENTRY lazy_glBindFramebuffer(GLenum target, GLuint framebuffer)
+{
+   LAZY(BindFramebuffer);
+   glBindFramebuffer(target, framebuffer);
+}
+static void APIENTRY lazy_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers)
+{
+   LAZY(DeleteFramebuffers);
+   glDeleteFramebuffers(n, framebuffers);
+}
+static void APIENTRY lazy_glGenFramebuffers(GLsizei n, GLuint *framebuffers)
+{
+   LAZY(GenFramebuffers);
+   glGenFramebuffers(n, framebuffers);
+}
+static GLenum APIENTRY lazy_glCheckFramebufferStatus(GLenum target)
+{
+   LAZY(CheckFramebufferStatus);
+   return glCheckFramebufferStatus(target);
+}
+static void APIENTRY lazy_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+   LAZY(FramebufferTexture1D);
+   glFramebufferTexture1D(target, attachment, textarget, texture, level);
+}
+static void APIENTRY lazy_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+   LAZY(FramebufferTexture2D);
+   glFramebufferTexture2D(target, attachment, textarget, texture, level);
+}
+static void APIENTRY lazy_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset)
+{
+   LAZY(FramebufferTexture3D);
+   glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+}
+static void APIENTRY lazy_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+{
+   LAZY(FramebufferRenderbuffer);
+   glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+}
+static void APIENTRY lazy_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params)
+{
+   LAZY(GetFramebufferAttachmentParameteriv);
+   glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+}
+static void APIENTRY lazy_glGenerateMipmap(GLenum target)
+{
+   LAZY(GenerateMipmap);
+   glGenerateMipmap(target);
+}
+static void APIENTRY lazy_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+{
+   LAZY(BlitFramebuffer);
+   glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+static void APIENTRY lazy_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+   LAZY(RenderbufferStorageMultisample);
+   glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+}
+static void APIENTRY lazy_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer)
+{
+   LAZY(FramebufferTextureLayer);
+   glFramebufferTextureLayer(target, attachment, texture, level, layer);
+}
+static void APIENTRY lazy_glProgramParameteriARB(GLuint program, GLenum pname, GLint value)
+{
+   LAZY(ProgramParameteriARB);
+   glProgramParameteriARB(program, pname, value);
+}
+static void APIENTRY lazy_glFramebufferTextureARB(GLenum target, GLenum attachment, GLuint texture, GLint level)
+{
+   LAZY(FramebufferTextureARB);
+   glFramebufferTextureARB(target, attachment, texture, level);
+}
+static void APIENTRY lazy_glFramebufferTextureLayerARB(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer)
+{
+   LAZY(FramebufferTextureLayerARB);
+   glFramebufferTextureLayerARB(target, attachment, texture, level, layer);
+}
+static void APIENTRY lazy_glFramebufferTextureFaceARB(GLenum target, GLenum attachment, GLuint texture, GLint level, GLenum face)
+{
+   LAZY(FramebufferTextureFaceARB);
+   glFramebufferTextureFaceARB(target, attachment, texture, level, face);
+}
+static void APIENTRY lazy_glVertexAttribDivisorARB(GLuint index, GLuint divisor)
+{
+   LAZY(VertexAttribDivisorARB);
+   glVertexAttribDivisorARB(index, divisor);
+}
+static GLvoid* APIENTRY lazy_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+   LAZY(MapBufferRange);
+   return glMapBufferRange(target, offset, length, access);
+}
+static void APIENTRY lazy_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length)
+{
+   LAZY(FlushMappedBufferRange);
+   glFlushMappedBufferRange(target, offset, length);
+}
+static void APIENTRY lazy_glTexBufferARB(GLenum target, GLenum internalformat, GLuint buffer)
+{
+   LAZY(TexBufferARB);
+   glTexBufferARB(target, internalformat, buffer);
+}
+static void APIENTRY lazy_glBindVertexArray(GLuint array)
+{
+   LAZY(BindVertexArray);
+   glBindVertexArray(array);
+}
+static void APIENTRY lazy_glDeleteVertexArrays(GLsizei n, const GLuint *arrays)
+{
+   LAZY(DeleteVertexArrays);
+   glDeleteVertexArrays(n, arrays);
+}
+static void APIENTRY lazy_glGenVertexArrays(GLsizei n, GLuint *arrays)
+{
+   LAZY(GenVertexArrays);
+   glGenVertexArrays(n, arrays);
+}
+static GLboolean APIENTRY lazy_glIsVertexArray(GLuint array)
+{
+   LAZY(IsVertexArray);
+   return glIsVertexArray(array);
+}
+static void APIENTRY lazy_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar* const *uniformNames, GLuint *uniformIndices)
+{
+   LAZY(GetUniformIndices);
+   glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+}
+static void APIENTRY lazy_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params)
+{
+   LAZY(GetActiveUniformsiv);
+   glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+}
+static void APIENTRY lazy_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName)
+{
+   LAZY(GetActiveUniformName);
+   glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+}
+static GLuint APIENTRY lazy_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName)
+{
+   LAZY(GetUniformBlockIndex);
+   return glGetUniformBlockIndex(program, uniformBlockName);
+}
+static void APIENTRY lazy_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params)
+{
+   LAZY(GetActiveUniformBlockiv);
+   glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+}
+static void APIENTRY lazy_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName)
+{
+   LAZY(GetActiveUniformBlockName);
+   glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+}
+static void APIENTRY lazy_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding)
+{
+   LAZY(UniformBlockBinding);
+   glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+}
+static void APIENTRY lazy_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+{
+   LAZY(CopyBufferSubData);
+   glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+}
+static void APIENTRY lazy_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const GLvoid *indices, GLint basevertex)
+{
+   LAZY(DrawElementsBaseVertex);
+   glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+}
+static void APIENTRY lazy_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const GLvoid *indices, GLint basevertex)
+{
+   LAZY(DrawRangeElementsBaseVertex);
+   glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+}
+static void APIENTRY lazy_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const GLvoid *indices, GLsizei instancecount, GLint basevertex)
+{
+   LAZY(DrawElementsInstancedBaseVertex);
+   glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+}
+static void APIENTRY lazy_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const GLvoid* const *indices, GLsizei drawcount, const GLint *basevertex)
+{
+   LAZY(MultiDrawElementsBaseVertex);
+   glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+}
+static void APIENTRY lazy_glProvokingVertex(GLenum mode)
+{
+   LAZY(ProvokingVertex);
+   glProvokingVertex(mode);
+}
+static GLsync APIENTRY lazy_glFenceSync(GLenum condition, GLbitfield flags)
+{
+   LAZY(FenceSync);
+   return glFenceSync(condition, flags);
+}
+static GLboolean APIENTRY lazy_glIsSync(GLsync sync)
+{
+   LAZY(IsSync);
+   return glIsSync(sync);
+}
+static void APIENTRY lazy_glDeleteSync(GLsync sync)
+{
+   LAZY(DeleteSync);
+   glDeleteSync(sync);
+}
+static GLenum APIENTRY lazy_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+   LAZY(ClientWaitSync);
+   return glClientWaitSync(sync, flags, timeout);
+}
+static void APIENTRY lazy_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+   LAZY(WaitSync);
+   glWaitSync(sync, flags, timeout);
+}
+static void APIENTRY lazy_glGetInteger64v(GLenum pname, GLint64 *params)
+{
+   LAZY(GetInteger64v);
+   glGetInteger64v(pname, params);
+}
+static void APIENTRY lazy_glGetSynciv(GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values)
+{
+   LAZY(GetSynciv);
+   glGetSynciv(sync, pname, bufSize, length, values);
+}
+static void APIENTRY lazy_glTexImage2DMultisample(GLenum target, GLsizei samples, GLint internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+{
+   LAZY(TexImage2DMultisample);
+   glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+static void APIENTRY lazy_glTexImage3DMultisample(GLenum target, GLsizei samples, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+   LAZY(TexImage3DMultisample);
+   glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+static void APIENTRY lazy_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val)
+{
+   LAZY(GetMultisamplefv);
+   glGetMultisamplefv(pname, index, val);
+}
+static void APIENTRY lazy_glSampleMaski(GLuint index, GLbitfield mask)
+{
+   LAZY(SampleMaski);
+   glSampleMaski(index, mask);
+}
+static void APIENTRY lazy_glBlendEquationiARB(GLuint buf, GLenum mode)
+{
+   LAZY(BlendEquationiARB);
+   glBlendEquationiARB(buf, mode);
+}
+static void APIENTRY lazy_glBlendEquationSeparateiARB(GLuint buf, GLenum modeRGB, GLenum modeAlpha)
+{
+   LAZY(BlendEquationSeparateiARB);
+   glBlendEquationSeparateiARB(buf, modeRGB, modeAlpha);
+}
+static void APIENTRY lazy_glBlendFunciARB(GLuint buf, GLenum src, GLenum dst)
+{
+   LAZY(BlendFunciARB);
+   glBlendFunciARB(buf, src, dst);
+}
+static void APIENTRY lazy_glBlendFuncSeparateiARB(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+{
+   LAZY(BlendFuncSeparateiARB);
+   glBlendFuncSeparateiARB(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+}
+static void APIENTRY lazy_glMinSampleShadingARB(GLfloat value)
+{
+   LAZY(MinSampleShadingARB);
+   glMinSampleShadingARB(value);
+}
+static void APIENTRY lazy_glNamedStringARB(GLenum type, GLint namelen, const GLchar *name, GLint stringlen, const GLchar *string)
+{
+   LAZY(NamedStringARB);
+   glNamedStringARB(type, namelen, name, stringlen, string);
+}
+static void APIENTRY lazy_glDeleteNamedStringARB(GLint namelen, const GLchar *name)
+{
+   LAZY(DeleteNamedStringARB);
+   glDeleteNamedStringARB(namelen, name);
+}
+static void APIENTRY lazy_glCompileShaderIncludeARB(GLuint shader, GLsizei count, const GLchar* *path, const GLint *length)
+{
+   LAZY(CompileShaderIncludeARB);
+   glCompileShaderIncludeARB(shader, count, path, length);
+}
+static GLboolean APIENTRY lazy_glIsNamedStringARB(GLint namelen, const GLchar *name)
+{
+   LAZY(IsNamedStringARB);
+   return glIsNamedStringARB(namelen, name);
+}
+static void APIENTRY lazy_glGetNamedStringARB(GLint namelen, const GLchar *name, GLsizei bufSize, GLint *stringlen, GLchar *string)
+{
+   LAZY(GetNamedStringARB);
+   glGetNamedStringARB(namelen, name, bufSize, stringlen, string);
+}
+static void APIENTRY lazy_glGetNamedStringivARB(GLint namelen, const GLchar *name, GLenum pname, GLint *params)
+{
+   LAZY(GetNamedStringivARB);
+   glGetNamedStringivARB(namelen, name, pname, params);
+}
+static void APIENTRY lazy_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name)
+{
+   LAZY(BindFragDataLocationIndexed);
+   glBindFragDataLocationIndexed(program, colorNumber, index, name);
+}
+static GLint APIENTRY lazy_glGetFragDataIndex(GLuint program, const GLchar *name)
+{
+   LAZY(GetFragDataIndex);
+   return glGetFragDataIndex(program, name);
+}
+static void APIENTRY lazy_glGenSamplers(GLsizei count, GLuint *samplers)
+{
+   LAZY(GenSamplers);
+   glGenSamplers(count, samplers);
+}
+static void APIENTRY lazy_glDeleteSamplers(GLsizei count, const GLuint *samplers)
+{
+   LAZY(DeleteSamplers);
+   glDeleteSamplers(count, samplers);
+}
+static GLboolean APIENTRY lazy_glIsSampler(GLuint sampler)
+{
+   LAZY(IsSampler);
+   return glIsSampler(sampler);
+}
+static void APIENTRY lazy_glBindSampler(GLuint unit, GLuint sampler)
+{
+   LAZY(BindSampler);
+   glBindSampler(unit, sampler);
+}
+static void APIENTRY lazy_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param)
+{
+   LAZY(SamplerParameteri);
+   glSamplerParameteri(sampler, pname, param);
+}
+static void APIENTRY lazy_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param)
+{
+   LAZY(SamplerParameteriv);
+   glSamplerParameteriv(sampler, pname, param);
+}
+static void APIENTRY lazy_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param)
+{
+   LAZY(SamplerParameterf);
+   glSamplerParameterf(sampler, pname, param);
+}
+static void APIENTRY lazy_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param)
+{
+   LAZY(SamplerParameterfv);
+   glSamplerParameterfv(sampler, pname, param);
+}
+static void APIENTRY lazy_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param)
+{
+   LAZY(SamplerParameterIiv);
+   glSamplerParameterIiv(sampler, pname, param);
+}
+static void APIENTRY lazy_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param)
+{
+   LAZY(SamplerParameterIuiv);
+   glSamplerParameterIuiv(sampler, pname, param);
+}
+static void APIENTRY lazy_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params)
+{
+   LAZY(GetSamplerParameteriv);
+   glGetSamplerParameteriv(sampler, pname, params);
+}
+static void APIENTRY lazy_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params)
+{
+   LAZY(GetSamplerParameterIiv);
+   glGetSamplerParameterIiv(sampler, pname, params);
+}
+static void APIENTRY lazy_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params)
+{
+   LAZY(GetSamplerParameterfv);
+   glGetSamplerParameterfv(sampler, pname, params);
+}
+static void APIENTRY lazy_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params)
+{
+   LAZY(GetSamplerParameterIuiv);
+   glGetSamplerParameterIuiv(sampler, pname, params);
+}
+static void APIENTRY lazy_glQueryCounter(GLuint id, GLenum target)
+{
+   LAZY(QueryCounter);
+   glQueryCounter(id, target);
+}
+static void APIENTRY lazy_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params)
+{
+   LAZY(GetQueryObjecti64v);
+   glGetQueryObjecti64v(id, pname, params);
+}
+static void APIENTRY lazy_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params)
+{
+   LAZY(GetQueryObjectui64v);
+   glGetQueryObjectui64v(id, pname, params);
+}
+static void APIENTRY lazy_glVertexP2ui(GLenum type, GLuint value)
+{
+   LAZY(VertexP2ui);
+   glVertexP2ui(type, value);
+}
+static void APIENTRY lazy_glVertexP2uiv(GLenum type, const GLuint *value)
+{
+   LAZY(VertexP2uiv);
+   glVertexP2uiv(type, value);
+}
+static void APIENTRY lazy_glVertexP3ui(GLenum type, GLuint value)
+{
+   LAZY(VertexP3ui);
+   glVertexP3ui(type, value);
+}
+static void APIENTRY lazy_glVertexP3uiv(GLenum type, const GLuint *value)
+{
+   LAZY(VertexP3uiv);
+   glVertexP3uiv(type, value);
+}
+static void APIENTRY lazy_glVertexP4ui(GLenum type, GLuint value)
+{
+   LAZY(VertexP4ui);
+   glVertexP4ui(type, value);
+}
+static void APIENTRY lazy_glVertexP4uiv(GLenum type, const GLuint *value)
+{
+   LAZY(VertexP4uiv);
+   glVertexP4uiv(type, value);
+}
+static void APIENTRY lazy_glTexCoordP1ui(GLenum type, GLuint coords)
+{
+   LAZY(TexCoordP1ui);
+   glTexCoordP1ui(type, coords);
+}
+static void APIENTRY lazy_glTexCoordP1uiv(GLenum type, const GLuint *coords)
+{
+   LAZY(TexCoordP1uiv);
+   glTexCoordP1uiv(type, coords);
+}
+static void APIENTRY lazy_glTexCoordP2ui(GLenum type, GLuint coords)
+{
+   LAZY(TexCoordP2ui);
+   glTexCoordP2ui(type, coords);
+}
+static void APIENTRY lazy_glTexCoordP2uiv(GLenum type, const GLuint *coords)
+{
+   LAZY(TexCoordP2uiv);
+   glTexCoordP2uiv(type, coords);
+}
+static void APIENTRY lazy_glTexCoordP3ui(GLenum type, GLuint coords)
+{
+   LAZY(TexCoordP3ui);
+   glTexCoordP3ui(type, coords);
+}
+static void APIENTRY lazy_glTexCoordP3uiv(GLenum type, const GLuint *coords)
+{
+   LAZY(TexCoordP3uiv);
+   glTexCoordP3uiv(type, coords);
+}
+static void APIENTRY lazy_glTexCoordP4ui(GLenum type, GLuint coords)
+{
+   LAZY(TexCoordP4ui);
+   glTexCoordP4ui(type, coords);
+}
+static void APIENTRY lazy_glTexCoordP4uiv(GLenum type, const GLuint *coords)
+{
+   LAZY(TexCoordP4uiv);
+   glTexCoordP4uiv(type, coords);
+}
+static void APIENTRY lazy_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords)
+{
+   LAZY(MultiTexCoordP1ui);
+   glMultiTexCoordP1ui(texture, type, coords);
+}
+static void APIENTRY lazy_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords)
+{
+   LAZY(MultiTexCoordP1uiv);
+   glMultiTexCoordP1uiv(texture, type, coords);
+}
+static void APIENTRY lazy_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords)
+{
+   LAZY(MultiTexCoordP2ui);
+   glMultiTexCoordP2ui(texture, type, coords);
+}
+static void APIENTRY lazy_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords)
+{
+   LAZY(MultiTexCoordP2uiv);
+   glMultiTexCoordP2uiv(texture, type, coords);
+}
+static void APIENTRY lazy_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords)
+{
+   LAZY(MultiTexCoordP3ui);
+   glMultiTexCoordP3ui(texture, type, coords);
+}
+static void APIENTRY lazy_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords)
+{
+   LAZY(MultiTexCoordP3uiv);
+   glMultiTexCoordP3uiv(texture, type, coords);
+}
+static void APIENTRY lazy_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords)
+{
+   LAZY(MultiTexCoordP4ui);
+   glMultiTexCoordP4ui(texture, type, coords);
+}
+static void APIENTRY lazy_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords)
+{
+   LAZY(MultiTexCoordP4uiv);
+   glMultiTexCoordP4uiv(texture, type, coords);
+}
+static void APIENTRY lazy_glNormalP3ui(GLenum type, GLuint coords)
+{
+   LAZY(NormalP3ui);
+   glNormalP3ui(type, coords);
+}
+static void APIENTRY lazy_glNormalP3uiv(GLenum type, const GLuint *coords)
+{
+   LAZY(NormalP3uiv);
+   glNormalP3uiv(type, coords);
+}
+static void APIENTRY lazy_glColorP3ui(GLenum type, GLuint color)
+{
+   LAZY(ColorP3ui);
+   glColorP3ui(type, color);
+}
+static void APIENTRY lazy_glColorP3uiv(GLenum type, const GLuint *color)
+{
+   LAZY(ColorP3uiv);
+   glColorP3uiv(type, color);
+}
+static void APIENTRY lazy_glColorP4ui(GLenum type, GLuint color)
+{
+   LAZY(ColorP4ui);
+   glColorP4ui(type, color);
+}
+static void APIENTRY lazy_glColorP4uiv(GLenum type, const GLuint *color)
+{
+   LAZY(ColorP4uiv);
+   glColorP4uiv(type, color);
+}
+static void APIENTRY lazy_glSecondaryColorP3ui(GLenum type, GLuint color)
+{
+   LAZY(SecondaryColorP3ui);
+   glSecondaryColorP3ui(type, color);
+}
+static void APIENTRY lazy_glSecondaryColorP3uiv(GLenum type, const GLuint *color)
+{
+   LAZY(SecondaryColorP3uiv);
+   glSecondaryColorP3uiv(type, color);
+}
+static void APIENTRY lazy_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+   LAZY(VertexAttribP1ui);
+   glVertexAttribP1ui(index, type, normalized, value);
+}
+static void APIENTRY lazy_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+   LAZY(VertexAttribP1uiv);
+   glVertexAttribP1uiv(index, type, normalized, value);
+}
+static void APIENTRY lazy_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+   LAZY(VertexAttribP2ui);
+   glVertexAttribP2ui(index, type, normalized, value);
+}
+static void APIENTRY lazy_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+   LAZY(VertexAttribP2uiv);
+   glVertexAttribP2uiv(index, type, normalized, value);
+}
+static void APIENTRY lazy_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+   LAZY(VertexAttribP3ui);
+   glVertexAttribP3ui(index, type, normalized, value);
+}
+static void APIENTRY lazy_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+   LAZY(VertexAttribP3uiv);
+   glVertexAttribP3uiv(index, type, normalized, value);
+}
+static void APIENTRY lazy_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+   LAZY(VertexAttribP4ui);
+   glVertexAttribP4ui(index, type, normalized, value);
+}
+static void APIENTRY lazy_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+   LAZY(VertexAttribP4uiv);
+   glVertexAttribP4uiv(index, type, normalized, value);
+}
+static void APIENTRY lazy_glDrawArraysIndirect(GLenum mode, const GLvoid *indirect)
+{
+   LAZY(DrawArraysIndirect);
+   glDrawArraysIndirect(mode, indirect);
+}
+static void APIENTRY lazy_glDrawElementsIndirect(GLenum mode, GLenum type, const GLvoid *indirect)
+{
+   LAZY(DrawElementsIndirect);
+   glDrawElementsIndirect(mode, type, indirect);
+}
+static void APIENTRY lazy_glUniform1d(GLint location, GLdouble x)
+{
+   LAZY(Uniform1d);
+   glUniform1d(location, x);
+}
+static void APIENTRY lazy_glUniform2d(GLint location, GLdouble x, GLdouble y)
+{
+   LAZY(Uniform2d);
+   glUniform2d(location, x, y);
+}
+static void APIENTRY lazy_glUniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z)
+{
+   LAZY(Uniform3d);
+   glUniform3d(location, x, y, z);
+}
+static void APIENTRY lazy_glUniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+   LAZY(Uniform4d);
+   glUniform4d(location, x, y, z, w);
+}
+static void APIENTRY lazy_glUniform1dv(GLint location, GLsizei count, const GLdouble *value)
+{
+   LAZY(Uniform1dv);
+   glUniform1dv(location, count, value);
+}
+static void APIENTRY lazy_glUniform2dv(GLint location, GLsizei count, const GLdouble *value)
+{
+   LAZY(Uniform2dv);
+   glUniform2dv(location, count, value);
+}
+static void APIENTRY lazy_glUniform3dv(GLint location, GLsizei count, const GLdouble *value)
+{
+   LAZY(Uniform3dv);
+   glUniform3dv(location, count, value);
+}
+static void APIENTRY lazy_glUniform4dv(GLint location, GLsizei count, const GLdouble *value)
+{
+   LAZY(Uniform4dv);
+   glUniform4dv(location, count, value);
+}
+static void APIENTRY lazy_glUniformMatrix2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+   LAZY(UniformMatrix2dv);
+   glUniformMatrix2dv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+   LAZY(UniformMatrix3dv);
+   glUniformMatrix3dv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+   LAZY(UniformMatrix4dv);
+   glUniformMatrix4dv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix2x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+   LAZY(UniformMatrix2x3dv);
+   glUniformMatrix2x3dv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix2x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+   LAZY(UniformMatrix2x4dv);
+   glUniformMatrix2x4dv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix3x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+   LAZY(UniformMatrix3x2dv);
+   glUniformMatrix3x2dv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix3x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+   LAZY(UniformMatrix3x4dv);
+   glUniformMatrix3x4dv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix4x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+   LAZY(UniformMatrix4x2dv);
+   glUniformMatrix4x2dv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix4x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+   LAZY(UniformMatrix4x3dv);
+   glUniformMatrix4x3dv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glGetUniformdv(GLuint program, GLint location, GLdouble *params)
+{
+   LAZY(GetUniformdv);
+   glGetUniformdv(program, location, params);
+}
+static GLint APIENTRY lazy_glGetSubroutineUniformLocation(GLuint program, GLenum shadertype, const GLchar *name)
+{
+   LAZY(GetSubroutineUniformLocation);
+   return glGetSubroutineUniformLocation(program, shadertype, name);
+}
+static GLuint APIENTRY lazy_glGetSubroutineIndex(GLuint program, GLenum shadertype, const GLchar *name)
+{
+   LAZY(GetSubroutineIndex);
+   return glGetSubroutineIndex(program, shadertype, name);
+}
+static void APIENTRY lazy_glGetActiveSubroutineUniformiv(GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values)
+{
+   LAZY(GetActiveSubroutineUniformiv);
+   glGetActiveSubroutineUniformiv(program, shadertype, index, pname, values);
+}
+static void APIENTRY lazy_glGetActiveSubroutineUniformName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei *length, GLchar *name)
+{
+   LAZY(GetActiveSubroutineUniformName);
+   glGetActiveSubroutineUniformName(program, shadertype, index, bufsize, length, name);
+}
+static void APIENTRY lazy_glGetActiveSubroutineName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei *length, GLchar *name)
+{
+   LAZY(GetActiveSubroutineName);
+   glGetActiveSubroutineName(program, shadertype, index, bufsize, length, name);
+}
+static void APIENTRY lazy_glUniformSubroutinesuiv(GLenum shadertype, GLsizei count, const GLuint *indices)
+{
+   LAZY(UniformSubroutinesuiv);
+   glUniformSubroutinesuiv(shadertype, count, indices);
+}
+static void APIENTRY lazy_glGetUniformSubroutineuiv(GLenum shadertype, GLint location, GLuint *params)
+{
+   LAZY(GetUniformSubroutineuiv);
+   glGetUniformSubroutineuiv(shadertype, location, params);
+}
+static void APIENTRY lazy_glGetProgramStageiv(GLuint program, GLenum shadertype, GLenum pname, GLint *values)
+{
+   LAZY(GetProgramStageiv);
+   glGetProgramStageiv(program, shadertype, pname, values);
+}
+static void APIENTRY lazy_glPatchParameteri(GLenum pname, GLint value)
+{
+   LAZY(PatchParameteri);
+   glPatchParameteri(pname, value);
+}
+static void APIENTRY lazy_glPatchParameterfv(GLenum pname, const GLfloat *values)
+{
+   LAZY(PatchParameterfv);
+   glPatchParameterfv(pname, values);
+}
+static void APIENTRY lazy_glBindTransformFeedback(GLenum target, GLuint id)
+{
+   LAZY(BindTransformFeedback);
+   glBindTransformFeedback(target, id);
+}
+static void APIENTRY lazy_glDeleteTransformFeedbacks(GLsizei n, const GLuint *ids)
+{
+   LAZY(DeleteTransformFeedbacks);
+   glDeleteTransformFeedbacks(n, ids);
+}
+static void APIENTRY lazy_glGenTransformFeedbacks(GLsizei n, GLuint *ids)
+{
+   LAZY(GenTransformFeedbacks);
+   glGenTransformFeedbacks(n, ids);
+}
+static GLboolean APIENTRY lazy_glIsTransformFeedback(GLuint id)
+{
+   LAZY(IsTransformFeedback);
+   return glIsTransformFeedback(id);
+}
+static void APIENTRY lazy_glPauseTransformFeedback(void)
+{
+   LAZY(PauseTransformFeedback);
+   glPauseTransformFeedback();
+}
+static void APIENTRY lazy_glResumeTransformFeedback(void)
+{
+   LAZY(ResumeTransformFeedback);
+   glResumeTransformFeedback();
+}
+static void APIENTRY lazy_glDrawTransformFeedback(GLenum mode, GLuint id)
+{
+   LAZY(DrawTransformFeedback);
+   glDrawTransformFeedback(mode, id);
+}
+static void APIENTRY lazy_glDrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream)
+{
+   LAZY(DrawTransformFeedbackStream);
+   glDrawTransformFeedbackStream(mode, id, stream);
+}
+static void APIENTRY lazy_glBeginQueryIndexed(GLenum target, GLuint index, GLuint id)
+{
+   LAZY(BeginQueryIndexed);
+   glBeginQueryIndexed(target, index, id);
+}
+static void APIENTRY lazy_glEndQueryIndexed(GLenum target, GLuint index)
+{
+   LAZY(EndQueryIndexed);
+   glEndQueryIndexed(target, index);
+}
+static void APIENTRY lazy_glGetQueryIndexediv(GLenum target, GLuint index, GLenum pname, GLint *params)
+{
+   LAZY(GetQueryIndexediv);
+   glGetQueryIndexediv(target, index, pname, params);
+}
+static void APIENTRY lazy_glReleaseShaderCompiler(void)
+{
+   LAZY(ReleaseShaderCompiler);
+   glReleaseShaderCompiler();
+}
+static void APIENTRY lazy_glShaderBinary(GLsizei count, const GLuint *shaders, GLenum binaryformat, const GLvoid *binary, GLsizei length)
+{
+   LAZY(ShaderBinary);
+   glShaderBinary(count, shaders, binaryformat, binary, length);
+}
+static void APIENTRY lazy_glGetShaderPrecisionFormat(GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision)
+{
+   LAZY(GetShaderPrecisionFormat);
+   glGetShaderPrecisionFormat(shadertype, precisiontype, range, precision);
+}
+static void APIENTRY lazy_glDepthRangef(GLfloat n, GLfloat f)
+{
+   LAZY(DepthRangef);
+   glDepthRangef(n, f);
+}
+static void APIENTRY lazy_glClearDepthf(GLfloat d)
+{
+   LAZY(ClearDepthf);
+   glClearDepthf(d);
+}
+static void APIENTRY lazy_glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, GLvoid *binary)
+{
+   LAZY(GetProgramBinary);
+   glGetProgramBinary(program, bufSize, length, binaryFormat, binary);
+}
+static void APIENTRY lazy_glProgramBinary(GLuint program, GLenum binaryFormat, const GLvoid *binary, GLsizei length)
+{
+   LAZY(ProgramBinary);
+   glProgramBinary(program, binaryFormat, binary, length);
+}
+static void APIENTRY lazy_glProgramParameteri(GLuint program, GLenum pname, GLint value)
+{
+   LAZY(ProgramParameteri);
+   glProgramParameteri(program, pname, value);
+}
+static void APIENTRY lazy_glUseProgramStages(GLuint pipeline, GLbitfield stages, GLuint program)
+{
+   LAZY(UseProgramStages);
+   glUseProgramStages(pipeline, stages, program);
+}
+static void APIENTRY lazy_glActiveShaderProgram(GLuint pipeline, GLuint program)
+{
+   LAZY(ActiveShaderProgram);
+   glActiveShaderProgram(pipeline, program);
+}
+static GLuint APIENTRY lazy_glCreateShaderProgramv(GLenum type, GLsizei count, const GLchar* const *strings)
+{
+   LAZY(CreateShaderProgramv);
+   return glCreateShaderProgramv(type, count, strings);
+}
+static void APIENTRY lazy_glBindProgramPipeline(GLuint pipeline)
+{
+   LAZY(BindProgramPipeline);
+   glBindProgramPipeline(pipeline);
+}
+static void APIENTRY lazy_glDeleteProgramPipelines(GLsizei n, const GLuint *pipelines)
+{
+   LAZY(DeleteProgramPipelines);
+   glDeleteProgramPipelines(n, pipelines);
+}
+static void APIENTRY lazy_glGenProgramPipelines(GLsizei n, GLuint *pipelines)
+{
+   LAZY(GenProgramPipelines);
+   glGenProgramPipelines(n, pipelines);
+}
+static GLboolean APIENTRY lazy_glIsProgramPipeline(GLuint pipeline)
+{
+   LAZY(IsProgramPipeline);
+   return glIsProgramPipeline(pipeline);
+}
+static void APIENTRY lazy_glGetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint *params)
+{
+   LAZY(GetProgramPipelineiv);
+   glGetProgramPipelineiv(pipeline, pname, params);
+}
+static void APIENTRY lazy_glProgramUniform1i(GLuint program, GLint location, GLint v0)
+{
+   LAZY(ProgramUniform1i);
+   glProgramUniform1i(program, location, v0);
+}
+static void APIENTRY lazy_glProgramUniform1iv(GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+   LAZY(ProgramUniform1iv);
+   glProgramUniform1iv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform1f(GLuint program, GLint location, GLfloat v0)
+{
+   LAZY(ProgramUniform1f);
+   glProgramUniform1f(program, location, v0);
+}
+static void APIENTRY lazy_glProgramUniform1fv(GLuint program, GLint location, GLsizei count, const GLfloat *value)
+{
+   LAZY(ProgramUniform1fv);
+   glProgramUniform1fv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform1d(GLuint program, GLint location, GLdouble v0)
+{
+   LAZY(ProgramUniform1d);
+   glProgramUniform1d(program, location, v0);
+}
+static void APIENTRY lazy_glProgramUniform1dv(GLuint program, GLint location, GLsizei count, const GLdouble *value)
+{
+   LAZY(ProgramUniform1dv);
+   glProgramUniform1dv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform1ui(GLuint program, GLint location, GLuint v0)
+{
+   LAZY(ProgramUniform1ui);
+   glProgramUniform1ui(program, location, v0);
+}
+static void APIENTRY lazy_glProgramUniform1uiv(GLuint program, GLint location, GLsizei count, const GLuint *value)
+{
+   LAZY(ProgramUniform1uiv);
+   glProgramUniform1uiv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1)
+{
+   LAZY(ProgramUniform2i);
+   glProgramUniform2i(program, location, v0, v1);
+}
+static void APIENTRY lazy_glProgramUniform2iv(GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+   LAZY(ProgramUniform2iv);
+   glProgramUniform2iv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1)
+{
+   LAZY(ProgramUniform2f);
+   glProgramUniform2f(program, location, v0, v1);
+}
+static void APIENTRY lazy_glProgramUniform2fv(GLuint program, GLint location, GLsizei count, const GLfloat *value)
+{
+   LAZY(ProgramUniform2fv);
+   glProgramUniform2fv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform2d(GLuint program, GLint location, GLdouble v0, GLdouble v1)
+{
+   LAZY(ProgramUniform2d);
+   glProgramUniform2d(program, location, v0, v1);
+}
+static void APIENTRY lazy_glProgramUniform2dv(GLuint program, GLint location, GLsizei count, const GLdouble *value)
+{
+   LAZY(ProgramUniform2dv);
+   glProgramUniform2dv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform2ui(GLuint program, GLint location, GLuint v0, GLuint v1)
+{
+   LAZY(ProgramUniform2ui);
+   glProgramUniform2ui(program, location, v0, v1);
+}
+static void APIENTRY lazy_glProgramUniform2uiv(GLuint program, GLint location, GLsizei count, const GLuint *value)
+{
+   LAZY(ProgramUniform2uiv);
+   glProgramUniform2uiv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform3i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2)
+{
+   LAZY(ProgramUniform3i);
+   glProgramUniform3i(program, location, v0, v1, v2);
+}
+static void APIENTRY lazy_glProgramUniform3iv(GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+   LAZY(ProgramUniform3iv);
+   glProgramUniform3iv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+   LAZY(ProgramUniform3f);
+   glProgramUniform3f(program, location, v0, v1, v2);
+}
+static void APIENTRY lazy_glProgramUniform3fv(GLuint program, GLint location, GLsizei count, const GLfloat *value)
+{
+   LAZY(ProgramUniform3fv);
+   glProgramUniform3fv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform3d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2)
+{
+   LAZY(ProgramUniform3d);
+   glProgramUniform3d(program, location, v0, v1, v2);
+}
+static void APIENTRY lazy_glProgramUniform3dv(GLuint program, GLint location, GLsizei count, const GLdouble *value)
+{
+   LAZY(ProgramUniform3dv);
+   glProgramUniform3dv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2)
+{
+   LAZY(ProgramUniform3ui);
+   glProgramUniform3ui(program, location, v0, v1, v2);
+}
+static void APIENTRY lazy_glProgramUniform3uiv(GLuint program, GLint location, GLsizei count, const GLuint *value)
+{
+   LAZY(ProgramUniform3uiv);
+   glProgramUniform3uiv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+   LAZY(ProgramUniform4i);
+   glProgramUniform4i(program, location, v0, v1, v2, v3);
+}
+static void APIENTRY lazy_glProgramUniform4iv(GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+   LAZY(ProgramUniform4iv);
+   glProgramUniform4iv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+   LAZY(ProgramUniform4f);
+   glProgramUniform4f(program, location, v0, v1, v2, v3);
+}
+static void APIENTRY lazy_glProgramUniform4fv(GLuint program, GLint location, GLsizei count, const GLfloat *value)
+{
+   LAZY(ProgramUniform4fv);
+   glProgramUniform4fv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform4d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3)
+{
+   LAZY(ProgramUniform4d);
+   glProgramUniform4d(program, location, v0, v1, v2, v3);
+}
+static void APIENTRY lazy_glProgramUniform4dv(GLuint program, GLint location, GLsizei count, const GLdouble *value)
+{
+   LAZY(ProgramUniform4dv);
+   glProgramUniform4dv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
+{
+   LAZY(ProgramUniform4ui);
+   glProgramUniform4ui(program, location, v0, v1, v2, v3);
+}
+static void APIENTRY lazy_glProgramUniform4uiv(GLuint program, GLint location, GLsizei count, const GLuint *value)
+{
+   LAZY(ProgramUniform4uiv);
+   glProgramUniform4uiv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+   LAZY(ProgramUniformMatrix2fv);
+   glProgramUniformMatrix2fv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+   LAZY(ProgramUniformMatrix3fv);
+   glProgramUniformMatrix3fv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+   LAZY(ProgramUniformMatrix4fv);
+   glProgramUniformMatrix4fv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+   LAZY(ProgramUniformMatrix2dv);
+   glProgramUniformMatrix2dv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+   LAZY(ProgramUniformMatrix3dv);
+   glProgramUniformMatrix3dv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+   LAZY(ProgramUniformMatrix4dv);
+   glProgramUniformMatrix4dv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix2x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+   LAZY(ProgramUniformMatrix2x3fv);
+   glProgramUniformMatrix2x3fv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix3x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+   LAZY(ProgramUniformMatrix3x2fv);
+   glProgramUniformMatrix3x2fv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix2x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+   LAZY(ProgramUniformMatrix2x4fv);
+   glProgramUniformMatrix2x4fv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix4x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+   LAZY(ProgramUniformMatrix4x2fv);
+   glProgramUniformMatrix4x2fv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix3x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+   LAZY(ProgramUniformMatrix3x4fv);
+   glProgramUniformMatrix3x4fv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix4x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+   LAZY(ProgramUniformMatrix4x3fv);
+   glProgramUniformMatrix4x3fv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix2x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+   LAZY(ProgramUniformMatrix2x3dv);
+   glProgramUniformMatrix2x3dv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix3x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+   LAZY(ProgramUniformMatrix3x2dv);
+   glProgramUniformMatrix3x2dv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix2x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+   LAZY(ProgramUniformMatrix2x4dv);
+   glProgramUniformMatrix2x4dv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix4x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+   LAZY(ProgramUniformMatrix4x2dv);
+   glProgramUniformMatrix4x2dv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix3x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+   LAZY(ProgramUniformMatrix3x4dv);
+   glProgramUniformMatrix3x4dv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix4x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+   LAZY(ProgramUniformMatrix4x3dv);
+   glProgramUniformMatrix4x3dv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glValidateProgramPipeline(GLuint pipeline)
+{
+   LAZY(ValidateProgramPipeline);
+   glValidateProgramPipeline(pipeline);
+}
+static void APIENTRY lazy_glGetProgramPipelineInfoLog(GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+   LAZY(GetProgramPipelineInfoLog);
+   glGetProgramPipelineInfoLog(pipeline, bufSize, length, infoLog);
+}
+static void APIENTRY lazy_glVertexAttribL1d(GLuint index, GLdouble x)
+{
+   LAZY(VertexAttribL1d);
+   glVertexAttribL1d(index, x);
+}
+static void APIENTRY lazy_glVertexAttribL2d(GLuint index, GLdouble x, GLdouble y)
+{
+   LAZY(VertexAttribL2d);
+   glVertexAttribL2d(index, x, y);
+}
+static void APIENTRY lazy_glVertexAttribL3d(GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+   LAZY(VertexAttribL3d);
+   glVertexAttribL3d(index, x, y, z);
+}
+static void APIENTRY lazy_glVertexAttribL4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+   LAZY(VertexAttribL4d);
+   glVertexAttribL4d(index, x, y, z, w);
+}
+static void APIENTRY lazy_glVertexAttribL1dv(GLuint index, const GLdouble *v)
+{
+   LAZY(VertexAttribL1dv);
+   glVertexAttribL1dv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribL2dv(GLuint index, const GLdouble *v)
+{
+   LAZY(VertexAttribL2dv);
+   glVertexAttribL2dv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribL3dv(GLuint index, const GLdouble *v)
+{
+   LAZY(VertexAttribL3dv);
+   glVertexAttribL3dv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribL4dv(GLuint index, const GLdouble *v)
+{
+   LAZY(VertexAttribL4dv);
+   glVertexAttribL4dv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribLPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const GLvoid *pointer)
+{
+   LAZY(VertexAttribLPointer);
+   glVertexAttribLPointer(index, size, type, stride, pointer);
+}
+static void APIENTRY lazy_glGetVertexAttribLdv(GLuint index, GLenum pname, GLdouble *params)
+{
+   LAZY(GetVertexAttribLdv);
+   glGetVertexAttribLdv(index, pname, params);
+}
+static void APIENTRY lazy_glViewportArrayv(GLuint first, GLsizei count, const GLfloat *v)
+{
+   LAZY(ViewportArrayv);
+   glViewportArrayv(first, count, v);
+}
+static void APIENTRY lazy_glViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h)
+{
+   LAZY(ViewportIndexedf);
+   glViewportIndexedf(index, x, y, w, h);
+}
+static void APIENTRY lazy_glViewportIndexedfv(GLuint index, const GLfloat *v)
+{
+   LAZY(ViewportIndexedfv);
+   glViewportIndexedfv(index, v);
+}
+static void APIENTRY lazy_glScissorArrayv(GLuint first, GLsizei count, const GLint *v)
+{
+   LAZY(ScissorArrayv);
+   glScissorArrayv(first, count, v);
+}
+static void APIENTRY lazy_glScissorIndexed(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height)
+{
+   LAZY(ScissorIndexed);
+   glScissorIndexed(index, left, bottom, width, height);
+}
+static void APIENTRY lazy_glScissorIndexedv(GLuint index, const GLint *v)
+{
+   LAZY(ScissorIndexedv);
+   glScissorIndexedv(index, v);
+}
+static void APIENTRY lazy_glDepthRangeArrayv(GLuint first, GLsizei count, const GLdouble *v)
+{
+   LAZY(DepthRangeArrayv);
+   glDepthRangeArrayv(first, count, v);
+}
+static void APIENTRY lazy_glDepthRangeIndexed(GLuint index, GLdouble n, GLdouble f)
+{
+   LAZY(DepthRangeIndexed);
+   glDepthRangeIndexed(index, n, f);
+}
+static void APIENTRY lazy_glGetFloati_v(GLenum target, GLuint index, GLfloat *data)
+{
+   LAZY(GetFloati_v);
+   glGetFloati_v(target, index, data);
+}
+static void APIENTRY lazy_glGetDoublei_v(GLenum target, GLuint index, GLdouble *data)
+{
+   LAZY(GetDoublei_v);
+   glGetDoublei_v(target, index, data);
+}
+static GLsync APIENTRY lazy_glCreateSyncFromCLeventARB(struct _cl_context * context, struct _cl_event * event, GLbitfield flags)
+{
+   LAZY(CreateSyncFromCLeventARB);
+   return glCreateSyncFromCLeventARB(context, event, flags);
+}
+static void APIENTRY lazy_glDebugMessageControlARB(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled)
+{
+   LAZY(DebugMessageControlARB);
+   glDebugMessageControlARB(source, type, severity, count, ids, enabled);
+}
+static void APIENTRY lazy_glDebugMessageInsertARB(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf)
+{
+   LAZY(DebugMessageInsertARB);
+   glDebugMessageInsertARB(source, type, id, severity, length, buf);
+}
+static void APIENTRY lazy_glDebugMessageCallbackARB(RGLGENGLDEBUGPROCARB callback, const GLvoid *userParam)
+{
+   LAZY(DebugMessageCallbackARB);
+   glDebugMessageCallbackARB(callback, userParam);
+}
+static GLuint APIENTRY lazy_glGetDebugMessageLogARB(GLuint count, GLsizei bufsize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog)
+{
+   LAZY(GetDebugMessageLogARB);
+   return glGetDebugMessageLogARB(count, bufsize, sources, types, ids, severities, lengths, messageLog);
+}
+static GLenum APIENTRY lazy_glGetGraphicsResetStatusARB(void)
+{
+   LAZY(GetGraphicsResetStatusARB);
+   return glGetGraphicsResetStatusARB();
+}
+static void APIENTRY lazy_glGetnMapdvARB(GLenum target, GLenum query, GLsizei bufSize, GLdouble *v)
+{
+   LAZY(GetnMapdvARB);
+   glGetnMapdvARB(target, query, bufSize, v);
+}
+static void APIENTRY lazy_glGetnMapfvARB(GLenum target, GLenum query, GLsizei bufSize, GLfloat *v)
+{
+   LAZY(GetnMapfvARB);
+   glGetnMapfvARB(target, query, bufSize, v);
+}
+static void APIENTRY lazy_glGetnMapivARB(GLenum target, GLenum query, GLsizei bufSize, GLint *v)
+{
+   LAZY(GetnMapivARB);
+   glGetnMapivARB(target, query, bufSize, v);
+}
+static void APIENTRY lazy_glGetnPixelMapfvARB(GLenum map, GLsizei bufSize, GLfloat *values)
+{
+   LAZY(GetnPixelMapfvARB);
+   glGetnPixelMapfvARB(map, bufSize, values);
+}
+static void APIENTRY lazy_glGetnPixelMapuivARB(GLenum map, GLsizei bufSize, GLuint *values)
+{
+   LAZY(GetnPixelMapuivARB);
+   glGetnPixelMapuivARB(map, bufSize, values);
+}
+static void APIENTRY lazy_glGetnPixelMapusvARB(GLenum map, GLsizei bufSize, GLushort *values)
+{
+   LAZY(GetnPixelMapusvARB);
+   glGetnPixelMapusvARB(map, bufSize, values);
+}
+static void APIENTRY lazy_glGetnPolygonStippleARB(GLsizei bufSize, GLubyte *pattern)
+{
+   LAZY(GetnPolygonStippleARB);
+   glGetnPolygonStippleARB(bufSize, pattern);
+}
+static void APIENTRY lazy_glGetnColorTableARB(GLenum target, GLenum format, GLenum type, GLsizei bufSize, GLvoid *table)
+{
+   LAZY(GetnColorTableARB);
+   glGetnColorTableARB(target, format, type, bufSize, table);
+}
+static void APIENTRY lazy_glGetnConvolutionFilterARB(GLenum target, GLenum format, GLenum type, GLsizei bufSize, GLvoid *image)
+{
+   LAZY(GetnConvolutionFilterARB);
+   glGetnConvolutionFilterARB(target, format, type, bufSize, image);
+}
+static void APIENTRY lazy_glGetnSeparableFilterARB(GLenum target, GLenum format, GLenum type, GLsizei rowBufSize, GLvoid *row, GLsizei columnBufSize, GLvoid *column, GLvoid *span)
+{
+   LAZY(GetnSeparableFilterARB);
+   glGetnSeparableFilterARB(target, format, type, rowBufSize, row, columnBufSize, column, span);
+}
+static void APIENTRY lazy_glGetnHistogramARB(GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, GLvoid *values)
+{
+   LAZY(GetnHistogramARB);
+   glGetnHistogramARB(target, reset, format, type, bufSize, values);
+}
+static void APIENTRY lazy_glGetnMinmaxARB(GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, GLvoid *values)
+{
+   LAZY(GetnMinmaxARB);
+   glGetnMinmaxARB(target, reset, format, type, bufSize, values);
+}
+static void APIENTRY lazy_glGetnTexImageARB(GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, GLvoid *img)
+{
+   LAZY(GetnTexImageARB);
+   glGetnTexImageARB(target, level, format, type, bufSize, img);
+}
+static void APIENTRY lazy_glReadnPixelsARB(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, GLvoid *data)
+{
+   LAZY(ReadnPixelsARB);
+   glReadnPixelsARB(x, y, width, height, format, type, bufSize, data);
+}
+static void APIENTRY lazy_glGetnCompressedTexImageARB(GLenum target, GLint lod, GLsizei bufSize, GLvoid *img)
+{
+   LAZY(GetnCompressedTexImageARB);
+   glGetnCompressedTexImageARB(target, lod, bufSize, img);
+}
+static void APIENTRY lazy_glGetnUniformfvARB(GLuint program, GLint location, GLsizei bufSize, GLfloat *params)
+{
+   LAZY(GetnUniformfvARB);
+   glGetnUniformfvARB(program, location, bufSize, params);
+}
+static void APIENTRY lazy_glGetnUniformivARB(GLuint program, GLint location, GLsizei bufSize, GLint *params)
+{
+   LAZY(GetnUniformivARB);
+   glGetnUniformivARB(program, location, bufSize, params);
+}
+static void APIENTRY lazy_glGetnUniformuivARB(GLuint program, GLint location, GLsizei bufSize, GLuint *params)
+{
+   LAZY(GetnUniformuivARB);
+   glGetnUniformuivARB(program, location, bufSize, params);
+}
+static void APIENTRY lazy_glGetnUniformdvARB(GLuint program, GLint location, GLsizei bufSize, GLdouble *params)
+{
+   LAZY(GetnUniformdvARB);
+   glGetnUniformdvARB(program, location, bufSize, params);
+}
+static void APIENTRY lazy_glDrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance)
+{
+   LAZY(DrawArraysInstancedBaseInstance);
+   glDrawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
+}
+static void APIENTRY lazy_glDrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance)
+{
+   LAZY(DrawElementsInstancedBaseInstance);
+   glDrawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance);
+}
+static void APIENTRY lazy_glDrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance)
+{
+   LAZY(DrawElementsInstancedBaseVertexBaseInstance);
+   glDrawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance);
+}
+static void APIENTRY lazy_glDrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsizei instancecount)
+{
+   LAZY(DrawTransformFeedbackInstanced);
+   glDrawTransformFeedbackInstanced(mode, id, instancecount);
+}
+static void APIENTRY lazy_glDrawTransformFeedbackStreamInstanced(GLenum mode, GLuint id, GLuint stream, GLsizei instancecount)
+{
+   LAZY(DrawTransformFeedbackStreamInstanced);
+   glDrawTransformFeedbackStreamInstanced(mode, id, stream, instancecount);
+}
+static void APIENTRY lazy_glGetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint *params)
+{
+   LAZY(GetInternalformativ);
+   glGetInternalformativ(target, internalformat, pname, bufSize, params);
+}
+static void APIENTRY lazy_glGetActiveAtomicCounterBufferiv(GLuint program, GLuint bufferIndex, GLenum pname, GLint *params)
+{
+   LAZY(GetActiveAtomicCounterBufferiv);
+   glGetActiveAtomicCounterBufferiv(program, bufferIndex, pname, params);
+}
+static void APIENTRY lazy_glBindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format)
+{
+   LAZY(BindImageTexture);
+   glBindImageTexture(unit, texture, level, layered, layer, access, format);
+}
+static void APIENTRY lazy_glMemoryBarrier(GLbitfield barriers)
+{
+   LAZY(MemoryBarrier);
+   glMemoryBarrier(barriers);
+}
+static void APIENTRY lazy_glTexStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width)
+{
+   LAZY(TexStorage1D);
+   glTexStorage1D(target, levels, internalformat, width);
+}
+static void APIENTRY lazy_glTexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
+{
+   LAZY(TexStorage2D);
+   glTexStorage2D(target, levels, internalformat, width, height);
+}
+static void APIENTRY lazy_glTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
+{
+   LAZY(TexStorage3D);
+   glTexStorage3D(target, levels, internalformat, width, height, depth);
+}
+static void APIENTRY lazy_glDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled)
+{
+   LAZY(DebugMessageControl);
+   glDebugMessageControl(source, type, severity, count, ids, enabled);
+}
+static void APIENTRY lazy_glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf)
+{
+   LAZY(DebugMessageInsert);
+   glDebugMessageInsert(source, type, id, severity, length, buf);
+}
+static void APIENTRY lazy_glDebugMessageCallback(RGLGENGLDEBUGPROC callback, const void *userParam)
+{
+   LAZY(DebugMessageCallback);
+   glDebugMessageCallback(callback, userParam);
+}
+static GLuint APIENTRY lazy_glGetDebugMessageLog(GLuint count, GLsizei bufsize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog)
+{
+   LAZY(GetDebugMessageLog);
+   return glGetDebugMessageLog(count, bufsize, sources, types, ids, severities, lengths, messageLog);
+}
+static void APIENTRY lazy_glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar *message)
+{
+   LAZY(PushDebugGroup);
+   glPushDebugGroup(source, id, length, message);
+}
+static void APIENTRY lazy_glPopDebugGroup(void)
+{
+   LAZY(PopDebugGroup);
+   glPopDebugGroup();
+}
+static void APIENTRY lazy_glObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar *label)
+{
+   LAZY(ObjectLabel);
+   glObjectLabel(identifier, name, length, label);
+}
+static void APIENTRY lazy_glGetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label)
+{
+   LAZY(GetObjectLabel);
+   glGetObjectLabel(identifier, name, bufSize, length, label);
+}
+static void APIENTRY lazy_glObjectPtrLabel(const void *ptr, GLsizei length, const GLchar *label)
+{
+   LAZY(ObjectPtrLabel);
+   glObjectPtrLabel(ptr, length, label);
+}
+static void APIENTRY lazy_glGetObjectPtrLabel(const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label)
+{
+   LAZY(GetObjectPtrLabel);
+   glGetObjectPtrLabel(ptr, bufSize, length, label);
+}
+static void APIENTRY lazy_glClearBufferData(GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data)
+{
+   LAZY(ClearBufferData);
+   glClearBufferData(target, internalformat, format, type, data);
+}
+static void APIENTRY lazy_glClearBufferSubData(GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data)
+{
+   LAZY(ClearBufferSubData);
+   glClearBufferSubData(target, internalformat, offset, size, format, type, data);
+}
+static void APIENTRY lazy_glDispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z)
+{
+   LAZY(DispatchCompute);
+   glDispatchCompute(num_groups_x, num_groups_y, num_groups_z);
+}
+static void APIENTRY lazy_glDispatchComputeIndirect(GLintptr indirect)
+{
+   LAZY(DispatchComputeIndirect);
+   glDispatchComputeIndirect(indirect);
+}
+static void APIENTRY lazy_glCopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth)
+{
+   LAZY(CopyImageSubData);
+   glCopyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+}
+static void APIENTRY lazy_glTextureView(GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers)
+{
+   LAZY(TextureView);
+   glTextureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+}
+static void APIENTRY lazy_glBindVertexBuffer(GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride)
+{
+   LAZY(BindVertexBuffer);
+   glBindVertexBuffer(bindingindex, buffer, offset, stride);
+}
+static void APIENTRY lazy_glVertexAttribFormat(GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset)
+{
+   LAZY(VertexAttribFormat);
+   glVertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
+}
+static void APIENTRY lazy_glVertexAttribIFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+   LAZY(VertexAttribIFormat);
+   glVertexAttribIFormat(attribindex, size, type, relativeoffset);
+}
+static void APIENTRY lazy_glVertexAttribLFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+   LAZY(VertexAttribLFormat);
+   glVertexAttribLFormat(attribindex, size, type, relativeoffset);
+}
+static void APIENTRY lazy_glVertexAttribBinding(GLuint attribindex, GLuint bindingindex)
+{
+   LAZY(VertexAttribBinding);
+   glVertexAttribBinding(attribindex, bindingindex);
+}
+static void APIENTRY lazy_glVertexBindingDivisor(GLuint bindingindex, GLuint divisor)
+{
+   LAZY(VertexBindingDivisor);
+   glVertexBindingDivisor(bindingindex, divisor);
+}
+static void APIENTRY lazy_glFramebufferParameteri(GLenum target, GLenum pname, GLint param)
+{
+   LAZY(FramebufferParameteri);
+   glFramebufferParameteri(target, pname, param);
+}
+static void APIENTRY lazy_glGetFramebufferParameteriv(GLenum target, GLenum pname, GLint *params)
+{
+   LAZY(GetFramebufferParameteriv);
+   glGetFramebufferParameteriv(target, pname, params);
+}
+static void APIENTRY lazy_glGetInternalformati64v(GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint64 *params)
+{
+   LAZY(GetInternalformati64v);
+   glGetInternalformati64v(target, internalformat, pname, bufSize, params);
+}
+static void APIENTRY lazy_glInvalidateTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth)
+{
+   LAZY(InvalidateTexSubImage);
+   glInvalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth);
+}
+static void APIENTRY lazy_glInvalidateTexImage(GLuint texture, GLint level)
+{
+   LAZY(InvalidateTexImage);
+   glInvalidateTexImage(texture, level);
+}
+static void APIENTRY lazy_glInvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr length)
+{
+   LAZY(InvalidateBufferSubData);
+   glInvalidateBufferSubData(buffer, offset, length);
+}
+static void APIENTRY lazy_glInvalidateBufferData(GLuint buffer)
+{
+   LAZY(InvalidateBufferData);
+   glInvalidateBufferData(buffer);
+}
+static void APIENTRY lazy_glInvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments)
+{
+   LAZY(InvalidateFramebuffer);
+   glInvalidateFramebuffer(target, numAttachments, attachments);
+}
+static void APIENTRY lazy_glInvalidateSubFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+   LAZY(InvalidateSubFramebuffer);
+   glInvalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
+}
+static void APIENTRY lazy_glMultiDrawArraysIndirect(GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride)
+{
+   LAZY(MultiDrawArraysIndirect);
+   glMultiDrawArraysIndirect(mode, indirect, drawcount, stride);
+}
+static void APIENTRY lazy_glMultiDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride)
+{
+   LAZY(MultiDrawElementsIndirect);
+   glMultiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
+}
+static void APIENTRY lazy_glGetProgramInterfaceiv(GLuint program, GLenum programInterface, GLenum pname, GLint *params)
+{
+   LAZY(GetProgramInterfaceiv);
+   glGetProgramInterfaceiv(program, programInterface, pname, params);
+}
+static GLuint APIENTRY lazy_glGetProgramResourceIndex(GLuint program, GLenum programInterface, const GLchar *name)
+{
+   LAZY(GetProgramResourceIndex);
+   return glGetProgramResourceIndex(program, programInterface, name);
+}
+static void APIENTRY lazy_glGetProgramResourceName(GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name)
+{
+   LAZY(GetProgramResourceName);
+   glGetProgramResourceName(program, programInterface, index, bufSize, length, name);
+}
+static void APIENTRY lazy_glGetProgramResourceiv(GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei bufSize, GLsizei *length, GLint *params)
+{
+   LAZY(GetProgramResourceiv);
+   glGetProgramResourceiv(program, programInterface, index, propCount, props, bufSize, length, params);
+}
+static GLint APIENTRY lazy_glGetProgramResourceLocation(GLuint program, GLenum programInterface, const GLchar *name)
+{
+   LAZY(GetProgramResourceLocation);
+   return glGetProgramResourceLocation(program, programInterface, name);
+}
+static GLint APIENTRY lazy_glGetProgramResourceLocationIndex(GLuint program, GLenum programInterface, const GLchar *name)
+{
+   LAZY(GetProgramResourceLocationIndex);
+   return glGetProgramResourceLocationIndex(program, programInterface, name);
+}
+static void APIENTRY lazy_glShaderStorageBlockBinding(GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding)
+{
+   LAZY(ShaderStorageBlockBinding);
+   glShaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding);
+}
+static void APIENTRY lazy_glTexBufferRange(GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+   LAZY(TexBufferRange);
+   glTexBufferRange(target, internalformat, buffer, offset, size);
+}
+static void APIENTRY lazy_glTexStorage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+{
+   LAZY(TexStorage2DMultisample);
+   glTexStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+static void APIENTRY lazy_glTexStorage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+   LAZY(TexStorage3DMultisample);
+   glTexStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+static void APIENTRY lazy_glImageTransformParameteriHP(GLenum target, GLenum pname, GLint param)
+{
+   LAZY(ImageTransformParameteriHP);
+   glImageTransformParameteriHP(target, pname, param);
+}
+static void APIENTRY lazy_glImageTransformParameterfHP(GLenum target, GLenum pname, GLfloat param)
+{
+   LAZY(ImageTransformParameterfHP);
+   glImageTransformParameterfHP(target, pname, param);
+}
+static void APIENTRY lazy_glImageTransformParameterivHP(GLenum target, GLenum pname, const GLint *params)
+{
+   LAZY(ImageTransformParameterivHP);
+   glImageTransformParameterivHP(target, pname, params);
+}
+static void APIENTRY lazy_glImageTransformParameterfvHP(GLenum target, GLenum pname, const GLfloat *params)
+{
+   LAZY(ImageTransformParameterfvHP);
+   glImageTransformParameterfvHP(target, pname, params);
+}
+static void APIENTRY lazy_glGetImageTransformParameterivHP(GLenum target, GLenum pname, GLint *params)
+{
+   LAZY(GetImageTransformParameterivHP);
+   glGetImageTransformParameterivHP(target, pname, params);
+}
+static void APIENTRY lazy_glGetImageTransformParameterfvHP(GLenum target, GLenum pname, GLfloat *params)
+{
+   LAZY(GetImageTransformParameterfvHP);
+   glGetImageTransformParameterfvHP(target, pname, params);
+}
+static void APIENTRY lazy_glMultiTexCoord1bOES(GLenum texture, GLbyte s)
+{
+   LAZY(MultiTexCoord1bOES);
+   glMultiTexCoord1bOES(texture, s);
+}
+static void APIENTRY lazy_glMultiTexCoord1bvOES(GLenum texture, const GLbyte *coords)
+{
+   LAZY(MultiTexCoord1bvOES);
+   glMultiTexCoord1bvOES(texture, coords);
+}
+static void APIENTRY lazy_glMultiTexCoord2bOES(GLenum texture, GLbyte s, GLbyte t)
+{
+   LAZY(MultiTexCoord2bOES);
+   glMultiTexCoord2bOES(texture, s, t);
+}
+static void APIENTRY lazy_glMultiTexCoord2bvOES(GLenum texture, const GLbyte *coords)
+{
+   LAZY(MultiTexCoord2bvOES);
+   glMultiTexCoord2bvOES(texture, coords);
+}
+static void APIENTRY lazy_glMultiTexCoord3bOES(GLenum texture, GLbyte s, GLbyte t, GLbyte r)
+{
+   LAZY(MultiTexCoord3bOES);
+   glMultiTexCoord3bOES(texture, s, t, r);
+}
+static void APIENTRY lazy_glMultiTexCoord3bvOES(GLenum texture, const GLbyte *coords)
+{
+   LAZY(MultiTexCoord3bvOES);
+   glMultiTexCoord3bvOES(texture, coords);
+}
+static void APIENTRY lazy_glMultiTexCoord4bOES(GLenum texture, GLbyte s, GLbyte t, GLbyte r, GLbyte q)
+{
+   LAZY(MultiTexCoord4bOES);
+   glMultiTexCoord4bOES(texture, s, t, r, q);
+}
+static void APIENTRY lazy_glMultiTexCoord4bvOES(GLenum texture, const GLbyte *coords)
+{
+   LAZY(MultiTexCoord4bvOES);
+   glMultiTexCoord4bvOES(texture, coords);
+}
+static void APIENTRY lazy_glTexCoord1bOES(GLbyte s)
+{
+   LAZY(TexCoord1bOES);
+   glTexCoord1bOES(s);
+}
+static void APIENTRY lazy_glTexCoord1bvOES(const GLbyte *coords)
+{
+   LAZY(TexCoord1bvOES);
+   glTexCoord1bvOES(coords);
+}
+static void APIENTRY lazy_glTexCoord2bOES(GLbyte s, GLbyte t)
+{
+   LAZY(TexCoord2bOES);
+   glTexCoord2bOES(s, t);
+}
+static void APIENTRY lazy_glTexCoord2bvOES(const GLbyte *coords)
+{
+   LAZY(TexCoord2bvOES);
+   glTexCoord2bvOES(coords);
+}
+static void APIENTRY lazy_glTexCoord3bOES(GLbyte s, GLbyte t, GLbyte r)
+{
+   LAZY(TexCoord3bOES);
+   glTexCoord3bOES(s, t, r);
+}
+static void APIENTRY lazy_glTexCoord3bvOES(const GLbyte *coords)
+{
+   LAZY(TexCoord3bvOES);
+   glTexCoord3bvOES(coords);
+}
+static void APIENTRY lazy_glTexCoord4bOES(GLbyte s, GLbyte t, GLbyte r, GLbyte q)
+{
+   LAZY(TexCoord4bOES);
+   glTexCoord4bOES(s, t, r, q);
+}
+static void APIENTRY lazy_glTexCoord4bvOES(const GLbyte *coords)
+{
+   LAZY(TexCoord4bvOES);
+   glTexCoord4bvOES(coords);
+}
+static void APIENTRY lazy_glVertex2bOES(GLbyte x)
+{
+   LAZY(Vertex2bOES);
+   glVertex2bOES(x);
+}
+static void APIENTRY lazy_glVertex2bvOES(const GLbyte *coords)
+{
+   LAZY(Vertex2bvOES);
+   glVertex2bvOES(coords);
+}
+static void APIENTRY lazy_glVertex3bOES(GLbyte x, GLbyte y)
+{
+   LAZY(Vertex3bOES);
+   glVertex3bOES(x, y);
+}
+static void APIENTRY lazy_glVertex3bvOES(const GLbyte *coords)
+{
+   LAZY(Vertex3bvOES);
+   glVertex3bvOES(coords);
+}
+static void APIENTRY lazy_glVertex4bOES(GLbyte x, GLbyte y, GLbyte z)
+{
+   LAZY(Vertex4bOES);
+   glVertex4bOES(x, y, z);
+}
+static void APIENTRY lazy_glVertex4bvOES(const GLbyte *coords)
+{
+   LAZY(Vertex4bvOES);
+   glVertex4bvOES(coords);
+}
+static void APIENTRY lazy_glAccumxOES(GLenum op, GLfixed value)
+{
+   LAZY(AccumxOES);
+   glAccumxOES(op, value);
+}
+static void APIENTRY lazy_glAlphaFuncxOES(GLenum func, GLfixed ref)
+{
+   LAZY(AlphaFuncxOES);
+   glAlphaFuncxOES(func, ref);
+}
+static void APIENTRY lazy_glBitmapxOES(GLsizei width, GLsizei height, GLfixed xorig, GLfixed yorig, GLfixed xmove, GLfixed ymove, const GLubyte *bitmap)
+{
+   LAZY(BitmapxOES);
+   glBitmapxOES(width, height, xorig, yorig, xmove, ymove, bitmap);
+}
+static void APIENTRY lazy_glBlendColorxOES(GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha)
+{
+   LAZY(BlendColorxOES);
+   glBlendColorxOES(red, green, blue, alpha);
+}
+static void APIENTRY lazy_glClearAccumxOES(GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha)
+{
+   LAZY(ClearAccumxOES);
+   glClearAccumxOES(red, green, blue, alpha);
+}
+static void APIENTRY lazy_glClearColorxOES(GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha)
+{
+   LAZY(ClearColorxOES);
+   glClearColorxOES(red, green, blue, alpha);
+}
+static void APIENTRY lazy_glClearDepthxOES(GLfixed depth)
+{
+   LAZY(ClearDepthxOES);
+   glClearDepthxOES(depth);
+}
+static void APIENTRY lazy_glClipPlanexOES(GLenum plane, const GLfixed *equation)
+{
+   LAZY(ClipPlanexOES);
+   glClipPlanexOES(plane, equation);
+}
+static void APIENTRY lazy_glColor3xOES(GLfixed red, GLfixed green, GLfixed blue)
+{
+   LAZY(Color3xOES);
+   glColor3xOES(red, green, blue);
+}
+static void APIENTRY lazy_glColor4xOES(GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha)
+{
+   LAZY(Color4xOES);
+   glColor4xOES(red, green, blue, alpha);
+}
+static void APIENTRY lazy_glColor3xvOES(const GLfixed *components)
+{
+   LAZY(Color3xvOES);
+   glColor3xvOES(components);
+}
+static void APIENTRY lazy_glColor4xvOES(const GLfixed *components)
+{
+   LAZY(Color4xvOES);
+   glColor4xvOES(components);
+}
+static void APIENTRY lazy_glConvolutionParameterxOES(GLenum target, GLenum pname, GLfixed param)
+{
+   LAZY(ConvolutionParameterxOES);
+   glConvolutionParameterxOES(target, pname, param);
+}
+static void APIENTRY lazy_glConvolutionParameterxvOES(GLenum target, GLenum pname, const GLfixed *params)
+{
+   LAZY(ConvolutionParameterxvOES);
+   glConvolutionParameterxvOES(target, pname, params);
+}
+static void APIENTRY lazy_glDepthRangexOES(GLfixed n, GLfixed f)
+{
+   LAZY(DepthRangexOES);
+   glDepthRangexOES(n, f);
+}
+static void APIENTRY lazy_glEvalCoord1xOES(GLfixed u)
+{
+   LAZY(EvalCoord1xOES);
+   glEvalCoord1xOES(u);
+}
+static void APIENTRY lazy_glEvalCoord2xOES(GLfixed u, GLfixed v)
+{
+   LAZY(EvalCoord2xOES);
+   glEvalCoord2xOES(u, v);
+}
+static void APIENTRY lazy_glEvalCoord1xvOES(const GLfixed *coords)
+{
+   LAZY(EvalCoord1xvOES);
+   glEvalCoord1xvOES(coords);
+}
+static void APIENTRY lazy_glEvalCoord2xvOES(const GLfixed *coords)
+{
+   LAZY(EvalCoord2xvOES);
+   glEvalCoord2xvOES(coords);
+}
+static void APIENTRY lazy_glFeedbackBufferxOES(GLsizei n, GLenum type, const GLfixed *buffer)
+{
+   LAZY(FeedbackBufferxOES);
+   glFeedbackBufferxOES(n, type, buffer);
+}
+static void APIENTRY lazy_glFogxOES(GLenum pname, GLfixed param)
+{
+   LAZY(FogxOES);
+   glFogxOES(pname, param);
+}
+static void APIENTRY lazy_glFogxvOES(GLenum pname, const GLfixed *param)
+{
+   LAZY(FogxvOES);
+   glFogxvOES(pname, param);
+}
+static void APIENTRY lazy_glFrustumxOES(GLfixed l, GLfixed r, GLfixed b, GLfixed t, GLfixed n, GLfixed f)
+{
+   LAZY(FrustumxOES);
+   glFrustumxOES(l, r, b, t, n, f);
+}
+static void APIENTRY lazy_glGetClipPlanexOES(GLenum plane, GLfixed *equation)
+{
+   LAZY(GetClipPlanexOES);
+   glGetClipPlanexOES(plane, equation);
+}
+static void APIENTRY lazy_glGetConvolutionParameterxvOES(GLenum target, GLenum pname, GLfixed *params)
+{
+   LAZY(GetConvolutionParameterxvOES);
+   glGetConvolutionParameterxvOES(target, pname, params);
+}
+static void APIENTRY lazy_glGetFixedvOES(GLenum pname, GLfixed *params)
+{
+   LAZY(GetFixedvOES);
+   glGetFixedvOES(pname, params);
+}
+static void APIENTRY lazy_glGetHistogramParameterxvOES(GLenum target, GLenum pname, GLfixed *params)
+{
+   LAZY(GetHistogramParameterxvOES);
+   glGetHistogramParameterxvOES(target, pname, params);
+}
+static void APIENTRY lazy_glGetLightxOES(GLenum light, GLenum pname, GLfixed *params)
+{
+   LAZY(GetLightxOES);
+   glGetLightxOES(light, pname, params);
+}
+static void APIENTRY lazy_glGetMapxvOES(GLenum target, GLenum query, GLfixed *v)
+{
+   LAZY(GetMapxvOES);
+   glGetMapxvOES(target, query, v);
+}
+static void APIENTRY lazy_glGetMaterialxOES(GLenum face, GLenum pname, GLfixed param)
+{
+   LAZY(GetMaterialxOES);
+   glGetMaterialxOES(face, pname, param);
+}
+static void APIENTRY lazy_glGetPixelMapxv(GLenum map, GLint size, GLfixed *values)
+{
+   LAZY(GetPixelMapxv);
+   glGetPixelMapxv(map, size, values);
+}
+static void APIENTRY lazy_glGetTexEnvxvOES(GLenum target, GLenum pname, GLfixed *params)
+{
+   LAZY(GetTexEnvxvOES);
+   glGetTexEnvxvOES(target, pname, params);
+}
+static void APIENTRY lazy_glGetTexGenxvOES(GLenum coord, GLenum pname, GLfixed *params)
+{
+   LAZY(GetTexGenxvOES);
+   glGetTexGenxvOES(coord, pname, params);
+}
+static void APIENTRY lazy_glGetTexLevelParameterxvOES(GLenum target, GLint level, GLenum pname, GLfixed *params)
+{
+   LAZY(GetTexLevelParameterxvOES);
+   glGetTexLevelParameterxvOES(target, level, pname, params);
+}
+static void APIENTRY lazy_glGetTexParameterxvOES(GLenum target, GLenum pname, GLfixed *params)
+{
+   LAZY(GetTexParameterxvOES);
+   glGetTexParameterxvOES(target, pname, params);
+}
+static void APIENTRY lazy_glIndexxOES(GLfixed component)
+{
+   LAZY(IndexxOES);
+   glIndexxOES(component);
+}
+static void APIENTRY lazy_glIndexxvOES(const GLfixed *component)
+{
+   LAZY(IndexxvOES);
+   glIndexxvOES(component);
+}
+static void APIENTRY lazy_glLightModelxOES(GLenum pname, GLfixed param)
+{
+   LAZY(LightModelxOES);
+   glLightModelxOES(pname, param);
+}
+static void APIENTRY lazy_glLightModelxvOES(GLenum pname, const GLfixed *param)
+{
+   LAZY(LightModelxvOES);
+   glLightModelxvOES(pname, param);
+}
+static void APIENTRY lazy_glLightxOES(GLenum light, GLenum pname, GLfixed param)
+{
+   LAZY(LightxOES);
+   glLightxOES(light, pname, param);
+}
+static void APIENTRY lazy_glLightxvOES(GLenum light, GLenum pname, const GLfixed *params)
+{
+   LAZY(LightxvOES);
+   glLightxvOES(light, pname, params);
+}
+static void APIENTRY lazy_glLineWidthxOES(GLfixed width)
+{
+   LAZY(LineWidthxOES);
+   glLineWidthxOES(width);
+}
+static void APIENTRY lazy_glLoadMatrixxOES(const GLfixed *m)
+{
+   LAZY(LoadMatrixxOES);
+   glLoadMatrixxOES(m);
+}
+static void APIENTRY lazy_glLoadTransposeMatrixxOES(const GLfixed *m)
+{
+   LAZY(LoadTransposeMatrixxOES);
+   glLoadTransposeMatrixxOES(m);
+}
+static void APIENTRY lazy_glMap1xOES(GLenum target, GLfixed u1, GLfixed u2, GLint stride, GLint order, GLfixed points)
+{
+   LAZY(Map1xOES);
+   glMap1xOES(target, u1, u2, stride, order, points);
+}
+static void APIENTRY lazy_glMap2xOES(GLenum target, GLfixed u1, GLfixed u2, GLint ustride, GLint uorder, GLfixed v1, GLfixed v2, GLint vstride, GLint vorder, GLfixed points)
+{
+   LAZY(Map2xOES);
+   glMap2xOES(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+}
+static void APIENTRY lazy_glMapGrid1xOES(GLint n, GLfixed u1, GLfixed u2)
+{
+   LAZY(MapGrid1xOES);
+   glMapGrid1xOES(n, u1, u2);
+}
+static void APIENTRY lazy_glMapGrid2xOES(GLint n, GLfixed u1, GLfixed u2, GLfixed v1, GLfixed v2)
+{
+   LAZY(MapGrid2xOES);
+   glMapGrid2xOES(n, u1, u2, v1, v2);
+}
+static void APIENTRY lazy_glMaterialxOES(GLenum face, GLenum pname, GLfixed param)
+{
+   LAZY(MaterialxOES);
+   glMaterialxOES(face, pname, param);
+}
+static void APIENTRY lazy_glMaterialxvOES(GLenum face, GLenum pname, const GLfixed *param)
+{
+   LAZY(MaterialxvOES);
+   glMaterialxvOES(face, pname, param);
+}
+static void APIENTRY lazy_glMultMatrixxOES(const GLfixed *m)
+{
+   LAZY(MultMatrixxOES);
+   glMultMatrixxOES(m);
+}
+static void APIENTRY lazy_glMultTransposeMatrixxOES(const GLfixed *m)
+{
+   LAZY(MultTransposeMatrixxOES);
+   glMultTransposeMatrixxOES(m);
+}
+static void APIENTRY lazy_glMultiTexCoord1xOES(GLenum texture, GLfixed s)
+{
+   LAZY(MultiTexCoord1xOES);
+   glMultiTexCoord1xOES(texture, s);
+}
+static void APIENTRY lazy_glMultiTexCoord2xOES(GLenum texture, GLfixed s, GLfixed t)
+{
+   LAZY(MultiTexCoord2xOES);
+   glMultiTexCoord2xOES(texture, s, t);
+}
+static void APIENTRY lazy_glMultiTexCoord3xOES(GLenum texture, GLfixed s, GLfixed t, GLfixed r)
+{
+   LAZY(MultiTexCoord3xOES);
+   glMultiTexCoord3xOES(texture, s, t, r);
+}
+static void APIENTRY lazy_glMultiTexCoord4xOES(GLenum texture, GLfixed s, GLfixed t, GLfixed r, GLfixed q)
+{
+   LAZY(MultiTexCoord4xOES);
+   glMultiTexCoord4xOES(texture, s, t, r, q);
+}
+static void APIENTRY lazy_glMultiTexCoord1xvOES(GLenum texture, const GLfixed *coords)
+{
+   LAZY(MultiTexCoord1xvOES);
+   glMultiTexCoord1xvOES(texture, coords);
+}
+static void APIENTRY lazy_glMultiTexCoord2xvOES(GLenum texture, const GLfixed *coords)
+{
+   LAZY(MultiTexCoord2xvOES);
+   glMultiTexCoord2xvOES(texture, coords);
+}
+static void APIENTRY lazy_glMultiTexCoord3xvOES(GLenum texture, const GLfixed *coords)
+{
+   LAZY(MultiTexCoord3xvOES);
+   glMultiTexCoord3xvOES(texture, coords);
+}
+static void APIENTRY lazy_glMultiTexCoord4xvOES(GLenum texture, const GLfixed *coords)
+{
+   LAZY(MultiTexCoord4xvOES);
+   glMultiTexCoord4xvOES(texture, coords);
+}
+static void APIENTRY lazy_glNormal3xOES(GLfixed nx, GLfixed ny, GLfixed nz)
+{
+   LAZY(Normal3xOES);
+   glNormal3xOES(nx, ny, nz);
+}
+static void APIENTRY lazy_glNormal3xvOES(const GLfixed *coords)
+{
+   LAZY(Normal3xvOES);
+   glNormal3xvOES(coords);
+}
+static void APIENTRY lazy_glOrthoxOES(GLfixed l, GLfixed r, GLfixed b, GLfixed t, GLfixed n, GLfixed f)
+{
+   LAZY(OrthoxOES);
+   glOrthoxOES(l, r, b, t, n, f);
+}
+static void APIENTRY lazy_glPassThroughxOES(GLfixed token)
+{
+   LAZY(PassThroughxOES);
+   glPassThroughxOES(token);
+}
+static void APIENTRY lazy_glPixelMapx(GLenum map, GLint size, const GLfixed *values)
+{
+   LAZY(PixelMapx);
+   glPixelMapx(map, size, values);
+}
+static void APIENTRY lazy_glPixelStorex(GLenum pname, GLfixed param)
+{
+   LAZY(PixelStorex);
+   glPixelStorex(pname, param);
+}
+static void APIENTRY lazy_glPixelTransferxOES(GLenum pname, GLfixed param)
+{
+   LAZY(PixelTransferxOES);
+   glPixelTransferxOES(pname, param);
+}
+static void APIENTRY lazy_glPixelZoomxOES(GLfixed xfactor, GLfixed yfactor)
+{
+   LAZY(PixelZoomxOES);
+   glPixelZoomxOES(xfactor, yfactor);
+}
+static void APIENTRY lazy_glPointParameterxvOES(GLenum pname, const GLfixed *params)
+{
+   LAZY(PointParameterxvOES);
+   glPointParameterxvOES(pname, params);
+}
+static void APIENTRY lazy_glPointSizexOES(GLfixed size)
+{
+   LAZY(PointSizexOES);
+   glPointSizexOES(size);
+}
+static void APIENTRY lazy_glPolygonOffsetxOES(GLfixed factor, GLfixed units)
+{
+   LAZY(PolygonOffsetxOES);
+   glPolygonOffsetxOES(factor, units);
+}
+static void APIENTRY lazy_glPrioritizeTexturesxOES(GLsizei n, const GLuint *textures, const GLfixed *priorities)
+{
+   LAZY(PrioritizeTexturesxOES);
+   glPrioritizeTexturesxOES(n, textures, priorities);
+}
+static void APIENTRY lazy_glRasterPos2xOES(GLfixed x, GLfixed y)
+{
+   LAZY(RasterPos2xOES);
+   glRasterPos2xOES(x, y);
+}
+static void APIENTRY lazy_glRasterPos3xOES(GLfixed x, GLfixed y, GLfixed z)
+{
+   LAZY(RasterPos3xOES);
+   glRasterPos3xOES(x, y, z);
+}
+static void APIENTRY lazy_glRasterPos4xOES(GLfixed x, GLfixed y, GLfixed z, GLfixed w)
+{
+   LAZY(RasterPos4xOES);
+   glRasterPos4xOES(x, y, z, w);
+}
+static void APIENTRY lazy_glRasterPos2xvOES(const GLfixed *coords)
+{
+   LAZY(RasterPos2xvOES);
+   glRasterPos2xvOES(coords);
+}
+static void APIENTRY lazy_glRasterPos3xvOES(const GLfixed *coords)
+{
+   LAZY(RasterPos3xvOES);
+   glRasterPos3xvOES(coords);
+}
+static void APIENTRY lazy_glRasterPos4xvOES(const GLfixed *coords)
+{
+   LAZY(RasterPos4xvOES);
+   glRasterPos4xvOES(coords);
+}
+static void APIENTRY lazy_glRectxOES(GLfixed x1, GLfixed y1, GLfixed x2, GLfixed y2)
+{
+   LAZY(RectxOES);
+   glRectxOES(x1, y1, x2, y2);
+}
+static void APIENTRY lazy_glRectxvOES(const GLfixed *v1, const GLfixed *v2)
+{
+   LAZY(RectxvOES);
+   glRectxvOES(v1, v2);
+}
+static void APIENTRY lazy_glRotatexOES(GLfixed angle, GLfixed x, GLfixed y, GLfixed z)
+{
+   LAZY(RotatexOES);
+   glRotatexOES(angle, x, y, z);
+}
+static void APIENTRY lazy_glSampleCoverageOES(GLfixed value, GLboolean invert)
+{
+   LAZY(SampleCoverageOES);
+   glSampleCoverageOES(value, invert);
+}
+static void APIENTRY lazy_glScalexOES(GLfixed x, GLfixed y, GLfixed z)
+{
+   LAZY(ScalexOES);
+   glScalexOES(x, y, z);
+}
+static void APIENTRY lazy_glTexCoord1xOES(GLfixed s)
+{
+   LAZY(TexCoord1xOES);
+   glTexCoord1xOES(s);
+}
+static void APIENTRY lazy_glTexCoord2xOES(GLfixed s, GLfixed t)
+{
+   LAZY(TexCoord2xOES);
+   glTexCoord2xOES(s, t);
+}
+static void APIENTRY lazy_glTexCoord3xOES(GLfixed s, GLfixed t, GLfixed r)
+{
+   LAZY(TexCoord3xOES);
+   glTexCoord3xOES(s, t, r);
+}
+static void APIENTRY lazy_glTexCoord4xOES(GLfixed s, GLfixed t, GLfixed r, GLfixed q)
+{
+   LAZY(TexCoord4xOES);
+   glTexCoord4xOES(s, t, r, q);
+}
+static void APIENTRY lazy_glTexCoord1xvOES(const GLfixed *coords)
+{
+   LAZY(TexCoord1xvOES);
+   glTexCoord1xvOES(coords);
+}
+static void APIENTRY lazy_glTexCoord2xvOES(const GLfixed *coords)
+{
+   LAZY(TexCoord2xvOES);
+   glTexCoord2xvOES(coords);
+}
+static void APIENTRY lazy_glTexCoord3xvOES(const GLfixed *coords)
+{
+   LAZY(TexCoord3xvOES);
+   glTexCoord3xvOES(coords);
+}
+static void APIENTRY lazy_glTexCoord4xvOES(const GLfixed *coords)
+{
+   LAZY(TexCoord4xvOES);
+   glTexCoord4xvOES(coords);
+}
+static void APIENTRY lazy_glTexEnvxOES(GLenum target, GLenum pname, GLfixed param)
+{
+   LAZY(TexEnvxOES);
+   glTexEnvxOES(target, pname, param);
+}
+static void APIENTRY lazy_glTexEnvxvOES(GLenum target, GLenum pname, const GLfixed *params)
+{
+   LAZY(TexEnvxvOES);
+   glTexEnvxvOES(target, pname, params);
+}
+static void APIENTRY lazy_glTexGenxOES(GLenum coord, GLenum pname, GLfixed param)
+{
+   LAZY(TexGenxOES);
+   glTexGenxOES(coord, pname, param);
+}
+static void APIENTRY lazy_glTexGenxvOES(GLenum coord, GLenum pname, const GLfixed *params)
+{
+   LAZY(TexGenxvOES);
+   glTexGenxvOES(coord, pname, params);
+}
+static void APIENTRY lazy_glTexParameterxOES(GLenum target, GLenum pname, GLfixed param)
+{
+   LAZY(TexParameterxOES);
+   glTexParameterxOES(target, pname, param);
+}
+static void APIENTRY lazy_glTexParameterxvOES(GLenum target, GLenum pname, const GLfixed *params)
+{
+   LAZY(TexParameterxvOES);
+   glTexParameterxvOES(target, pname, params);
+}
+static void APIENTRY lazy_glTranslatexOES(GLfixed x, GLfixed y, GLfixed z)
+{
+   LAZY(TranslatexOES);
+   glTranslatexOES(x, y, z);
+}
+static void APIENTRY lazy_glVertex2xOES(GLfixed x)
+{
+   LAZY(Vertex2xOES);
+   glVertex2xOES(x);
+}
+static void APIENTRY lazy_glVertex3xOES(GLfixed x, GLfixed y)
+{
+   LAZY(Vertex3xOES);
+   glVertex3xOES(x, y);
+}
+static void APIENTRY lazy_glVertex4xOES(GLfixed x, GLfixed y, GLfixed z)
+{
+   LAZY(Vertex4xOES);
+   glVertex4xOES(x, y, z);
+}
+static void APIENTRY lazy_glVertex2xvOES(const GLfixed *coords)
+{
+   LAZY(Vertex2xvOES);
+   glVertex2xvOES(coords);
+}
+static void APIENTRY lazy_glVertex3xvOES(const GLfixed *coords)
+{
+   LAZY(Vertex3xvOES);
+   glVertex3xvOES(coords);
+}
+static void APIENTRY lazy_glVertex4xvOES(const GLfixed *coords)
+{
+   LAZY(Vertex4xvOES);
+   glVertex4xvOES(coords);
+}
+static void APIENTRY lazy_glDepthRangefOES(GLclampf n, GLclampf f)
+{
+   LAZY(DepthRangefOES);
+   glDepthRangefOES(n, f);
+}
+static void APIENTRY lazy_glFrustumfOES(GLfloat l, GLfloat r, GLfloat b, GLfloat t, GLfloat n, GLfloat f)
+{
+   LAZY(FrustumfOES);
+   glFrustumfOES(l, r, b, t, n, f);
+}
+static void APIENTRY lazy_glOrthofOES(GLfloat l, GLfloat r, GLfloat b, GLfloat t, GLfloat n, GLfloat f)
+{
+   LAZY(OrthofOES);
+   glOrthofOES(l, r, b, t, n, f);
+}
+static void APIENTRY lazy_glClipPlanefOES(GLenum plane, const GLfloat *equation)
+{
+   LAZY(ClipPlanefOES);
+   glClipPlanefOES(plane, equation);
+}
+static void APIENTRY lazy_glClearDepthfOES(GLclampf depth)
+{
+   LAZY(ClearDepthfOES);
+   glClearDepthfOES(depth);
+}
+static void APIENTRY lazy_glGetClipPlanefOES(GLenum plane, GLfloat *equation)
+{
+   LAZY(GetClipPlanefOES);
+   glGetClipPlanefOES(plane, equation);
+}
+static GLbitfield APIENTRY lazy_glQueryMatrixxOES(GLfixed *mantissa, GLint *exponent)
+{
+   LAZY(QueryMatrixxOES);
+   return glQueryMatrixxOES(mantissa, exponent);
+}
+
 const struct rglgen_sym_map rglgen_symbol_map[] = {
     SYM(BlendColor),
     SYM(BlendEquation),
@@ -999,7 +5982,7 @@ const struct rglgen_sym_map rglgen_symbol_map[] = {
     SYM(GetClipPlanefOES),
     SYM(QueryMatrixxOES),
 
-    { NULL, NULL },
+    { NULL, NULL, NULL },
 };
 RGLSYMGLBLENDCOLORPROC __rglgen_glBlendColor;
 RGLSYMGLBLENDEQUATIONPROC __rglgen_glBlendEquation;
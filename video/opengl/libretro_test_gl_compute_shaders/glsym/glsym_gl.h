@@ -3012,7 +3012,7 @@ extern RGLSYMGLCLEARDEPTHFOESPROC __rglgen_glClearDepthfOES;
 extern RGLSYMGLGETCLIPPLANEFOESPROC __rglgen_glGetClipPlanefOES;
 extern RGLSYMGLQUERYMATRIXXOESPROC __rglgen_glQueryMatrixxOES;
 
-struct rglgen_sym_map { const char *sym; void *ptr; };
+struct rglgen_sym_map { const char *sym; void *ptr; rglgen_func_t lazy; };
 extern const struct rglgen_sym_map rglgen_symbol_map[];
 #ifdef __cplusplus
 }
@@ -2,12 +2,25 @@
 #include "glsym.h"
 #include <string.h>
 
+static rglgen_proc_address_t rglgen_proc;
+static unsigned rglgen_resolved;
+
+/* Symbols with a lazy stub are pointed at it and only looked up when
+ * first called, see rglgen_resolve_lazy(). */
 void rglgen_resolve_symbols_custom(rglgen_proc_address_t proc,
       const struct rglgen_sym_map *map)
 {
+   rglgen_proc = proc;
+   rglgen_resolved = 0;
+
    for (; map->sym; map++)
    {
-      rglgen_func_t func = proc(map->sym);
+      rglgen_func_t func = map->lazy;
+      if (!func)
+      {
+         func = proc(map->sym);
+         rglgen_resolved++;
+      }
       memcpy(map->ptr, &func, sizeof(func));
    }
 }
@@ -17,3 +30,15 @@ void rglgen_resolve_symbols(rglgen_proc_address_t proc)
    rglgen_resolve_symbols_custom(proc, rglgen_symbol_map);
 }
 
+void rglgen_resolve_lazy(const char *sym, void *ptr)
+{
+   rglgen_func_t func = rglgen_proc ? rglgen_proc(sym) : NULL;
+   memcpy(ptr, &func, sizeof(func));
+   rglgen_resolved++;
+}
+
+unsigned rglgen_resolved_symbols(void)
+{
+   return rglgen_resolved;
+}
+
@@ -49,6 +49,12 @@ void rglgen_resolve_symbols(rglgen_proc_address_t proc);
 void rglgen_resolve_symbols_custom(rglgen_proc_address_t proc,
       const struct rglgen_sym_map *map);
 
+/* Called by the lazy stubs, patches in the real entry point. */
+void rglgen_resolve_lazy(const char *sym, void *ptr);
+
+/* Entry points looked up since the last rglgen_resolve_symbols(). */
+unsigned rglgen_resolved_symbols(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -2,6 +2,10 @@
 #include "util.hpp"
 #include "global.hpp"
 #include "framebuffer.hpp"
+#include "shader.hpp"
+#include "state_cache.hpp"
+#include "texture_stream.hpp"
+#include "timer.hpp"
 #include <cstring>
 
 using namespace std;
@@ -20,10 +24,27 @@ static Renderbuffer ms_color;
 static Renderbuffer ms_depth_stencil;
 static unsigned multisample;
 
+// Post-process anti-aliasing renders into a single-sampled target (or
+// resolves MSAA into it), runs gl/shaders/fxaa.cs into a second texture
+// and blits that to the frontend.
+static Framebuffer aa_fbo;
+static Texture aa_color;
+static Renderbuffer aa_depth_stencil;
+static Framebuffer aa_result_fbo;
+static Texture aa_result;
+static Shader aa_shader;
+static bool fxaa;
+
+// Splits the frame into the application and the resolve / AA work so the
+// anti-aliasing modes can be compared with timer queries.
+static PassTimer aa_timer;
+enum { AATimerInterval = 600 };
+
 static unsigned width;
 static unsigned height;
 
 static bool use_frame_time_cb;
+static bool shared_context;
 static float frame_delta;
 
 static void init_multisample(unsigned samples, unsigned width, unsigned height)
@@ -38,6 +59,45 @@ static void init_multisample(unsigned samples, unsigned width, unsigned height)
    multisample = samples;
 }
 
+static void init_post_aa(bool enable, unsigned width, unsigned height)
+{
+   fxaa = enable;
+   if (!fxaa)
+      return;
+
+   aa_color.init({Texture::Texture2D, 1, GL_RGBA8, width, height});
+   aa_result.init({Texture::Texture2D, 1, GL_RGBA8, width, height});
+   aa_depth_stencil.init(GL_DEPTH24_STENCIL8, width, height);
+   aa_fbo.set_attachments({{ &aa_color }}, {{ &aa_depth_stencil }});
+   aa_result_fbo.set_attachments({{ &aa_result }}, {});
+   aa_shader.init_compute("gl/shaders/fxaa.cs");
+}
+
+static void run_post_aa()
+{
+   enum { Tile = 16 };
+
+   aa_shader.use();
+   aa_color.bind(0);
+   Sampler::bind(0, Sampler::BilinearClamp);
+   aa_result.bind_image(0, Texture::WriteOnly);
+   glDispatchCompute((width + Tile - 1) / Tile, (height + Tile - 1) / Tile, 1);
+   aa_result.unbind_image(0);
+   Sampler::unbind(0, Sampler::BilinearClamp);
+   aa_color.unbind(0);
+   aa_shader.unbind();
+
+   glMemoryBarrier(GL_FRAMEBUFFER_BARRIER_BIT);
+}
+
+static void update_aa_label()
+{
+   string label = multisample ? "msaa " + to_string(multisample) + "x" : "";
+   if (fxaa)
+      label += label.empty() ? "fxaa" : " + fxaa";
+   aa_timer.set_label(label.empty() ? "no aa" : label);
+}
+
 void retro_init(void)
 {
    if (!app)
@@ -47,6 +107,7 @@ void retro_init(void)
 void retro_deinit(void)
 {
    app.reset();
+   TextureStreamer::get().shutdown();
 }
 
 unsigned retro_api_version(void)
@@ -123,8 +184,23 @@ void retro_set_video_refresh(retro_video_refresh_t cb)
    video_cb = cb;
 }
 
+static void update_options()
+{
+   for (auto& option : app->get_options())
+   {
+      auto name = app->get_application_name_short() + "_" + option.key;
+      retro_variable var = {};
+      var.key = name.c_str();
+
+      if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+         app->option_changed(option.key, var.value);
+   }
+}
+
 static void update_variables()
 {
+   update_options();
+
    auto name = app->get_application_name_short();
    name += "_resolution";
    retro_variable var = {};
@@ -143,6 +219,16 @@ static void update_variables()
 
    app->viewport_changed({width, height});
 
+   name = app->get_application_name_short();
+   name += "_post_aa";
+   var = {};
+   var.key = name.c_str();
+
+   bool post_aa = environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value &&
+      string(var.value) == "fxaa";
+   init_post_aa(post_aa, width, height);
+   log("Post-process anti-aliasing: %s.", post_aa ? "FXAA" : "disabled");
+
    name = app->get_application_name_short();
    name += "_multisample";
    var = {};
@@ -153,6 +239,7 @@ static void update_variables()
 
    unsigned ms = *var.value - '0';
    init_multisample(ms, width, height);
+   update_aa_label();
 
    log("Multisample: %ux.", ms);
 }
@@ -168,9 +255,17 @@ void retro_run(void)
    if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE_UPDATE, &updated) && updated)
       update_variables();
 
+   // Without a shared context the frontend may have touched any GL state
+   // since our last frame.
+   if (!shared_context)
+      StateCache::get().invalidate();
+   StateCache::get().begin_frame();
+
    GLuint fb = hw_render.get_current_framebuffer();
    if (multisample)
       Framebuffer::set_back_buffer(ms_fbo);
+   else if (fxaa)
+      Framebuffer::set_back_buffer(aa_fbo);
    else
       Framebuffer::set_back_buffer(fb);
    Framebuffer::unbind();
@@ -225,14 +320,35 @@ void retro_run(void)
    if (!use_frame_time_cb)
       frame_delta = 1.0f / 60.0f;
 
+   // Uploads before the app renders, so levels finished here are sampled
+   // this frame.
+   TextureStreamer::get().update();
+
+   aa_timer.begin_frame();
    app->run(frame_delta, state);
+   aa_timer.end_pass(0);
 
    if (multisample)
    {
-      ms_fbo.blit(fb, width, height, GL_COLOR_BUFFER_BIT);
+      if (fxaa)
+         ms_fbo.blit(aa_fbo, width, height, GL_COLOR_BUFFER_BIT);
+      else
+         ms_fbo.blit(fb, width, height, GL_COLOR_BUFFER_BIT);
       ms_fbo.invalidate();
    }
 
+   if (fxaa)
+   {
+      run_post_aa();
+      aa_result_fbo.blit(fb, width, height, GL_COLOR_BUFFER_BIT);
+      aa_fbo.invalidate();
+   }
+   aa_timer.end_pass(1);
+
+   // The frontend only sees our bindings without a shared context. With one,
+   // deferred unbinds carry over and are usually elided by the next frame.
+   if (!shared_context)
+      StateCache::get().flush();
    video_cb(RETRO_HW_FRAME_BUFFER_VALID, width, height, 0);
 }
 
@@ -253,7 +369,8 @@ static void context_reset(void)
    rglgen_resolve_symbols(hw_render.get_proc_address);
 
 #ifdef GL_DEBUG
-   if (glDebugMessageCallbackARB)
+   // The symbols are lazy stubs, so ask the frontend whether it is there.
+   if (hw_render.get_proc_address("glDebugMessageCallbackARB"))
    {
       std::cerr << "[OpenGL debug]: Using ARB_debug_output." << std::endl;
       glDebugMessageCallbackARB(debug_cb, nullptr);
@@ -267,6 +384,7 @@ static void context_reset(void)
 
 static void context_destroy(void)
 {
+   log("Resolved %u GL entry points.", rglgen_resolved_symbols());
    ContextManager::get().notify_destroyed();
 }
 
@@ -276,6 +394,7 @@ bool retro_load_game(const struct retro_game_info *info)
 
    auto name = app->get_application_name_short();
    auto ms_name = name + "_multisample";
+   auto post_aa_name = name + "_post_aa";
    name += "_resolution";
 
    string res = "Internal resolution; ";
@@ -284,13 +403,21 @@ bool retro_load_game(const struct retro_game_info *info)
       res += to_string(r.width) + "x" + to_string(r.height) + "|";
    res.resize(res.size() - 1);
 
-   retro_variable variables[] = {
+   vector<retro_variable> variables = {
       { name.c_str(), res.c_str() },
       { ms_name.c_str(), "Multisample; 1x|2x|4x" },
-      { nullptr, nullptr },
+      { post_aa_name.c_str(), "Post-process anti-aliasing; disabled|fxaa" },
    };
 
-   environ_cb(RETRO_ENVIRONMENT_SET_VARIABLES, variables);
+   auto options = app->get_options();
+   vector<string> option_names;
+   for (auto& option : options)
+      option_names.push_back(app->get_application_name_short() + "_" + option.key);
+   for (unsigned i = 0; i < options.size(); i++)
+      variables.push_back({ option_names[i].c_str(), options[i].description.c_str() });
+   variables.push_back({ nullptr, nullptr });
+
+   environ_cb(RETRO_ENVIRONMENT_SET_VARIABLES, variables.data());
 
    enum retro_pixel_format fmt = RETRO_PIXEL_FORMAT_XRGB8888;
    if (!environ_cb(RETRO_ENVIRONMENT_SET_PIXEL_FORMAT, &fmt))
@@ -313,6 +440,11 @@ bool retro_load_game(const struct retro_game_info *info)
    if (!environ_cb(RETRO_ENVIRONMENT_SET_HW_RENDER, &hw_render))
       return false;
 
+   // With a shared context the frontend keeps its GL state apart from ours,
+   // so GL::StateCache can carry bindings from one frame to the next.
+   shared_context = environ_cb(RETRO_ENVIRONMENT_SET_HW_SHARED_CONTEXT, nullptr);
+   log("Shared context: %s.", shared_context ? "yes" : "no");
+
    const char *libretro = nullptr;
    if (!environ_cb(RETRO_ENVIRONMENT_GET_LIBRETRO_PATH, &libretro) || !libretro)
    {
@@ -324,6 +456,7 @@ bool retro_load_game(const struct retro_game_info *info)
    log("Loaded from dir: %s.", libretro);
 
    app->load();
+   aa_timer.init({ "scene", "resolve" }, AATimerInterval);
    update_variables();
 
    struct retro_frame_time_callback cb = { frame_time_cb, 1000000 / 60 };
@@ -349,17 +482,21 @@ bool retro_load_game_special(unsigned, const struct retro_game_info *, size_t)
 
 size_t retro_serialize_size(void)
 {
-   return 0;
+   return app->serialize_size();
 }
 
-bool retro_serialize(void *, size_t)
+bool retro_serialize(void *data, size_t size)
 {
-   return false;
+   // Only a normal savestate may come from an earlier frame. Frontends
+   // without the query only make normal ones.
+   int context = RETRO_SAVESTATE_CONTEXT_NORMAL;
+   environ_cb(RETRO_ENVIRONMENT_GET_SAVESTATE_CONTEXT, &context);
+   return app->serialize(data, size, context != RETRO_SAVESTATE_CONTEXT_NORMAL);
 }
 
-bool retro_unserialize(const void *, size_t)
+bool retro_unserialize(const void *data, size_t size)
 {
-   return false;
+   return app->unserialize(data, size);
 }
 
 void *retro_get_memory_data(unsigned)
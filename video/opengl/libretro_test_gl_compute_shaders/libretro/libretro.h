@@ -564,6 +564,40 @@ enum retro_mod
                                            // as certain platforms cannot use use stderr for logging. It also allows the frontend to
                                            // show logging information in a more suitable way.
                                            // If this interface is not used, libretro cores should log to stderr as desired.
+#define RETRO_ENVIRONMENT_GET_SAVESTATE_CONTEXT (72 | RETRO_ENVIRONMENT_EXPERIMENTAL)
+                                           // int * --
+                                           // Tells the core what kind of savestate is being requested, as one of
+                                           // enum retro_savestate_context. Query it in retro_serialize and retro_unserialize.
+                                           // Frontends which do not support it return false, and the context should be
+                                           // taken as RETRO_SAVESTATE_CONTEXT_NORMAL.
+#define RETRO_ENVIRONMENT_SET_HW_SHARED_CONTEXT (44 | RETRO_ENVIRONMENT_EXPERIMENTAL)
+                                           // N/A (null) * --
+                                           // The frontend will try to use a 'shared' hardware context (mostly applicable
+                                           // to OpenGL) when a hardware context is being set up.
+                                           //
+                                           // Returns true if the frontend supports shared hardware contexts and false
+                                           // if the frontend does not support shared hardware contexts.
+                                           //
+                                           // This will do nothing on its own until SET_HW_RENDER env callbacks are
+                                           // being used.
+
+enum retro_savestate_context
+{
+   // Standard savestate written to disk, or a rewind state.
+   RETRO_SAVESTATE_CONTEXT_NORMAL = 0,
+
+   // Run-ahead in the same instance. The state is loaded again right away
+   // and must be exactly the frame which just ran.
+   RETRO_SAVESTATE_CONTEXT_RUNAHEAD_SAME_INSTANCE = 1,
+
+   // Run-ahead with a second instance of the same binary.
+   RETRO_SAVESTATE_CONTEXT_RUNAHEAD_SAME_BINARY = 2,
+
+   // Netplay rollback, the state may be sent to another machine.
+   RETRO_SAVESTATE_CONTEXT_ROLLBACK_NETPLAY = 3,
+
+   RETRO_SAVESTATE_CONTEXT_UNKNOWN = INT_MAX
+};
 
 enum retro_log_level
 {
@@ -19,7 +19,7 @@ LOCAL_CFLAGS += -DANDROID_MIPS -D__mips__ -D__MIPSEL__
 endif
 
 LOCAL_SRC_FILES    += ../libretro-test.c
-LOCAL_CFLAGS += -O3 -std=gnu99 -ffast-math -funroll-loops
+LOCAL_CFLAGS += -O3 -std=gnu99 -ffast-math -funroll-loops -DHAVE_THREADS
 
 
 include $(BUILD_SHARED_LIBRARY)
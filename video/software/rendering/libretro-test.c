@@ -5,12 +5,37 @@
 #include <string.h>
 #include <math.h>
 
+#ifdef HAVE_THREADS
+#include <pthread.h>
+#endif
+
 #include "libretro.h"
 
+#ifdef RARCH_INTERNAL
+#define TESTSW_CORE_PREFIX(s) libretro_testsw_##s
+#else
+#define TESTSW_CORE_PREFIX(s) s
+#endif
+
+/* Frames rendered by the pipelined worker rotate through this many
+ * buffers, so the one handed to the frontend in the previous call is never
+ * written while the frontend might still be looking at it. */
+#define PIPELINE_BUFFERS 3
+
 static uint32_t *frame_buf;
 static struct retro_log_callback logging;
 static retro_log_printf_t log_cb;
 
+/* Refresh rates we are willing to declare. The frontend's target rate is
+ * snapped to the closest one so odd values like 143.9 Hz still map to 144. */
+static const double refresh_rates[] = { 60.0, 120.0, 144.0, 240.0 };
+static double refresh_rate = 60.0;
+
+/* Checkerboard scroll speed in pixels per second, independent of refresh rate. */
+#define SCROLL_SPEED 60.0f
+static float scroll_pos;
+static retro_usec_t frame_time_usec;
+
 static void fallback_log(enum retro_log_level level, const char *fmt, ...)
 {
    (void)level;
@@ -20,28 +45,31 @@ static void fallback_log(enum retro_log_level level, const char *fmt, ...)
    va_end(va);
 }
 
-void retro_init(void)
+void TESTSW_CORE_PREFIX(retro_init)(void)
 {
-   frame_buf = calloc(320 * 240, sizeof(uint32_t));
+   frame_buf = calloc(PIPELINE_BUFFERS * 320 * 240, sizeof(uint32_t));
 }
 
-void retro_deinit(void)
+static void pipeline_stop(void);
+
+void TESTSW_CORE_PREFIX(retro_deinit)(void)
 {
+   pipeline_stop();
    free(frame_buf);
    frame_buf = NULL;
 }
 
-unsigned retro_api_version(void)
+unsigned TESTSW_CORE_PREFIX(retro_api_version)(void)
 {
    return RETRO_API_VERSION;
 }
 
-void retro_set_controller_port_device(unsigned port, unsigned device)
+void TESTSW_CORE_PREFIX(retro_set_controller_port_device)(unsigned port, unsigned device)
 {
    log_cb(RETRO_LOG_INFO, "Plugging device %u into port %u.\n", device, port);
 }
 
-void retro_get_system_info(struct retro_system_info *info)
+void TESTSW_CORE_PREFIX(retro_get_system_info)(struct retro_system_info *info)
 {
    memset(info, 0, sizeof(*info));
    info->library_name     = "TestCore";
@@ -57,12 +85,12 @@ static retro_environment_t environ_cb;
 static retro_input_poll_t input_poll_cb;
 static retro_input_state_t input_state_cb;
 
-void retro_get_system_av_info(struct retro_system_av_info *info)
+void TESTSW_CORE_PREFIX(retro_get_system_av_info)(struct retro_system_av_info *info)
 {
    float aspect = 4.0f / 3.0f;
 
    info->timing = (struct retro_system_timing) {
-      .fps = 60.0,
+      .fps = refresh_rate,
       .sample_rate = 0.0,
    };
 
@@ -75,10 +103,17 @@ void retro_get_system_av_info(struct retro_system_av_info *info)
    };
 }
 
-void retro_set_environment(retro_environment_t cb)
+void TESTSW_CORE_PREFIX(retro_set_environment)(retro_environment_t cb)
 {
    environ_cb = cb;
 
+   static const struct retro_variable vars[] = {
+      { "rendering_pipelined", "Pipelined rendering (one frame latency); disabled|enabled" },
+      { NULL, NULL },
+   };
+
+   cb(RETRO_ENVIRONMENT_SET_VARIABLES, (void*)vars);
+
    bool no_content = true;
    cb(RETRO_ENVIRONMENT_SET_SUPPORT_NO_GAME, &no_content);
 
@@ -88,27 +123,27 @@ void retro_set_environment(retro_environment_t cb)
       log_cb = fallback_log;
 }
 
-void retro_set_audio_sample(retro_audio_sample_t cb)
+void TESTSW_CORE_PREFIX(retro_set_audio_sample)(retro_audio_sample_t cb)
 {
    audio_cb = cb;
 }
 
-void retro_set_audio_sample_batch(retro_audio_sample_batch_t cb)
+void TESTSW_CORE_PREFIX(retro_set_audio_sample_batch)(retro_audio_sample_batch_t cb)
 {
    audio_batch_cb = cb;
 }
 
-void retro_set_input_poll(retro_input_poll_t cb)
+void TESTSW_CORE_PREFIX(retro_set_input_poll)(retro_input_poll_t cb)
 {
    input_poll_cb = cb;
 }
 
-void retro_set_input_state(retro_input_state_t cb)
+void TESTSW_CORE_PREFIX(retro_set_input_state)(retro_input_state_t cb)
 {
    input_state_cb = cb;
 }
 
-void retro_set_video_refresh(retro_video_refresh_t cb)
+void TESTSW_CORE_PREFIX(retro_set_video_refresh)(retro_video_refresh_t cb)
 {
    video_cb = cb;
 }
@@ -118,10 +153,11 @@ static unsigned y_coord;
 static int mouse_rel_x;
 static int mouse_rel_y;
 
-void retro_reset(void)
+void TESTSW_CORE_PREFIX(retro_reset)(void)
 {
-   x_coord = 0;
-   y_coord = 0;
+   x_coord    = 0;
+   y_coord    = 0;
+   scroll_pos = 0.0f;
 }
 
 static void update_input(void)
@@ -133,33 +169,191 @@ static void update_input(void)
    }
 }
 
-static void render_checkered(void)
+static void update_simulation(void)
+{
+   /* Advance by the time that actually elapsed rather than by a fixed
+    * step per frame, so the scroll speed is the same at any refresh rate. */
+   scroll_pos += SCROLL_SPEED * (float)frame_time_usec / 1000000.0f;
+   if (scroll_pos >= 32.0f)
+      scroll_pos = fmodf(scroll_pos, 32.0f);
+
+   x_coord = (unsigned)scroll_pos & 31;
+}
+
+struct frame_params
+{
+   unsigned x_coord;
+   unsigned y_coord;
+   int mouse_rel_x;
+   int mouse_rel_y;
+};
+
+static void render_checkered(uint32_t *buf, const struct frame_params *params)
 {
-   uint32_t *buf    = frame_buf;
    unsigned stride  = 320;
    uint32_t color_r = 0xff << 16;
    uint32_t color_g = 0xff <<  8;
    uint32_t *line   = buf;
+   uint32_t rows[2][320];
 
-   for (unsigned y = 0; y < 240; y++, line += stride)
+   /* Only two distinct lines exist, build them once and copy them down. */
+   for (unsigned x = 0; x < 320; x++)
    {
-      unsigned index_y = ((y - y_coord) >> 4) & 1;
-      for (unsigned x = 0; x < 320; x++)
-      {
-         unsigned index_x = ((x - x_coord) >> 4) & 1;
-         line[x] = (index_y ^ index_x) ? color_r : color_g;
-      }
+      unsigned index_x = ((x - params->x_coord) >> 4) & 1;
+      rows[0][x] = index_x ? color_r : color_g;
+      rows[1][x] = index_x ? color_g : color_r;
    }
 
-   for (unsigned y = mouse_rel_y - 5; y <= mouse_rel_y + 5; y++)
-      for (unsigned x = mouse_rel_x - 5; x <= mouse_rel_x + 5; x++)
+   for (unsigned y = 0; y < 240; y++, line += stride)
+      memcpy(line, rows[((y - params->y_coord) >> 4) & 1], sizeof(rows[0]));
+
+   for (unsigned y = params->mouse_rel_y - 5; y <= params->mouse_rel_y + 5; y++)
+      for (unsigned x = params->mouse_rel_x - 5; x <= params->mouse_rel_x + 5; x++)
          buf[y * stride + x] = 0xff;
+}
 
-   video_cb(buf, 320, 240, stride << 2);
+/* Pipelined mode: retro_run() hands the parameters of frame N+1 to a worker
+ * thread and presents frame N, which the worker finished during the previous
+ * call. Rendering then overlaps the frontend's own upload and present work,
+ * at the cost of exactly one frame of extra latency. */
+static bool pipelined;
+
+#ifdef HAVE_THREADS
+static pthread_t pipeline_thread;
+static pthread_mutex_t pipeline_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t pipeline_cond  = PTHREAD_COND_INITIALIZER;
+static bool pipeline_running;
+static bool pipeline_quit;
+static bool pipeline_busy;
+static bool pipeline_have_frame;
+static unsigned pipeline_index;
+static struct frame_params pipeline_params;
+
+static void *pipeline_worker(void *data)
+{
+   (void)data;
+
+   pthread_mutex_lock(&pipeline_lock);
+   for (;;)
+   {
+      while (!pipeline_busy && !pipeline_quit)
+         pthread_cond_wait(&pipeline_cond, &pipeline_lock);
+      if (pipeline_quit)
+         break;
+
+      struct frame_params params = pipeline_params;
+      uint32_t *buf = frame_buf + pipeline_index * 320 * 240;
+
+      pthread_mutex_unlock(&pipeline_lock);
+      render_checkered(buf, &params);
+      pthread_mutex_lock(&pipeline_lock);
+
+      pipeline_busy = false;
+      pthread_cond_broadcast(&pipeline_cond);
+   }
+   pthread_mutex_unlock(&pipeline_lock);
+
+   return NULL;
 }
 
+static void pipeline_wait(void)
+{
+   pthread_mutex_lock(&pipeline_lock);
+   while (pipeline_busy)
+      pthread_cond_wait(&pipeline_cond, &pipeline_lock);
+   pthread_mutex_unlock(&pipeline_lock);
+}
+
+static bool pipeline_start(void)
+{
+   if (pipeline_running)
+      return true;
+
+   pipeline_quit       = false;
+   pipeline_busy       = false;
+   pipeline_have_frame = false;
+   pipeline_index      = 0;
+
+   if (pthread_create(&pipeline_thread, NULL, pipeline_worker, NULL) != 0)
+      return false;
+
+   pipeline_running = true;
+   return true;
+}
+
+static void pipeline_stop(void)
+{
+   if (!pipeline_running)
+      return;
+
+   pthread_mutex_lock(&pipeline_lock);
+   pipeline_quit = true;
+   pthread_cond_broadcast(&pipeline_cond);
+   pthread_mutex_unlock(&pipeline_lock);
+
+   pthread_join(pipeline_thread, NULL);
+   pipeline_running = false;
+}
+
+static void render_pipelined(const struct frame_params *params)
+{
+   /* Frame N was submitted last call, it is the one we present now. */
+   pipeline_wait();
+   unsigned done = pipeline_index;
+   bool have_frame = pipeline_have_frame;
+
+   pthread_mutex_lock(&pipeline_lock);
+   pipeline_index      = (pipeline_index + 1) % PIPELINE_BUFFERS;
+   pipeline_params     = *params;
+   pipeline_busy       = true;
+   pipeline_have_frame = true;
+   pthread_cond_broadcast(&pipeline_cond);
+   pthread_mutex_unlock(&pipeline_lock);
+
+   /* Nothing to show yet on the very first frame, wait for this one. */
+   if (!have_frame)
+   {
+      pipeline_wait();
+      done = pipeline_index;
+   }
+
+   video_cb(frame_buf + done * 320 * 240, 320, 240, 320 << 2);
+}
+#else
+static bool pipeline_start(void)
+{
+   return false;
+}
+
+static void pipeline_stop(void)
+{
+}
+
+static void render_pipelined(const struct frame_params *params)
+{
+   (void)params;
+}
+#endif
+
 static void check_variables(void)
 {
+   struct retro_variable var = { .key = "rendering_pipelined" };
+   bool enable = false;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+      enable = !strcmp(var.value, "enabled");
+
+   if (enable && !pipeline_start())
+   {
+      log_cb(RETRO_LOG_WARN, "Pipelined rendering is not available.\n");
+      enable = false;
+   }
+   else if (!enable)
+      pipeline_stop();
+
+   if (enable != pipelined)
+      log_cb(RETRO_LOG_INFO, "Pipelined rendering %s.\n", enable ? "enabled" : "disabled");
+   pipelined = enable;
 }
 
 static void audio_callback(void)
@@ -167,10 +361,19 @@ static void audio_callback(void)
    audio_cb(0, 0);
 }
 
-void retro_run(void)
+void TESTSW_CORE_PREFIX(retro_run)(void)
 {
    update_input();
-   render_checkered();
+   update_simulation();
+
+   struct frame_params params = { x_coord, y_coord, mouse_rel_x, mouse_rel_y };
+   if (pipelined)
+      render_pipelined(&params);
+   else
+   {
+      render_checkered(frame_buf, &params);
+      video_cb(frame_buf, 320, 240, 320 << 2);
+   }
    audio_callback();
 
    bool updated = false;
@@ -178,7 +381,28 @@ void retro_run(void)
       check_variables();
 }
 
-bool retro_load_game(const struct retro_game_info *info)
+static void frame_time_cb(retro_usec_t usec)
+{
+   frame_time_usec = usec;
+}
+
+static void check_refresh_rate(void)
+{
+   float target = 0.0f;
+
+   refresh_rate = 60.0;
+   if (environ_cb(RETRO_ENVIRONMENT_GET_TARGET_REFRESH_RATE, &target) && target > 0.0f)
+   {
+      for (unsigned i = 1; i < sizeof(refresh_rates) / sizeof(refresh_rates[0]); i++)
+         if (fabs(refresh_rates[i] - target) < fabs(refresh_rate - target))
+            refresh_rate = refresh_rates[i];
+   }
+
+   log_cb(RETRO_LOG_INFO, "Target refresh rate %.2f Hz, running at %.0f Hz.\n",
+         target, refresh_rate);
+}
+
+bool TESTSW_CORE_PREFIX(retro_load_game)(const struct retro_game_info *info)
 {
    enum retro_pixel_format fmt = RETRO_PIXEL_FORMAT_XRGB8888;
    if (!environ_cb(RETRO_ENVIRONMENT_SET_PIXEL_FORMAT, &fmt))
@@ -187,47 +411,63 @@ bool retro_load_game(const struct retro_game_info *info)
       return false;
    }
 
+   check_refresh_rate();
+
+   /* Fall back to the nominal frame time if the frontend never calls us. */
+   frame_time_usec = (retro_usec_t)(1000000.0 / refresh_rate);
+
+   struct retro_frame_time_callback frame_cb = { frame_time_cb, frame_time_usec };
+   if (!environ_cb(RETRO_ENVIRONMENT_SET_FRAME_TIME_CALLBACK, &frame_cb))
+      log_cb(RETRO_LOG_INFO, "Frame time callback not supported.\n");
+
    check_variables();
 
    (void)info;
    return true;
 }
 
-void retro_unload_game(void)
+void TESTSW_CORE_PREFIX(retro_unload_game)(void)
 {
+   pipeline_stop();
+   pipelined = false;
 }
 
-unsigned retro_get_region(void)
+unsigned TESTSW_CORE_PREFIX(retro_get_region)(void)
 {
    return RETRO_REGION_NTSC;
 }
 
-bool retro_load_game_special(unsigned type, const struct retro_game_info *info, size_t num)
+bool TESTSW_CORE_PREFIX(retro_load_game_special)(unsigned type, const struct retro_game_info *info, size_t num)
 {
    if (type != 0x200)
       return false;
    if (num != 2)
       return false;
-   return retro_load_game(NULL);
+   return TESTSW_CORE_PREFIX(retro_load_game)(NULL);
 }
 
-size_t retro_serialize_size(void)
+/* The scroll position is saved as well. x_coord is recomputed from it
+ * every frame, and it keeps the sub-pixel part of the scroll. */
+#define STATE_SIZE (2 + sizeof(float))
+
+size_t TESTSW_CORE_PREFIX(retro_serialize_size)(void)
 {
-   return 2;
+   return STATE_SIZE;
 }
 
-bool retro_serialize(void *data_, size_t size)
+bool TESTSW_CORE_PREFIX(retro_serialize)(void *data_, size_t size)
 {
-   if (size < 2)
+   if (size < STATE_SIZE)
       return false;
 
    uint8_t *data = data_;
    data[0] = x_coord;
    data[1] = y_coord;
+   memcpy(data + 2, &scroll_pos, sizeof(scroll_pos));
    return true;
 }
 
-bool retro_unserialize(const void *data_, size_t size)
+bool TESTSW_CORE_PREFIX(retro_unserialize)(const void *data_, size_t size)
 {
    if (size < 2)
       return false;
@@ -235,25 +475,35 @@ bool retro_unserialize(const void *data_, size_t size)
    const uint8_t *data = data_;
    x_coord = data[0] & 31;
    y_coord = data[1] & 31;
+
+   /* States without the scroll position start from the whole pixel. */
+   scroll_pos = (float)x_coord;
+   if (size >= STATE_SIZE)
+   {
+      float pos;
+      memcpy(&pos, data + 2, sizeof(pos));
+      if (pos >= 0.0f && pos < 32.0f && ((unsigned)pos & 31) == x_coord)
+         scroll_pos = pos;
+   }
    return true;
 }
 
-void *retro_get_memory_data(unsigned id)
+void *TESTSW_CORE_PREFIX(retro_get_memory_data)(unsigned id)
 {
    (void)id;
    return NULL;
 }
 
-size_t retro_get_memory_size(unsigned id)
+size_t TESTSW_CORE_PREFIX(retro_get_memory_size)(unsigned id)
 {
    (void)id;
    return 0;
 }
 
-void retro_cheat_reset(void)
+void TESTSW_CORE_PREFIX(retro_cheat_reset)(void)
 {}
 
-void retro_cheat_set(unsigned index, bool enabled, const char *code)
+void TESTSW_CORE_PREFIX(retro_cheat_set)(unsigned index, bool enabled, const char *code)
 {
    (void)index;
    (void)enabled;
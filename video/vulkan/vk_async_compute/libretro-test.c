@@ -6,6 +6,7 @@
 
 #include "vulkan/vulkan_symbol_wrapper.h"
 #include "libretro_vulkan.h"
+#include "render_graph.h"
 
 static struct retro_hw_render_callback hw_render;
 static const struct retro_hw_render_interface_vulkan *vulkan;
@@ -17,12 +18,62 @@ static uint32_t async_queue_index;
 #define BASE_HEIGHT 360
 #define MAX_SYNC 8
 
+/* Must match scene.glsl. */
+#define TILE_SIZE 16
+#define MAX_TILES 1024
+#define TILES_X ((BASE_WIDTH + TILE_SIZE - 1) / TILE_SIZE)
+#define TILES_Y ((BASE_HEIGHT + TILE_SIZE - 1) / TILE_SIZE)
+#define COARSE_WIDTH ((BASE_WIDTH + 1) / 2)
+#define COARSE_HEIGHT ((BASE_HEIGHT + 1) / 2)
+#define TIMING_INTERVAL 600
+
 struct buffer
 {
    VkBuffer buffer;
    VkDeviceMemory memory;
 };
 
+enum march_mode
+{
+   MARCH_ADAPTIVE = 0,
+   MARCH_BRUTE_FORCE,
+   MARCH_COUNT
+};
+
+static const char *march_mode_names[MARCH_COUNT] = {
+   "adaptive",
+   "brute force",
+};
+
+static enum march_mode march_mode;
+static bool march_benchmark;
+
+/* Matches the Frame block in scene.glsl (std140). */
+struct frame_data
+{
+   float origin[4];
+   float right[4];
+   float up[4];
+   float forward[4];
+   float prev_origin[4];
+   float prev_right[4];
+   float prev_up[4];
+   float prev_forward[4];
+   uint32_t size[4];
+   uint32_t mode;
+   uint32_t history_valid;
+   uint32_t padding[2];
+};
+
+/* Header of the Tiles block, copied out for the statistics. */
+struct tile_stats
+{
+   uint32_t refine_count;
+   uint32_t dispatch_y;
+   uint32_t dispatch_z;
+   uint32_t steps;
+};
+
 struct vulkan_data
 {
    unsigned index;
@@ -34,11 +85,15 @@ struct vulkan_data
 
    VkDescriptorSetLayout set_layout;
    VkDescriptorPool desc_pool;
-   VkDescriptorSet desc_set[MAX_SYNC];
+   /* Second index is the frame parity, which picks the distance history
+    * to read and the one to write. */
+   VkDescriptorSet desc_set[MAX_SYNC][2];
 
    VkPipelineCache pipeline_cache;
    VkPipelineLayout pipeline_layout;
-   VkPipeline pipeline;
+   VkPipeline coarse_pipeline;
+   VkPipeline refine_pipeline;
+   VkPipeline upsample_pipeline;
 
    struct retro_vulkan_image images[MAX_SYNC];
    VkDeviceMemory image_memory[MAX_SYNC];
@@ -47,9 +102,49 @@ struct vulkan_data
    VkSemaphore acquire_semaphores[MAX_SYNC];
 
    bool need_acquire[MAX_SYNC];
+
+   /* Only ever used on the compute queue, so one of each is enough.
+    * The coarse image is a transient of the render graph. */
+   VkImage history_images[2];
+   VkDeviceMemory history_memory[2];
+   VkImageView history_views[2];
+   bool history_valid;
+   struct buffer tiles;
+
+   struct buffer ubo[MAX_SYNC];
+   struct buffer stats[MAX_SYNC];
+
+   VkQueryPool query_pool[MAX_SYNC];
+   bool queries_pending[MAX_SYNC];
+   enum march_mode query_mode[MAX_SYNC];
+   bool timestamps;
+   uint64_t timestamp_mask;
+
+   struct render_graph graph;
+   bool graph_dumped;
+   unsigned output;
+   unsigned coarse;
+   unsigned distance;
+   unsigned prev_distance;
+   unsigned tiles_resource;
+   unsigned stats_resource;
+   unsigned coarse_pass;
+   unsigned refine_pass;
+   unsigned brute_force_pass;
 };
 static struct vulkan_data vk;
 
+/* GPU time and work per mode, reported every TIMING_INTERVAL frames. */
+struct timing
+{
+   unsigned frames;
+   double gpu_ms;
+   double steps;
+   double refined_tiles;
+};
+static struct timing timing[MARCH_COUNT];
+static unsigned timing_frames;
+
 void retro_init(void)
 {}
 
@@ -103,8 +198,17 @@ void retro_set_environment(retro_environment_t cb)
 {
    environ_cb = cb;
 
+   struct retro_variable variables[] = {
+      {
+         "testvulkan_async_march",
+         "Raymarching; adaptive|brute force|benchmark",
+      },
+      { NULL, NULL },
+   };
+
    bool no_rom = true;
    cb(RETRO_ENVIRONMENT_SET_SUPPORT_NO_GAME, &no_rom);
+   cb(RETRO_ENVIRONMENT_SET_VARIABLES, variables);
 }
 
 void retro_set_audio_sample(retro_audio_sample_t cb)
@@ -150,88 +254,195 @@ static uint32_t find_memory_type_from_requirements(
    return 0;
 }
 
-static void vulkan_test_render(void)
+static void vec3_normalize(float *v)
 {
-   VkCommandBuffer cmd = vk.cmd[vk.index];
+   float len = sqrtf(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+   if (len > 0.0f)
+   {
+      v[0] /= len;
+      v[1] /= len;
+      v[2] /= len;
+   }
+}
 
-   VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
-   begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
-   vkResetCommandBuffer(cmd, 0);
-   vkBeginCommandBuffer(cmd, &begin_info);
+static void vec3_cross(float *out, const float *a, const float *b)
+{
+   out[0] = a[1] * b[2] - a[2] * b[1];
+   out[1] = a[2] * b[0] - a[0] * b[2];
+   out[2] = a[0] * b[1] - a[1] * b[0];
+}
 
-   VkImageMemoryBarrier prepare_rendering = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
-   prepare_rendering.srcAccessMask = 0;
-   prepare_rendering.dstAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
-   prepare_rendering.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-   prepare_rendering.newLayout = VK_IMAGE_LAYOUT_GENERAL;
+static void update_ubo(void)
+{
+   static struct frame_data prev;
+   struct frame_data data;
+   float time = frame_count / 60.0f;
+   float tan_half_fov = tanf(0.5f * 1.0f);
+
+   memset(&data, 0, sizeof(data));
+
+   /* Circle the middle of the scene, bobbing up and down. */
+   data.origin[0] = 9.0f * cosf(0.15f * time);
+   data.origin[1] = 2.5f + 0.8f * sinf(0.23f * time);
+   data.origin[2] = 9.0f * sinf(0.15f * time);
+   data.origin[3] = time;
+
+   static const float target[3] = { 0.0f, 1.2f, 0.0f };
+   static const float world_up[3] = { 0.0f, 1.0f, 0.0f };
+   for (unsigned i = 0; i < 3; i++)
+      data.forward[i] = target[i] - data.origin[i];
+   vec3_normalize(data.forward);
+   vec3_cross(data.right, data.forward, world_up);
+   vec3_normalize(data.right);
+   vec3_cross(data.up, data.right, data.forward);
+   data.right[3] = tan_half_fov * BASE_WIDTH / BASE_HEIGHT;
+   data.up[3] = tan_half_fov;
+
+   /* The first frame reprojects onto itself, history_valid keeps it
+    * from reading the history anyway. */
+   if (!vk.history_valid)
+      memcpy(&prev, &data, sizeof(prev));
+   memcpy(data.prev_origin, prev.origin, sizeof(data.prev_origin));
+   memcpy(data.prev_right, prev.right, sizeof(data.prev_right));
+   memcpy(data.prev_up, prev.up, sizeof(data.prev_up));
+   memcpy(data.prev_forward, prev.forward, sizeof(data.prev_forward));
+   memcpy(&prev, &data, sizeof(prev));
+
+   data.size[0] = BASE_WIDTH;
+   data.size[1] = BASE_HEIGHT;
+   data.size[2] = TILES_X;
+   data.size[3] = TILES_Y;
+   data.mode = march_mode == MARCH_BRUTE_FORCE;
+   data.history_valid = vk.history_valid;
+
+   void *ptr;
+   vkMapMemory(vulkan->device, vk.ubo[vk.index].memory,
+         0, sizeof(data), 0, &ptr);
+   memcpy(ptr, &data, sizeof(data));
+   vkUnmapMemory(vulkan->device, vk.ubo[vk.index].memory);
+}
 
-   if (vk.need_acquire[vk.index])
+static void read_timings(void)
+{
+   unsigned index = vk.index;
+   if (!vk.queries_pending[index])
+      return;
+   vk.queries_pending[index] = false;
+
+   /* The frame which last used this index is done after wait_sync_index(). */
+   struct timing *t = &timing[vk.query_mode[index]];
+   if (vk.timestamps)
    {
-      prepare_rendering.srcQueueFamilyIndex = vulkan->queue_index;
-      prepare_rendering.dstQueueFamilyIndex = async_queue_index;
+      uint64_t stamps[2];
+      if (vkGetQueryPoolResults(vulkan->device, vk.query_pool[index],
+               0, 2, sizeof(stamps), stamps,
+               sizeof(uint64_t), VK_QUERY_RESULT_64_BIT) == VK_SUCCESS)
+      {
+         uint64_t ticks = ((stamps[1] & vk.timestamp_mask) - (stamps[0] & vk.timestamp_mask)) &
+            vk.timestamp_mask;
+         t->gpu_ms += ticks * vk.gpu_properties.limits.timestampPeriod * 1e-6;
+      }
    }
-   else
+
+   struct tile_stats *stats;
+   vkMapMemory(vulkan->device, vk.stats[index].memory,
+         0, sizeof(*stats), 0, (void**)&stats);
+   t->steps += stats->steps;
+   t->refined_tiles += stats->refine_count;
+   vkUnmapMemory(vulkan->device, vk.stats[index].memory);
+   t->frames++;
+
+   if (++timing_frames < TIMING_INTERVAL)
+      return;
+
+   for (unsigned i = 0; i < MARCH_COUNT; i++)
    {
-      prepare_rendering.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-      prepare_rendering.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+      t = &timing[i];
+      if (!t->frames)
+         continue;
+
+      fprintf(stderr, "[libretro-test]: %s: %.3f ms GPU, %.1f march steps per pixel, %.0f of %u tiles refined.\n",
+            march_mode_names[i],
+            vk.timestamps ? t->gpu_ms / t->frames : 0.0,
+            t->steps / (t->frames * (double)(BASE_WIDTH * BASE_HEIGHT)),
+            i == MARCH_BRUTE_FORCE ? (double)(TILES_X * TILES_Y) : t->refined_tiles / t->frames,
+            TILES_X * TILES_Y);
    }
-   prepare_rendering.image = vk.images[vk.index].create_info.image;
-   prepare_rendering.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-   prepare_rendering.subresourceRange.levelCount = 1;
-   prepare_rendering.subresourceRange.layerCount = 1;
-   vkCmdPipelineBarrier(cmd,
-         VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
-         false, 
-         0, NULL,
-         0, NULL,
-         1, &prepare_rendering);
-
-   vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, vk.pipeline);
-   vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_COMPUTE,
-         vk.pipeline_layout, 0,
-         1, &vk.desc_set[vk.index], 0, NULL);
 
-   const float constants[4] = {
-      1.0f / BASE_WIDTH,
-      1.0f / BASE_HEIGHT,
-      (float)frame_count++,
-      0.0f,
-   };
-   vkCmdPushConstants(cmd, vk.pipeline_layout,
-         VK_SHADER_STAGE_COMPUTE_BIT,
-         0, 16, constants);
+   memset(timing, 0, sizeof(timing));
+   timing_frames = 0;
 
-   vkCmdDispatch(cmd, BASE_WIDTH / 8, BASE_HEIGHT / 8, 1);
+   if (march_benchmark)
+      march_mode = (march_mode + 1) % MARCH_COUNT;
+}
 
-   VkImageMemoryBarrier prepare_presentation = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
-   prepare_presentation.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
-   prepare_presentation.dstAccessMask = 0;
-   prepare_presentation.oldLayout = VK_IMAGE_LAYOUT_GENERAL;
-   prepare_presentation.newLayout = VK_IMAGE_LAYOUT_GENERAL;
+/* No tiles listed yet, refine.comp runs as an indirect dispatch of
+ * (refine_count, 1, 1). */
+static void reset_tiles(VkCommandBuffer cmd, void *userdata)
+{
+   const struct tile_stats header = { 0, 1, 1, 0 };
+   vkCmdUpdateBuffer(cmd, vk.tiles.buffer, 0, sizeof(header), (const uint32_t*)&header);
+}
 
-   if (async_queue && vulkan->queue_index != async_queue_index)
-   {
-      prepare_presentation.srcQueueFamilyIndex = async_queue_index;
-      prepare_presentation.dstQueueFamilyIndex = vulkan->queue_index;
-      vk.need_acquire[vk.index] = true;
-   }
-   else
+static void march_coarse(VkCommandBuffer cmd, void *userdata)
+{
+   vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, vk.coarse_pipeline);
+   vkCmdDispatch(cmd, (COARSE_WIDTH + 7) / 8, (COARSE_HEIGHT + 7) / 8, 1);
+}
+
+/* Refine and upsample write disjoint tiles, so they share a pass and
+ * get no barrier between them. */
+static void march_refine(VkCommandBuffer cmd, void *userdata)
+{
+   vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, vk.refine_pipeline);
+   vkCmdDispatchIndirect(cmd, vk.tiles.buffer, 0);
+   vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, vk.upsample_pipeline);
+   vkCmdDispatch(cmd, TILES_X, TILES_Y, 1);
+}
+
+static void march_brute_force(VkCommandBuffer cmd, void *userdata)
+{
+   vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, vk.refine_pipeline);
+   vkCmdDispatch(cmd, TILES_X, TILES_Y, 1);
+}
+
+static void copy_stats(VkCommandBuffer cmd, void *userdata)
+{
+   const VkBufferCopy region = { 0, 0, sizeof(struct tile_stats) };
+   vkCmdCopyBuffer(cmd, vk.tiles.buffer, vk.stats[vk.index].buffer, 1, &region);
+}
+
+static void vulkan_test_render(void)
+{
+   VkCommandBuffer cmd = vk.cmd[vk.index];
+
+   update_ubo();
+
+   VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+   begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+   vkResetCommandBuffer(cmd, 0);
+   vkBeginCommandBuffer(cmd, &begin_info);
+
+   if (vk.timestamps)
    {
-      prepare_presentation.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-      prepare_presentation.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-      vk.need_acquire[vk.index] = false;
+      vkCmdResetQueryPool(cmd, vk.query_pool[vk.index], 0, 2);
+      vkCmdWriteTimestamp(cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, vk.query_pool[vk.index], 0);
    }
 
-   prepare_presentation.image = vk.images[vk.index].create_info.image;
-   prepare_presentation.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-   prepare_presentation.subresourceRange.levelCount = 1;
-   prepare_presentation.subresourceRange.layerCount = 1;
-   vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
-         VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
-         false,
-         0, NULL,
-         0, NULL,
-         1, &prepare_presentation);
+   vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_COMPUTE,
+         vk.pipeline_layout, 0,
+         1, &vk.desc_set[vk.index][frame_count & 1], 0, NULL);
+
+   rg_set_image(&vk.graph, vk.output, vk.images[vk.index].create_info.image,
+         vk.need_acquire[vk.index] ? vulkan->queue_index : VK_QUEUE_FAMILY_IGNORED);
+   rg_set_buffer(&vk.graph, vk.stats_resource, vk.stats[vk.index].buffer);
+   rg_pass_enable(&vk.graph, vk.coarse_pass, march_mode == MARCH_ADAPTIVE);
+   rg_pass_enable(&vk.graph, vk.refine_pass, march_mode == MARCH_ADAPTIVE);
+   rg_pass_enable(&vk.graph, vk.brute_force_pass, march_mode == MARCH_BRUTE_FORCE);
+   rg_execute(&vk.graph, cmd);
+
+   if (vk.timestamps)
+      vkCmdWriteTimestamp(cmd, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, vk.query_pool[vk.index], 1);
 
    vkEndCommandBuffer(cmd);
 
@@ -248,6 +459,22 @@ static void vulkan_test_render(void)
 
    if (!async_queue)
       vulkan->unlock_queue(vulkan->handle);
+
+   if (!vk.graph_dumped)
+   {
+      rg_dump(&vk.graph, stderr);
+      vk.graph_dumped = true;
+   }
+
+   /* The output was released to the graphics queue if there is one. The
+    * next frame has the other parity. */
+   vk.need_acquire[vk.index] = async_queue && vulkan->queue_index != async_queue_index;
+   rg_swap(&vk.graph, vk.distance, vk.prev_distance);
+
+   vk.queries_pending[vk.index] = true;
+   vk.query_mode[vk.index] = march_mode;
+   vk.history_valid = true;
+   frame_count++;
 }
 
 static VkShaderModule create_shader_module(const uint32_t *data, size_t size)
@@ -260,41 +487,241 @@ static VkShaderModule create_shader_module(const uint32_t *data, size_t size)
    return module;
 }
 
-static void init_descriptor(void)
+static struct buffer create_buffer(size_t size, VkBufferUsageFlags usage)
 {
+   struct buffer buffer;
    VkDevice device = vulkan->device;
 
-   VkDescriptorSetLayoutBinding binding = {0};
-   binding.binding = 0;
-   binding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
-   binding.descriptorCount = 1;
-   binding.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
-   binding.pImmutableSamplers = NULL;
+   VkBufferCreateInfo info = { VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
+   info.usage = usage;
+   info.size = size;
+
+   vkCreateBuffer(device, &info, NULL, &buffer.buffer);
 
-   const VkDescriptorPoolSize pool_sizes[1] = {
-      { VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, vk.num_swapchain_images },
+   VkMemoryRequirements mem_reqs;
+   vkGetBufferMemoryRequirements(device, buffer.buffer, &mem_reqs);
+
+   VkMemoryAllocateInfo alloc = { VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO };
+   alloc.allocationSize = mem_reqs.size;
+
+   alloc.memoryTypeIndex = find_memory_type_from_requirements(mem_reqs.memoryTypeBits,
+         VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+   vkAllocateMemory(device, &alloc, NULL, &buffer.memory);
+   vkBindBufferMemory(device, buffer.buffer, buffer.memory, 0);
+   return buffer;
+}
+
+static void destroy_buffer(struct buffer *buffer)
+{
+   vkFreeMemory(vulkan->device, buffer->memory, NULL);
+   vkDestroyBuffer(vulkan->device, buffer->buffer, NULL);
+}
+
+static void create_storage_image(VkFormat format, unsigned width, unsigned height,
+      VkImage *image, VkDeviceMemory *memory, VkImageView *view)
+{
+   VkDevice device = vulkan->device;
+
+   VkImageCreateInfo info = { VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO };
+   info.imageType = VK_IMAGE_TYPE_2D;
+   info.format = format;
+   info.extent.width = width;
+   info.extent.height = height;
+   info.extent.depth = 1;
+   info.samples = VK_SAMPLE_COUNT_1_BIT;
+   info.tiling = VK_IMAGE_TILING_OPTIMAL;
+   info.usage = VK_IMAGE_USAGE_STORAGE_BIT;
+   info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+   info.mipLevels = 1;
+   info.arrayLayers = 1;
+   vkCreateImage(device, &info, NULL, image);
+
+   VkMemoryAllocateInfo alloc = { VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO };
+   VkMemoryRequirements mem_reqs;
+
+   vkGetImageMemoryRequirements(device, *image, &mem_reqs);
+   alloc.allocationSize = mem_reqs.size;
+   alloc.memoryTypeIndex = find_memory_type_from_requirements(
+         mem_reqs.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+   vkAllocateMemory(device, &alloc, NULL, memory);
+   vkBindImageMemory(device, *image, *memory, 0);
+
+   VkImageViewCreateInfo view_info = { VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO };
+   view_info.image = *image;
+   view_info.viewType = VK_IMAGE_VIEW_TYPE_2D;
+   view_info.format = format;
+   view_info.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+   view_info.subresourceRange.levelCount = 1;
+   view_info.subresourceRange.layerCount = 1;
+   view_info.components.r = VK_COMPONENT_SWIZZLE_R;
+   view_info.components.g = VK_COMPONENT_SWIZZLE_G;
+   view_info.components.b = VK_COMPONENT_SWIZZLE_B;
+   view_info.components.a = VK_COMPONENT_SWIZZLE_A;
+   vkCreateImageView(device, &view_info, NULL, view);
+}
+
+static void init_march_resources(void)
+{
+   for (unsigned i = 0; i < 2; i++)
+      create_storage_image(VK_FORMAT_R32_SFLOAT, BASE_WIDTH, BASE_HEIGHT,
+            &vk.history_images[i], &vk.history_memory[i], &vk.history_views[i]);
+   vk.history_valid = false;
+
+   vk.tiles = create_buffer(sizeof(struct tile_stats) + 2 * MAX_TILES * sizeof(uint32_t),
+         VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT |
+         VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+
+   for (unsigned i = 0; i < vk.num_swapchain_images; i++)
+   {
+      vk.ubo[i] = create_buffer(sizeof(struct frame_data),
+            VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+      vk.stats[i] = create_buffer(sizeof(struct tile_stats),
+            VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+   }
+}
+
+/* Every pass runs on the compute queue. The output starts undefined each
+ * frame and is handed to the graphics queue at the end, the distances
+ * and tile list carry over to the next frame. */
+static void init_render_graph(void)
+{
+   uint32_t family = async_queue != VK_NULL_HANDLE ?
+      async_queue_index : vulkan->queue_index;
+   struct render_graph *graph = &vk.graph;
+
+   rg_init(graph, vulkan->device, family);
+
+   vk.output = rg_import_image(graph, "output", VK_IMAGE_ASPECT_COLOR_BIT,
+         true, RG_USAGE_SAMPLED_FRAGMENT_GENERAL,
+         async_queue && async_queue_index != vulkan->queue_index ?
+         vulkan->queue_index : VK_QUEUE_FAMILY_IGNORED);
+   vk.distance = rg_import_image(graph, "distance", VK_IMAGE_ASPECT_COLOR_BIT,
+         false, RG_USAGE_NONE, VK_QUEUE_FAMILY_IGNORED);
+   vk.prev_distance = rg_import_image(graph, "previous distance", VK_IMAGE_ASPECT_COLOR_BIT,
+         false, RG_USAGE_NONE, VK_QUEUE_FAMILY_IGNORED);
+   vk.tiles_resource = rg_import_buffer(graph, "tiles", false, RG_USAGE_NONE);
+   vk.stats_resource = rg_import_buffer(graph, "stats", true, RG_USAGE_HOST_READ);
+
+   VkImageCreateInfo info = { VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO };
+   info.imageType = VK_IMAGE_TYPE_2D;
+   info.format = VK_FORMAT_R8G8B8A8_UNORM;
+   info.extent.width = COARSE_WIDTH;
+   info.extent.height = COARSE_HEIGHT;
+   info.extent.depth = 1;
+   info.samples = VK_SAMPLE_COUNT_1_BIT;
+   info.tiling = VK_IMAGE_TILING_OPTIMAL;
+   info.usage = VK_IMAGE_USAGE_STORAGE_BIT;
+   info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+   info.mipLevels = 1;
+   info.arrayLayers = 1;
+   vk.coarse = rg_create_image(graph, "coarse", &info, VK_IMAGE_ASPECT_COLOR_BIT);
+
+   /* Parity n writes history n. */
+   rg_set_image(graph, vk.distance, vk.history_images[frame_count & 1], VK_QUEUE_FAMILY_IGNORED);
+   rg_set_image(graph, vk.prev_distance, vk.history_images[(frame_count & 1) ^ 1], VK_QUEUE_FAMILY_IGNORED);
+   rg_set_buffer(graph, vk.tiles_resource, vk.tiles.buffer);
+
+   unsigned pass = rg_add_pass(graph, "reset tiles", reset_tiles, NULL);
+   rg_pass_use(graph, pass, vk.tiles_resource, RG_USAGE_TRANSFER_WRITE);
+
+   pass = vk.coarse_pass = rg_add_pass(graph, "coarse", march_coarse, NULL);
+   rg_pass_use(graph, pass, vk.tiles_resource, RG_USAGE_STORAGE_READ_WRITE);
+   rg_pass_use(graph, pass, vk.coarse, RG_USAGE_STORAGE_WRITE);
+   rg_pass_use(graph, pass, vk.prev_distance, RG_USAGE_STORAGE_READ);
+   rg_pass_use(graph, pass, vk.distance, RG_USAGE_STORAGE_WRITE);
+
+   pass = vk.refine_pass = rg_add_pass(graph, "refine", march_refine, NULL);
+   rg_pass_use(graph, pass, vk.tiles_resource, RG_USAGE_INDIRECT_READ);
+   rg_pass_use(graph, pass, vk.tiles_resource, RG_USAGE_STORAGE_READ_WRITE);
+   rg_pass_use(graph, pass, vk.coarse, RG_USAGE_STORAGE_READ);
+   rg_pass_use(graph, pass, vk.prev_distance, RG_USAGE_STORAGE_READ);
+   rg_pass_use(graph, pass, vk.distance, RG_USAGE_STORAGE_WRITE);
+   rg_pass_use(graph, pass, vk.output, RG_USAGE_STORAGE_WRITE);
+
+   pass = vk.brute_force_pass = rg_add_pass(graph, "brute force", march_brute_force, NULL);
+   rg_pass_use(graph, pass, vk.tiles_resource, RG_USAGE_STORAGE_READ_WRITE);
+   rg_pass_use(graph, pass, vk.distance, RG_USAGE_STORAGE_WRITE);
+   rg_pass_use(graph, pass, vk.output, RG_USAGE_STORAGE_WRITE);
+
+   pass = rg_add_pass(graph, "stats", copy_stats, NULL);
+   rg_pass_use(graph, pass, vk.tiles_resource, RG_USAGE_TRANSFER_READ);
+   rg_pass_use(graph, pass, vk.stats_resource, RG_USAGE_TRANSFER_WRITE);
+
+   rg_compile(graph, &vk.memory_properties);
+}
+
+static void init_queries(void)
+{
+   uint32_t queue_count;
+   VkQueueFamilyProperties *queue_properties;
+   uint32_t family = async_queue != VK_NULL_HANDLE ?
+      async_queue_index : vulkan->queue_index;
+
+   vkGetPhysicalDeviceQueueFamilyProperties(vulkan->gpu, &queue_count, NULL);
+   queue_properties = calloc(queue_count, sizeof(*queue_properties));
+   if (!queue_properties)
+      return;
+   vkGetPhysicalDeviceQueueFamilyProperties(vulkan->gpu, &queue_count, queue_properties);
+   uint32_t bits = queue_properties[family].timestampValidBits;
+   free(queue_properties);
+
+   vk.timestamps = bits != 0;
+   vk.timestamp_mask = bits >= 64 ? ~UINT64_C(0) : (UINT64_C(1) << bits) - 1;
+   if (!vk.timestamps)
+      fprintf(stderr, "[libretro-test]: No timestamps on the compute queue, only work is reported.\n");
+
+   VkQueryPoolCreateInfo pool_info = { VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO };
+   pool_info.queryType = VK_QUERY_TYPE_TIMESTAMP;
+   pool_info.queryCount = 2;
+
+   for (unsigned i = 0; i < vk.num_swapchain_images; i++)
+      vkCreateQueryPool(vulkan->device, &pool_info, NULL, &vk.query_pool[i]);
+}
+
+static void init_descriptor(void)
+{
+   VkDevice device = vulkan->device;
+
+   static const VkDescriptorType types[6] = {
+      VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+      VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+      VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+      VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+      VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+      VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
    };
 
-   const VkPushConstantRange range = {
-      VK_SHADER_STAGE_COMPUTE_BIT,
-      0, 16,
+   VkDescriptorSetLayoutBinding bindings[6];
+   memset(bindings, 0, sizeof(bindings));
+   for (unsigned i = 0; i < 6; i++)
+   {
+      bindings[i].binding = i;
+      bindings[i].descriptorType = types[i];
+      bindings[i].descriptorCount = 1;
+      bindings[i].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+      bindings[i].pImmutableSamplers = NULL;
+   }
+
+   const VkDescriptorPoolSize pool_sizes[3] = {
+      { VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 2 * vk.num_swapchain_images },
+      { VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, 8 * vk.num_swapchain_images },
+      { VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 2 * vk.num_swapchain_images },
    };
 
    VkDescriptorSetLayoutCreateInfo set_layout_info = { VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO };
-   set_layout_info.bindingCount = 1;
-   set_layout_info.pBindings = &binding;
+   set_layout_info.bindingCount = 6;
+   set_layout_info.pBindings = bindings;
    vkCreateDescriptorSetLayout(device, &set_layout_info, NULL, &vk.set_layout);
 
    VkPipelineLayoutCreateInfo layout_info = { VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO };
    layout_info.setLayoutCount = 1;
    layout_info.pSetLayouts = &vk.set_layout;
-   layout_info.pushConstantRangeCount = 1;
-   layout_info.pPushConstantRanges = &range;
    vkCreatePipelineLayout(device, &layout_info, NULL, &vk.pipeline_layout);
 
    VkDescriptorPoolCreateInfo pool_info = { VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO };
-   pool_info.maxSets = vk.num_swapchain_images;
-   pool_info.poolSizeCount = 1;
+   pool_info.maxSets = 2 * vk.num_swapchain_images;
+   pool_info.poolSizeCount = 3;
    pool_info.pPoolSizes = pool_sizes;
    pool_info.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
    vkCreateDescriptorPool(device, &pool_info, NULL, &vk.desc_pool);
@@ -306,43 +733,87 @@ static void init_descriptor(void)
 
    for (unsigned i = 0; i < vk.num_swapchain_images; i++)
    {
-      vkAllocateDescriptorSets(device, &alloc_info, &vk.desc_set[i]);
-
-      VkWriteDescriptorSet write = { VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
-      VkDescriptorImageInfo image_info;
-
-      write.dstSet = vk.desc_set[i];
-      write.dstBinding = 0;
-      write.descriptorCount = 1;
-      write.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
-      write.pImageInfo = &image_info;
+      for (unsigned parity = 0; parity < 2; parity++)
+      {
+         VkDescriptorSet set;
+         vkAllocateDescriptorSets(device, &alloc_info, &set);
+         vk.desc_set[i][parity] = set;
+
+         /* Parity n writes history n and reads the other one. */
+         const VkImageView views[4] = {
+            vk.images[i].image_view,
+            rg_image_view(&vk.graph, vk.coarse),
+            vk.history_views[parity ^ 1],
+            vk.history_views[parity],
+         };
+
+         VkDescriptorBufferInfo buffer_info[2] = {
+            { vk.ubo[i].buffer, 0, VK_WHOLE_SIZE },
+            { vk.tiles.buffer, 0, VK_WHOLE_SIZE },
+         };
+         VkDescriptorImageInfo image_info[4];
+         VkWriteDescriptorSet writes[6];
+         memset(writes, 0, sizeof(writes));
+
+         for (unsigned j = 0; j < 6; j++)
+         {
+            writes[j].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            writes[j].dstSet = set;
+            writes[j].dstBinding = j;
+            writes[j].descriptorCount = 1;
+            writes[j].descriptorType = types[j];
+         }
 
-      image_info.imageView = vk.images[i].image_view;
-      image_info.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
-      image_info.sampler = VK_NULL_HANDLE;
+         writes[0].pBufferInfo = &buffer_info[0];
+         writes[5].pBufferInfo = &buffer_info[1];
+         for (unsigned j = 0; j < 4; j++)
+         {
+            image_info[j].imageView = views[j];
+            image_info[j].imageLayout = VK_IMAGE_LAYOUT_GENERAL;
+            image_info[j].sampler = VK_NULL_HANDLE;
+            writes[j + 1].pImageInfo = &image_info[j];
+         }
 
-      vkUpdateDescriptorSets(device, 1, &write, 0, NULL);
+         vkUpdateDescriptorSets(device, 6, writes, 0, NULL);
+      }
    }
 }
 
-static void init_pipeline(void)
+static VkPipeline create_compute_pipeline(const uint32_t *code, size_t size)
 {
    VkDevice device = vulkan->device;
-
-   static const uint32_t raymarch_comp[] =
-#include "shaders/raymarch.comp.inc"
-      ;
+   VkPipeline pipeline;
 
    VkComputePipelineCreateInfo pipe = { VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO };
 
    pipe.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
    pipe.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
-   pipe.stage.module = create_shader_module(raymarch_comp, sizeof(raymarch_comp));
+   pipe.stage.module = create_shader_module(code, size);
    pipe.stage.pName = "main";
    pipe.layout = vk.pipeline_layout;
 
-   vkCreateComputePipelines(vulkan->device, vk.pipeline_cache, 1, &pipe, NULL, &vk.pipeline);
+   vkCreateComputePipelines(device, vk.pipeline_cache, 1, &pipe, NULL, &pipeline);
    vkDestroyShaderModule(device, pipe.stage.module, NULL);
+   return pipeline;
+}
+
+static void init_pipeline(void)
+{
+   static const uint32_t coarse_comp[] =
+#include "shaders/coarse.comp.inc"
+      ;
+
+   static const uint32_t refine_comp[] =
+#include "shaders/refine.comp.inc"
+      ;
+
+   static const uint32_t upsample_comp[] =
+#include "shaders/upsample.comp.inc"
+      ;
+
+   vk.coarse_pipeline = create_compute_pipeline(coarse_comp, sizeof(coarse_comp));
+   vk.refine_pipeline = create_compute_pipeline(refine_comp, sizeof(refine_comp));
+   vk.upsample_pipeline = create_compute_pipeline(upsample_comp, sizeof(upsample_comp));
 }
 
 static void init_swapchain(void)
@@ -444,6 +915,9 @@ static void vulkan_test_init(void)
 
    init_command();
    init_swapchain();
+   init_march_resources();
+   init_render_graph();
+   init_queries();
    init_descriptor();
 
    VkPipelineCacheCreateInfo pipeline_cache_info = { VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO };
@@ -451,6 +925,9 @@ static void vulkan_test_init(void)
          NULL, &vk.pipeline_cache);
 
    init_pipeline();
+
+   memset(timing, 0, sizeof(timing));
+   timing_frames = 0;
 }
 
 static void vulkan_test_deinit(void)
@@ -467,12 +944,26 @@ static void vulkan_test_deinit(void)
       vkFreeMemory(device, vk.image_memory[i], NULL);
       vkDestroyImage(device, vk.images[i].create_info.image, NULL);
       vkDestroySemaphore(device, vk.acquire_semaphores[i], NULL);
+      vkDestroyQueryPool(device, vk.query_pool[i], NULL);
+      destroy_buffer(&vk.ubo[i]);
+      destroy_buffer(&vk.stats[i]);
+   }
+
+   rg_destroy(&vk.graph);
+   for (unsigned i = 0; i < 2; i++)
+   {
+      vkDestroyImageView(device, vk.history_views[i], NULL);
+      vkFreeMemory(device, vk.history_memory[i], NULL);
+      vkDestroyImage(device, vk.history_images[i], NULL);
    }
+   destroy_buffer(&vk.tiles);
 
-   vkFreeDescriptorSets(device, vk.desc_pool, vk.num_swapchain_images, vk.desc_set);
+   vkFreeDescriptorSets(device, vk.desc_pool, 2 * vk.num_swapchain_images, &vk.desc_set[0][0]);
    vkDestroyDescriptorPool(device, vk.desc_pool, NULL);
 
-   vkDestroyPipeline(device, vk.pipeline, NULL);
+   vkDestroyPipeline(device, vk.coarse_pipeline, NULL);
+   vkDestroyPipeline(device, vk.refine_pipeline, NULL);
+   vkDestroyPipeline(device, vk.upsample_pipeline, NULL);
    vkDestroyDescriptorSetLayout(device, vk.set_layout, NULL);
    vkDestroyPipelineLayout(device, vk.pipeline_layout, NULL);
    vkDestroyPipelineCache(device, vk.pipeline_cache, NULL);
@@ -486,8 +977,30 @@ static void vulkan_test_deinit(void)
    memset(&vk, 0, sizeof(vk));
 }
 
+static void update_variables(void)
+{
+   struct retro_variable var = {
+      .key = "testvulkan_async_march",
+   };
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   {
+      march_benchmark = !strcmp(var.value, "benchmark");
+      if (!strcmp(var.value, "brute force"))
+         march_mode = MARCH_BRUTE_FORCE;
+      else if (!march_benchmark)
+         march_mode = MARCH_ADAPTIVE;
+
+      fprintf(stderr, "[libretro-test]: Raymarching: %s.\n", var.value);
+   }
+}
+
 void retro_run(void)
 {
+   bool updated = false;
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE_UPDATE, &updated) && updated)
+      update_variables();
+
    input_poll_cb();
 
    if (input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_UP))
@@ -504,6 +1017,7 @@ void retro_run(void)
    vulkan->wait_sync_index(vulkan->handle);
 
    vk.index = vulkan->get_sync_index(vulkan->handle);
+   read_timings();
    vulkan_test_render();
    vulkan->set_image(vulkan->handle, &vk.images[vk.index],
          1, &vk.acquire_semaphores[vk.index],
@@ -531,7 +1045,8 @@ static void context_reset(void)
 
    vulkan_symbol_wrapper_init(vulkan->get_instance_proc_addr);
    vulkan_symbol_wrapper_load_core_instance_symbols(vulkan->instance);
-   vulkan_symbol_wrapper_load_core_device_symbols(vulkan->device);
+   if (!vulkan_symbol_wrapper_load_core_device_symbols(vulkan->device))
+      fprintf(stderr, "Failed to load device-level Vulkan symbols!\n");
    vulkan_test_init();
 }
 
@@ -738,6 +1253,8 @@ bool retro_load_game(const struct retro_game_info *info)
    fprintf(stderr, "Loaded game!\n");
    (void)info;
 
+   update_variables();
+
    frame_count = 0;
    return true;
 }
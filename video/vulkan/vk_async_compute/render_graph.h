@@ -0,0 +1,179 @@
+#ifndef RENDER_GRAPH_H__
+#define RENDER_GRAPH_H__
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "vulkan/vulkan_symbol_wrapper.h"
+
+/* A small render graph for one queue. Passes declare which resources they
+ * read and write, and the graph records the barriers, layout transitions
+ * and queue family ownership transfers between them. The passes are
+ * declared once, their order is the order of declaration. Each
+ * execution derives the barriers from the state the resources were left
+ * in, so passes can be disabled and imported handles swapped per frame.
+ *
+ * Transient images live only within one execution. They are created by
+ * the graph and share memory whenever their lifetimes do not overlap. */
+
+#define RG_MAX_RESOURCES 16
+#define RG_MAX_PASSES 16
+#define RG_MAX_PASS_ACCESSES 8
+#define RG_MAX_BARRIERS 32
+
+enum rg_usage
+{
+   RG_USAGE_NONE = 0, /* Contents are not needed. */
+   RG_USAGE_COLOR_ATTACHMENT,
+   RG_USAGE_DEPTH_ATTACHMENT,
+   RG_USAGE_SAMPLED_FRAGMENT,
+   RG_USAGE_SAMPLED_FRAGMENT_GENERAL,
+   RG_USAGE_STORAGE_READ,
+   RG_USAGE_STORAGE_WRITE,
+   RG_USAGE_STORAGE_READ_WRITE,
+   RG_USAGE_INDIRECT_READ,
+   RG_USAGE_VERTEX_READ,
+   RG_USAGE_TRANSFER_READ,
+   RG_USAGE_TRANSFER_WRITE,
+   RG_USAGE_HOST_READ,
+   RG_USAGE_COUNT
+};
+
+typedef void (*rg_execute_t)(VkCommandBuffer cmd, void *userdata);
+
+struct rg_state
+{
+   VkPipelineStageFlags write_stages; /* Last write, until a later one. */
+   VkAccessFlags write_access;
+   VkPipelineStageFlags read_stages;  /* Reads since the last write. */
+   VkAccessFlags visible_access;      /* Reads the last write was made visible to. */
+   VkPipelineStageFlags visible_stages;
+   VkImageLayout layout;
+};
+
+struct rg_resource
+{
+   const char *name;
+   bool is_image;
+   bool transient;
+   bool discard;                      /* Contents undefined at every execution. */
+   VkImage image;
+   VkBuffer buffer;
+   VkImageView view;
+   VkImageAspectFlags aspect;
+   VkImageCreateInfo info;
+
+   enum rg_usage final_usage;
+   uint32_t acquire_family;
+   uint32_t release_family;
+
+   /* Transients: memory slot, and the previous resource in it. */
+   int slot;
+   int alias_prev;
+   int first_pass;
+   int last_pass;
+
+   struct rg_state state;
+   bool used;
+};
+
+struct rg_access
+{
+   unsigned resource;
+   VkPipelineStageFlags stages;
+   VkAccessFlags access;
+   VkImageLayout layout;
+   bool write;
+};
+
+struct rg_pass
+{
+   const char *name;
+   bool enabled;
+   rg_execute_t execute;
+   void *userdata;
+   struct rg_access accesses[RG_MAX_PASS_ACCESSES];
+   unsigned num_accesses;
+};
+
+struct rg_barrier
+{
+   int pass; /* -1 for the final transitions. */
+   unsigned resource;
+   VkPipelineStageFlags src_stages;
+   VkPipelineStageFlags dst_stages;
+   VkAccessFlags src_access;
+   VkAccessFlags dst_access;
+   VkImageLayout old_layout;
+   VkImageLayout new_layout;
+   uint32_t src_family;
+   uint32_t dst_family;
+};
+
+struct rg_slot
+{
+   VkDeviceMemory memory;
+   VkDeviceSize size;
+   uint32_t memory_type_bits;
+};
+
+struct render_graph
+{
+   VkDevice device;
+   uint32_t family;
+
+   struct rg_resource resources[RG_MAX_RESOURCES];
+   unsigned num_resources;
+   struct rg_pass passes[RG_MAX_PASSES];
+   unsigned num_passes;
+   struct rg_slot slots[RG_MAX_RESOURCES];
+   unsigned num_slots;
+
+   /* Barriers of the last execution, for rg_dump(). */
+   struct rg_barrier barriers[RG_MAX_BARRIERS];
+   unsigned num_barriers;
+   unsigned num_batches;
+};
+
+void rg_init(struct render_graph *graph, VkDevice device, uint32_t family);
+void rg_destroy(struct render_graph *graph);
+
+/* Imported resources keep their state between executions unless discard
+ * is set. A final usage other than RG_USAGE_NONE is transitioned to at the
+ * end of every execution and released to release_family if that is not
+ * VK_QUEUE_FAMILY_IGNORED. */
+unsigned rg_import_image(struct render_graph *graph, const char *name,
+      VkImageAspectFlags aspect, bool discard,
+      enum rg_usage final_usage, uint32_t release_family);
+unsigned rg_import_buffer(struct render_graph *graph, const char *name,
+      bool discard, enum rg_usage final_usage);
+unsigned rg_create_image(struct render_graph *graph, const char *name,
+      const VkImageCreateInfo *info, VkImageAspectFlags aspect);
+
+/* Per execution: the handle to use, and for images the family to acquire
+ * them from first (VK_QUEUE_FAMILY_IGNORED if none). */
+void rg_set_image(struct render_graph *graph, unsigned resource,
+      VkImage image, uint32_t acquire_family);
+void rg_set_buffer(struct render_graph *graph, unsigned resource, VkBuffer buffer);
+
+/* Swaps two imported resources along with their state, for ping-ponging. */
+void rg_swap(struct render_graph *graph, unsigned a, unsigned b);
+
+unsigned rg_add_pass(struct render_graph *graph, const char *name,
+      rg_execute_t execute, void *userdata);
+void rg_pass_use(struct render_graph *graph, unsigned pass,
+      unsigned resource, enum rg_usage usage);
+void rg_pass_enable(struct render_graph *graph, unsigned pass, bool enable);
+
+/* Creates the transient images and their aliased memory. */
+bool rg_compile(struct render_graph *graph,
+      const VkPhysicalDeviceMemoryProperties *memory_properties);
+
+VkImageView rg_image_view(const struct render_graph *graph, unsigned resource);
+
+void rg_execute(struct render_graph *graph, VkCommandBuffer cmd);
+
+/* Passes, resources, memory slots and the barriers of the last execution. */
+void rg_dump(const struct render_graph *graph, FILE *file);
+
+#endif
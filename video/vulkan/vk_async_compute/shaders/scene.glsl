@@ -0,0 +1,246 @@
+// Shared by the raymarching passes: frame data, bindings, the signed
+// distance field scene and the march itself.
+
+#define MODE_ADAPTIVE 0u
+#define MODE_BRUTE_FORCE 1u
+
+#define TILE_SIZE 16
+#define MAX_TILES 1024
+
+#define MAX_STEPS 160u
+#define MAX_DIST 80.0
+#define HIT_EPSILON 0.0005
+#define SHADOW_STEPS 48
+
+// How far any surface can move in one frame, see march_start().
+#define MAX_SURFACE_MOVE 0.05
+#define START_SAFETY 0.95
+#define MAX_START_SAMPLES 16
+
+// Tiles whose coarse samples differ more than this are marched at full rate.
+#define LUMA_THRESHOLD 0.06
+#define DEPTH_RATIO_THRESHOLD 1.15
+
+layout(std140, set = 0, binding = 0) uniform Frame
+{
+   vec4 origin;  // w: time in seconds
+   vec4 right;   // w: tan(fov / 2) * aspect
+   vec4 up;      // w: tan(fov / 2)
+   vec4 forward;
+   vec4 prev_origin;
+   vec4 prev_right;
+   vec4 prev_up;
+   vec4 prev_forward;
+   uvec4 size;   // xy: resolution, zw: tiles
+   uint mode;
+   uint history_valid;
+} frame;
+
+layout(rgba8, set = 0, binding = 1) uniform writeonly image2D uImage;
+layout(rgba8, set = 0, binding = 2) uniform image2D uCoarse;
+layout(r32f, set = 0, binding = 3) uniform readonly image2D uPrevDistance;
+layout(r32f, set = 0, binding = 4) uniform writeonly image2D uDistance;
+
+// The header doubles as the indirect dispatch of refine.comp, the host
+// reads it back for the statistics.
+layout(std430, set = 0, binding = 5) buffer Tiles
+{
+   uint refine_count;
+   uint dispatch_y;
+   uint dispatch_z;
+   uint steps;
+   uint flags[MAX_TILES];
+   uint list[MAX_TILES];
+} tiles;
+
+float sd_sphere(vec3 p, float r)
+{
+   return length(p) - r;
+}
+
+float sd_round_box(vec3 p, vec3 b, float r)
+{
+   vec3 q = abs(p) - b;
+   return length(max(q, 0.0)) + min(max(q.x, max(q.y, q.z)), 0.0) - r;
+}
+
+float sd_torus(vec3 p, vec2 t)
+{
+   vec2 q = vec2(length(p.xz) - t.x, p.y);
+   return length(q) - t.y;
+}
+
+float smin(float a, float b, float k)
+{
+   float h = clamp(0.5 + 0.5 * (b - a) / k, 0.0, 1.0);
+   return mix(b, a, h) - k * h * (1.0 - h);
+}
+
+// x: distance, y: material
+vec2 map(vec3 p)
+{
+   float time = frame.origin.w;
+   vec2 res = vec2(p.y, 0.0);
+
+   // An endless field of pillars.
+   vec3 q = p;
+   q.xz = mod(q.xz + 4.0, 8.0) - 4.0;
+   float pillar = sd_round_box(q - vec3(0.0, 1.5, 0.0), vec3(0.4, 1.5, 0.4), 0.1);
+   if (pillar < res.x)
+      res = vec2(pillar, 1.0);
+
+   // A blob orbiting through a torus in the middle.
+   vec3 center = vec3(2.0 * sin(time), 1.5 + 0.5 * sin(1.3 * time), 2.0 * cos(0.7 * time));
+   float blob = smin(sd_sphere(p - center, 0.8),
+         sd_torus(p - vec3(0.0, 1.5, 0.0), vec2(2.0, 0.35)), 0.6);
+   if (blob < res.x)
+      res = vec2(blob, 2.0);
+
+   return res;
+}
+
+vec3 calc_normal(vec3 p)
+{
+   const vec2 k = vec2(1.0, -1.0);
+   const float h = 0.0005;
+   return normalize(
+         k.xyy * map(p + k.xyy * h).x +
+         k.yyx * map(p + k.yyx * h).x +
+         k.yxy * map(p + k.yxy * h).x +
+         k.xxx * map(p + k.xxx * h).x);
+}
+
+float soft_shadow(vec3 ro, vec3 rd)
+{
+   float res = 1.0;
+   float t = 0.02;
+   for (int i = 0; i < SHADOW_STEPS && t < 20.0; i++)
+   {
+      float h = map(ro + rd * t).x;
+      if (h < 0.0005)
+         return 0.0;
+      res = min(res, 8.0 * h / t);
+      t += clamp(h, 0.02, 1.0);
+   }
+   return clamp(res, 0.0, 1.0);
+}
+
+// Ray through a position in full resolution pixels.
+vec3 ray_dir(vec2 pixel)
+{
+   vec2 ndc = vec2(2.0 * pixel.x / float(frame.size.x) - 1.0,
+         1.0 - 2.0 * pixel.y / float(frame.size.y));
+   return normalize(frame.forward.xyz +
+         ndc.x * frame.right.w * frame.right.xyz +
+         ndc.y * frame.up.w * frame.up.xyz);
+}
+
+// Full resolution pixel position of a point in the previous frame, false
+// if the previous frame did not see it.
+bool reproject(vec3 p, out vec2 pixel)
+{
+   vec3 d = p - frame.prev_origin.xyz;
+   float z = dot(d, frame.prev_forward.xyz);
+   if (z <= 0.0)
+      return false;
+
+   vec2 ndc = vec2(dot(d, frame.prev_right.xyz) / (z * frame.prev_right.w),
+         dot(d, frame.prev_up.xyz) / (z * frame.prev_up.w));
+   pixel = vec2(0.5 + 0.5 * ndc.x, 0.5 - 0.5 * ndc.y) * vec2(frame.size.xy);
+   return all(greaterThanEqual(pixel, vec2(0.0))) && all(lessThan(pixel, vec2(frame.size.xy)));
+}
+
+// Nearest previous hit around a pixel.
+float prev_distance(vec2 pixel)
+{
+   float t = MAX_DIST;
+   ivec2 center = ivec2(floor(pixel));
+   ivec2 limit = ivec2(frame.size.xy) - 1;
+   for (int y = -1; y <= 1; y++)
+      for (int x = -1; x <= 1; x++)
+         t = min(t, imageLoad(uPrevDistance, clamp(center + ivec2(x, y), ivec2(0), limit)).x);
+   return t;
+}
+
+// Where to start marching, from the previous frame's hit distances.
+// The previous hit at this pixel gives a guess of the surface, which is
+// projected into the previous frame. The nearest hit around it, less how
+// far the camera and any surface moved, is the candidate start. Previous
+// rays only cleared what the previous frame saw, so the ray up to there
+// is walked through the previous frame a couple of pixels at a time,
+// starting at the sphere the distance field clears around the camera.
+// Any point the previous frame did not see, or saw behind a surface,
+// marches from the camera instead. Only a surface thinner than a pixel
+// can slip through.
+float march_start(vec3 ro, vec3 rd, ivec2 pixel)
+{
+   if (frame.history_valid == 0u)
+      return 0.0;
+
+   vec2 prev;
+   if (!reproject(ro + rd * imageLoad(uPrevDistance, pixel).x, prev))
+      return 0.0;
+
+   float moved = distance(ro, frame.prev_origin.xyz) + MAX_SURFACE_MOVE;
+   float t = START_SAFETY * (prev_distance(prev) - moved);
+   float near = map(ro).x;
+   if (near <= 0.0 || t <= near)
+      return 0.0;
+
+   // The segment projects about evenly in inverse distance.
+   vec2 near_prev, far_prev;
+   if (!reproject(ro + rd * near, near_prev) || !reproject(ro + rd * t, far_prev))
+      return 0.0;
+   int samples = int(ceil(0.5 * distance(near_prev, far_prev)));
+   if (samples > MAX_START_SAMPLES)
+      return 0.0;
+
+   for (int i = 1; i <= samples; i++)
+   {
+      vec3 p = ro + rd / mix(1.0 / near, 1.0 / t, float(i) / float(samples));
+      if (!reproject(p, prev) ||
+            prev_distance(prev) < distance(p, frame.prev_origin.xyz) + MAX_SURFACE_MOVE)
+         return 0.0;
+   }
+   return t;
+}
+
+float march(vec3 ro, vec3 rd, float t, out uint steps)
+{
+   for (steps = 0u; steps < MAX_STEPS && t < MAX_DIST; steps++)
+   {
+      float d = map(ro + rd * t).x;
+      if (d < HIT_EPSILON * max(t, 1.0))
+         return t;
+      t += d;
+   }
+   return min(t, MAX_DIST);
+}
+
+vec3 shade(vec3 ro, vec3 rd, float t)
+{
+   vec3 sky = mix(vec3(0.6, 0.7, 0.9), vec3(0.2, 0.3, 0.6), clamp(rd.y, 0.0, 1.0));
+   if (t >= MAX_DIST)
+      return sky;
+
+   vec3 p = ro + rd * t;
+   float material = map(p).y;
+   vec3 n = calc_normal(p);
+
+   vec3 albedo;
+   if (material < 0.5)
+      albedo = mix(vec3(0.45), vec3(0.55), mod(floor(p.x) + floor(p.z), 2.0));
+   else if (material < 1.5)
+      albedo = vec3(0.8, 0.75, 0.7);
+   else
+      albedo = vec3(0.9, 0.4, 0.2);
+
+   const vec3 light = vec3(0.57, 0.74, 0.35);
+   float diffuse = max(dot(n, light), 0.0);
+   if (diffuse > 0.0)
+      diffuse *= soft_shadow(p + 0.01 * n, light);
+
+   vec3 color = albedo * (0.15 + 0.85 * diffuse);
+   color = mix(color, sky, 1.0 - exp(-0.0008 * t * t));
+   return sqrt(color);
+}
@@ -0,0 +1,1742 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "vulkan/vulkan_symbol_wrapper.h"
+#include "libretro_vulkan.h"
+
+static struct retro_hw_render_callback hw_render;
+static const struct retro_hw_render_interface_vulkan *vulkan;
+static unsigned frame_count;
+static VkQueue async_queue;
+static uint32_t async_queue_index;
+
+#define BASE_WIDTH 640
+#define BASE_HEIGHT 360
+#define MAX_SYNC 8
+
+/* Same scene as Boxes in the GL compute sample, on a smaller grid. */
+#define GRID_SIZE 32
+#define GRID_SPACING 8.0f
+#define INSTANCE_RADIUS 1.4143f
+#define NUM_INSTANCES (GRID_SIZE * GRID_SIZE * GRID_SIZE)
+#define NUM_LODS 3
+#define CULL_WORKGROUP 64
+#define DELTA_TIME (1.0f / 60.0f)
+#define TIMING_INTERVAL 600
+
+struct buffer
+{
+   VkBuffer buffer;
+   VkDeviceMemory memory;
+};
+
+struct vertex
+{
+   float pos[3];
+   float normal[3];
+};
+
+struct lod_mesh
+{
+   uint32_t first_index;
+   uint32_t index_count;
+   int32_t vertex_offset;
+};
+
+/* Matches the Global block in the shaders (std140). */
+struct global_data
+{
+   float vp[16];
+   float frustum[6][4];
+   float camera_pos[4];
+   float camera_vel[4];
+   float delta_time;
+   uint32_t count;
+   uint32_t padding[2];
+};
+
+enum
+{
+   QUERY_CULL_BEGIN = 0,
+   QUERY_CULL_END,
+   QUERY_DRAW_BEGIN,
+   QUERY_DRAW_END,
+   QUERY_COUNT
+};
+
+struct vulkan_data
+{
+   unsigned index;
+   unsigned num_swapchain_images;
+   uint32_t swapchain_mask;
+
+   VkPhysicalDeviceMemoryProperties memory_properties;
+   VkPhysicalDeviceProperties gpu_properties;
+
+   struct buffer vbo;
+   struct buffer ibo;
+   struct buffer points;
+   struct buffer ubo[MAX_SYNC];
+   struct buffer instances[MAX_SYNC];
+   struct buffer indirect[MAX_SYNC];
+   struct lod_mesh lods[NUM_LODS];
+
+   VkDescriptorSetLayout cull_set_layout;
+   VkDescriptorSetLayout draw_set_layout;
+   VkDescriptorPool desc_pool;
+   VkDescriptorSet cull_set[MAX_SYNC];
+   VkDescriptorSet draw_set[MAX_SYNC];
+
+   VkPipelineCache pipeline_cache;
+   VkPipelineLayout cull_pipeline_layout;
+   VkPipelineLayout draw_pipeline_layout;
+   VkPipeline cull_pipeline;
+   VkPipeline draw_pipeline;
+   VkRenderPass render_pass;
+
+   struct retro_vulkan_image images[MAX_SYNC];
+   VkDeviceMemory image_memory[MAX_SYNC];
+   VkImage depth_images[MAX_SYNC];
+   VkDeviceMemory depth_memory[MAX_SYNC];
+   VkImageView depth_views[MAX_SYNC];
+   VkFramebuffer framebuffers[MAX_SYNC];
+
+   VkCommandPool cull_cmd_pool[MAX_SYNC];
+   VkCommandPool draw_cmd_pool[MAX_SYNC];
+   VkCommandBuffer cull_cmd[MAX_SYNC];
+   VkCommandBuffer draw_cmd[MAX_SYNC];
+   VkSemaphore cull_semaphores[MAX_SYNC];
+   VkSemaphore draw_semaphores[MAX_SYNC];
+
+   VkQueryPool query_pool[MAX_SYNC];
+   bool queries_pending[MAX_SYNC];
+   bool cull_timestamps;
+   bool draw_timestamps;
+   uint64_t cull_timestamp_mask;
+   uint64_t draw_timestamp_mask;
+};
+static struct vulkan_data vk;
+
+/* GPU time per queue, and how much of frame N's culling ran while
+ * frame N-1 was still drawing. Reported every TIMING_INTERVAL frames. */
+struct timing
+{
+   unsigned frames;
+   double cull_ms;
+   double draw_ms;
+   double overlap_ms;
+   bool have_draw;
+   uint64_t draw_begin;
+   uint64_t draw_end;
+};
+static struct timing timing;
+
+void retro_init(void)
+{}
+
+void retro_deinit(void)
+{}
+
+unsigned retro_api_version(void)
+{
+   return RETRO_API_VERSION;
+}
+
+void retro_set_controller_port_device(unsigned port, unsigned device)
+{
+   (void)port;
+   (void)device;
+}
+
+void retro_get_system_info(struct retro_system_info *info)
+{
+   memset(info, 0, sizeof(*info));
+   info->library_name     = "TestCore Async Culling Vulkan";
+   info->library_version  = "v1";
+   info->need_fullpath    = false;
+   info->valid_extensions = NULL; // Anything is fine, we don't care.
+}
+
+void retro_get_system_av_info(struct retro_system_av_info *info)
+{
+   info->timing = (struct retro_system_timing) {
+      .fps = 60.0,
+      .sample_rate = 0.0,
+   };
+
+   info->geometry = (struct retro_game_geometry) {
+      .base_width   = BASE_WIDTH,
+      .base_height  = BASE_HEIGHT,
+      .max_width    = BASE_WIDTH,
+      .max_height   = BASE_HEIGHT,
+      .aspect_ratio = (float)BASE_WIDTH / (float)BASE_HEIGHT,
+   };
+}
+
+static retro_video_refresh_t video_cb;
+static retro_audio_sample_t audio_cb;
+static retro_audio_sample_batch_t audio_batch_cb;
+static retro_environment_t environ_cb;
+static retro_input_poll_t input_poll_cb;
+static retro_input_state_t input_state_cb;
+
+void retro_set_environment(retro_environment_t cb)
+{
+   environ_cb = cb;
+
+   bool no_rom = true;
+   cb(RETRO_ENVIRONMENT_SET_SUPPORT_NO_GAME, &no_rom);
+}
+
+void retro_set_audio_sample(retro_audio_sample_t cb)
+{
+   audio_cb = cb;
+}
+
+void retro_set_audio_sample_batch(retro_audio_sample_batch_t cb)
+{
+   audio_batch_cb = cb;
+}
+
+void retro_set_input_poll(retro_input_poll_t cb)
+{
+   input_poll_cb = cb;
+}
+
+void retro_set_input_state(retro_input_state_t cb)
+{
+   input_state_cb = cb;
+}
+
+void retro_set_video_refresh(retro_video_refresh_t cb)
+{
+   video_cb = cb;
+}
+
+/* Culling runs on its own queue family, so the buffers it writes
+ * need queue family ownership transfers to the graphics queue. */
+static bool separate_families(void)
+{
+   return async_queue && async_queue_index != vulkan->queue_index;
+}
+
+static uint32_t cull_queue_family(void)
+{
+   return async_queue ? async_queue_index : vulkan->queue_index;
+}
+
+static uint32_t find_memory_type_from_requirements(
+      uint32_t device_requirements, uint32_t host_requirements)
+{
+   const VkPhysicalDeviceMemoryProperties *props = &vk.memory_properties;
+   for (uint32_t i = 0; i < VK_MAX_MEMORY_TYPES; i++)
+   {
+      if (device_requirements & (1u << i))
+      {
+         if ((props->memoryTypes[i].propertyFlags & host_requirements) == host_requirements)
+         {
+            return i;
+         }
+      }
+   }
+
+   return 0;
+}
+
+static void mat4_mul(float *out, const float *a, const float *b)
+{
+   for (unsigned c = 0; c < 4; c++)
+   {
+      for (unsigned r = 0; r < 4; r++)
+      {
+         float sum = 0.0f;
+         for (unsigned k = 0; k < 4; k++)
+            sum += a[k * 4 + r] * b[c * 4 + k];
+         out[c * 4 + r] = sum;
+      }
+   }
+}
+
+/* Right-handed, Y flipped and depth in [0, 1] for Vulkan clip space. */
+static void mat4_perspective(float *out, float fovy, float aspect, float znear, float zfar)
+{
+   float f = 1.0f / tanf(0.5f * fovy);
+   memset(out, 0, 16 * sizeof(float));
+   out[0] = f / aspect;
+   out[5] = -f;
+   out[10] = zfar / (znear - zfar);
+   out[11] = -1.0f;
+   out[14] = znear * zfar / (znear - zfar);
+}
+
+static void vec3_normalize(float *v)
+{
+   float len = sqrtf(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+   if (len > 0.0f)
+   {
+      v[0] /= len;
+      v[1] /= len;
+      v[2] /= len;
+   }
+}
+
+static void vec3_cross(float *out, const float *a, const float *b)
+{
+   out[0] = a[1] * b[2] - a[2] * b[1];
+   out[1] = a[2] * b[0] - a[0] * b[2];
+   out[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+static float vec3_dot(const float *a, const float *b)
+{
+   return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+static void mat4_look_at(float *out, const float *eye, const float *center, const float *up)
+{
+   float f[3] = { center[0] - eye[0], center[1] - eye[1], center[2] - eye[2] };
+   float s[3], u[3];
+   vec3_normalize(f);
+   vec3_cross(s, f, up);
+   vec3_normalize(s);
+   vec3_cross(u, s, f);
+
+   memset(out, 0, 16 * sizeof(float));
+   out[0] = s[0];
+   out[4] = s[1];
+   out[8] = s[2];
+   out[1] = u[0];
+   out[5] = u[1];
+   out[9] = u[2];
+   out[2] = -f[0];
+   out[6] = -f[1];
+   out[10] = -f[2];
+   out[12] = -vec3_dot(s, eye);
+   out[13] = -vec3_dot(u, eye);
+   out[14] = vec3_dot(f, eye);
+   out[15] = 1.0f;
+}
+
+/* Planes from the rows of the view projection, near plane first since
+ * the cull shader also uses it as view depth to pick the LOD. */
+static void extract_frustum(float frustum[6][4], const float *vp)
+{
+   static const float signs[6][4] = {
+      /* row0, row1, row2, row3 */
+      { 0.0f, 0.0f, 1.0f, 0.0f }, /* near */
+      { 0.0f, 0.0f, -1.0f, 1.0f }, /* far */
+      { 1.0f, 0.0f, 0.0f, 1.0f }, /* left */
+      { -1.0f, 0.0f, 0.0f, 1.0f }, /* right */
+      { 0.0f, 1.0f, 0.0f, 1.0f }, /* bottom */
+      { 0.0f, -1.0f, 0.0f, 1.0f }, /* top */
+   };
+
+   for (unsigned p = 0; p < 6; p++)
+   {
+      for (unsigned c = 0; c < 4; c++)
+      {
+         frustum[p][c] = 0.0f;
+         for (unsigned r = 0; r < 4; r++)
+            frustum[p][c] += signs[p][r] * vp[c * 4 + r];
+      }
+
+      float len = sqrtf(vec3_dot(frustum[p], frustum[p]));
+      for (unsigned c = 0; c < 4; c++)
+         frustum[p][c] /= len;
+   }
+}
+
+static void update_ubo(void)
+{
+   static float prev_eye[3];
+   struct global_data global;
+   float view[16], proj[16];
+   float t = frame_count * DELTA_TIME;
+
+   /* Orbit the grid while moving in and out, so every LOD shows up
+    * and the camera flies through the blocks now and then. */
+   float radius = 250.0f + 200.0f * sinf(0.3f * t);
+   float eye[3] = {
+      radius * cosf(0.2f * t),
+      40.0f * sinf(0.7f * t),
+      radius * sinf(0.2f * t),
+   };
+   static const float center[3] = { 0.0f, 0.0f, 0.0f };
+   static const float up[3] = { 0.0f, 1.0f, 0.0f };
+
+   if (frame_count == 0)
+      memcpy(prev_eye, eye, sizeof(eye));
+
+   memset(&global, 0, sizeof(global));
+   mat4_look_at(view, eye, center, up);
+   mat4_perspective(proj, 1.0f, (float)BASE_WIDTH / BASE_HEIGHT, 1.0f, 2000.0f);
+   mat4_mul(global.vp, proj, view);
+   extract_frustum(global.frustum, global.vp);
+
+   for (unsigned i = 0; i < 3; i++)
+   {
+      global.camera_pos[i] = eye[i];
+      global.camera_vel[i] = (eye[i] - prev_eye[i]) / DELTA_TIME;
+   }
+   memcpy(prev_eye, eye, sizeof(eye));
+
+   global.delta_time = DELTA_TIME;
+   global.count = NUM_INSTANCES;
+
+   void *ptr;
+   vkMapMemory(vulkan->device, vk.ubo[vk.index].memory,
+         0, sizeof(global), 0, &ptr);
+   memcpy(ptr, &global, sizeof(global));
+   vkUnmapMemory(vulkan->device, vk.ubo[vk.index].memory);
+}
+
+static void read_timings(void)
+{
+   unsigned index = vk.index;
+   uint64_t stamps[QUERY_COUNT];
+   double period = vk.gpu_properties.limits.timestampPeriod * 1e-6;
+
+   if (!vk.queries_pending[index])
+      return;
+   vk.queries_pending[index] = false;
+
+   /* The frame which last used this index is done after wait_sync_index(). */
+   if (vk.cull_timestamps && vkGetQueryPoolResults(vulkan->device, vk.query_pool[index],
+            QUERY_CULL_BEGIN, 2, 2 * sizeof(uint64_t), &stamps[QUERY_CULL_BEGIN],
+            sizeof(uint64_t), VK_QUERY_RESULT_64_BIT) != VK_SUCCESS)
+      return;
+   if (vk.draw_timestamps && vkGetQueryPoolResults(vulkan->device, vk.query_pool[index],
+            QUERY_DRAW_BEGIN, 2, 2 * sizeof(uint64_t), &stamps[QUERY_DRAW_BEGIN],
+            sizeof(uint64_t), VK_QUERY_RESULT_64_BIT) != VK_SUCCESS)
+      return;
+
+   if (vk.cull_timestamps)
+   {
+      uint64_t begin = stamps[QUERY_CULL_BEGIN] & vk.cull_timestamp_mask;
+      uint64_t end = stamps[QUERY_CULL_END] & vk.cull_timestamp_mask;
+      timing.cull_ms += (end - begin) * period;
+
+      /* Both queues count the same device clock, compare against the
+       * previous frame's draw. */
+      if (vk.draw_timestamps && timing.have_draw)
+      {
+         uint64_t lo = begin > timing.draw_begin ? begin : timing.draw_begin;
+         uint64_t hi = end < timing.draw_end ? end : timing.draw_end;
+         if (hi > lo)
+            timing.overlap_ms += (hi - lo) * period;
+      }
+   }
+
+   if (vk.draw_timestamps)
+   {
+      timing.draw_begin = stamps[QUERY_DRAW_BEGIN] & vk.draw_timestamp_mask;
+      timing.draw_end = stamps[QUERY_DRAW_END] & vk.draw_timestamp_mask;
+      timing.draw_ms += (timing.draw_end - timing.draw_begin) * period;
+      timing.have_draw = true;
+   }
+
+   if (++timing.frames < TIMING_INTERVAL)
+      return;
+
+   VkDrawIndexedIndirectCommand *draws;
+   vkMapMemory(vulkan->device, vk.indirect[index].memory,
+         0, NUM_LODS * sizeof(*draws), 0, (void**)&draws);
+   fprintf(stderr, "[libretro-test]: %u/%u/%u instances per LOD, cull %.3f ms on the %s queue, "
+         "draw %.3f ms, %.0f%% of culling overlapped the previous frame's draw.\n",
+         draws[0].instanceCount, draws[1].instanceCount, draws[2].instanceCount,
+         timing.cull_ms / timing.frames,
+         async_queue ? "async compute" : "graphics",
+         timing.draw_ms / timing.frames,
+         timing.cull_ms > 0.0 ? 100.0 * timing.overlap_ms / timing.cull_ms : 0.0);
+   vkUnmapMemory(vulkan->device, vk.indirect[index].memory);
+
+   timing.frames = 0;
+   timing.cull_ms = 0.0;
+   timing.draw_ms = 0.0;
+   timing.overlap_ms = 0.0;
+}
+
+static void record_cull(void)
+{
+   VkCommandBuffer cmd = vk.cull_cmd[vk.index];
+   VkQueryPool pool = vk.query_pool[vk.index];
+
+   VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+   begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+   vkResetCommandBuffer(cmd, 0);
+   vkBeginCommandBuffer(cmd, &begin_info);
+
+   if (vk.cull_timestamps)
+   {
+      vkCmdResetQueryPool(cmd, pool, QUERY_CULL_BEGIN, 2);
+      vkCmdWriteTimestamp(cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, pool, QUERY_CULL_BEGIN);
+   }
+
+   /* Every LOD's draw starts out with no instances. The contents from the
+    * last time this index was drawn are not needed, so the buffers are
+    * reused without transferring ownership back. */
+   VkDrawIndexedIndirectCommand draws[NUM_LODS];
+   for (unsigned i = 0; i < NUM_LODS; i++)
+   {
+      draws[i].indexCount = vk.lods[i].index_count;
+      draws[i].instanceCount = 0;
+      draws[i].firstIndex = vk.lods[i].first_index;
+      draws[i].vertexOffset = vk.lods[i].vertex_offset;
+      draws[i].firstInstance = 0;
+   }
+   vkCmdUpdateBuffer(cmd, vk.indirect[vk.index].buffer, 0, sizeof(draws), (const uint32_t*)draws);
+
+   /* The indirect reset, and the previous frame's culling of the points. */
+   VkMemoryBarrier prepare_cull = { VK_STRUCTURE_TYPE_MEMORY_BARRIER };
+   prepare_cull.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+   prepare_cull.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+   vkCmdPipelineBarrier(cmd,
+         VK_PIPELINE_STAGE_TRANSFER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+         VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+         false,
+         1, &prepare_cull,
+         0, NULL,
+         0, NULL);
+
+   vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, vk.cull_pipeline);
+   vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_COMPUTE,
+         vk.cull_pipeline_layout, 0,
+         1, &vk.cull_set[vk.index], 0, NULL);
+   vkCmdDispatch(cmd, (NUM_INSTANCES + CULL_WORKGROUP - 1) / CULL_WORKGROUP, 1, 1);
+
+   /* Release to the graphics queue, which acquires in record_draw(). */
+   if (separate_families())
+   {
+      VkBufferMemoryBarrier release[2] = {
+         { VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER },
+         { VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER },
+      };
+
+      release[0].srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+      release[0].dstAccessMask = 0;
+      release[0].srcQueueFamilyIndex = async_queue_index;
+      release[0].dstQueueFamilyIndex = vulkan->queue_index;
+      release[0].buffer = vk.indirect[vk.index].buffer;
+      release[0].offset = 0;
+      release[0].size = VK_WHOLE_SIZE;
+      release[1] = release[0];
+      release[1].buffer = vk.instances[vk.index].buffer;
+
+      vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+            VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+            false,
+            0, NULL,
+            2, release,
+            0, NULL);
+   }
+
+   if (vk.cull_timestamps)
+      vkCmdWriteTimestamp(cmd, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, pool, QUERY_CULL_END);
+
+   vkEndCommandBuffer(cmd);
+}
+
+static void record_draw(void)
+{
+   VkCommandBuffer cmd = vk.draw_cmd[vk.index];
+   VkQueryPool pool = vk.query_pool[vk.index];
+
+   VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+   begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+   vkResetCommandBuffer(cmd, 0);
+   vkBeginCommandBuffer(cmd, &begin_info);
+
+   if (vk.draw_timestamps)
+   {
+      vkCmdResetQueryPool(cmd, pool, QUERY_DRAW_BEGIN, 2);
+      vkCmdWriteTimestamp(cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, pool, QUERY_DRAW_BEGIN);
+   }
+
+   /* Acquire the culling results, after the semaphore wait at the same stages. */
+   VkBufferMemoryBarrier acquire[2] = {
+      { VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER },
+      { VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER },
+   };
+
+   if (separate_families())
+   {
+      acquire[0].srcAccessMask = 0;
+      acquire[0].srcQueueFamilyIndex = async_queue_index;
+      acquire[0].dstQueueFamilyIndex = vulkan->queue_index;
+   }
+   else
+   {
+      acquire[0].srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+      acquire[0].srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+      acquire[0].dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+   }
+   acquire[0].offset = 0;
+   acquire[0].size = VK_WHOLE_SIZE;
+   acquire[1] = acquire[0];
+   acquire[0].dstAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+   acquire[0].buffer = vk.indirect[vk.index].buffer;
+   acquire[1].dstAccessMask = VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT;
+   acquire[1].buffer = vk.instances[vk.index].buffer;
+
+   vkCmdPipelineBarrier(cmd,
+         separate_families() ?
+         VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_INPUT_BIT :
+         VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+         VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_INPUT_BIT,
+         false,
+         0, NULL,
+         2, acquire,
+         0, NULL);
+
+   VkImageMemoryBarrier prepare_rendering = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
+   prepare_rendering.srcAccessMask = 0;
+   prepare_rendering.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_COLOR_ATTACHMENT_READ_BIT;
+   prepare_rendering.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+   prepare_rendering.newLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+   prepare_rendering.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+   prepare_rendering.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+   prepare_rendering.image = vk.images[vk.index].create_info.image;
+   prepare_rendering.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+   prepare_rendering.subresourceRange.levelCount = 1;
+   prepare_rendering.subresourceRange.layerCount = 1;
+   vkCmdPipelineBarrier(cmd,
+         VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+         false,
+         0, NULL,
+         0, NULL,
+         1, &prepare_rendering);
+
+   VkClearValue clear_values[2];
+   memset(clear_values, 0, sizeof(clear_values));
+   clear_values[0].color.float32[0] = 0.1f;
+   clear_values[0].color.float32[1] = 0.1f;
+   clear_values[0].color.float32[2] = 0.15f;
+   clear_values[0].color.float32[3] = 1.0f;
+   clear_values[1].depthStencil.depth = 1.0f;
+
+   VkRenderPassBeginInfo rp_begin = { VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO };
+   rp_begin.renderPass = vk.render_pass;
+   rp_begin.framebuffer = vk.framebuffers[vk.index];
+   rp_begin.renderArea.extent.width = BASE_WIDTH;
+   rp_begin.renderArea.extent.height = BASE_HEIGHT;
+   rp_begin.clearValueCount = 2;
+   rp_begin.pClearValues = clear_values;
+   vkCmdBeginRenderPass(cmd, &rp_begin, VK_SUBPASS_CONTENTS_INLINE);
+
+   vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, vk.draw_pipeline);
+   vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS,
+         vk.draw_pipeline_layout, 0,
+         1, &vk.draw_set[vk.index], 0, NULL);
+
+   VkViewport vp = { 0 };
+   vp.width = BASE_WIDTH;
+   vp.height = BASE_HEIGHT;
+   vp.minDepth = 0.0f;
+   vp.maxDepth = 1.0f;
+   vkCmdSetViewport(cmd, 0, 1, &vp);
+
+   VkRect2D scissor;
+   memset(&scissor, 0, sizeof(scissor));
+   scissor.extent.width = BASE_WIDTH;
+   scissor.extent.height = BASE_HEIGHT;
+   vkCmdSetScissor(cmd, 0, 1, &scissor);
+
+   VkDeviceSize offset = 0;
+   vkCmdBindVertexBuffers(cmd, 0, 1, &vk.vbo.buffer, &offset);
+   vkCmdBindIndexBuffer(cmd, vk.ibo.buffer, 0, VK_INDEX_TYPE_UINT16);
+
+   static const float lod_colors[NUM_LODS][4] = {
+      { 0.8f, 0.6f, 0.2f, 1.0f },
+      { 0.3f, 0.7f, 0.4f, 1.0f },
+      { 0.3f, 0.4f, 0.9f, 1.0f },
+   };
+
+   /* One indirect draw per LOD, the instance list for LOD n starts at
+    * n * NUM_INSTANCES. Bound as a vertex buffer offset rather than
+    * firstInstance, which would need drawIndirectFirstInstance. */
+   for (unsigned i = 0; i < NUM_LODS; i++)
+   {
+      VkDeviceSize instance_offset = (VkDeviceSize)i * NUM_INSTANCES * 4 * sizeof(float);
+      vkCmdBindVertexBuffers(cmd, 1, 1, &vk.instances[vk.index].buffer, &instance_offset);
+      vkCmdPushConstants(cmd, vk.draw_pipeline_layout,
+            VK_SHADER_STAGE_FRAGMENT_BIT,
+            0, sizeof(lod_colors[i]), lod_colors[i]);
+      vkCmdDrawIndexedIndirect(cmd, vk.indirect[vk.index].buffer,
+            i * sizeof(VkDrawIndexedIndirectCommand), 1,
+            sizeof(VkDrawIndexedIndirectCommand));
+   }
+
+   vkCmdEndRenderPass(cmd);
+
+   VkImageMemoryBarrier prepare_presentation = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
+   prepare_presentation.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+   prepare_presentation.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+   prepare_presentation.oldLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+   prepare_presentation.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+   prepare_presentation.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+   prepare_presentation.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+   prepare_presentation.image = vk.images[vk.index].create_info.image;
+   prepare_presentation.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+   prepare_presentation.subresourceRange.levelCount = 1;
+   prepare_presentation.subresourceRange.layerCount = 1;
+   vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT,
+         VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+         false,
+         0, NULL,
+         0, NULL,
+         1, &prepare_presentation);
+
+   if (vk.draw_timestamps)
+      vkCmdWriteTimestamp(cmd, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, pool, QUERY_DRAW_END);
+
+   vkEndCommandBuffer(cmd);
+}
+
+/* Frame N's culling is submitted to the async queue right after frame
+ * N-1's draw went to the graphics queue, and only frame N's draw waits
+ * for it, so the two can run at the same time. */
+static void vulkan_test_render(void)
+{
+   update_ubo();
+   record_cull();
+   record_draw();
+
+   VkSubmitInfo submit = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+   submit.commandBufferCount = 1;
+   submit.pCommandBuffers = &vk.cull_cmd[vk.index];
+   submit.signalSemaphoreCount = 1;
+   submit.pSignalSemaphores = &vk.cull_semaphores[vk.index];
+
+   if (!async_queue)
+      vulkan->lock_queue(vulkan->handle);
+   vkQueueSubmit(async_queue != VK_NULL_HANDLE ? async_queue : vulkan->queue,
+         1, &submit, VK_NULL_HANDLE);
+   if (!async_queue)
+      vulkan->unlock_queue(vulkan->handle);
+
+   const VkPipelineStageFlags wait_stage =
+      VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_INPUT_BIT;
+   submit.waitSemaphoreCount = 1;
+   submit.pWaitSemaphores = &vk.cull_semaphores[vk.index];
+   submit.pWaitDstStageMask = &wait_stage;
+   submit.pCommandBuffers = &vk.draw_cmd[vk.index];
+   submit.pSignalSemaphores = &vk.draw_semaphores[vk.index];
+
+   vulkan->lock_queue(vulkan->handle);
+   vkQueueSubmit(vulkan->queue, 1, &submit, VK_NULL_HANDLE);
+   vulkan->unlock_queue(vulkan->handle);
+
+   vk.queries_pending[vk.index] = vk.cull_timestamps || vk.draw_timestamps;
+   frame_count++;
+}
+
+static struct buffer create_buffer(const void *initial, size_t size,
+      VkBufferUsageFlags usage, bool shared)
+{
+   struct buffer buffer;
+   VkDevice device = vulkan->device;
+
+   VkBufferCreateInfo info = { VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
+   info.usage = usage;
+   info.size = size;
+
+   uint32_t share_queues[] = { async_queue_index, vulkan->queue_index };
+   if (shared && separate_families())
+   {
+      info.sharingMode = VK_SHARING_MODE_CONCURRENT;
+      info.queueFamilyIndexCount = 2;
+      info.pQueueFamilyIndices = share_queues;
+   }
+
+   vkCreateBuffer(device, &info, NULL, &buffer.buffer);
+
+   VkMemoryRequirements mem_reqs;
+   vkGetBufferMemoryRequirements(device, buffer.buffer, &mem_reqs);
+
+   VkMemoryAllocateInfo alloc = { VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO };
+   alloc.allocationSize = mem_reqs.size;
+
+   alloc.memoryTypeIndex = find_memory_type_from_requirements(mem_reqs.memoryTypeBits,
+         VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+   vkAllocateMemory(device, &alloc, NULL, &buffer.memory);
+   vkBindBufferMemory(device, buffer.buffer, buffer.memory, 0);
+
+   if (initial)
+   {
+      void *ptr;
+      vkMapMemory(device, buffer.memory, 0, size, 0, &ptr);
+      memcpy(ptr, initial, size);
+      vkUnmapMemory(device, buffer.memory);
+   }
+
+   return buffer;
+}
+
+static void destroy_buffer(struct buffer *buffer)
+{
+   vkFreeMemory(vulkan->device, buffer->memory, NULL);
+   vkDestroyBuffer(vulkan->device, buffer->buffer, NULL);
+}
+
+/* Flat shaded triangle, wound counter-clockwise seen from outside. */
+static void add_triangle(struct vertex *vertices, uint16_t *indices, unsigned *count,
+      const float *a, const float *b, const float *c)
+{
+   float ab[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+   float ac[3] = { c[0] - a[0], c[1] - a[1], c[2] - a[2] };
+   float centroid[3] = { a[0] + b[0] + c[0], a[1] + b[1] + c[1], a[2] + b[2] + c[2] };
+   const float *corners[3] = { a, b, c };
+   float normal[3];
+
+   vec3_cross(normal, ab, ac);
+   if (vec3_dot(normal, centroid) < 0.0f)
+   {
+      corners[1] = c;
+      corners[2] = b;
+      normal[0] = -normal[0];
+      normal[1] = -normal[1];
+      normal[2] = -normal[2];
+   }
+   vec3_normalize(normal);
+
+   for (unsigned i = 0; i < 3; i++)
+   {
+      memcpy(vertices[*count].pos, corners[i], sizeof(vertices[*count].pos));
+      memcpy(vertices[*count].normal, normal, sizeof(normal));
+      indices[*count] = (uint16_t)*count;
+      (*count)++;
+   }
+}
+
+/* LOD0 is a cube, LOD1 an octahedron and LOD2 a tetrahedron, all with
+ * the block's bounding radius. */
+static void init_meshes(void)
+{
+   struct vertex vertices[36 + 24 + 12];
+   uint16_t indices[36 + 24 + 12];
+   unsigned count = 0;
+
+   static const float cube[8][3] = {
+      { -1.0f, -1.0f, -1.0f }, { 1.0f, -1.0f, -1.0f },
+      { -1.0f, 1.0f, -1.0f }, { 1.0f, 1.0f, -1.0f },
+      { -1.0f, -1.0f, 1.0f }, { 1.0f, -1.0f, 1.0f },
+      { -1.0f, 1.0f, 1.0f }, { 1.0f, 1.0f, 1.0f },
+   };
+   static const unsigned cube_faces[6][4] = {
+      { 0, 1, 3, 2 }, { 4, 5, 7, 6 },
+      { 0, 1, 5, 4 }, { 2, 3, 7, 6 },
+      { 0, 2, 6, 4 }, { 1, 3, 7, 5 },
+   };
+
+   vk.lods[0].first_index = count;
+   for (unsigned i = 0; i < 6; i++)
+   {
+      const unsigned *f = cube_faces[i];
+      add_triangle(vertices, indices, &count, cube[f[0]], cube[f[1]], cube[f[2]]);
+      add_triangle(vertices, indices, &count, cube[f[0]], cube[f[2]], cube[f[3]]);
+   }
+   vk.lods[0].index_count = count - vk.lods[0].first_index;
+
+   const float r = INSTANCE_RADIUS;
+   const float octahedron[6][3] = {
+      { r, 0.0f, 0.0f }, { -r, 0.0f, 0.0f },
+      { 0.0f, r, 0.0f }, { 0.0f, -r, 0.0f },
+      { 0.0f, 0.0f, r }, { 0.0f, 0.0f, -r },
+   };
+
+   vk.lods[1].first_index = count;
+   for (unsigned x = 0; x < 2; x++)
+      for (unsigned y = 2; y < 4; y++)
+         for (unsigned z = 4; z < 6; z++)
+            add_triangle(vertices, indices, &count, octahedron[x], octahedron[y], octahedron[z]);
+   vk.lods[1].index_count = count - vk.lods[1].first_index;
+
+   const float t = r / sqrtf(3.0f);
+   const float tetrahedron[4][3] = {
+      { t, t, t }, { t, -t, -t },
+      { -t, t, -t }, { -t, -t, t },
+   };
+
+   vk.lods[2].first_index = count;
+   for (unsigned i = 0; i < 4; i++)
+      add_triangle(vertices, indices, &count,
+            tetrahedron[(i + 1) & 3], tetrahedron[(i + 2) & 3], tetrahedron[(i + 3) & 3]);
+   vk.lods[2].index_count = count - vk.lods[2].first_index;
+
+   for (unsigned i = 0; i < NUM_LODS; i++)
+      vk.lods[i].vertex_offset = 0;
+
+   vk.vbo = create_buffer(vertices, count * sizeof(vertices[0]),
+         VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, false);
+   vk.ibo = create_buffer(indices, count * sizeof(indices[0]),
+         VK_BUFFER_USAGE_INDEX_BUFFER_BIT, false);
+}
+
+static void init_buffers(void)
+{
+   /* The blocks start at rest on a grid, pos.w is the bounding radius. */
+   float *points = calloc(NUM_INSTANCES, 8 * sizeof(float));
+   const float base = -0.5f * (GRID_SIZE - 1) * GRID_SPACING;
+   for (unsigned z = 0; z < GRID_SIZE; z++)
+   {
+      for (unsigned y = 0; y < GRID_SIZE; y++)
+      {
+         for (unsigned x = 0; x < GRID_SIZE; x++)
+         {
+            float *point = points + 8 * ((z * GRID_SIZE + y) * GRID_SIZE + x);
+            point[0] = base + x * GRID_SPACING;
+            point[1] = base + y * GRID_SPACING;
+            point[2] = base + z * GRID_SPACING;
+            point[3] = INSTANCE_RADIUS;
+         }
+      }
+   }
+
+   vk.points = create_buffer(points, NUM_INSTANCES * 8 * sizeof(float),
+         VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, false);
+   free(points);
+
+   for (unsigned i = 0; i < vk.num_swapchain_images; i++)
+   {
+      vk.ubo[i] = create_buffer(NULL, sizeof(struct global_data),
+            VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, true);
+      vk.instances[i] = create_buffer(NULL, NUM_LODS * NUM_INSTANCES * 4 * sizeof(float),
+            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, false);
+      vk.indirect[i] = create_buffer(NULL, NUM_LODS * sizeof(VkDrawIndexedIndirectCommand),
+            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT |
+            VK_BUFFER_USAGE_TRANSFER_DST_BIT, false);
+   }
+}
+
+static VkShaderModule create_shader_module(const uint32_t *data, size_t size)
+{
+   VkShaderModuleCreateInfo module_info = { VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO };
+   VkShaderModule module;
+   module_info.codeSize = size;
+   module_info.pCode = data;
+   vkCreateShaderModule(vulkan->device, &module_info, NULL, &module);
+   return module;
+}
+
+static void init_descriptor(void)
+{
+   VkDevice device = vulkan->device;
+
+   VkDescriptorSetLayoutBinding cull_bindings[4];
+   memset(cull_bindings, 0, sizeof(cull_bindings));
+   for (unsigned i = 0; i < 4; i++)
+   {
+      cull_bindings[i].binding = i;
+      cull_bindings[i].descriptorType = i == 0 ?
+         VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER : VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+      cull_bindings[i].descriptorCount = 1;
+      cull_bindings[i].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+   }
+
+   VkDescriptorSetLayoutBinding draw_binding = {0};
+   draw_binding.binding = 0;
+   draw_binding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+   draw_binding.descriptorCount = 1;
+   draw_binding.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+
+   const VkDescriptorPoolSize pool_sizes[2] = {
+      { VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 2 * vk.num_swapchain_images },
+      { VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 3 * vk.num_swapchain_images },
+   };
+
+   const VkPushConstantRange range = {
+      VK_SHADER_STAGE_FRAGMENT_BIT,
+      0, 16,
+   };
+
+   VkDescriptorSetLayoutCreateInfo set_layout_info = { VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO };
+   set_layout_info.bindingCount = 4;
+   set_layout_info.pBindings = cull_bindings;
+   vkCreateDescriptorSetLayout(device, &set_layout_info, NULL, &vk.cull_set_layout);
+   set_layout_info.bindingCount = 1;
+   set_layout_info.pBindings = &draw_binding;
+   vkCreateDescriptorSetLayout(device, &set_layout_info, NULL, &vk.draw_set_layout);
+
+   VkPipelineLayoutCreateInfo layout_info = { VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO };
+   layout_info.setLayoutCount = 1;
+   layout_info.pSetLayouts = &vk.cull_set_layout;
+   vkCreatePipelineLayout(device, &layout_info, NULL, &vk.cull_pipeline_layout);
+   layout_info.pSetLayouts = &vk.draw_set_layout;
+   layout_info.pushConstantRangeCount = 1;
+   layout_info.pPushConstantRanges = &range;
+   vkCreatePipelineLayout(device, &layout_info, NULL, &vk.draw_pipeline_layout);
+
+   VkDescriptorPoolCreateInfo pool_info = { VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO };
+   pool_info.maxSets = 2 * vk.num_swapchain_images;
+   pool_info.poolSizeCount = 2;
+   pool_info.pPoolSizes = pool_sizes;
+   pool_info.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
+   vkCreateDescriptorPool(device, &pool_info, NULL, &vk.desc_pool);
+
+   VkDescriptorSetAllocateInfo alloc_info = { VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO };
+   alloc_info.descriptorPool = vk.desc_pool;
+   alloc_info.descriptorSetCount = 1;
+
+   for (unsigned i = 0; i < vk.num_swapchain_images; i++)
+   {
+      alloc_info.pSetLayouts = &vk.cull_set_layout;
+      vkAllocateDescriptorSets(device, &alloc_info, &vk.cull_set[i]);
+      alloc_info.pSetLayouts = &vk.draw_set_layout;
+      vkAllocateDescriptorSets(device, &alloc_info, &vk.draw_set[i]);
+
+      const struct buffer *buffers[4] = {
+         &vk.ubo[i], &vk.points, &vk.instances[i], &vk.indirect[i],
+      };
+      VkDescriptorBufferInfo buffer_info[4];
+      VkWriteDescriptorSet writes[5];
+      memset(writes, 0, sizeof(writes));
+
+      for (unsigned j = 0; j < 4; j++)
+      {
+         buffer_info[j].buffer = buffers[j]->buffer;
+         buffer_info[j].offset = 0;
+         buffer_info[j].range = VK_WHOLE_SIZE;
+
+         writes[j].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+         writes[j].dstSet = vk.cull_set[i];
+         writes[j].dstBinding = j;
+         writes[j].descriptorCount = 1;
+         writes[j].descriptorType = cull_bindings[j].descriptorType;
+         writes[j].pBufferInfo = &buffer_info[j];
+      }
+
+      writes[4] = writes[0];
+      writes[4].dstSet = vk.draw_set[i];
+
+      vkUpdateDescriptorSets(device, 5, writes, 0, NULL);
+   }
+}
+
+static void init_cull_pipeline(void)
+{
+   VkDevice device = vulkan->device;
+
+   static const uint32_t cull_comp[] =
+#include "shaders/cull.comp.inc"
+      ;
+
+   VkComputePipelineCreateInfo pipe = { VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO };
+
+   pipe.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+   pipe.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+   pipe.stage.module = create_shader_module(cull_comp, sizeof(cull_comp));
+   pipe.stage.pName = "main";
+   pipe.layout = vk.cull_pipeline_layout;
+
+   vkCreateComputePipelines(device, vk.pipeline_cache, 1, &pipe, NULL, &vk.cull_pipeline);
+   vkDestroyShaderModule(device, pipe.stage.module, NULL);
+}
+
+static void init_draw_pipeline(void)
+{
+   VkDevice device = vulkan->device;
+
+   VkPipelineInputAssemblyStateCreateInfo input_assembly = { VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO };
+   input_assembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+
+   VkVertexInputAttributeDescription attributes[3] = {{ 0 }};
+   attributes[0].location = 0;
+   attributes[0].binding = 0;
+   attributes[0].format = VK_FORMAT_R32G32B32_SFLOAT;
+   attributes[0].offset = 0;
+   attributes[1].location = 1;
+   attributes[1].binding = 0;
+   attributes[1].format = VK_FORMAT_R32G32B32_SFLOAT;
+   attributes[1].offset = 3 * sizeof(float);
+   attributes[2].location = 2;
+   attributes[2].binding = 1;
+   attributes[2].format = VK_FORMAT_R32G32B32A32_SFLOAT;
+   attributes[2].offset = 0;
+
+   VkVertexInputBindingDescription bindings[2] = {{ 0 }};
+   bindings[0].binding = 0;
+   bindings[0].stride = sizeof(struct vertex);
+   bindings[0].inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+   bindings[1].binding = 1;
+   bindings[1].stride = 4 * sizeof(float);
+   bindings[1].inputRate = VK_VERTEX_INPUT_RATE_INSTANCE;
+
+   VkPipelineVertexInputStateCreateInfo vertex_input = { VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO };
+   vertex_input.vertexBindingDescriptionCount = 2;
+   vertex_input.pVertexBindingDescriptions = bindings;
+   vertex_input.vertexAttributeDescriptionCount = 3;
+   vertex_input.pVertexAttributeDescriptions = attributes;
+
+   VkPipelineRasterizationStateCreateInfo raster = { VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO };
+   raster.polygonMode = VK_POLYGON_MODE_FILL;
+   raster.cullMode = VK_CULL_MODE_BACK_BIT;
+   raster.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+   raster.depthClampEnable = false;
+   raster.rasterizerDiscardEnable = false;
+   raster.depthBiasEnable = false;
+   raster.lineWidth = 1.0f;
+
+   VkPipelineColorBlendAttachmentState blend_attachment = { 0 };
+   blend_attachment.blendEnable = false;
+   blend_attachment.colorWriteMask = 0xf;
+
+   VkPipelineColorBlendStateCreateInfo blend = { VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO };
+   blend.attachmentCount = 1;
+   blend.pAttachments = &blend_attachment;
+
+   VkPipelineViewportStateCreateInfo viewport = { VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO };
+   viewport.viewportCount = 1;
+   viewport.scissorCount = 1;
+
+   VkPipelineDepthStencilStateCreateInfo depth_stencil = { VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO };
+   depth_stencil.depthTestEnable = true;
+   depth_stencil.depthWriteEnable = true;
+   depth_stencil.depthCompareOp = VK_COMPARE_OP_LESS;
+   depth_stencil.depthBoundsTestEnable = false;
+   depth_stencil.stencilTestEnable = false;
+
+   VkPipelineMultisampleStateCreateInfo multisample = { VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO };
+   multisample.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+
+   static const VkDynamicState dynamics[] = {
+      VK_DYNAMIC_STATE_VIEWPORT,
+      VK_DYNAMIC_STATE_SCISSOR,
+   };
+   VkPipelineDynamicStateCreateInfo dynamic = { VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO };
+   dynamic.pDynamicStates = dynamics;
+   dynamic.dynamicStateCount = sizeof(dynamics) / sizeof(dynamics[0]);
+
+   VkPipelineShaderStageCreateInfo shader_stages[2] = {
+      { VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO },
+      { VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO },
+   };
+
+   static const uint32_t box_vert[] =
+#include "shaders/box.vert.inc"
+      ;
+
+   static const uint32_t box_frag[] =
+#include "shaders/box.frag.inc"
+      ;
+
+   shader_stages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+   shader_stages[0].module = create_shader_module(box_vert, sizeof(box_vert));
+   shader_stages[0].pName = "main";
+   shader_stages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+   shader_stages[1].module = create_shader_module(box_frag, sizeof(box_frag));
+   shader_stages[1].pName = "main";
+
+   VkGraphicsPipelineCreateInfo pipe = { VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO };
+   pipe.stageCount = 2;
+   pipe.pStages = shader_stages;
+   pipe.pVertexInputState = &vertex_input;
+   pipe.pInputAssemblyState = &input_assembly;
+   pipe.pRasterizationState = &raster;
+   pipe.pColorBlendState = &blend;
+   pipe.pMultisampleState = &multisample;
+   pipe.pViewportState = &viewport;
+   pipe.pDepthStencilState = &depth_stencil;
+   pipe.pDynamicState = &dynamic;
+   pipe.renderPass = vk.render_pass;
+   pipe.layout = vk.draw_pipeline_layout;
+
+   vkCreateGraphicsPipelines(device, vk.pipeline_cache, 1, &pipe, NULL, &vk.draw_pipeline);
+
+   vkDestroyShaderModule(device, shader_stages[0].module, NULL);
+   vkDestroyShaderModule(device, shader_stages[1].module, NULL);
+}
+
+static void init_render_pass(VkFormat format)
+{
+   VkAttachmentDescription attachments[2] = {{ 0 }};
+   attachments[0].format = format;
+   attachments[0].samples = VK_SAMPLE_COUNT_1_BIT;
+   attachments[0].loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+   attachments[0].storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+   attachments[0].stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+   attachments[0].stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+   attachments[0].initialLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+   attachments[0].finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+   attachments[1].format = VK_FORMAT_D16_UNORM;
+   attachments[1].samples = VK_SAMPLE_COUNT_1_BIT;
+   attachments[1].loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+   attachments[1].storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+   attachments[1].stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+   attachments[1].stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+   attachments[1].initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+   attachments[1].finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+
+   VkAttachmentReference color_ref = { 0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL };
+   VkAttachmentReference depth_ref = { 1, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL };
+   VkSubpassDescription subpass = { 0 };
+   subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+   subpass.colorAttachmentCount = 1;
+   subpass.pColorAttachments = &color_ref;
+   subpass.pDepthStencilAttachment = &depth_ref;
+
+   VkRenderPassCreateInfo rp_info = { VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO };
+   rp_info.attachmentCount = 2;
+   rp_info.pAttachments = attachments;
+   rp_info.subpassCount = 1;
+   rp_info.pSubpasses = &subpass;
+   vkCreateRenderPass(vulkan->device, &rp_info, NULL, &vk.render_pass);
+}
+
+static void init_swapchain(void)
+{
+   VkDevice device = vulkan->device;
+
+   for (unsigned i = 0; i < vk.num_swapchain_images; i++)
+   {
+      VkImageCreateInfo image = { VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO };
+
+      image.imageType = VK_IMAGE_TYPE_2D;
+      image.flags |= VK_IMAGE_CREATE_MUTABLE_FORMAT_BIT;
+      image.format = VK_FORMAT_R8G8B8A8_UNORM;
+      image.extent.width = BASE_WIDTH;
+      image.extent.height = BASE_HEIGHT;
+      image.extent.depth = 1;
+      image.samples = VK_SAMPLE_COUNT_1_BIT;
+      image.tiling = VK_IMAGE_TILING_OPTIMAL;
+      image.usage =
+         VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT |
+         VK_IMAGE_USAGE_SAMPLED_BIT |
+         VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+      image.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+      image.mipLevels = 1;
+      image.arrayLayers = 1;
+
+      vkCreateImage(device, &image, NULL, &vk.images[i].create_info.image);
+
+      VkMemoryAllocateInfo alloc = { VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO };
+      VkMemoryRequirements mem_reqs;
+
+      vkGetImageMemoryRequirements(device, vk.images[i].create_info.image, &mem_reqs);
+      alloc.allocationSize = mem_reqs.size;
+      alloc.memoryTypeIndex = find_memory_type_from_requirements(
+            mem_reqs.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+      vkAllocateMemory(device, &alloc, NULL, &vk.image_memory[i]);
+      vkBindImageMemory(device, vk.images[i].create_info.image, vk.image_memory[i], 0);
+
+      vk.images[i].create_info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+      vk.images[i].create_info.viewType = VK_IMAGE_VIEW_TYPE_2D;
+      vk.images[i].create_info.format = VK_FORMAT_R8G8B8A8_UNORM;
+      vk.images[i].create_info.subresourceRange.baseMipLevel = 0;
+      vk.images[i].create_info.subresourceRange.baseArrayLayer = 0;
+      vk.images[i].create_info.subresourceRange.levelCount = 1;
+      vk.images[i].create_info.subresourceRange.layerCount = 1;
+      vk.images[i].create_info.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+      vk.images[i].create_info.components.r = VK_COMPONENT_SWIZZLE_R;
+      vk.images[i].create_info.components.g = VK_COMPONENT_SWIZZLE_G;
+      vk.images[i].create_info.components.b = VK_COMPONENT_SWIZZLE_B;
+      vk.images[i].create_info.components.a = VK_COMPONENT_SWIZZLE_A;
+
+      vkCreateImageView(device, &vk.images[i].create_info,
+            NULL, &vk.images[i].image_view);
+      vk.images[i].image_layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+      image.flags = 0;
+      image.format = VK_FORMAT_D16_UNORM;
+      image.usage = VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
+      vkCreateImage(device, &image, NULL, &vk.depth_images[i]);
+
+      vkGetImageMemoryRequirements(device, vk.depth_images[i], &mem_reqs);
+      alloc.allocationSize = mem_reqs.size;
+      alloc.memoryTypeIndex = find_memory_type_from_requirements(
+            mem_reqs.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+      vkAllocateMemory(device, &alloc, NULL, &vk.depth_memory[i]);
+      vkBindImageMemory(device, vk.depth_images[i], vk.depth_memory[i], 0);
+
+      VkImageViewCreateInfo depth_view = vk.images[i].create_info;
+      depth_view.image = vk.depth_images[i];
+      depth_view.format = VK_FORMAT_D16_UNORM;
+      depth_view.subresourceRange.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
+      vkCreateImageView(device, &depth_view, NULL, &vk.depth_views[i]);
+
+      VkImageView views[2] = { vk.images[i].image_view, vk.depth_views[i] };
+      VkFramebufferCreateInfo fb_info = { VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO };
+      fb_info.renderPass = vk.render_pass;
+      fb_info.attachmentCount = 2;
+      fb_info.pAttachments = views;
+      fb_info.width = BASE_WIDTH;
+      fb_info.height = BASE_HEIGHT;
+      fb_info.layers = 1;
+
+      vkCreateFramebuffer(device, &fb_info, NULL, &vk.framebuffers[i]);
+
+      VkSemaphoreCreateInfo sem_info = { VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO };
+      vkCreateSemaphore(device, &sem_info, NULL, &vk.cull_semaphores[i]);
+      vkCreateSemaphore(device, &sem_info, NULL, &vk.draw_semaphores[i]);
+   }
+}
+
+static void init_command(void)
+{
+   VkCommandPoolCreateInfo pool_info = { VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
+   VkCommandBufferAllocateInfo info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+
+   pool_info.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+   info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+   info.commandBufferCount = 1;
+
+   for (unsigned i = 0; i < vk.num_swapchain_images; i++)
+   {
+      pool_info.queueFamilyIndex = cull_queue_family();
+      vkCreateCommandPool(vulkan->device, &pool_info, NULL, &vk.cull_cmd_pool[i]);
+      info.commandPool = vk.cull_cmd_pool[i];
+      vkAllocateCommandBuffers(vulkan->device, &info, &vk.cull_cmd[i]);
+
+      pool_info.queueFamilyIndex = vulkan->queue_index;
+      vkCreateCommandPool(vulkan->device, &pool_info, NULL, &vk.draw_cmd_pool[i]);
+      info.commandPool = vk.draw_cmd_pool[i];
+      vkAllocateCommandBuffers(vulkan->device, &info, &vk.draw_cmd[i]);
+   }
+}
+
+static uint64_t timestamp_mask(uint32_t valid_bits)
+{
+   return valid_bits >= 64 ? ~UINT64_C(0) : (UINT64_C(1) << valid_bits) - 1;
+}
+
+static void init_queries(void)
+{
+   uint32_t queue_count;
+   VkQueueFamilyProperties *queue_properties;
+
+   vkGetPhysicalDeviceQueueFamilyProperties(vulkan->gpu, &queue_count, NULL);
+   queue_properties = calloc(queue_count, sizeof(*queue_properties));
+   if (!queue_properties)
+      return;
+   vkGetPhysicalDeviceQueueFamilyProperties(vulkan->gpu, &queue_count, queue_properties);
+
+   uint32_t cull_bits = queue_properties[cull_queue_family()].timestampValidBits;
+   uint32_t draw_bits = queue_properties[vulkan->queue_index].timestampValidBits;
+   free(queue_properties);
+
+   vk.cull_timestamps = cull_bits != 0;
+   vk.draw_timestamps = draw_bits != 0;
+   vk.cull_timestamp_mask = timestamp_mask(cull_bits);
+   vk.draw_timestamp_mask = timestamp_mask(draw_bits);
+
+   if (!vk.cull_timestamps || !vk.draw_timestamps)
+      fprintf(stderr, "[libretro-test]: No timestamps on the %s queue, timings will be partial.\n",
+            vk.cull_timestamps ? "graphics" : "culling");
+
+   VkQueryPoolCreateInfo pool_info = { VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO };
+   pool_info.queryType = VK_QUERY_TYPE_TIMESTAMP;
+   pool_info.queryCount = QUERY_COUNT;
+
+   for (unsigned i = 0; i < vk.num_swapchain_images; i++)
+      vkCreateQueryPool(vulkan->device, &pool_info, NULL, &vk.query_pool[i]);
+}
+
+static void vulkan_test_init(void)
+{
+   vkGetPhysicalDeviceProperties(vulkan->gpu, &vk.gpu_properties);
+   vkGetPhysicalDeviceMemoryProperties(vulkan->gpu, &vk.memory_properties);
+
+   unsigned num_images = 0;
+   uint32_t mask = vulkan->get_sync_index_mask(vulkan->handle);
+   for (unsigned i = 0; i < 32; i++)
+      if (mask & (1u << i))
+         num_images = i + 1;
+   vk.num_swapchain_images = num_images;
+   vk.swapchain_mask = mask;
+
+   init_meshes();
+   init_buffers();
+   init_command();
+   init_queries();
+   init_render_pass(VK_FORMAT_R8G8B8A8_UNORM);
+   init_swapchain();
+   init_descriptor();
+
+   VkPipelineCacheCreateInfo pipeline_cache_info = { VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO };
+   vkCreatePipelineCache(vulkan->device, &pipeline_cache_info,
+         NULL, &vk.pipeline_cache);
+
+   init_cull_pipeline();
+   init_draw_pipeline();
+
+   memset(&timing, 0, sizeof(timing));
+   frame_count = 0;
+}
+
+static void vulkan_test_deinit(void)
+{
+   if (!vulkan)
+      return;
+
+   VkDevice device = vulkan->device;
+   vkDeviceWaitIdle(device);
+
+   for (unsigned i = 0; i < vk.num_swapchain_images; i++)
+   {
+      vkDestroyFramebuffer(device, vk.framebuffers[i], NULL);
+      vkDestroyImageView(device, vk.images[i].image_view, NULL);
+      vkFreeMemory(device, vk.image_memory[i], NULL);
+      vkDestroyImage(device, vk.images[i].create_info.image, NULL);
+      vkDestroyImageView(device, vk.depth_views[i], NULL);
+      vkFreeMemory(device, vk.depth_memory[i], NULL);
+      vkDestroyImage(device, vk.depth_images[i], NULL);
+      vkDestroySemaphore(device, vk.cull_semaphores[i], NULL);
+      vkDestroySemaphore(device, vk.draw_semaphores[i], NULL);
+      vkDestroyQueryPool(device, vk.query_pool[i], NULL);
+
+      destroy_buffer(&vk.ubo[i]);
+      destroy_buffer(&vk.instances[i]);
+      destroy_buffer(&vk.indirect[i]);
+   }
+
+   destroy_buffer(&vk.points);
+   destroy_buffer(&vk.vbo);
+   destroy_buffer(&vk.ibo);
+
+   vkFreeDescriptorSets(device, vk.desc_pool, vk.num_swapchain_images, vk.cull_set);
+   vkFreeDescriptorSets(device, vk.desc_pool, vk.num_swapchain_images, vk.draw_set);
+   vkDestroyDescriptorPool(device, vk.desc_pool, NULL);
+
+   vkDestroyRenderPass(device, vk.render_pass, NULL);
+   vkDestroyPipeline(device, vk.cull_pipeline, NULL);
+   vkDestroyPipeline(device, vk.draw_pipeline, NULL);
+   vkDestroyDescriptorSetLayout(device, vk.cull_set_layout, NULL);
+   vkDestroyDescriptorSetLayout(device, vk.draw_set_layout, NULL);
+   vkDestroyPipelineLayout(device, vk.cull_pipeline_layout, NULL);
+   vkDestroyPipelineLayout(device, vk.draw_pipeline_layout, NULL);
+   vkDestroyPipelineCache(device, vk.pipeline_cache, NULL);
+
+   for (unsigned i = 0; i < vk.num_swapchain_images; i++)
+   {
+      vkFreeCommandBuffers(device, vk.cull_cmd_pool[i], 1, &vk.cull_cmd[i]);
+      vkDestroyCommandPool(device, vk.cull_cmd_pool[i], NULL);
+      vkFreeCommandBuffers(device, vk.draw_cmd_pool[i], 1, &vk.draw_cmd[i]);
+      vkDestroyCommandPool(device, vk.draw_cmd_pool[i], NULL);
+   }
+
+   memset(&vk, 0, sizeof(vk));
+}
+
+void retro_run(void)
+{
+   input_poll_cb();
+
+   if (input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_UP))
+   {
+   }
+
+   /* Very lazy way to do this. */
+   if (vulkan->get_sync_index_mask(vulkan->handle) != vk.swapchain_mask)
+   {
+      vulkan_test_deinit();
+      vulkan_test_init();
+   }
+
+   vulkan->wait_sync_index(vulkan->handle);
+
+   vk.index = vulkan->get_sync_index(vulkan->handle);
+   read_timings();
+   vulkan_test_render();
+   vulkan->set_image(vulkan->handle, &vk.images[vk.index],
+         1, &vk.draw_semaphores[vk.index], VK_QUEUE_FAMILY_IGNORED);
+   video_cb(RETRO_HW_FRAME_BUFFER_VALID, BASE_WIDTH, BASE_HEIGHT, 0);
+}
+
+static void context_reset(void)
+{
+   fprintf(stderr, "Context reset!\n");
+   if (!environ_cb(RETRO_ENVIRONMENT_GET_HW_RENDER_INTERFACE, (void**)&vulkan) || !vulkan)
+   {
+      fprintf(stderr, "Failed to get HW rendering interface!\n");
+      return;
+   }
+
+   if (vulkan->interface_version != RETRO_HW_RENDER_INTERFACE_VULKAN_VERSION)
+   {
+      fprintf(stderr, "HW render interface mismatch, expected %u, got %u!\n",
+            RETRO_HW_RENDER_INTERFACE_VULKAN_VERSION, vulkan->interface_version);
+      vulkan = NULL;
+      return;
+   }
+
+   vulkan_symbol_wrapper_init(vulkan->get_instance_proc_addr);
+   vulkan_symbol_wrapper_load_core_instance_symbols(vulkan->instance);
+   if (!vulkan_symbol_wrapper_load_core_device_symbols(vulkan->device))
+      fprintf(stderr, "Failed to load device-level Vulkan symbols!\n");
+
+   if (!async_queue)
+      fprintf(stderr, "[libretro-test]: No async compute queue, culling on the graphics queue.\n");
+   else if (separate_families())
+      fprintf(stderr, "[libretro-test]: Culling on queue family %u, drawing on %u.\n",
+            async_queue_index, vulkan->queue_index);
+   else
+      fprintf(stderr, "[libretro-test]: Culling on a second queue of family %u.\n",
+            async_queue_index);
+
+   vulkan_test_init();
+}
+
+static void context_destroy(void)
+{
+   fprintf(stderr, "Context destroy!\n");
+   vulkan_test_deinit();
+   vulkan = NULL;
+   memset(&vk, 0, sizeof(vk));
+}
+
+static const VkApplicationInfo *get_application_info(void)
+{
+   static const VkApplicationInfo info = {
+      VK_STRUCTURE_TYPE_APPLICATION_INFO,
+      NULL,
+      "libretro-test-vulkan-async-culling",
+      0,
+      "libretro-test-vulkan-async-culling",
+      0,
+      VK_MAKE_VERSION(1, 0, 18),
+   };
+   return &info;
+}
+
+/* Like vk_async_compute, but a device without a second queue is still
+ * created; culling then goes to the graphics queue (e.g. lavapipe). */
+static bool create_device(struct retro_vulkan_context *context,
+      VkInstance instance,
+      VkPhysicalDevice gpu,
+      VkSurfaceKHR surface,
+      PFN_vkGetInstanceProcAddr get_instance_proc_addr,
+      const char **required_device_extensions,
+      unsigned num_required_device_extensions,
+      const char **required_device_layers,
+      unsigned num_required_device_layers,
+      const VkPhysicalDeviceFeatures *required_features)
+{
+   async_queue = VK_NULL_HANDLE;
+   vulkan_symbol_wrapper_init(get_instance_proc_addr);
+   vulkan_symbol_wrapper_load_core_symbols(instance);
+
+   if (gpu == VK_NULL_HANDLE)
+   {
+      uint32_t gpu_count;
+      vkEnumeratePhysicalDevices(instance, &gpu_count, NULL);
+      if (!gpu_count)
+         return false;
+      VkPhysicalDevice *gpus = calloc(gpu_count, sizeof(*gpus));
+      if (!gpus)
+         return false;
+
+      vkEnumeratePhysicalDevices(instance, &gpu_count, gpus);
+      gpu = gpus[0];
+      free(gpus);
+   }
+
+   context->gpu = gpu;
+
+   uint32_t queue_count;
+   VkQueueFamilyProperties *queue_properties = NULL;
+   vkGetPhysicalDeviceQueueFamilyProperties(gpu, &queue_count, NULL);
+   if (queue_count < 1)
+      return false;
+   queue_properties = calloc(queue_count, sizeof(*queue_properties));
+   if (!queue_properties)
+      return false;
+   vkGetPhysicalDeviceQueueFamilyProperties(gpu, &queue_count, queue_properties);
+
+   if (surface != VK_NULL_HANDLE)
+   {
+      VULKAN_SYMBOL_WRAPPER_LOAD_INSTANCE_EXTENSION_SYMBOL(instance,
+            vkGetPhysicalDeviceSurfaceSupportKHR);
+   }
+
+   bool found_queue = false;
+   for (uint32_t i = 0; i < queue_count; i++)
+   {
+      VkBool32 supported = surface == VK_NULL_HANDLE;
+
+      if (surface != VK_NULL_HANDLE)
+      {
+         vkGetPhysicalDeviceSurfaceSupportKHR(
+               gpu, i, surface, &supported);
+      }
+
+      VkQueueFlags required = VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT;
+      if (supported && ((queue_properties[i].queueFlags & required) == required))
+      {
+         context->queue_family_index = i;
+         found_queue = true;
+         break;
+      }
+   }
+
+   if (!found_queue)
+   {
+      free(queue_properties);
+      return false;
+   }
+
+   /* Prefer a dedicated compute family, then a second graphics queue. */
+   bool found_async = false;
+   bool same_queue_async = false;
+   for (uint32_t i = 0; i < queue_count; i++)
+   {
+      if (i == context->queue_family_index)
+         continue;
+
+      VkQueueFlags required = VK_QUEUE_COMPUTE_BIT;
+      if ((queue_properties[i].queueFlags & required) == required)
+      {
+         async_queue_index = i;
+         found_async = true;
+         break;
+      }
+   }
+
+   if (!found_async && queue_properties[context->queue_family_index].queueCount >= 2)
+   {
+      async_queue_index = context->queue_family_index;
+      same_queue_async = true;
+   }
+
+   free(queue_properties);
+
+   const float prios[] = { 0.5f, 0.5f };
+   VkDeviceQueueCreateInfo queues[2] = {
+      { VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO },
+      { VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO },
+   };
+
+   queues[0].queueFamilyIndex = context->queue_family_index;
+   queues[0].queueCount = same_queue_async ? 2 : 1;
+   queues[0].pQueuePriorities = prios;
+   queues[1].queueFamilyIndex = async_queue_index;
+   queues[1].queueCount = 1;
+   queues[1].pQueuePriorities = &prios[1];
+
+   VkDeviceCreateInfo device_info = { VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO };
+   device_info.enabledExtensionCount = num_required_device_extensions;
+   device_info.ppEnabledExtensionNames = required_device_extensions;
+   device_info.enabledLayerCount = num_required_device_layers;
+   device_info.ppEnabledLayerNames = required_device_layers;
+   device_info.queueCreateInfoCount = found_async ? 2 : 1;
+   device_info.pQueueCreateInfos = queues;
+   device_info.pEnabledFeatures = required_features;
+
+   if (vkCreateDevice(gpu, &device_info, NULL, &context->device) != VK_SUCCESS)
+      return false;
+
+   vkGetDeviceQueue(context->device, context->queue_family_index, 0, &context->queue);
+   if (same_queue_async)
+      vkGetDeviceQueue(context->device, context->queue_family_index, 1, &async_queue);
+   else if (found_async)
+      vkGetDeviceQueue(context->device, async_queue_index, 0, &async_queue);
+
+   context->presentation_queue = context->queue;
+   context->presentation_queue_family_index = context->queue_family_index;
+   return true;
+}
+
+static bool retro_init_hw_context(void)
+{
+   hw_render.context_type = RETRO_HW_CONTEXT_VULKAN;
+   hw_render.version_major = VK_MAKE_VERSION(1, 0, 18);
+   hw_render.version_minor = 0;
+   hw_render.context_reset = context_reset;
+   hw_render.context_destroy = context_destroy;
+   hw_render.cache_context = false;
+   if (!environ_cb(RETRO_ENVIRONMENT_SET_HW_RENDER, &hw_render))
+      return false;
+
+   /* Stays null if the frontend creates the device without asking us. */
+   async_queue = VK_NULL_HANDLE;
+
+   static const struct retro_hw_render_context_negotiation_interface_vulkan iface = {
+      RETRO_HW_RENDER_CONTEXT_NEGOTIATION_INTERFACE_VULKAN,
+      RETRO_HW_RENDER_CONTEXT_NEGOTIATION_INTERFACE_VULKAN_VERSION,
+
+      get_application_info,
+      create_device,
+   };
+
+   environ_cb(RETRO_ENVIRONMENT_SET_HW_RENDER_CONTEXT_NEGOTIATION_INTERFACE, (void*)&iface);
+
+   return true;
+}
+
+bool retro_load_game(const struct retro_game_info *info)
+{
+   if (!retro_init_hw_context())
+   {
+      fprintf(stderr, "HW Context could not be initialized, exiting...\n");
+      return false;
+   }
+
+   fprintf(stderr, "Loaded game!\n");
+   (void)info;
+
+   frame_count = 0;
+   return true;
+}
+
+void retro_unload_game(void)
+{}
+
+unsigned retro_get_region(void)
+{
+   return RETRO_REGION_NTSC;
+}
+
+bool retro_load_game_special(unsigned type, const struct retro_game_info *info, size_t num)
+{
+   (void)type;
+   (void)info;
+   (void)num;
+   return false;
+}
+
+size_t retro_serialize_size(void)
+{
+   return 0;
+}
+
+bool retro_serialize(void *data, size_t size)
+{
+   (void)data;
+   (void)size;
+   return false;
+}
+
+bool retro_unserialize(const void *data, size_t size)
+{
+   (void)data;
+   (void)size;
+   return false;
+}
+
+void *retro_get_memory_data(unsigned id)
+{
+   (void)id;
+   return NULL;
+}
+
+size_t retro_get_memory_size(unsigned id)
+{
+   (void)id;
+   return 0;
+}
+
+void retro_reset(void)
+{}
+
+void retro_cheat_reset(void)
+{}
+
+void retro_cheat_set(unsigned index, bool enabled, const char *code)
+{
+   (void)index;
+   (void)enabled;
+   (void)code;
+}
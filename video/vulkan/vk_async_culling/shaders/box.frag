@@ -0,0 +1,18 @@
+#version 450
+precision mediump float;
+
+layout(location = 0) in vec3 vNormal;
+layout(location = 1) in vec3 vEye;
+layout(location = 0) out vec4 FragColor;
+
+layout(push_constant, std430) uniform PushConstants
+{
+   vec4 color;
+} constants;
+
+void main()
+{
+   // Light at the camera, like the GL sample's far LODs.
+   float ndotl = max(dot(normalize(vNormal), normalize(vEye)), 0.0);
+   FragColor = vec4(sqrt(0.1 + 0.9 * ndotl * constants.color.rgb), 1.0);
+}
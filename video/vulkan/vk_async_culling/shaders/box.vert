@@ -0,0 +1,25 @@
+#version 450
+layout(location = 0) in vec3 Position;
+layout(location = 1) in vec3 Normal;
+layout(location = 2) in vec4 Instance;
+
+layout(std140, set = 0, binding = 0) uniform Global
+{
+   mat4 vp;
+   vec4 frustum[6];
+   vec4 camera_pos;
+   vec4 camera_vel;
+   float delta_time;
+   uint count;
+} global;
+
+layout(location = 0) out vec3 vNormal;
+layout(location = 1) out vec3 vEye;
+
+void main()
+{
+   vec3 world = Position + Instance.xyz;
+   vNormal = Normal;
+   vEye = global.camera_pos.xyz - world;
+   gl_Position = global.vp * vec4(world, 1.0);
+}
@@ -0,0 +1,356 @@
+
+/* This header is autogenerated by vulkan_loader_generator.py */
+#ifndef VULKAN_SYMBOL_WRAPPER_H
+#define VULKAN_SYMBOL_WRAPPER_H
+#define VK_NO_PROTOTYPES
+#include <vulkan/vulkan.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern PFN_vkCreateInstance vulkan_symbol_wrapper_vkCreateInstance;
+#define vkCreateInstance vulkan_symbol_wrapper_vkCreateInstance
+extern PFN_vkEnumerateInstanceExtensionProperties vulkan_symbol_wrapper_vkEnumerateInstanceExtensionProperties;
+#define vkEnumerateInstanceExtensionProperties vulkan_symbol_wrapper_vkEnumerateInstanceExtensionProperties
+extern PFN_vkEnumerateInstanceLayerProperties vulkan_symbol_wrapper_vkEnumerateInstanceLayerProperties;
+#define vkEnumerateInstanceLayerProperties vulkan_symbol_wrapper_vkEnumerateInstanceLayerProperties
+extern PFN_vkDestroyInstance vulkan_symbol_wrapper_vkDestroyInstance;
+#define vkDestroyInstance vulkan_symbol_wrapper_vkDestroyInstance
+extern PFN_vkEnumeratePhysicalDevices vulkan_symbol_wrapper_vkEnumeratePhysicalDevices;
+#define vkEnumeratePhysicalDevices vulkan_symbol_wrapper_vkEnumeratePhysicalDevices
+extern PFN_vkGetPhysicalDeviceFeatures vulkan_symbol_wrapper_vkGetPhysicalDeviceFeatures;
+#define vkGetPhysicalDeviceFeatures vulkan_symbol_wrapper_vkGetPhysicalDeviceFeatures
+extern PFN_vkGetPhysicalDeviceFormatProperties vulkan_symbol_wrapper_vkGetPhysicalDeviceFormatProperties;
+#define vkGetPhysicalDeviceFormatProperties vulkan_symbol_wrapper_vkGetPhysicalDeviceFormatProperties
+extern PFN_vkGetPhysicalDeviceImageFormatProperties vulkan_symbol_wrapper_vkGetPhysicalDeviceImageFormatProperties;
+#define vkGetPhysicalDeviceImageFormatProperties vulkan_symbol_wrapper_vkGetPhysicalDeviceImageFormatProperties
+extern PFN_vkGetPhysicalDeviceProperties vulkan_symbol_wrapper_vkGetPhysicalDeviceProperties;
+#define vkGetPhysicalDeviceProperties vulkan_symbol_wrapper_vkGetPhysicalDeviceProperties
+extern PFN_vkGetPhysicalDeviceQueueFamilyProperties vulkan_symbol_wrapper_vkGetPhysicalDeviceQueueFamilyProperties;
+#define vkGetPhysicalDeviceQueueFamilyProperties vulkan_symbol_wrapper_vkGetPhysicalDeviceQueueFamilyProperties
+extern PFN_vkGetPhysicalDeviceMemoryProperties vulkan_symbol_wrapper_vkGetPhysicalDeviceMemoryProperties;
+#define vkGetPhysicalDeviceMemoryProperties vulkan_symbol_wrapper_vkGetPhysicalDeviceMemoryProperties
+extern PFN_vkGetDeviceProcAddr vulkan_symbol_wrapper_vkGetDeviceProcAddr;
+#define vkGetDeviceProcAddr vulkan_symbol_wrapper_vkGetDeviceProcAddr
+extern PFN_vkCreateDevice vulkan_symbol_wrapper_vkCreateDevice;
+#define vkCreateDevice vulkan_symbol_wrapper_vkCreateDevice
+extern PFN_vkDestroyDevice vulkan_symbol_wrapper_vkDestroyDevice;
+#define vkDestroyDevice vulkan_symbol_wrapper_vkDestroyDevice
+extern PFN_vkEnumerateDeviceExtensionProperties vulkan_symbol_wrapper_vkEnumerateDeviceExtensionProperties;
+#define vkEnumerateDeviceExtensionProperties vulkan_symbol_wrapper_vkEnumerateDeviceExtensionProperties
+extern PFN_vkEnumerateDeviceLayerProperties vulkan_symbol_wrapper_vkEnumerateDeviceLayerProperties;
+#define vkEnumerateDeviceLayerProperties vulkan_symbol_wrapper_vkEnumerateDeviceLayerProperties
+extern PFN_vkGetDeviceQueue vulkan_symbol_wrapper_vkGetDeviceQueue;
+#define vkGetDeviceQueue vulkan_symbol_wrapper_vkGetDeviceQueue
+extern PFN_vkQueueSubmit vulkan_symbol_wrapper_vkQueueSubmit;
+#define vkQueueSubmit vulkan_symbol_wrapper_vkQueueSubmit
+extern PFN_vkQueueWaitIdle vulkan_symbol_wrapper_vkQueueWaitIdle;
+#define vkQueueWaitIdle vulkan_symbol_wrapper_vkQueueWaitIdle
+extern PFN_vkDeviceWaitIdle vulkan_symbol_wrapper_vkDeviceWaitIdle;
+#define vkDeviceWaitIdle vulkan_symbol_wrapper_vkDeviceWaitIdle
+extern PFN_vkAllocateMemory vulkan_symbol_wrapper_vkAllocateMemory;
+#define vkAllocateMemory vulkan_symbol_wrapper_vkAllocateMemory
+extern PFN_vkFreeMemory vulkan_symbol_wrapper_vkFreeMemory;
+#define vkFreeMemory vulkan_symbol_wrapper_vkFreeMemory
+extern PFN_vkMapMemory vulkan_symbol_wrapper_vkMapMemory;
+#define vkMapMemory vulkan_symbol_wrapper_vkMapMemory
+extern PFN_vkUnmapMemory vulkan_symbol_wrapper_vkUnmapMemory;
+#define vkUnmapMemory vulkan_symbol_wrapper_vkUnmapMemory
+extern PFN_vkFlushMappedMemoryRanges vulkan_symbol_wrapper_vkFlushMappedMemoryRanges;
+#define vkFlushMappedMemoryRanges vulkan_symbol_wrapper_vkFlushMappedMemoryRanges
+extern PFN_vkInvalidateMappedMemoryRanges vulkan_symbol_wrapper_vkInvalidateMappedMemoryRanges;
+#define vkInvalidateMappedMemoryRanges vulkan_symbol_wrapper_vkInvalidateMappedMemoryRanges
+extern PFN_vkGetDeviceMemoryCommitment vulkan_symbol_wrapper_vkGetDeviceMemoryCommitment;
+#define vkGetDeviceMemoryCommitment vulkan_symbol_wrapper_vkGetDeviceMemoryCommitment
+extern PFN_vkBindBufferMemory vulkan_symbol_wrapper_vkBindBufferMemory;
+#define vkBindBufferMemory vulkan_symbol_wrapper_vkBindBufferMemory
+extern PFN_vkBindImageMemory vulkan_symbol_wrapper_vkBindImageMemory;
+#define vkBindImageMemory vulkan_symbol_wrapper_vkBindImageMemory
+extern PFN_vkGetBufferMemoryRequirements vulkan_symbol_wrapper_vkGetBufferMemoryRequirements;
+#define vkGetBufferMemoryRequirements vulkan_symbol_wrapper_vkGetBufferMemoryRequirements
+extern PFN_vkGetImageMemoryRequirements vulkan_symbol_wrapper_vkGetImageMemoryRequirements;
+#define vkGetImageMemoryRequirements vulkan_symbol_wrapper_vkGetImageMemoryRequirements
+extern PFN_vkGetImageSparseMemoryRequirements vulkan_symbol_wrapper_vkGetImageSparseMemoryRequirements;
+#define vkGetImageSparseMemoryRequirements vulkan_symbol_wrapper_vkGetImageSparseMemoryRequirements
+extern PFN_vkGetPhysicalDeviceSparseImageFormatProperties vulkan_symbol_wrapper_vkGetPhysicalDeviceSparseImageFormatProperties;
+#define vkGetPhysicalDeviceSparseImageFormatProperties vulkan_symbol_wrapper_vkGetPhysicalDeviceSparseImageFormatProperties
+extern PFN_vkQueueBindSparse vulkan_symbol_wrapper_vkQueueBindSparse;
+#define vkQueueBindSparse vulkan_symbol_wrapper_vkQueueBindSparse
+extern PFN_vkCreateFence vulkan_symbol_wrapper_vkCreateFence;
+#define vkCreateFence vulkan_symbol_wrapper_vkCreateFence
+extern PFN_vkDestroyFence vulkan_symbol_wrapper_vkDestroyFence;
+#define vkDestroyFence vulkan_symbol_wrapper_vkDestroyFence
+extern PFN_vkResetFences vulkan_symbol_wrapper_vkResetFences;
+#define vkResetFences vulkan_symbol_wrapper_vkResetFences
+extern PFN_vkGetFenceStatus vulkan_symbol_wrapper_vkGetFenceStatus;
+#define vkGetFenceStatus vulkan_symbol_wrapper_vkGetFenceStatus
+extern PFN_vkWaitForFences vulkan_symbol_wrapper_vkWaitForFences;
+#define vkWaitForFences vulkan_symbol_wrapper_vkWaitForFences
+extern PFN_vkCreateSemaphore vulkan_symbol_wrapper_vkCreateSemaphore;
+#define vkCreateSemaphore vulkan_symbol_wrapper_vkCreateSemaphore
+extern PFN_vkDestroySemaphore vulkan_symbol_wrapper_vkDestroySemaphore;
+#define vkDestroySemaphore vulkan_symbol_wrapper_vkDestroySemaphore
+extern PFN_vkCreateEvent vulkan_symbol_wrapper_vkCreateEvent;
+#define vkCreateEvent vulkan_symbol_wrapper_vkCreateEvent
+extern PFN_vkDestroyEvent vulkan_symbol_wrapper_vkDestroyEvent;
+#define vkDestroyEvent vulkan_symbol_wrapper_vkDestroyEvent
+extern PFN_vkGetEventStatus vulkan_symbol_wrapper_vkGetEventStatus;
+#define vkGetEventStatus vulkan_symbol_wrapper_vkGetEventStatus
+extern PFN_vkSetEvent vulkan_symbol_wrapper_vkSetEvent;
+#define vkSetEvent vulkan_symbol_wrapper_vkSetEvent
+extern PFN_vkResetEvent vulkan_symbol_wrapper_vkResetEvent;
+#define vkResetEvent vulkan_symbol_wrapper_vkResetEvent
+extern PFN_vkCreateQueryPool vulkan_symbol_wrapper_vkCreateQueryPool;
+#define vkCreateQueryPool vulkan_symbol_wrapper_vkCreateQueryPool
+extern PFN_vkDestroyQueryPool vulkan_symbol_wrapper_vkDestroyQueryPool;
+#define vkDestroyQueryPool vulkan_symbol_wrapper_vkDestroyQueryPool
+extern PFN_vkGetQueryPoolResults vulkan_symbol_wrapper_vkGetQueryPoolResults;
+#define vkGetQueryPoolResults vulkan_symbol_wrapper_vkGetQueryPoolResults
+extern PFN_vkCreateBuffer vulkan_symbol_wrapper_vkCreateBuffer;
+#define vkCreateBuffer vulkan_symbol_wrapper_vkCreateBuffer
+extern PFN_vkDestroyBuffer vulkan_symbol_wrapper_vkDestroyBuffer;
+#define vkDestroyBuffer vulkan_symbol_wrapper_vkDestroyBuffer
+extern PFN_vkCreateBufferView vulkan_symbol_wrapper_vkCreateBufferView;
+#define vkCreateBufferView vulkan_symbol_wrapper_vkCreateBufferView
+extern PFN_vkDestroyBufferView vulkan_symbol_wrapper_vkDestroyBufferView;
+#define vkDestroyBufferView vulkan_symbol_wrapper_vkDestroyBufferView
+extern PFN_vkCreateImage vulkan_symbol_wrapper_vkCreateImage;
+#define vkCreateImage vulkan_symbol_wrapper_vkCreateImage
+extern PFN_vkDestroyImage vulkan_symbol_wrapper_vkDestroyImage;
+#define vkDestroyImage vulkan_symbol_wrapper_vkDestroyImage
+extern PFN_vkGetImageSubresourceLayout vulkan_symbol_wrapper_vkGetImageSubresourceLayout;
+#define vkGetImageSubresourceLayout vulkan_symbol_wrapper_vkGetImageSubresourceLayout
+extern PFN_vkCreateImageView vulkan_symbol_wrapper_vkCreateImageView;
+#define vkCreateImageView vulkan_symbol_wrapper_vkCreateImageView
+extern PFN_vkDestroyImageView vulkan_symbol_wrapper_vkDestroyImageView;
+#define vkDestroyImageView vulkan_symbol_wrapper_vkDestroyImageView
+extern PFN_vkCreateShaderModule vulkan_symbol_wrapper_vkCreateShaderModule;
+#define vkCreateShaderModule vulkan_symbol_wrapper_vkCreateShaderModule
+extern PFN_vkDestroyShaderModule vulkan_symbol_wrapper_vkDestroyShaderModule;
+#define vkDestroyShaderModule vulkan_symbol_wrapper_vkDestroyShaderModule
+extern PFN_vkCreatePipelineCache vulkan_symbol_wrapper_vkCreatePipelineCache;
+#define vkCreatePipelineCache vulkan_symbol_wrapper_vkCreatePipelineCache
+extern PFN_vkDestroyPipelineCache vulkan_symbol_wrapper_vkDestroyPipelineCache;
+#define vkDestroyPipelineCache vulkan_symbol_wrapper_vkDestroyPipelineCache
+extern PFN_vkGetPipelineCacheData vulkan_symbol_wrapper_vkGetPipelineCacheData;
+#define vkGetPipelineCacheData vulkan_symbol_wrapper_vkGetPipelineCacheData
+extern PFN_vkMergePipelineCaches vulkan_symbol_wrapper_vkMergePipelineCaches;
+#define vkMergePipelineCaches vulkan_symbol_wrapper_vkMergePipelineCaches
+extern PFN_vkCreateGraphicsPipelines vulkan_symbol_wrapper_vkCreateGraphicsPipelines;
+#define vkCreateGraphicsPipelines vulkan_symbol_wrapper_vkCreateGraphicsPipelines
+extern PFN_vkCreateComputePipelines vulkan_symbol_wrapper_vkCreateComputePipelines;
+#define vkCreateComputePipelines vulkan_symbol_wrapper_vkCreateComputePipelines
+extern PFN_vkDestroyPipeline vulkan_symbol_wrapper_vkDestroyPipeline;
+#define vkDestroyPipeline vulkan_symbol_wrapper_vkDestroyPipeline
+extern PFN_vkCreatePipelineLayout vulkan_symbol_wrapper_vkCreatePipelineLayout;
+#define vkCreatePipelineLayout vulkan_symbol_wrapper_vkCreatePipelineLayout
+extern PFN_vkDestroyPipelineLayout vulkan_symbol_wrapper_vkDestroyPipelineLayout;
+#define vkDestroyPipelineLayout vulkan_symbol_wrapper_vkDestroyPipelineLayout
+extern PFN_vkCreateSampler vulkan_symbol_wrapper_vkCreateSampler;
+#define vkCreateSampler vulkan_symbol_wrapper_vkCreateSampler
+extern PFN_vkDestroySampler vulkan_symbol_wrapper_vkDestroySampler;
+#define vkDestroySampler vulkan_symbol_wrapper_vkDestroySampler
+extern PFN_vkCreateDescriptorSetLayout vulkan_symbol_wrapper_vkCreateDescriptorSetLayout;
+#define vkCreateDescriptorSetLayout vulkan_symbol_wrapper_vkCreateDescriptorSetLayout
+extern PFN_vkDestroyDescriptorSetLayout vulkan_symbol_wrapper_vkDestroyDescriptorSetLayout;
+#define vkDestroyDescriptorSetLayout vulkan_symbol_wrapper_vkDestroyDescriptorSetLayout
+extern PFN_vkCreateDescriptorPool vulkan_symbol_wrapper_vkCreateDescriptorPool;
+#define vkCreateDescriptorPool vulkan_symbol_wrapper_vkCreateDescriptorPool
+extern PFN_vkDestroyDescriptorPool vulkan_symbol_wrapper_vkDestroyDescriptorPool;
+#define vkDestroyDescriptorPool vulkan_symbol_wrapper_vkDestroyDescriptorPool
+extern PFN_vkResetDescriptorPool vulkan_symbol_wrapper_vkResetDescriptorPool;
+#define vkResetDescriptorPool vulkan_symbol_wrapper_vkResetDescriptorPool
+extern PFN_vkAllocateDescriptorSets vulkan_symbol_wrapper_vkAllocateDescriptorSets;
+#define vkAllocateDescriptorSets vulkan_symbol_wrapper_vkAllocateDescriptorSets
+extern PFN_vkFreeDescriptorSets vulkan_symbol_wrapper_vkFreeDescriptorSets;
+#define vkFreeDescriptorSets vulkan_symbol_wrapper_vkFreeDescriptorSets
+extern PFN_vkUpdateDescriptorSets vulkan_symbol_wrapper_vkUpdateDescriptorSets;
+#define vkUpdateDescriptorSets vulkan_symbol_wrapper_vkUpdateDescriptorSets
+extern PFN_vkCreateFramebuffer vulkan_symbol_wrapper_vkCreateFramebuffer;
+#define vkCreateFramebuffer vulkan_symbol_wrapper_vkCreateFramebuffer
+extern PFN_vkDestroyFramebuffer vulkan_symbol_wrapper_vkDestroyFramebuffer;
+#define vkDestroyFramebuffer vulkan_symbol_wrapper_vkDestroyFramebuffer
+extern PFN_vkCreateRenderPass vulkan_symbol_wrapper_vkCreateRenderPass;
+#define vkCreateRenderPass vulkan_symbol_wrapper_vkCreateRenderPass
+extern PFN_vkDestroyRenderPass vulkan_symbol_wrapper_vkDestroyRenderPass;
+#define vkDestroyRenderPass vulkan_symbol_wrapper_vkDestroyRenderPass
+extern PFN_vkGetRenderAreaGranularity vulkan_symbol_wrapper_vkGetRenderAreaGranularity;
+#define vkGetRenderAreaGranularity vulkan_symbol_wrapper_vkGetRenderAreaGranularity
+extern PFN_vkCreateCommandPool vulkan_symbol_wrapper_vkCreateCommandPool;
+#define vkCreateCommandPool vulkan_symbol_wrapper_vkCreateCommandPool
+extern PFN_vkDestroyCommandPool vulkan_symbol_wrapper_vkDestroyCommandPool;
+#define vkDestroyCommandPool vulkan_symbol_wrapper_vkDestroyCommandPool
+extern PFN_vkResetCommandPool vulkan_symbol_wrapper_vkResetCommandPool;
+#define vkResetCommandPool vulkan_symbol_wrapper_vkResetCommandPool
+extern PFN_vkAllocateCommandBuffers vulkan_symbol_wrapper_vkAllocateCommandBuffers;
+#define vkAllocateCommandBuffers vulkan_symbol_wrapper_vkAllocateCommandBuffers
+extern PFN_vkFreeCommandBuffers vulkan_symbol_wrapper_vkFreeCommandBuffers;
+#define vkFreeCommandBuffers vulkan_symbol_wrapper_vkFreeCommandBuffers
+extern PFN_vkBeginCommandBuffer vulkan_symbol_wrapper_vkBeginCommandBuffer;
+#define vkBeginCommandBuffer vulkan_symbol_wrapper_vkBeginCommandBuffer
+extern PFN_vkEndCommandBuffer vulkan_symbol_wrapper_vkEndCommandBuffer;
+#define vkEndCommandBuffer vulkan_symbol_wrapper_vkEndCommandBuffer
+extern PFN_vkResetCommandBuffer vulkan_symbol_wrapper_vkResetCommandBuffer;
+#define vkResetCommandBuffer vulkan_symbol_wrapper_vkResetCommandBuffer
+extern PFN_vkCmdBindPipeline vulkan_symbol_wrapper_vkCmdBindPipeline;
+#define vkCmdBindPipeline vulkan_symbol_wrapper_vkCmdBindPipeline
+extern PFN_vkCmdSetViewport vulkan_symbol_wrapper_vkCmdSetViewport;
+#define vkCmdSetViewport vulkan_symbol_wrapper_vkCmdSetViewport
+extern PFN_vkCmdSetScissor vulkan_symbol_wrapper_vkCmdSetScissor;
+#define vkCmdSetScissor vulkan_symbol_wrapper_vkCmdSetScissor
+extern PFN_vkCmdSetLineWidth vulkan_symbol_wrapper_vkCmdSetLineWidth;
+#define vkCmdSetLineWidth vulkan_symbol_wrapper_vkCmdSetLineWidth
+extern PFN_vkCmdSetDepthBias vulkan_symbol_wrapper_vkCmdSetDepthBias;
+#define vkCmdSetDepthBias vulkan_symbol_wrapper_vkCmdSetDepthBias
+extern PFN_vkCmdSetBlendConstants vulkan_symbol_wrapper_vkCmdSetBlendConstants;
+#define vkCmdSetBlendConstants vulkan_symbol_wrapper_vkCmdSetBlendConstants
+extern PFN_vkCmdSetDepthBounds vulkan_symbol_wrapper_vkCmdSetDepthBounds;
+#define vkCmdSetDepthBounds vulkan_symbol_wrapper_vkCmdSetDepthBounds
+extern PFN_vkCmdSetStencilCompareMask vulkan_symbol_wrapper_vkCmdSetStencilCompareMask;
+#define vkCmdSetStencilCompareMask vulkan_symbol_wrapper_vkCmdSetStencilCompareMask
+extern PFN_vkCmdSetStencilWriteMask vulkan_symbol_wrapper_vkCmdSetStencilWriteMask;
+#define vkCmdSetStencilWriteMask vulkan_symbol_wrapper_vkCmdSetStencilWriteMask
+extern PFN_vkCmdSetStencilReference vulkan_symbol_wrapper_vkCmdSetStencilReference;
+#define vkCmdSetStencilReference vulkan_symbol_wrapper_vkCmdSetStencilReference
+extern PFN_vkCmdBindDescriptorSets vulkan_symbol_wrapper_vkCmdBindDescriptorSets;
+#define vkCmdBindDescriptorSets vulkan_symbol_wrapper_vkCmdBindDescriptorSets
+extern PFN_vkCmdBindIndexBuffer vulkan_symbol_wrapper_vkCmdBindIndexBuffer;
+#define vkCmdBindIndexBuffer vulkan_symbol_wrapper_vkCmdBindIndexBuffer
+extern PFN_vkCmdBindVertexBuffers vulkan_symbol_wrapper_vkCmdBindVertexBuffers;
+#define vkCmdBindVertexBuffers vulkan_symbol_wrapper_vkCmdBindVertexBuffers
+extern PFN_vkCmdDraw vulkan_symbol_wrapper_vkCmdDraw;
+#define vkCmdDraw vulkan_symbol_wrapper_vkCmdDraw
+extern PFN_vkCmdDrawIndexed vulkan_symbol_wrapper_vkCmdDrawIndexed;
+#define vkCmdDrawIndexed vulkan_symbol_wrapper_vkCmdDrawIndexed
+extern PFN_vkCmdDrawIndirect vulkan_symbol_wrapper_vkCmdDrawIndirect;
+#define vkCmdDrawIndirect vulkan_symbol_wrapper_vkCmdDrawIndirect
+extern PFN_vkCmdDrawIndexedIndirect vulkan_symbol_wrapper_vkCmdDrawIndexedIndirect;
+#define vkCmdDrawIndexedIndirect vulkan_symbol_wrapper_vkCmdDrawIndexedIndirect
+extern PFN_vkCmdDispatch vulkan_symbol_wrapper_vkCmdDispatch;
+#define vkCmdDispatch vulkan_symbol_wrapper_vkCmdDispatch
+extern PFN_vkCmdDispatchIndirect vulkan_symbol_wrapper_vkCmdDispatchIndirect;
+#define vkCmdDispatchIndirect vulkan_symbol_wrapper_vkCmdDispatchIndirect
+extern PFN_vkCmdCopyBuffer vulkan_symbol_wrapper_vkCmdCopyBuffer;
+#define vkCmdCopyBuffer vulkan_symbol_wrapper_vkCmdCopyBuffer
+extern PFN_vkCmdCopyImage vulkan_symbol_wrapper_vkCmdCopyImage;
+#define vkCmdCopyImage vulkan_symbol_wrapper_vkCmdCopyImage
+extern PFN_vkCmdBlitImage vulkan_symbol_wrapper_vkCmdBlitImage;
+#define vkCmdBlitImage vulkan_symbol_wrapper_vkCmdBlitImage
+extern PFN_vkCmdCopyBufferToImage vulkan_symbol_wrapper_vkCmdCopyBufferToImage;
+#define vkCmdCopyBufferToImage vulkan_symbol_wrapper_vkCmdCopyBufferToImage
+extern PFN_vkCmdCopyImageToBuffer vulkan_symbol_wrapper_vkCmdCopyImageToBuffer;
+#define vkCmdCopyImageToBuffer vulkan_symbol_wrapper_vkCmdCopyImageToBuffer
+extern PFN_vkCmdUpdateBuffer vulkan_symbol_wrapper_vkCmdUpdateBuffer;
+#define vkCmdUpdateBuffer vulkan_symbol_wrapper_vkCmdUpdateBuffer
+extern PFN_vkCmdFillBuffer vulkan_symbol_wrapper_vkCmdFillBuffer;
+#define vkCmdFillBuffer vulkan_symbol_wrapper_vkCmdFillBuffer
+extern PFN_vkCmdClearColorImage vulkan_symbol_wrapper_vkCmdClearColorImage;
+#define vkCmdClearColorImage vulkan_symbol_wrapper_vkCmdClearColorImage
+extern PFN_vkCmdClearDepthStencilImage vulkan_symbol_wrapper_vkCmdClearDepthStencilImage;
+#define vkCmdClearDepthStencilImage vulkan_symbol_wrapper_vkCmdClearDepthStencilImage
+extern PFN_vkCmdClearAttachments vulkan_symbol_wrapper_vkCmdClearAttachments;
+#define vkCmdClearAttachments vulkan_symbol_wrapper_vkCmdClearAttachments
+extern PFN_vkCmdResolveImage vulkan_symbol_wrapper_vkCmdResolveImage;
+#define vkCmdResolveImage vulkan_symbol_wrapper_vkCmdResolveImage
+extern PFN_vkCmdSetEvent vulkan_symbol_wrapper_vkCmdSetEvent;
+#define vkCmdSetEvent vulkan_symbol_wrapper_vkCmdSetEvent
+extern PFN_vkCmdResetEvent vulkan_symbol_wrapper_vkCmdResetEvent;
+#define vkCmdResetEvent vulkan_symbol_wrapper_vkCmdResetEvent
+extern PFN_vkCmdWaitEvents vulkan_symbol_wrapper_vkCmdWaitEvents;
+#define vkCmdWaitEvents vulkan_symbol_wrapper_vkCmdWaitEvents
+extern PFN_vkCmdPipelineBarrier vulkan_symbol_wrapper_vkCmdPipelineBarrier;
+#define vkCmdPipelineBarrier vulkan_symbol_wrapper_vkCmdPipelineBarrier
+extern PFN_vkCmdBeginQuery vulkan_symbol_wrapper_vkCmdBeginQuery;
+#define vkCmdBeginQuery vulkan_symbol_wrapper_vkCmdBeginQuery
+extern PFN_vkCmdEndQuery vulkan_symbol_wrapper_vkCmdEndQuery;
+#define vkCmdEndQuery vulkan_symbol_wrapper_vkCmdEndQuery
+extern PFN_vkCmdResetQueryPool vulkan_symbol_wrapper_vkCmdResetQueryPool;
+#define vkCmdResetQueryPool vulkan_symbol_wrapper_vkCmdResetQueryPool
+extern PFN_vkCmdWriteTimestamp vulkan_symbol_wrapper_vkCmdWriteTimestamp;
+#define vkCmdWriteTimestamp vulkan_symbol_wrapper_vkCmdWriteTimestamp
+extern PFN_vkCmdCopyQueryPoolResults vulkan_symbol_wrapper_vkCmdCopyQueryPoolResults;
+#define vkCmdCopyQueryPoolResults vulkan_symbol_wrapper_vkCmdCopyQueryPoolResults
+extern PFN_vkCmdPushConstants vulkan_symbol_wrapper_vkCmdPushConstants;
+#define vkCmdPushConstants vulkan_symbol_wrapper_vkCmdPushConstants
+extern PFN_vkCmdBeginRenderPass vulkan_symbol_wrapper_vkCmdBeginRenderPass;
+#define vkCmdBeginRenderPass vulkan_symbol_wrapper_vkCmdBeginRenderPass
+extern PFN_vkCmdNextSubpass vulkan_symbol_wrapper_vkCmdNextSubpass;
+#define vkCmdNextSubpass vulkan_symbol_wrapper_vkCmdNextSubpass
+extern PFN_vkCmdEndRenderPass vulkan_symbol_wrapper_vkCmdEndRenderPass;
+#define vkCmdEndRenderPass vulkan_symbol_wrapper_vkCmdEndRenderPass
+extern PFN_vkCmdExecuteCommands vulkan_symbol_wrapper_vkCmdExecuteCommands;
+#define vkCmdExecuteCommands vulkan_symbol_wrapper_vkCmdExecuteCommands
+extern PFN_vkDestroySurfaceKHR vulkan_symbol_wrapper_vkDestroySurfaceKHR;
+#define vkDestroySurfaceKHR vulkan_symbol_wrapper_vkDestroySurfaceKHR
+extern PFN_vkGetPhysicalDeviceSurfaceSupportKHR vulkan_symbol_wrapper_vkGetPhysicalDeviceSurfaceSupportKHR;
+#define vkGetPhysicalDeviceSurfaceSupportKHR vulkan_symbol_wrapper_vkGetPhysicalDeviceSurfaceSupportKHR
+extern PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR vulkan_symbol_wrapper_vkGetPhysicalDeviceSurfaceCapabilitiesKHR;
+#define vkGetPhysicalDeviceSurfaceCapabilitiesKHR vulkan_symbol_wrapper_vkGetPhysicalDeviceSurfaceCapabilitiesKHR
+extern PFN_vkGetPhysicalDeviceSurfaceFormatsKHR vulkan_symbol_wrapper_vkGetPhysicalDeviceSurfaceFormatsKHR;
+#define vkGetPhysicalDeviceSurfaceFormatsKHR vulkan_symbol_wrapper_vkGetPhysicalDeviceSurfaceFormatsKHR
+extern PFN_vkGetPhysicalDeviceSurfacePresentModesKHR vulkan_symbol_wrapper_vkGetPhysicalDeviceSurfacePresentModesKHR;
+#define vkGetPhysicalDeviceSurfacePresentModesKHR vulkan_symbol_wrapper_vkGetPhysicalDeviceSurfacePresentModesKHR
+extern PFN_vkCreateSwapchainKHR vulkan_symbol_wrapper_vkCreateSwapchainKHR;
+#define vkCreateSwapchainKHR vulkan_symbol_wrapper_vkCreateSwapchainKHR
+extern PFN_vkDestroySwapchainKHR vulkan_symbol_wrapper_vkDestroySwapchainKHR;
+#define vkDestroySwapchainKHR vulkan_symbol_wrapper_vkDestroySwapchainKHR
+extern PFN_vkGetSwapchainImagesKHR vulkan_symbol_wrapper_vkGetSwapchainImagesKHR;
+#define vkGetSwapchainImagesKHR vulkan_symbol_wrapper_vkGetSwapchainImagesKHR
+extern PFN_vkAcquireNextImageKHR vulkan_symbol_wrapper_vkAcquireNextImageKHR;
+#define vkAcquireNextImageKHR vulkan_symbol_wrapper_vkAcquireNextImageKHR
+extern PFN_vkQueuePresentKHR vulkan_symbol_wrapper_vkQueuePresentKHR;
+#define vkQueuePresentKHR vulkan_symbol_wrapper_vkQueuePresentKHR
+extern PFN_vkGetPhysicalDeviceDisplayPropertiesKHR vulkan_symbol_wrapper_vkGetPhysicalDeviceDisplayPropertiesKHR;
+#define vkGetPhysicalDeviceDisplayPropertiesKHR vulkan_symbol_wrapper_vkGetPhysicalDeviceDisplayPropertiesKHR
+extern PFN_vkGetPhysicalDeviceDisplayPlanePropertiesKHR vulkan_symbol_wrapper_vkGetPhysicalDeviceDisplayPlanePropertiesKHR;
+#define vkGetPhysicalDeviceDisplayPlanePropertiesKHR vulkan_symbol_wrapper_vkGetPhysicalDeviceDisplayPlanePropertiesKHR
+extern PFN_vkGetDisplayPlaneSupportedDisplaysKHR vulkan_symbol_wrapper_vkGetDisplayPlaneSupportedDisplaysKHR;
+#define vkGetDisplayPlaneSupportedDisplaysKHR vulkan_symbol_wrapper_vkGetDisplayPlaneSupportedDisplaysKHR
+extern PFN_vkGetDisplayModePropertiesKHR vulkan_symbol_wrapper_vkGetDisplayModePropertiesKHR;
+#define vkGetDisplayModePropertiesKHR vulkan_symbol_wrapper_vkGetDisplayModePropertiesKHR
+extern PFN_vkCreateDisplayModeKHR vulkan_symbol_wrapper_vkCreateDisplayModeKHR;
+#define vkCreateDisplayModeKHR vulkan_symbol_wrapper_vkCreateDisplayModeKHR
+extern PFN_vkGetDisplayPlaneCapabilitiesKHR vulkan_symbol_wrapper_vkGetDisplayPlaneCapabilitiesKHR;
+#define vkGetDisplayPlaneCapabilitiesKHR vulkan_symbol_wrapper_vkGetDisplayPlaneCapabilitiesKHR
+extern PFN_vkCreateDisplayPlaneSurfaceKHR vulkan_symbol_wrapper_vkCreateDisplayPlaneSurfaceKHR;
+#define vkCreateDisplayPlaneSurfaceKHR vulkan_symbol_wrapper_vkCreateDisplayPlaneSurfaceKHR
+extern PFN_vkCreateSharedSwapchainsKHR vulkan_symbol_wrapper_vkCreateSharedSwapchainsKHR;
+#define vkCreateSharedSwapchainsKHR vulkan_symbol_wrapper_vkCreateSharedSwapchainsKHR
+extern PFN_vkCreateDebugReportCallbackEXT vulkan_symbol_wrapper_vkCreateDebugReportCallbackEXT;
+#define vkCreateDebugReportCallbackEXT vulkan_symbol_wrapper_vkCreateDebugReportCallbackEXT
+extern PFN_vkDestroyDebugReportCallbackEXT vulkan_symbol_wrapper_vkDestroyDebugReportCallbackEXT;
+#define vkDestroyDebugReportCallbackEXT vulkan_symbol_wrapper_vkDestroyDebugReportCallbackEXT
+extern PFN_vkDebugReportMessageEXT vulkan_symbol_wrapper_vkDebugReportMessageEXT;
+#define vkDebugReportMessageEXT vulkan_symbol_wrapper_vkDebugReportMessageEXT
+extern PFN_vkDebugMarkerSetObjectTagEXT vulkan_symbol_wrapper_vkDebugMarkerSetObjectTagEXT;
+#define vkDebugMarkerSetObjectTagEXT vulkan_symbol_wrapper_vkDebugMarkerSetObjectTagEXT
+extern PFN_vkDebugMarkerSetObjectNameEXT vulkan_symbol_wrapper_vkDebugMarkerSetObjectNameEXT;
+#define vkDebugMarkerSetObjectNameEXT vulkan_symbol_wrapper_vkDebugMarkerSetObjectNameEXT
+extern PFN_vkCmdDebugMarkerBeginEXT vulkan_symbol_wrapper_vkCmdDebugMarkerBeginEXT;
+#define vkCmdDebugMarkerBeginEXT vulkan_symbol_wrapper_vkCmdDebugMarkerBeginEXT
+extern PFN_vkCmdDebugMarkerEndEXT vulkan_symbol_wrapper_vkCmdDebugMarkerEndEXT;
+#define vkCmdDebugMarkerEndEXT vulkan_symbol_wrapper_vkCmdDebugMarkerEndEXT
+extern PFN_vkCmdDebugMarkerInsertEXT vulkan_symbol_wrapper_vkCmdDebugMarkerInsertEXT;
+#define vkCmdDebugMarkerInsertEXT vulkan_symbol_wrapper_vkCmdDebugMarkerInsertEXT
+
+void vulkan_symbol_wrapper_init(PFN_vkGetInstanceProcAddr get_instance_proc_addr);
+PFN_vkGetInstanceProcAddr vulkan_symbol_wrapper_instance_proc_addr(void);
+VkBool32 vulkan_symbol_wrapper_load_global_symbols(void);
+VkBool32 vulkan_symbol_wrapper_load_core_instance_symbols(VkInstance instance);
+VkBool32 vulkan_symbol_wrapper_load_core_symbols(VkInstance instance);
+VkBool32 vulkan_symbol_wrapper_load_core_device_symbols(VkDevice device);
+VkBool32 vulkan_symbol_wrapper_load_instance_symbol(VkInstance instance, const char *name, PFN_vkVoidFunction *ppSymbol);
+VkBool32 vulkan_symbol_wrapper_load_device_symbol(VkDevice device, const char *name, PFN_vkVoidFunction *ppSymbol);
+
+#define VULKAN_SYMBOL_WRAPPER_LOAD_INSTANCE_SYMBOL(instance, name, pfn) vulkan_symbol_wrapper_load_instance_symbol(instance, name, (PFN_vkVoidFunction*) &(pfn))
+#define VULKAN_SYMBOL_WRAPPER_LOAD_INSTANCE_EXTENSION_SYMBOL(instance, name) vulkan_symbol_wrapper_load_instance_symbol(instance, #name, (PFN_vkVoidFunction*) & name)
+#define VULKAN_SYMBOL_WRAPPER_LOAD_DEVICE_SYMBOL(device, name, pfn) vulkan_symbol_wrapper_load_device_symbol(device, name, (PFN_vkVoidFunction*) &(pfn))
+#define VULKAN_SYMBOL_WRAPPER_LOAD_DEVICE_EXTENSION_SYMBOL(device, name) vulkan_symbol_wrapper_load_device_symbol(device, #name, (PFN_vkVoidFunction*) & name)
+
+
+#ifdef __cplusplus
+}
+#endif
+#endif
+
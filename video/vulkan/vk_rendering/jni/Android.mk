@@ -18,7 +18,8 @@ LOCAL_CFLAGS += -DANDROID_MIPS
 endif
 
 LOCAL_SRC_FILES += ../libretro-test.c \
-						 ../vulkan_symbol_wrapper.c
+						 ../vulkan_symbol_wrapper.c \
+						 ../render_graph.c
 LOCAL_CFLAGS += -O2 -Wall -std=gnu99 -ffast-math -I.. -I../include
 
 include $(BUILD_SHARED_LIBRARY)
@@ -6,6 +6,7 @@
 
 #include "vulkan/vulkan_symbol_wrapper.h"
 #include "libretro_vulkan.h"
+#include "render_graph.h"
 
 static struct retro_hw_render_callback hw_render;
 static const struct retro_hw_render_interface_vulkan *vulkan;
@@ -48,6 +49,10 @@ struct vulkan_data
    VkFramebuffer framebuffers[MAX_SYNC];
    VkCommandPool cmd_pool[MAX_SYNC];
    VkCommandBuffer cmd[MAX_SYNC];
+
+   struct render_graph graph;
+   unsigned output;
+   bool graph_dumped;
 };
 static struct vulkan_data vk;
 
@@ -182,35 +187,8 @@ static void update_ubo(void)
    vkUnmapMemory(vulkan->device, vk.ubo[vk.index].memory);
 }
 
-static void vulkan_test_render(void)
+static void render_triangle(VkCommandBuffer cmd, void *userdata)
 {
-   update_ubo();
-
-   VkCommandBuffer cmd = vk.cmd[vk.index];
-
-   VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
-   begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
-   vkResetCommandBuffer(cmd, 0);
-   vkBeginCommandBuffer(cmd, &begin_info);
-
-   VkImageMemoryBarrier prepare_rendering = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
-   prepare_rendering.srcAccessMask = 0;
-   prepare_rendering.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_COLOR_ATTACHMENT_READ_BIT;
-   prepare_rendering.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-   prepare_rendering.newLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
-   prepare_rendering.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-   prepare_rendering.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-   prepare_rendering.image = vk.images[vk.index].create_info.image;
-   prepare_rendering.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-   prepare_rendering.subresourceRange.levelCount = 1;
-   prepare_rendering.subresourceRange.layerCount = 1;
-   vkCmdPipelineBarrier(cmd,
-         VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
-         false, 
-         0, NULL,
-         0, NULL,
-         1, &prepare_rendering);
-
    VkClearValue clear_value;
    clear_value.color.float32[0] = 0.8f;
    clear_value.color.float32[1] = 0.6f;
@@ -252,27 +230,30 @@ static void vulkan_test_render(void)
    vkCmdDraw(cmd, 3, 1, 0, 0);
 
    vkCmdEndRenderPass(cmd);
+}
+
+static void vulkan_test_render(void)
+{
+   update_ubo();
+
+   VkCommandBuffer cmd = vk.cmd[vk.index];
+
+   VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+   begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+   vkResetCommandBuffer(cmd, 0);
+   vkBeginCommandBuffer(cmd, &begin_info);
 
-   VkImageMemoryBarrier prepare_presentation = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
-   prepare_presentation.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
-   prepare_presentation.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
-   prepare_presentation.oldLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
-   prepare_presentation.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-
-   prepare_presentation.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-   prepare_presentation.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-   prepare_presentation.image = vk.images[vk.index].create_info.image;
-   prepare_presentation.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-   prepare_presentation.subresourceRange.levelCount = 1;
-   prepare_presentation.subresourceRange.layerCount = 1;
-   vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT,
-         VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
-         false,
-         0, NULL,
-         0, NULL,
-         1, &prepare_presentation);
+   rg_set_image(&vk.graph, vk.output, vk.images[vk.index].create_info.image,
+         VK_QUEUE_FAMILY_IGNORED);
+   rg_execute(&vk.graph, cmd);
 
    vkEndCommandBuffer(cmd);
+
+   if (!vk.graph_dumped)
+   {
+      rg_dump(&vk.graph, stderr);
+      vk.graph_dumped = true;
+   }
 }
 
 static struct buffer create_buffer(const void *initial, size_t size, VkBufferUsageFlags usage)
@@ -612,6 +593,20 @@ static void init_command(void)
    }
 }
 
+/* The image handed to the frontend is cleared every frame, and ends up
+ * in the layout set_image() reports for it. */
+static void init_render_graph(void)
+{
+   rg_init(&vk.graph, vulkan->device, vulkan->queue_index);
+   vk.output = rg_import_image(&vk.graph, "output", VK_IMAGE_ASPECT_COLOR_BIT,
+         true, RG_USAGE_SAMPLED_FRAGMENT, VK_QUEUE_FAMILY_IGNORED);
+
+   unsigned pass = rg_add_pass(&vk.graph, "triangle", render_triangle, NULL);
+   rg_pass_use(&vk.graph, pass, vk.output, RG_USAGE_COLOR_ATTACHMENT);
+
+   rg_compile(&vk.graph, &vk.memory_properties);
+}
+
 static void vulkan_test_init(void)
 {
    vkGetPhysicalDeviceProperties(vulkan->gpu, &vk.gpu_properties);
@@ -637,8 +632,73 @@ static void vulkan_test_init(void)
    init_render_pass(VK_FORMAT_R8G8B8A8_UNORM);
    init_pipeline();
    init_swapchain();
+   init_render_graph();
 }
 
+#ifdef BENCHMARK_DISPATCH
+#include <time.h>
+
+#define BENCHMARK_COMMANDS 100000
+#define BENCHMARK_ROUNDS 8
+
+/* Best time per command over a few rounds of recording dynamic state. */
+static double benchmark_record(VkCommandBuffer cmd,
+      PFN_vkCmdSetViewport set_viewport, PFN_vkCmdSetScissor set_scissor)
+{
+   VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+   VkViewport vp = { 0.0f, 0.0f, (float)width, (float)height, 0.0f, 1.0f };
+   VkRect2D scissor = { { 0, 0 }, { width, height } };
+   double best = 0.0;
+
+   begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+   for (unsigned round = 0; round < BENCHMARK_ROUNDS; round++)
+   {
+      struct timespec start, end;
+      double ns;
+
+      vkBeginCommandBuffer(cmd, &begin_info);
+      clock_gettime(CLOCK_MONOTONIC, &start);
+      for (unsigned i = 0; i < BENCHMARK_COMMANDS / 2; i++)
+      {
+         set_viewport(cmd, 0, 1, &vp);
+         set_scissor(cmd, 0, 1, &scissor);
+      }
+      clock_gettime(CLOCK_MONOTONIC, &end);
+      vkEndCommandBuffer(cmd);
+      vkResetCommandBuffer(cmd, 0);
+
+      ns = ((end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec)) / BENCHMARK_COMMANDS;
+      if (round == 0 || ns < best)
+         best = ns;
+   }
+
+   return best;
+}
+
+/* Compares recording through the loader trampolines, which is what
+ * vkGetInstanceProcAddr hands out for device commands, with the pointers
+ * vulkan_symbol_wrapper_load_core_device_symbols() got from
+ * vkGetDeviceProcAddr for the frontend's device. */
+static void benchmark_dispatch(void)
+{
+   PFN_vkGetInstanceProcAddr gipa = vulkan_symbol_wrapper_instance_proc_addr();
+   PFN_vkCmdSetViewport loader_set_viewport =
+      (PFN_vkCmdSetViewport)gipa(vulkan->instance, "vkCmdSetViewport");
+   PFN_vkCmdSetScissor loader_set_scissor =
+      (PFN_vkCmdSetScissor)gipa(vulkan->instance, "vkCmdSetScissor");
+   double loader, device;
+
+   if (!loader_set_viewport || !loader_set_scissor)
+      return;
+
+   loader = benchmark_record(vk.cmd[0], loader_set_viewport, loader_set_scissor);
+   device = benchmark_record(vk.cmd[0], vkCmdSetViewport, vkCmdSetScissor);
+   fprintf(stderr, "[libretro-test]: Recording: %.1f ns/command through the loader, %.1f ns/command device-level.\n",
+         loader, device);
+}
+#endif
+
 static void vulkan_test_deinit(void)
 {
    if (!vulkan)
@@ -647,6 +707,8 @@ static void vulkan_test_deinit(void)
    VkDevice device = vulkan->device;
    vkDeviceWaitIdle(device);
 
+   rg_destroy(&vk.graph);
+
    for (unsigned i = 0; i < vk.num_swapchain_images; i++)
    {
       vkDestroyFramebuffer(device, vk.framebuffers[i], NULL);
@@ -749,8 +811,12 @@ static void context_reset(void)
 
    vulkan_symbol_wrapper_init(vulkan->get_instance_proc_addr);
    vulkan_symbol_wrapper_load_core_instance_symbols(vulkan->instance);
-   vulkan_symbol_wrapper_load_core_device_symbols(vulkan->device);
+   if (!vulkan_symbol_wrapper_load_core_device_symbols(vulkan->device))
+      fprintf(stderr, "Failed to load device-level Vulkan symbols!\n");
    vulkan_test_init();
+#ifdef BENCHMARK_DISPATCH
+   benchmark_dispatch();
+#endif
 }
 
 static void context_destroy(void)
@@ -0,0 +1,632 @@
+#include <string.h>
+#include "render_graph.h"
+
+#define RG_WRITE_ACCESS ( \
+      VK_ACCESS_SHADER_WRITE_BIT | \
+      VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | \
+      VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT | \
+      VK_ACCESS_TRANSFER_WRITE_BIT | \
+      VK_ACCESS_HOST_WRITE_BIT | \
+      VK_ACCESS_MEMORY_WRITE_BIT)
+
+static const struct
+{
+   const char *name;
+   VkPipelineStageFlags stages;
+   VkAccessFlags access;
+   VkImageLayout layout;
+   bool write;
+} rg_usages[RG_USAGE_COUNT] = {
+   { "none", VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, 0,
+      VK_IMAGE_LAYOUT_UNDEFINED, false },
+   { "color attachment", VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+      VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
+      VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, true },
+   { "depth attachment",
+      VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT,
+      VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT,
+      VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL, true },
+   { "sampled", VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT,
+      VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, false },
+   { "sampled (general)", VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT,
+      VK_IMAGE_LAYOUT_GENERAL, false },
+   { "storage read", VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT,
+      VK_IMAGE_LAYOUT_GENERAL, false },
+   { "storage write", VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_WRITE_BIT,
+      VK_IMAGE_LAYOUT_GENERAL, true },
+   { "storage read/write", VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+      VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
+      VK_IMAGE_LAYOUT_GENERAL, true },
+   { "indirect", VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT, VK_ACCESS_INDIRECT_COMMAND_READ_BIT,
+      VK_IMAGE_LAYOUT_UNDEFINED, false },
+   { "vertex", VK_PIPELINE_STAGE_VERTEX_INPUT_BIT, VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT,
+      VK_IMAGE_LAYOUT_UNDEFINED, false },
+   { "transfer read", VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_READ_BIT,
+      VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, false },
+   { "transfer write", VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT,
+      VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, true },
+   { "host read", VK_PIPELINE_STAGE_HOST_BIT, VK_ACCESS_HOST_READ_BIT,
+      VK_IMAGE_LAYOUT_GENERAL, false },
+};
+
+/* One vkCmdPipelineBarrier. Buffers and images which keep their layout
+ * and owner only need the global memory barrier. */
+struct rg_batch
+{
+   VkPipelineStageFlags src_stages;
+   VkPipelineStageFlags dst_stages;
+   VkMemoryBarrier memory;
+   VkImageMemoryBarrier images[RG_MAX_RESOURCES];
+   unsigned num_images;
+   bool pending;
+};
+
+void rg_init(struct render_graph *graph, VkDevice device, uint32_t family)
+{
+   memset(graph, 0, sizeof(*graph));
+   graph->device = device;
+   graph->family = family;
+}
+
+void rg_destroy(struct render_graph *graph)
+{
+   for (unsigned i = 0; i < graph->num_resources; i++)
+   {
+      struct rg_resource *res = &graph->resources[i];
+      if (!res->transient)
+         continue;
+      vkDestroyImageView(graph->device, res->view, NULL);
+      vkDestroyImage(graph->device, res->image, NULL);
+   }
+
+   for (unsigned i = 0; i < graph->num_slots; i++)
+      vkFreeMemory(graph->device, graph->slots[i].memory, NULL);
+
+   memset(graph, 0, sizeof(*graph));
+}
+
+static unsigned rg_add_resource(struct render_graph *graph, const char *name)
+{
+   unsigned index = graph->num_resources++;
+   struct rg_resource *res = &graph->resources[index];
+
+   memset(res, 0, sizeof(*res));
+   res->name = name;
+   res->acquire_family = VK_QUEUE_FAMILY_IGNORED;
+   res->release_family = VK_QUEUE_FAMILY_IGNORED;
+   res->slot = -1;
+   res->alias_prev = -1;
+   res->first_pass = -1;
+   res->last_pass = -1;
+   res->state.layout = VK_IMAGE_LAYOUT_UNDEFINED;
+   return index;
+}
+
+unsigned rg_import_image(struct render_graph *graph, const char *name,
+      VkImageAspectFlags aspect, bool discard,
+      enum rg_usage final_usage, uint32_t release_family)
+{
+   unsigned index = rg_add_resource(graph, name);
+   struct rg_resource *res = &graph->resources[index];
+   res->is_image = true;
+   res->aspect = aspect;
+   res->discard = discard;
+   res->final_usage = final_usage;
+   res->release_family = release_family;
+   return index;
+}
+
+unsigned rg_import_buffer(struct render_graph *graph, const char *name,
+      bool discard, enum rg_usage final_usage)
+{
+   unsigned index = rg_add_resource(graph, name);
+   struct rg_resource *res = &graph->resources[index];
+   res->discard = discard;
+   res->final_usage = final_usage;
+   return index;
+}
+
+unsigned rg_create_image(struct render_graph *graph, const char *name,
+      const VkImageCreateInfo *info, VkImageAspectFlags aspect)
+{
+   unsigned index = rg_add_resource(graph, name);
+   struct rg_resource *res = &graph->resources[index];
+   res->is_image = true;
+   res->transient = true;
+   res->aspect = aspect;
+   res->info = *info;
+   return index;
+}
+
+void rg_set_image(struct render_graph *graph, unsigned resource,
+      VkImage image, uint32_t acquire_family)
+{
+   graph->resources[resource].image = image;
+   graph->resources[resource].acquire_family = acquire_family;
+}
+
+void rg_set_buffer(struct render_graph *graph, unsigned resource, VkBuffer buffer)
+{
+   graph->resources[resource].buffer = buffer;
+}
+
+void rg_swap(struct render_graph *graph, unsigned a, unsigned b)
+{
+   struct rg_resource *ra = &graph->resources[a];
+   struct rg_resource *rb = &graph->resources[b];
+   struct rg_state state = ra->state;
+   VkImage image = ra->image;
+   VkBuffer buffer = ra->buffer;
+
+   ra->state = rb->state;
+   ra->image = rb->image;
+   ra->buffer = rb->buffer;
+   rb->state = state;
+   rb->image = image;
+   rb->buffer = buffer;
+}
+
+unsigned rg_add_pass(struct render_graph *graph, const char *name,
+      rg_execute_t execute, void *userdata)
+{
+   unsigned index = graph->num_passes++;
+   struct rg_pass *pass = &graph->passes[index];
+
+   memset(pass, 0, sizeof(*pass));
+   pass->name = name;
+   pass->enabled = true;
+   pass->execute = execute;
+   pass->userdata = userdata;
+   return index;
+}
+
+void rg_pass_use(struct render_graph *graph, unsigned pass,
+      unsigned resource, enum rg_usage usage)
+{
+   struct rg_pass *p = &graph->passes[pass];
+   struct rg_resource *res = &graph->resources[resource];
+   struct rg_access *access = NULL;
+
+   /* Several uses of one resource in a pass become one access. */
+   for (unsigned i = 0; i < p->num_accesses; i++)
+      if (p->accesses[i].resource == resource)
+         access = &p->accesses[i];
+
+   if (!access)
+   {
+      access = &p->accesses[p->num_accesses++];
+      memset(access, 0, sizeof(*access));
+      access->resource = resource;
+      access->layout = rg_usages[usage].layout;
+   }
+   else if (access->layout != rg_usages[usage].layout)
+      access->layout = VK_IMAGE_LAYOUT_GENERAL;
+
+   access->stages |= rg_usages[usage].stages;
+   access->access |= rg_usages[usage].access;
+   access->write |= rg_usages[usage].write;
+
+   if (res->first_pass < 0)
+      res->first_pass = pass;
+   res->last_pass = pass;
+}
+
+void rg_pass_enable(struct render_graph *graph, unsigned pass, bool enable)
+{
+   graph->passes[pass].enabled = enable;
+}
+
+static uint32_t rg_find_memory_type(const VkPhysicalDeviceMemoryProperties *props,
+      uint32_t type_bits)
+{
+   for (uint32_t i = 0; i < props->memoryTypeCount; i++)
+      if ((type_bits & (1u << i)) &&
+            (props->memoryTypes[i].propertyFlags & VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT))
+         return i;
+
+   for (uint32_t i = 0; i < props->memoryTypeCount; i++)
+      if (type_bits & (1u << i))
+         return i;
+
+   return 0;
+}
+
+bool rg_compile(struct render_graph *graph,
+      const VkPhysicalDeviceMemoryProperties *memory_properties)
+{
+   int slot_first[RG_MAX_RESOURCES];
+   int slot_last[RG_MAX_RESOURCES];
+   bool placed[RG_MAX_RESOURCES] = { false };
+
+   /* Place transients in order of first use. A slot is free once the last
+    * pass of its current occupant has run. */
+   for (;;)
+   {
+      int next = -1;
+      for (unsigned i = 0; i < graph->num_resources; i++)
+      {
+         struct rg_resource *res = &graph->resources[i];
+         if (!res->transient || placed[i] || res->first_pass < 0)
+            continue;
+         if (next < 0 || res->first_pass < graph->resources[next].first_pass)
+            next = i;
+      }
+
+      if (next < 0)
+         break;
+
+      struct rg_resource *res = &graph->resources[next];
+      placed[next] = true;
+
+      if (vkCreateImage(graph->device, &res->info, NULL, &res->image) != VK_SUCCESS)
+         return false;
+
+      VkMemoryRequirements mem_reqs;
+      vkGetImageMemoryRequirements(graph->device, res->image, &mem_reqs);
+
+      int slot = -1;
+      for (unsigned i = 0; i < graph->num_slots; i++)
+      {
+         if (graph->resources[slot_last[i]].last_pass < res->first_pass &&
+               (graph->slots[i].memory_type_bits & mem_reqs.memoryTypeBits))
+         {
+            slot = i;
+            break;
+         }
+      }
+
+      if (slot < 0)
+      {
+         slot = graph->num_slots++;
+         graph->slots[slot].size = 0;
+         graph->slots[slot].memory_type_bits = mem_reqs.memoryTypeBits;
+         slot_first[slot] = next;
+         slot_last[slot] = next;
+      }
+      else
+      {
+         res->alias_prev = slot_last[slot];
+         slot_last[slot] = next;
+      }
+
+      struct rg_slot *s = &graph->slots[slot];
+      if (mem_reqs.size > s->size)
+         s->size = mem_reqs.size;
+      s->memory_type_bits &= mem_reqs.memoryTypeBits;
+      res->slot = slot;
+   }
+
+   /* The first occupant follows the last one of the previous execution. */
+   for (unsigned i = 0; i < graph->num_slots; i++)
+      graph->resources[slot_first[i]].alias_prev = slot_last[i];
+
+   for (unsigned i = 0; i < graph->num_slots; i++)
+   {
+      struct rg_slot *s = &graph->slots[i];
+      VkMemoryAllocateInfo alloc = { VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO };
+      alloc.allocationSize = s->size;
+      alloc.memoryTypeIndex = rg_find_memory_type(memory_properties, s->memory_type_bits);
+      if (vkAllocateMemory(graph->device, &alloc, NULL, &s->memory) != VK_SUCCESS)
+         return false;
+   }
+
+   for (unsigned i = 0; i < graph->num_resources; i++)
+   {
+      struct rg_resource *res = &graph->resources[i];
+      if (!res->transient || res->slot < 0)
+         continue;
+
+      vkBindImageMemory(graph->device, res->image, graph->slots[res->slot].memory, 0);
+
+      VkImageViewCreateInfo view = { VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO };
+      view.image = res->image;
+      view.viewType = VK_IMAGE_VIEW_TYPE_2D;
+      view.format = res->info.format;
+      view.components.r = VK_COMPONENT_SWIZZLE_R;
+      view.components.g = VK_COMPONENT_SWIZZLE_G;
+      view.components.b = VK_COMPONENT_SWIZZLE_B;
+      view.components.a = VK_COMPONENT_SWIZZLE_A;
+      view.subresourceRange.aspectMask = res->aspect;
+      view.subresourceRange.levelCount = res->info.mipLevels;
+      view.subresourceRange.layerCount = res->info.arrayLayers;
+      if (vkCreateImageView(graph->device, &view, NULL, &res->view) != VK_SUCCESS)
+         return false;
+   }
+
+   return true;
+}
+
+VkImageView rg_image_view(const struct render_graph *graph, unsigned resource)
+{
+   return graph->resources[resource].view;
+}
+
+/* Orders an access after whatever the resource saw last, if it has to be. */
+static void rg_transition(struct render_graph *graph, struct rg_batch *batch,
+      int pass, unsigned index,
+      VkPipelineStageFlags stages, VkAccessFlags access,
+      VkImageLayout layout, bool write, uint32_t release_family)
+{
+   struct rg_resource *res = &graph->resources[index];
+   struct rg_state *s = &res->state;
+   uint32_t src_family = VK_QUEUE_FAMILY_IGNORED;
+   uint32_t dst_family = VK_QUEUE_FAMILY_IGNORED;
+
+   if (!res->used)
+   {
+      res->used = true;
+
+      if (res->transient)
+      {
+         /* Wait for whatever used the memory before. */
+         struct rg_state prev = graph->resources[res->alias_prev].state;
+         memset(s, 0, sizeof(*s));
+         s->write_stages = prev.write_stages;
+         s->write_access = prev.write_access;
+         s->read_stages = prev.read_stages;
+         s->layout = VK_IMAGE_LAYOUT_UNDEFINED;
+      }
+      else if (res->discard)
+      {
+         memset(s, 0, sizeof(*s));
+         s->layout = VK_IMAGE_LAYOUT_UNDEFINED;
+      }
+
+      if (res->acquire_family != VK_QUEUE_FAMILY_IGNORED &&
+            res->acquire_family != graph->family)
+      {
+         src_family = res->acquire_family;
+         dst_family = graph->family;
+      }
+   }
+
+   if (release_family != VK_QUEUE_FAMILY_IGNORED && release_family != graph->family)
+   {
+      src_family = graph->family;
+      dst_family = release_family;
+   }
+
+   if (!res->is_image)
+      layout = s->layout;
+
+   bool layout_change = s->layout != layout;
+   bool ownership = src_family != dst_family;
+   bool raw = s->write_stages &&
+      ((access & ~s->visible_access) || (stages & ~s->visible_stages));
+   bool war = write && s->read_stages;
+   bool waw = write && s->write_stages;
+   bool barrier = layout_change || ownership || raw || war || waw;
+
+   if (barrier)
+   {
+      VkPipelineStageFlags src_stages = s->write_stages | s->read_stages;
+      VkAccessFlags src_access = s->write_stages ? s->write_access : 0;
+      if (!src_stages)
+         src_stages = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+
+      batch->src_stages |= src_stages;
+      batch->dst_stages |= stages;
+      batch->pending = true;
+
+      if (res->is_image && (layout_change || ownership))
+      {
+         VkImageMemoryBarrier *b = &batch->images[batch->num_images++];
+         memset(b, 0, sizeof(*b));
+         b->sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+         b->srcAccessMask = src_access;
+         b->dstAccessMask = access;
+         b->oldLayout = s->layout;
+         b->newLayout = layout;
+         b->srcQueueFamilyIndex = src_family;
+         b->dstQueueFamilyIndex = dst_family;
+         b->image = res->image;
+         b->subresourceRange.aspectMask = res->aspect;
+         b->subresourceRange.levelCount = VK_REMAINING_MIP_LEVELS;
+         b->subresourceRange.layerCount = VK_REMAINING_ARRAY_LAYERS;
+      }
+      else
+      {
+         batch->memory.srcAccessMask |= src_access;
+         batch->memory.dstAccessMask |= access;
+      }
+
+      if (graph->num_barriers < RG_MAX_BARRIERS)
+      {
+         struct rg_barrier *b = &graph->barriers[graph->num_barriers++];
+         b->pass = pass;
+         b->resource = index;
+         b->src_stages = src_stages;
+         b->dst_stages = stages;
+         b->src_access = src_access;
+         b->dst_access = access;
+         b->old_layout = s->layout;
+         b->new_layout = layout;
+         b->src_family = src_family;
+         b->dst_family = dst_family;
+      }
+   }
+
+   if (write)
+   {
+      s->write_stages = stages;
+      s->write_access = access & RG_WRITE_ACCESS;
+      s->read_stages = 0;
+      s->visible_stages = 0;
+      s->visible_access = 0;
+   }
+   else if (layout_change)
+   {
+      /* Later reads in other stages have to wait for the transition. */
+      s->write_stages = stages;
+      s->write_access = 0;
+      s->read_stages = stages;
+      s->visible_stages = stages;
+      s->visible_access = access;
+   }
+   else
+   {
+      if (barrier)
+      {
+         s->visible_stages |= stages;
+         s->visible_access |= access;
+      }
+      s->read_stages |= stages;
+   }
+   s->layout = layout;
+}
+
+static void rg_flush(struct render_graph *graph, VkCommandBuffer cmd, struct rg_batch *batch)
+{
+   if (batch->pending)
+   {
+      bool memory = batch->memory.srcAccessMask || batch->memory.dstAccessMask;
+      vkCmdPipelineBarrier(cmd, batch->src_stages, batch->dst_stages,
+            0,
+            memory ? 1 : 0, &batch->memory,
+            0, NULL,
+            batch->num_images, batch->images);
+      graph->num_batches++;
+   }
+
+   memset(batch, 0, sizeof(*batch));
+   batch->memory.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+}
+
+void rg_execute(struct render_graph *graph, VkCommandBuffer cmd)
+{
+   struct rg_batch batch;
+
+   graph->num_barriers = 0;
+   graph->num_batches = 0;
+   for (unsigned i = 0; i < graph->num_resources; i++)
+      graph->resources[i].used = false;
+
+   memset(&batch, 0, sizeof(batch));
+   batch.memory.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+
+   for (unsigned i = 0; i < graph->num_passes; i++)
+   {
+      struct rg_pass *pass = &graph->passes[i];
+      if (!pass->enabled)
+         continue;
+
+      for (unsigned j = 0; j < pass->num_accesses; j++)
+      {
+         const struct rg_access *access = &pass->accesses[j];
+         rg_transition(graph, &batch, i, access->resource,
+               access->stages, access->access, access->layout, access->write,
+               VK_QUEUE_FAMILY_IGNORED);
+      }
+
+      rg_flush(graph, cmd, &batch);
+      pass->execute(cmd, pass->userdata);
+   }
+
+   /* Hand the imported resources over in their final state. */
+   for (unsigned i = 0; i < graph->num_resources; i++)
+   {
+      struct rg_resource *res = &graph->resources[i];
+      if (res->transient || res->final_usage == RG_USAGE_NONE)
+         continue;
+
+      bool release = res->release_family != VK_QUEUE_FAMILY_IGNORED &&
+         res->release_family != graph->family;
+      enum rg_usage usage = res->final_usage;
+
+      /* The destination of a release is left to the acquiring queue. */
+      rg_transition(graph, &batch, -1, i,
+            release ? VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT : rg_usages[usage].stages,
+            release ? 0 : rg_usages[usage].access,
+            rg_usages[usage].layout, false, res->release_family);
+   }
+   rg_flush(graph, cmd, &batch);
+}
+
+static const char *rg_layout_name(VkImageLayout layout)
+{
+   switch (layout)
+   {
+      case VK_IMAGE_LAYOUT_UNDEFINED:
+         return "undefined";
+      case VK_IMAGE_LAYOUT_GENERAL:
+         return "general";
+      case VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL:
+         return "color attachment";
+      case VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL:
+         return "depth attachment";
+      case VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL:
+         return "shader read";
+      case VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL:
+         return "transfer src";
+      case VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL:
+         return "transfer dst";
+      default:
+         return "other";
+   }
+}
+
+void rg_dump(const struct render_graph *graph, FILE *file)
+{
+   fprintf(file, "[render graph]: %u passes, %u resources, %u memory slots, queue family %u.\n",
+         graph->num_passes, graph->num_resources, graph->num_slots, graph->family);
+
+   for (unsigned i = 0; i < graph->num_resources; i++)
+   {
+      const struct rg_resource *res = &graph->resources[i];
+      fprintf(file, "  resource %u \"%s\": ", i, res->name);
+
+      if (res->transient)
+      {
+         fprintf(file, "transient image %ux%u", res->info.extent.width, res->info.extent.height);
+         if (res->slot >= 0)
+            fprintf(file, ", slot %d (%llu KiB) after \"%s\"", res->slot,
+                  (unsigned long long)(graph->slots[res->slot].size >> 10),
+                  graph->resources[res->alias_prev].name);
+         else
+            fprintf(file, ", unused");
+      }
+      else
+      {
+         fprintf(file, "imported %s%s", res->is_image ? "image" : "buffer",
+               res->discard ? ", discarded" : ", persistent");
+         if (res->final_usage != RG_USAGE_NONE)
+            fprintf(file, ", ends as %s", rg_usages[res->final_usage].name);
+         if (res->release_family != VK_QUEUE_FAMILY_IGNORED &&
+               res->release_family != graph->family)
+            fprintf(file, ", released to family %u", res->release_family);
+      }
+      fprintf(file, "\n");
+   }
+
+   for (unsigned i = 0; i < graph->num_passes; i++)
+   {
+      const struct rg_pass *pass = &graph->passes[i];
+      fprintf(file, "  pass %u \"%s\"%s:", i, pass->name, pass->enabled ? "" : " (disabled)");
+      for (unsigned j = 0; j < pass->num_accesses; j++)
+      {
+         const struct rg_access *access = &pass->accesses[j];
+         fprintf(file, " %s \"%s\"", access->write ? "writes" : "reads",
+               graph->resources[access->resource].name);
+      }
+      fprintf(file, "\n");
+   }
+
+   fprintf(file, "  last execution: %u barriers in %u batches.\n",
+         graph->num_barriers, graph->num_batches);
+   for (unsigned i = 0; i < graph->num_barriers; i++)
+   {
+      const struct rg_barrier *b = &graph->barriers[i];
+      fprintf(file, "    %s%s%s \"%s\": stages 0x%x -> 0x%x, access 0x%x -> 0x%x",
+            b->pass < 0 ? "final" : "before \"",
+            b->pass < 0 ? "" : graph->passes[b->pass].name,
+            b->pass < 0 ? "" : "\"",
+            graph->resources[b->resource].name,
+            (unsigned)b->src_stages, (unsigned)b->dst_stages,
+            (unsigned)b->src_access, (unsigned)b->dst_access);
+      if (graph->resources[b->resource].is_image)
+         fprintf(file, ", %s -> %s", rg_layout_name(b->old_layout), rg_layout_name(b->new_layout));
+      if (b->src_family != b->dst_family)
+         fprintf(file, ", family %u -> %u", b->src_family, b->dst_family);
+      fprintf(file, "\n");
+   }
+}